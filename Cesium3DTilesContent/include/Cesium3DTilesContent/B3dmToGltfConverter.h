@@ -8,7 +8,9 @@
 
 #include <gsl/span>
 
+#include <cstddef>
 #include <optional>
+#include <vector>
 
 namespace Cesium3DTilesContent {
 struct AssetFetcher;
@@ -18,5 +20,10 @@ struct B3dmToGltfConverter {
       const gsl::span<const std::byte>& b3dmBinary,
       const CesiumGltfReader::GltfReaderOptions& options,
       const AssetFetcher& assetFetcher);
+
+  static CesiumAsync::Future<GltfConverterResult> convert(
+      std::vector<std::byte>&& b3dmBinary,
+      const CesiumGltfReader::GltfReaderOptions& options,
+      const AssetFetcher& assetFetcher);
 };
 } // namespace Cesium3DTilesContent
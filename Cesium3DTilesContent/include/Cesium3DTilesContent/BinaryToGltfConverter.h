@@ -7,6 +7,7 @@
 #include <gsl/span>
 
 #include <cstddef>
+#include <vector>
 
 namespace Cesium3DTilesContent {
 struct AssetFetcher;
@@ -18,10 +19,21 @@ public:
       const CesiumGltfReader::GltfReaderOptions& options,
       const AssetFetcher& assetFetcher);
 
+  static CesiumAsync::Future<GltfConverterResult> convert(
+      std::vector<std::byte>&& gltfBinary,
+      const CesiumGltfReader::GltfReaderOptions& options,
+      const AssetFetcher& assetFetcher);
+
+  static CesiumAsync::Future<GltfConverterResult> convert(
+      std::vector<std::byte>&& data,
+      size_t byteOffset,
+      size_t byteLength,
+      const CesiumGltfReader::GltfReaderOptions& options,
+      const AssetFetcher& assetFetcher);
+
 private:
   static GltfConverterResult convertImmediate(
-      const gsl::span<const std::byte>& gltfBinary,
-      const CesiumGltfReader::GltfReaderOptions& options,
+      CesiumGltfReader::GltfReaderResult&& loadedGltf,
       const AssetFetcher& assetFetcher);
   static CesiumGltfReader::GltfReader _gltfReader;
 };
@@ -10,9 +10,12 @@
 
 #include <gsl/span>
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace Cesium3DTilesContent {
 
@@ -76,6 +79,15 @@ public:
       const CesiumGltfReader::GltfReaderOptions& options,
       const AssetFetcher& subprocessor);
 
+  /**
+   * @brief A function pointer that can create a {@link GltfConverterResult}
+   * from a tile binary content that it takes ownership of.
+   */
+  using OwningConverterFunction = CesiumAsync::Future<GltfConverterResult> (*)(
+      std::vector<std::byte>&& content,
+      const CesiumGltfReader::GltfReaderOptions& options,
+      const AssetFetcher& subprocessor);
+
   /**
    * @brief Register the given function for the given magic header.
    *
@@ -108,6 +120,24 @@ public:
       const std::string& fileExtension,
       ConverterFunction converter);
 
+  /**
+   * @brief Register a function that does the same as the given converter, but
+   * takes ownership of the tile binary content.
+   *
+   * It is used by {@link GltfConverters::convert} in place of the converter
+   * when the content can be taken from the completed request, so that the
+   * converter can keep parts of the content, such as the binary chunk of a
+   * GLB, without copying them.
+   *
+   * @param converter The converter that is registered for a magic header or
+   * file extension.
+   * @param owningConverter The converter to use instead when the content can
+   * be taken.
+   */
+  static void registerOwningConverter(
+      ConverterFunction converter,
+      OwningConverterFunction owningConverter);
+
   /**
    * @brief Retrieve the converter function that is already registered for the
    * given file extension. If no such function is found, nullptr will be
@@ -195,6 +225,32 @@ public:
       const CesiumGltfReader::GltfReaderOptions& options,
       const AssetFetcher& assetFetcher);
 
+  /**
+   * @brief Creates the {@link GltfConverterResult} from the response of a
+   * completed request with the given converter.
+   *
+   * If an owning converter is registered for the converter with
+   * {@link GltfConverters::registerOwningConverter}, and the request can give
+   * up its response data with
+   * {@link CesiumAsync::IAssetRequest::releaseResponseData}, the data is
+   * moved to the owning converter instead, and the response is left empty.
+   *
+   * @param converter The converter, usually found with
+   * {@link GltfConverters::getConverterByMagic} or
+   * {@link GltfConverters::getConverterByFileExtension}.
+   * @param completedRequest The completed request whose response data to
+   * convert.
+   * @param options The {@link CesiumGltfReader::GltfReaderOptions} for how to
+   * read a glTF.
+   * @param assetFetcher An object that can perform recursive asset requests.
+   * @return The {@link GltfConverterResult} that stores the gltf model converted from the binary data.
+   */
+  static CesiumAsync::Future<GltfConverterResult> convert(
+      ConverterFunction converter,
+      CesiumAsync::IAssetRequest& completedRequest,
+      const CesiumGltfReader::GltfReaderOptions& options,
+      const AssetFetcher& assetFetcher);
+
 private:
   static std::string toLowerCase(const std::string_view& str);
 
@@ -211,5 +267,7 @@ private:
   static std::unordered_map<std::string, ConverterFunction> _loadersByMagic;
   static std::unordered_map<std::string, ConverterFunction>
       _loadersByFileExtension;
+  static std::unordered_map<ConverterFunction, OwningConverterFunction>
+      _owningConverters;
 };
 } // namespace Cesium3DTilesContent
@@ -112,24 +112,31 @@ void parseB3dmHeader(
   }
 }
 
+uint32_t getGlbStart(const B3dmHeader& header, uint32_t headerLength) {
+  return headerLength + header.featureTableJsonByteLength +
+         header.featureTableBinaryByteLength + header.batchTableJsonByteLength +
+         header.batchTableBinaryByteLength;
+}
+
+CesiumAsync::Future<GltfConverterResult>
+createGlbAfterEndResult(const AssetFetcher& assetFetcher) {
+  GltfConverterResult result;
+  result.errors.emplaceError("The B3DM is invalid because the start of the "
+                             "glTF model is after the end of the entire B3DM.");
+  return assetFetcher.asyncSystem.createResolvedFuture(std::move(result));
+}
+
 CesiumAsync::Future<GltfConverterResult> convertB3dmContentToGltf(
     const gsl::span<const std::byte>& b3dmBinary,
     const B3dmHeader& header,
     uint32_t headerLength,
     const CesiumGltfReader::GltfReaderOptions& options,
     const AssetFetcher& assetFetcher) {
-  const uint32_t glbStart = headerLength + header.featureTableJsonByteLength +
-                            header.featureTableBinaryByteLength +
-                            header.batchTableJsonByteLength +
-                            header.batchTableBinaryByteLength;
+  const uint32_t glbStart = getGlbStart(header, headerLength);
   const uint32_t glbEnd = header.byteLength;
 
   if (glbEnd <= glbStart) {
-    GltfConverterResult result;
-    result.errors.emplaceError(
-        "The B3DM is invalid because the start of the "
-        "glTF model is after the end of the entire B3DM.");
-    return assetFetcher.asyncSystem.createResolvedFuture(std::move(result));
+    return createGlbAfterEndResult(assetFetcher);
   }
 
   const gsl::span<const std::byte> glbData =
@@ -257,4 +264,49 @@ CesiumAsync::Future<GltfConverterResult> B3dmToGltfConverter::convert(
             return std::move(glbResult);
           });
 }
+
+CesiumAsync::Future<GltfConverterResult> B3dmToGltfConverter::convert(
+    std::vector<std::byte>&& b3dmBinary,
+    const CesiumGltfReader::GltfReaderOptions& options,
+    const AssetFetcher& assetFetcher) {
+  GltfConverterResult result;
+  B3dmHeader header;
+  uint32_t headerLength = 0;
+  parseB3dmHeader(b3dmBinary, header, headerLength, result);
+  if (result.errors) {
+    return assetFetcher.asyncSystem.createResolvedFuture(std::move(result));
+  }
+
+  const uint32_t glbStart = getGlbStart(header, headerLength);
+  const uint32_t glbEnd = header.byteLength;
+
+  if (glbEnd <= glbStart) {
+    return createGlbAfterEndResult(assetFetcher);
+  }
+
+  // Reading the GLB may overwrite everything before its binary chunk in the
+  // B3DM, so copy the header, feature table, and batch table out first. They
+  // are usually much smaller than the GLB.
+  std::vector<std::byte> tables(
+      b3dmBinary.begin(),
+      b3dmBinary.begin() + glbStart);
+
+  return BinaryToGltfConverter::convert(
+             std::move(b3dmBinary),
+             glbStart,
+             glbEnd - glbStart,
+             options,
+             assetFetcher)
+      .thenImmediately([tables = std::move(tables), header, headerLength](
+                           GltfConverterResult&& glbResult) {
+        if (!glbResult.errors) {
+          convertB3dmMetadataToGltfStructuralMetadata(
+              tables,
+              header,
+              headerLength,
+              glbResult);
+        }
+        return std::move(glbResult);
+      });
+}
 } // namespace Cesium3DTilesContent
@@ -5,12 +5,8 @@ namespace Cesium3DTilesContent {
 CesiumGltfReader::GltfReader BinaryToGltfConverter::_gltfReader;
 
 GltfConverterResult BinaryToGltfConverter::convertImmediate(
-    const gsl::span<const std::byte>& gltfBinary,
-    const CesiumGltfReader::GltfReaderOptions& options,
+    CesiumGltfReader::GltfReaderResult&& loadedGltf,
     const AssetFetcher& assetFetcher) {
-  CesiumGltfReader::GltfReaderResult loadedGltf =
-      _gltfReader.readGltf(gltfBinary, options);
-
   if (loadedGltf.model) {
     loadedGltf.model->extras["gltfUpAxis"] =
         static_cast<std::underlying_type_t<CesiumGeometry::Axis>>(
@@ -27,7 +23,28 @@ CesiumAsync::Future<GltfConverterResult> BinaryToGltfConverter::convert(
     const gsl::span<const std::byte>& gltfBinary,
     const CesiumGltfReader::GltfReaderOptions& options,
     const AssetFetcher& assetFetcher) {
-  return assetFetcher.asyncSystem.createResolvedFuture(
-      convertImmediate(gltfBinary, options, assetFetcher));
+  return assetFetcher.asyncSystem.createResolvedFuture(convertImmediate(
+      _gltfReader.readGltf(gltfBinary, options),
+      assetFetcher));
+}
+
+CesiumAsync::Future<GltfConverterResult> BinaryToGltfConverter::convert(
+    std::vector<std::byte>&& gltfBinary,
+    const CesiumGltfReader::GltfReaderOptions& options,
+    const AssetFetcher& assetFetcher) {
+  return assetFetcher.asyncSystem.createResolvedFuture(convertImmediate(
+      _gltfReader.readGltf(std::move(gltfBinary), options),
+      assetFetcher));
+}
+
+CesiumAsync::Future<GltfConverterResult> BinaryToGltfConverter::convert(
+    std::vector<std::byte>&& data,
+    size_t byteOffset,
+    size_t byteLength,
+    const CesiumGltfReader::GltfReaderOptions& options,
+    const AssetFetcher& assetFetcher) {
+  return assetFetcher.asyncSystem.createResolvedFuture(convertImmediate(
+      _gltfReader.readGltf(std::move(data), byteOffset, byteLength, options),
+      assetFetcher));
 }
 } // namespace Cesium3DTilesContent
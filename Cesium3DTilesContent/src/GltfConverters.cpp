@@ -13,6 +13,11 @@ std::unordered_map<std::string, GltfConverters::ConverterFunction>
 std::unordered_map<std::string, GltfConverters::ConverterFunction>
     GltfConverters::_loadersByFileExtension;
 
+std::unordered_map<
+    GltfConverters::ConverterFunction,
+    GltfConverters::OwningConverterFunction>
+    GltfConverters::_owningConverters;
+
 void GltfConverters::registerMagic(
     const std::string& magic,
     ConverterFunction converter) {
@@ -27,6 +32,12 @@ void GltfConverters::registerFileExtension(
   _loadersByFileExtension[lowerCaseFileExtension] = converter;
 }
 
+void GltfConverters::registerOwningConverter(
+    ConverterFunction converter,
+    OwningConverterFunction owningConverter) {
+  _owningConverters[converter] = owningConverter;
+}
+
 GltfConverters::ConverterFunction
 GltfConverters::getConverterByFileExtension(const std::string& filePath) {
   std::string extension;
@@ -86,6 +97,30 @@ CesiumAsync::Future<GltfConverterResult> GltfConverters::convert(
       GltfConverterResult{std::nullopt, std::move(errors)});
 }
 
+CesiumAsync::Future<GltfConverterResult> GltfConverters::convert(
+    ConverterFunction converter,
+    CesiumAsync::IAssetRequest& completedRequest,
+    const CesiumGltfReader::GltfReaderOptions& options,
+    const AssetFetcher& assetFetcher) {
+  auto owningConverterIt = _owningConverters.find(converter);
+  if (owningConverterIt != _owningConverters.end()) {
+    std::optional<std::vector<std::byte>> maybeContent =
+        completedRequest.releaseResponseData();
+    if (maybeContent) {
+      return owningConverterIt->second(
+          std::move(*maybeContent),
+          options,
+          assetFetcher);
+    }
+  }
+
+  const CesiumAsync::IAssetResponse* pResponse = completedRequest.response();
+  return converter(
+      pResponse ? pResponse->data() : gsl::span<const std::byte>(),
+      options,
+      assetFetcher);
+}
+
 std::string GltfConverters::toLowerCase(const std::string_view& str) {
   std::string result;
   std::transform(
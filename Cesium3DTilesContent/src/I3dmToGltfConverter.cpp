@@ -488,7 +488,7 @@ CesiumAsync::Future<ConvertedI3dm> convertI3dmContent(
                   std::move(errorResult));
             }
             return BinaryToGltfConverter::convert(
-                assetFetcherResult.bytes,
+                std::move(assetFetcherResult.bytes),
                 options,
                 assetFetcher);
           });
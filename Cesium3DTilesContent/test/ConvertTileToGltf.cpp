@@ -1,12 +1,16 @@
 #include "ConvertTileToGltf.h"
 
 #include <Cesium3DTilesContent/B3dmToGltfConverter.h>
+#include <Cesium3DTilesContent/GltfConverters.h>
 #include <Cesium3DTilesContent/I3dmToGltfConverter.h>
 #include <Cesium3DTilesContent/PntsToGltfConverter.h>
+#include <CesiumAsync/IAssetResponse.h>
 #include <CesiumNativeTests/FileAccessor.h>
 #include <CesiumNativeTests/SimpleTaskProcessor.h>
 #include <CesiumNativeTests/readFile.h>
 
+#include <catch2/catch.hpp>
+
 namespace Cesium3DTilesContent {
 
 CesiumAsync::AsyncSystem ConvertTileToGltf::asyncSystem(
@@ -33,6 +37,30 @@ GltfConverterResult ConvertTileToGltf::fromB3dm(
   return future.wait();
 }
 
+GltfConverterResult ConvertTileToGltf::fromB3dm(
+    std::vector<std::byte>&& b3dm,
+    const CesiumGltfReader::GltfReaderOptions& options) {
+  AssetFetcher assetFetcher = makeAssetFetcher("");
+  auto future =
+      B3dmToGltfConverter::convert(std::move(b3dm), options, assetFetcher);
+  return future.wait();
+}
+
+GltfConverterResult ConvertTileToGltf::fromRequest(
+    CesiumAsync::IAssetRequest& completedRequest,
+    const CesiumGltfReader::GltfReaderOptions& options) {
+  AssetFetcher assetFetcher = makeAssetFetcher("");
+  GltfConverters::ConverterFunction converter =
+      GltfConverters::getConverterByMagic(completedRequest.response()->data());
+  REQUIRE(converter);
+  auto future = GltfConverters::convert(
+      converter,
+      completedRequest,
+      options,
+      assetFetcher);
+  return future.wait();
+}
+
 GltfConverterResult ConvertTileToGltf::fromPnts(
     const std::filesystem::path& filePath,
     const CesiumGltfReader::GltfReaderOptions& options) {
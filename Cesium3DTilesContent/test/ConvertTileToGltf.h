@@ -2,10 +2,13 @@
 
 #include <Cesium3DTilesContent/GltfConverters.h>
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetRequest.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumNativeTests/readFile.h>
 
+#include <cstddef>
 #include <filesystem>
+#include <vector>
 
 namespace Cesium3DTilesContent {
 
@@ -14,12 +17,18 @@ public:
   static GltfConverterResult fromB3dm(
       const std::filesystem::path& filePath,
       const CesiumGltfReader::GltfReaderOptions& options = {});
+  static GltfConverterResult fromB3dm(
+      std::vector<std::byte>&& b3dm,
+      const CesiumGltfReader::GltfReaderOptions& options = {});
   static GltfConverterResult fromPnts(
       const std::filesystem::path& filePath,
       const CesiumGltfReader::GltfReaderOptions& options = {});
   static GltfConverterResult fromI3dm(
       const std::filesystem::path& filePath,
       const CesiumGltfReader::GltfReaderOptions& options = {});
+  static GltfConverterResult fromRequest(
+      CesiumAsync::IAssetRequest& completedRequest,
+      const CesiumGltfReader::GltfReaderOptions& options = {});
 
 private:
   static CesiumAsync::AsyncSystem asyncSystem;
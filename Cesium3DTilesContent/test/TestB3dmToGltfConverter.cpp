@@ -1,11 +1,60 @@
 #include "ConvertTileToGltf.h"
 
+#include <Cesium3DTilesContent/registerAllTileContentTypes.h>
 #include <CesiumGltf/ExtensionCesiumRTC.h>
+#include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
+#include <CesiumNativeTests/SimpleAssetRequest.h>
+#include <CesiumNativeTests/SimpleAssetResponse.h>
+#include <CesiumNativeTests/readFile.h>
 
 #include <catch2/catch.hpp>
 
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
 using namespace Cesium3DTilesContent;
 using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+
+namespace {
+
+// A request that gives up the data of its response, like the requests of a
+// CachingAssetAccessor or GunzipAssetAccessor.
+class ReleasingAssetRequest : public SimpleAssetRequest {
+public:
+  using SimpleAssetRequest::SimpleAssetRequest;
+
+  virtual std::optional<std::vector<std::byte>>
+  releaseResponseData() override {
+    return std::exchange(this->pResponse->mockData, {});
+  }
+};
+
+void checkSameModel(const Model& expected, const Model& actual) {
+  REQUIRE(actual.buffers.size() == expected.buffers.size());
+  for (size_t i = 0; i < expected.buffers.size(); ++i) {
+    CHECK(actual.buffers[i].cesium.data == expected.buffers[i].cesium.data);
+  }
+  CHECK(actual.meshes.size() == expected.meshes.size());
+  CHECK(actual.accessors.size() == expected.accessors.size());
+  CHECK(
+      (actual.getExtension<ExtensionCesiumRTC>() != nullptr) ==
+      (expected.getExtension<ExtensionCesiumRTC>() != nullptr));
+
+  const ExtensionModelExtStructuralMetadata* pExpectedMetadata =
+      expected.getExtension<ExtensionModelExtStructuralMetadata>();
+  const ExtensionModelExtStructuralMetadata* pActualMetadata =
+      actual.getExtension<ExtensionModelExtStructuralMetadata>();
+  REQUIRE(pExpectedMetadata);
+  REQUIRE(pActualMetadata);
+  CHECK(
+      pActualMetadata->propertyTables.size() ==
+      pExpectedMetadata->propertyTables.size());
+}
+
+} // namespace
 
 TEST_CASE("B3dmToGltfConverter") {
   SECTION("includes CESIUM_RTC extension in extensionsUsed") {
@@ -68,3 +117,43 @@ TEST_CASE("B3dmToGltfConverter") {
     }
   }
 }
+
+TEST_CASE("B3dmToGltfConverter reads a B3DM that it owns") {
+  std::filesystem::path testFilePath = Cesium3DTilesSelection_TEST_DATA_DIR;
+  testFilePath =
+      testFilePath / "BatchTables" / "batchedWithBatchTableBinary.b3dm";
+
+  const GltfConverterResult expected =
+      ConvertTileToGltf::fromB3dm(testFilePath);
+  REQUIRE(expected.model);
+
+  SECTION("directly") {
+    const GltfConverterResult result =
+        ConvertTileToGltf::fromB3dm(readFile(testFilePath));
+    REQUIRE(result.model);
+    CHECK(!result.errors.hasErrors());
+    checkSameModel(*expected.model, *result.model);
+  }
+
+  SECTION("from a request that gives up its data") {
+    registerAllTileContentTypes();
+
+    ReleasingAssetRequest request(
+        "GET",
+        "batchedWithBatchTableBinary.b3dm",
+        CesiumAsync::HttpHeaders{},
+        std::make_unique<SimpleAssetResponse>(
+            static_cast<uint16_t>(200),
+            "application/octet-stream",
+            CesiumAsync::HttpHeaders{},
+            readFile(testFilePath)));
+
+    const GltfConverterResult result = ConvertTileToGltf::fromRequest(request);
+    REQUIRE(result.model);
+    CHECK(!result.errors.hasErrors());
+    checkSameModel(*expected.model, *result.model);
+
+    // The converter took the data instead of copying it.
+    CHECK(request.response()->data().empty());
+  }
+}
@@ -57,14 +57,30 @@ CesiumJsonReader::IJsonHandler* Extension3dTilesBoundingVolumeS2JsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         Cesium3DTiles::Extension3dTilesBoundingVolumeS2& o) {
-  using namespace std::string_literals;
-
-  if ("token"s == str)
-    return property("token", this->_token, o.token);
-  if ("minimumHeight"s == str)
-    return property("minimumHeight", this->_minimumHeight, o.minimumHeight);
-  if ("maximumHeight"s == str)
-    return property("maximumHeight", this->_maximumHeight, o.maximumHeight);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    if (str == "token"sv)
+      return property("token", this->_token, o.token);
+    break;
+  case 13:
+    switch (str[1]) {
+    case 'i':
+      if (str == "minimumHeight"sv)
+        return property("minimumHeight", this->_minimumHeight, o.minimumHeight);
+      break;
+    case 'a':
+      if (str == "maximumHeight"sv)
+        return property("maximumHeight", this->_maximumHeight, o.maximumHeight);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -152,10 +168,16 @@ CesiumJsonReader::IJsonHandler* StatisticsJsonHandler::readObjectKeyStatistics(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Statistics& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("classes"s == str)
-    return property("classes", this->_classes, o.classes);
+  switch (str.size()) {
+  case 7:
+    if (str == "classes"sv)
+      return property("classes", this->_classes, o.classes);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -236,12 +258,20 @@ ClassStatisticsJsonHandler::readObjectKeyClassStatistics(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::ClassStatistics& o) {
-  using namespace std::string_literals;
-
-  if ("count"s == str)
-    return property("count", this->_count, o.count);
-  if ("properties"s == str)
-    return property("properties", this->_properties, o.properties);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    if (str == "count"sv)
+      return property("count", this->_count, o.count);
+    break;
+  case 10:
+    if (str == "properties"sv)
+      return property("properties", this->_properties, o.properties);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -330,27 +360,53 @@ PropertyStatisticsJsonHandler::readObjectKeyPropertyStatistics(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::PropertyStatistics& o) {
-  using namespace std::string_literals;
-
-  if ("min"s == str)
-    return property("min", this->_min, o.min);
-  if ("max"s == str)
-    return property("max", this->_max, o.max);
-  if ("mean"s == str)
-    return property("mean", this->_mean, o.mean);
-  if ("median"s == str)
-    return property("median", this->_median, o.median);
-  if ("standardDeviation"s == str)
-    return property(
-        "standardDeviation",
-        this->_standardDeviation,
-        o.standardDeviation);
-  if ("variance"s == str)
-    return property("variance", this->_variance, o.variance);
-  if ("sum"s == str)
-    return property("sum", this->_sum, o.sum);
-  if ("occurrences"s == str)
-    return property("occurrences", this->_occurrences, o.occurrences);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    switch (str[1]) {
+    case 'i':
+      if (str == "min"sv)
+        return property("min", this->_min, o.min);
+      break;
+    case 'a':
+      if (str == "max"sv)
+        return property("max", this->_max, o.max);
+      break;
+    case 'u':
+      if (str == "sum"sv)
+        return property("sum", this->_sum, o.sum);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 4:
+    if (str == "mean"sv)
+      return property("mean", this->_mean, o.mean);
+    break;
+  case 6:
+    if (str == "median"sv)
+      return property("median", this->_median, o.median);
+    break;
+  case 8:
+    if (str == "variance"sv)
+      return property("variance", this->_variance, o.variance);
+    break;
+  case 11:
+    if (str == "occurrences"sv)
+      return property("occurrences", this->_occurrences, o.occurrences);
+    break;
+  case 17:
+    if (str == "standardDeviation"sv)
+      return property(
+          "standardDeviation",
+          this->_standardDeviation,
+          o.standardDeviation);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -437,20 +493,42 @@ CesiumJsonReader::IJsonHandler* SchemaJsonHandler::readObjectKeySchema(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Schema& o) {
-  using namespace std::string_literals;
-
-  if ("id"s == str)
-    return property("id", this->_id, o.id);
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("version"s == str)
-    return property("version", this->_version, o.version);
-  if ("classes"s == str)
-    return property("classes", this->_classes, o.classes);
-  if ("enums"s == str)
-    return property("enums", this->_enums, o.enums);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 2:
+    if (str == "id"sv)
+      return property("id", this->_id, o.id);
+    break;
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 5:
+    if (str == "enums"sv)
+      return property("enums", this->_enums, o.enums);
+    break;
+  case 7:
+    switch (str[0]) {
+    case 'v':
+      if (str == "version"sv)
+        return property("version", this->_version, o.version);
+      break;
+    case 'c':
+      if (str == "classes"sv)
+        return property("classes", this->_classes, o.classes);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -528,16 +606,28 @@ CesiumJsonReader::IJsonHandler* EnumJsonHandler::readObjectKeyEnum(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Enum& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("valueType"s == str)
-    return property("valueType", this->_valueType, o.valueType);
-  if ("values"s == str)
-    return property("values", this->_values, o.values);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 6:
+    if (str == "values"sv)
+      return property("values", this->_values, o.values);
+    break;
+  case 9:
+    if (str == "valueType"sv)
+      return property("valueType", this->_valueType, o.valueType);
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -614,14 +704,24 @@ CesiumJsonReader::IJsonHandler* EnumValueJsonHandler::readObjectKeyEnumValue(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::EnumValue& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("value"s == str)
-    return property("value", this->_value, o.value);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 5:
+    if (str == "value"sv)
+      return property("value", this->_value, o.value);
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -699,14 +799,24 @@ CesiumJsonReader::IJsonHandler* ClassJsonHandler::readObjectKeyClass(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Class& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("properties"s == str)
-    return property("properties", this->_properties, o.properties);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 10:
+    if (str == "properties"sv)
+      return property("properties", this->_properties, o.properties);
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -797,40 +907,106 @@ ClassPropertyJsonHandler::readObjectKeyClassProperty(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::ClassProperty& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("type"s == str)
-    return property("type", this->_type, o.type);
-  if ("componentType"s == str)
-    return property("componentType", this->_componentType, o.componentType);
-  if ("enumType"s == str)
-    return property("enumType", this->_enumType, o.enumType);
-  if ("array"s == str)
-    return property("array", this->_array, o.array);
-  if ("count"s == str)
-    return property("count", this->_count, o.count);
-  if ("normalized"s == str)
-    return property("normalized", this->_normalized, o.normalized);
-  if ("offset"s == str)
-    return property("offset", this->_offset, o.offset);
-  if ("scale"s == str)
-    return property("scale", this->_scale, o.scale);
-  if ("max"s == str)
-    return property("max", this->_max, o.max);
-  if ("min"s == str)
-    return property("min", this->_min, o.min);
-  if ("required"s == str)
-    return property("required", this->_required, o.required);
-  if ("noData"s == str)
-    return property("noData", this->_noData, o.noData);
-  if ("default"s == str)
-    return property("default", this->_defaultProperty, o.defaultProperty);
-  if ("semantic"s == str)
-    return property("semantic", this->_semantic, o.semantic);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    switch (str[1]) {
+    case 'a':
+      if (str == "max"sv)
+        return property("max", this->_max, o.max);
+      break;
+    case 'i':
+      if (str == "min"sv)
+        return property("min", this->_min, o.min);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 4:
+    switch (str[0]) {
+    case 'n':
+      if (str == "name"sv)
+        return property("name", this->_name, o.name);
+      break;
+    case 't':
+      if (str == "type"sv)
+        return property("type", this->_type, o.type);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 5:
+    switch (str[0]) {
+    case 'a':
+      if (str == "array"sv)
+        return property("array", this->_array, o.array);
+      break;
+    case 'c':
+      if (str == "count"sv)
+        return property("count", this->_count, o.count);
+      break;
+    case 's':
+      if (str == "scale"sv)
+        return property("scale", this->_scale, o.scale);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 6:
+    switch (str[0]) {
+    case 'o':
+      if (str == "offset"sv)
+        return property("offset", this->_offset, o.offset);
+      break;
+    case 'n':
+      if (str == "noData"sv)
+        return property("noData", this->_noData, o.noData);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 7:
+    if (str == "default"sv)
+      return property("default", this->_defaultProperty, o.defaultProperty);
+    break;
+  case 8:
+    switch (str[0]) {
+    case 'e':
+      if (str == "enumType"sv)
+        return property("enumType", this->_enumType, o.enumType);
+      break;
+    case 'r':
+      if (str == "required"sv)
+        return property("required", this->_required, o.required);
+      break;
+    case 's':
+      if (str == "semantic"sv)
+        return property("semantic", this->_semantic, o.semantic);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 10:
+    if (str == "normalized"sv)
+      return property("normalized", this->_normalized, o.normalized);
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  case 13:
+    if (str == "componentType"sv)
+      return property("componentType", this->_componentType, o.componentType);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -918,41 +1094,72 @@ CesiumJsonReader::IJsonHandler* SubtreeJsonHandler::readObjectKeySubtree(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Subtree& o) {
-  using namespace std::string_literals;
-
-  if ("buffers"s == str)
-    return property("buffers", this->_buffers, o.buffers);
-  if ("bufferViews"s == str)
-    return property("bufferViews", this->_bufferViews, o.bufferViews);
-  if ("propertyTables"s == str)
-    return property("propertyTables", this->_propertyTables, o.propertyTables);
-  if ("tileAvailability"s == str)
-    return property(
-        "tileAvailability",
-        this->_tileAvailability,
-        o.tileAvailability);
-  if ("contentAvailability"s == str)
-    return property(
-        "contentAvailability",
-        this->_contentAvailability,
-        o.contentAvailability);
-  if ("childSubtreeAvailability"s == str)
-    return property(
-        "childSubtreeAvailability",
-        this->_childSubtreeAvailability,
-        o.childSubtreeAvailability);
-  if ("tileMetadata"s == str)
-    return property("tileMetadata", this->_tileMetadata, o.tileMetadata);
-  if ("contentMetadata"s == str)
-    return property(
-        "contentMetadata",
-        this->_contentMetadata,
-        o.contentMetadata);
-  if ("subtreeMetadata"s == str)
-    return property(
-        "subtreeMetadata",
-        this->_subtreeMetadata,
-        o.subtreeMetadata);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 7:
+    if (str == "buffers"sv)
+      return property("buffers", this->_buffers, o.buffers);
+    break;
+  case 11:
+    if (str == "bufferViews"sv)
+      return property("bufferViews", this->_bufferViews, o.bufferViews);
+    break;
+  case 12:
+    if (str == "tileMetadata"sv)
+      return property("tileMetadata", this->_tileMetadata, o.tileMetadata);
+    break;
+  case 14:
+    if (str == "propertyTables"sv)
+      return property(
+          "propertyTables",
+          this->_propertyTables,
+          o.propertyTables);
+    break;
+  case 15:
+    switch (str[0]) {
+    case 'c':
+      if (str == "contentMetadata"sv)
+        return property(
+            "contentMetadata",
+            this->_contentMetadata,
+            o.contentMetadata);
+      break;
+    case 's':
+      if (str == "subtreeMetadata"sv)
+        return property(
+            "subtreeMetadata",
+            this->_subtreeMetadata,
+            o.subtreeMetadata);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 16:
+    if (str == "tileAvailability"sv)
+      return property(
+          "tileAvailability",
+          this->_tileAvailability,
+          o.tileAvailability);
+    break;
+  case 19:
+    if (str == "contentAvailability"sv)
+      return property(
+          "contentAvailability",
+          this->_contentAvailability,
+          o.contentAvailability);
+    break;
+  case 24:
+    if (str == "childSubtreeAvailability"sv)
+      return property(
+          "childSubtreeAvailability",
+          this->_childSubtreeAvailability,
+          o.childSubtreeAvailability);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1029,12 +1236,20 @@ MetadataEntityJsonHandler::readObjectKeyMetadataEntity(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::MetadataEntity& o) {
-  using namespace std::string_literals;
-
-  if ("class"s == str)
-    return property("class", this->_classProperty, o.classProperty);
-  if ("properties"s == str)
-    return property("properties", this->_properties, o.properties);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    if (str == "class"sv)
+      return property("class", this->_classProperty, o.classProperty);
+    break;
+  case 10:
+    if (str == "properties"sv)
+      return property("properties", this->_properties, o.properties);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1117,14 +1332,27 @@ AvailabilityJsonHandler::readObjectKeyAvailability(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Availability& o) {
-  using namespace std::string_literals;
-
-  if ("bitstream"s == str)
-    return property("bitstream", this->_bitstream, o.bitstream);
-  if ("availableCount"s == str)
-    return property("availableCount", this->_availableCount, o.availableCount);
-  if ("constant"s == str)
-    return property("constant", this->_constant, o.constant);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 8:
+    if (str == "constant"sv)
+      return property("constant", this->_constant, o.constant);
+    break;
+  case 9:
+    if (str == "bitstream"sv)
+      return property("bitstream", this->_bitstream, o.bitstream);
+    break;
+  case 14:
+    if (str == "availableCount"sv)
+      return property(
+          "availableCount",
+          this->_availableCount,
+          o.availableCount);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1207,16 +1435,34 @@ PropertyTableJsonHandler::readObjectKeyPropertyTable(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::PropertyTable& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("class"s == str)
-    return property("class", this->_classProperty, o.classProperty);
-  if ("count"s == str)
-    return property("count", this->_count, o.count);
-  if ("properties"s == str)
-    return property("properties", this->_properties, o.properties);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 5:
+    switch (str[1]) {
+    case 'l':
+      if (str == "class"sv)
+        return property("class", this->_classProperty, o.classProperty);
+      break;
+    case 'o':
+      if (str == "count"sv)
+        return property("count", this->_count, o.count);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 10:
+    if (str == "properties"sv)
+      return property("properties", this->_properties, o.properties);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1305,32 +1551,66 @@ PropertyTablePropertyJsonHandler::readObjectKeyPropertyTableProperty(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::PropertyTableProperty& o) {
-  using namespace std::string_literals;
-
-  if ("values"s == str)
-    return property("values", this->_values, o.values);
-  if ("arrayOffsets"s == str)
-    return property("arrayOffsets", this->_arrayOffsets, o.arrayOffsets);
-  if ("stringOffsets"s == str)
-    return property("stringOffsets", this->_stringOffsets, o.stringOffsets);
-  if ("arrayOffsetType"s == str)
-    return property(
-        "arrayOffsetType",
-        this->_arrayOffsetType,
-        o.arrayOffsetType);
-  if ("stringOffsetType"s == str)
-    return property(
-        "stringOffsetType",
-        this->_stringOffsetType,
-        o.stringOffsetType);
-  if ("offset"s == str)
-    return property("offset", this->_offset, o.offset);
-  if ("scale"s == str)
-    return property("scale", this->_scale, o.scale);
-  if ("max"s == str)
-    return property("max", this->_max, o.max);
-  if ("min"s == str)
-    return property("min", this->_min, o.min);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    switch (str[1]) {
+    case 'a':
+      if (str == "max"sv)
+        return property("max", this->_max, o.max);
+      break;
+    case 'i':
+      if (str == "min"sv)
+        return property("min", this->_min, o.min);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 5:
+    if (str == "scale"sv)
+      return property("scale", this->_scale, o.scale);
+    break;
+  case 6:
+    switch (str[0]) {
+    case 'v':
+      if (str == "values"sv)
+        return property("values", this->_values, o.values);
+      break;
+    case 'o':
+      if (str == "offset"sv)
+        return property("offset", this->_offset, o.offset);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 12:
+    if (str == "arrayOffsets"sv)
+      return property("arrayOffsets", this->_arrayOffsets, o.arrayOffsets);
+    break;
+  case 13:
+    if (str == "stringOffsets"sv)
+      return property("stringOffsets", this->_stringOffsets, o.stringOffsets);
+    break;
+  case 15:
+    if (str == "arrayOffsetType"sv)
+      return property(
+          "arrayOffsetType",
+          this->_arrayOffsetType,
+          o.arrayOffsetType);
+    break;
+  case 16:
+    if (str == "stringOffsetType"sv)
+      return property(
+          "stringOffsetType",
+          this->_stringOffsetType,
+          o.stringOffsetType);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1416,16 +1696,34 @@ CesiumJsonReader::IJsonHandler* BufferViewJsonHandler::readObjectKeyBufferView(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::BufferView& o) {
-  using namespace std::string_literals;
-
-  if ("buffer"s == str)
-    return property("buffer", this->_buffer, o.buffer);
-  if ("byteOffset"s == str)
-    return property("byteOffset", this->_byteOffset, o.byteOffset);
-  if ("byteLength"s == str)
-    return property("byteLength", this->_byteLength, o.byteLength);
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 6:
+    if (str == "buffer"sv)
+      return property("buffer", this->_buffer, o.buffer);
+    break;
+  case 10:
+    switch (str[4]) {
+    case 'O':
+      if (str == "byteOffset"sv)
+        return property("byteOffset", this->_byteOffset, o.byteOffset);
+      break;
+    case 'L':
+      if (str == "byteLength"sv)
+        return property("byteLength", this->_byteLength, o.byteLength);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1506,14 +1804,24 @@ CesiumJsonReader::IJsonHandler* BufferJsonHandler::readObjectKeyBuffer(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Buffer& o) {
-  using namespace std::string_literals;
-
-  if ("uri"s == str)
-    return property("uri", this->_uri, o.uri);
-  if ("byteLength"s == str)
-    return property("byteLength", this->_byteLength, o.byteLength);
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    if (str == "uri"sv)
+      return property("uri", this->_uri, o.uri);
+    break;
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 10:
+    if (str == "byteLength"sv)
+      return property("byteLength", this->_byteLength, o.byteLength);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1598,33 +1906,83 @@ CesiumJsonReader::IJsonHandler* TilesetJsonHandler::readObjectKeyTileset(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Tileset& o) {
-  using namespace std::string_literals;
-
-  if ("asset"s == str)
-    return property("asset", this->_asset, o.asset);
-  if ("properties"s == str)
-    return property("properties", this->_properties, o.properties);
-  if ("schema"s == str)
-    return property("schema", this->_schema, o.schema);
-  if ("schemaUri"s == str)
-    return property("schemaUri", this->_schemaUri, o.schemaUri);
-  if ("statistics"s == str)
-    return property("statistics", this->_statistics, o.statistics);
-  if ("groups"s == str)
-    return property("groups", this->_groups, o.groups);
-  if ("metadata"s == str)
-    return property("metadata", this->_metadata, o.metadata);
-  if ("geometricError"s == str)
-    return property("geometricError", this->_geometricError, o.geometricError);
-  if ("root"s == str)
-    return property("root", this->_root, o.root);
-  if ("extensionsUsed"s == str)
-    return property("extensionsUsed", this->_extensionsUsed, o.extensionsUsed);
-  if ("extensionsRequired"s == str)
-    return property(
-        "extensionsRequired",
-        this->_extensionsRequired,
-        o.extensionsRequired);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "root"sv)
+      return property("root", this->_root, o.root);
+    break;
+  case 5:
+    if (str == "asset"sv)
+      return property("asset", this->_asset, o.asset);
+    break;
+  case 6:
+    switch (str[0]) {
+    case 's':
+      if (str == "schema"sv)
+        return property("schema", this->_schema, o.schema);
+      break;
+    case 'g':
+      if (str == "groups"sv)
+        return property("groups", this->_groups, o.groups);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 8:
+    if (str == "metadata"sv)
+      return property("metadata", this->_metadata, o.metadata);
+    break;
+  case 9:
+    if (str == "schemaUri"sv)
+      return property("schemaUri", this->_schemaUri, o.schemaUri);
+    break;
+  case 10:
+    switch (str[0]) {
+    case 'p':
+      if (str == "properties"sv)
+        return property("properties", this->_properties, o.properties);
+      break;
+    case 's':
+      if (str == "statistics"sv)
+        return property("statistics", this->_statistics, o.statistics);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 14:
+    switch (str[0]) {
+    case 'g':
+      if (str == "geometricError"sv)
+        return property(
+            "geometricError",
+            this->_geometricError,
+            o.geometricError);
+      break;
+    case 'e':
+      if (str == "extensionsUsed"sv)
+        return property(
+            "extensionsUsed",
+            this->_extensionsUsed,
+            o.extensionsUsed);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 18:
+    if (str == "extensionsRequired"sv)
+      return property(
+          "extensionsRequired",
+          this->_extensionsRequired,
+          o.extensionsRequired);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1708,31 +2066,76 @@ CesiumJsonReader::IJsonHandler* TileJsonHandler::readObjectKeyTile(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Tile& o) {
-  using namespace std::string_literals;
-
-  if ("boundingVolume"s == str)
-    return property("boundingVolume", this->_boundingVolume, o.boundingVolume);
-  if ("viewerRequestVolume"s == str)
-    return property(
-        "viewerRequestVolume",
-        this->_viewerRequestVolume,
-        o.viewerRequestVolume);
-  if ("geometricError"s == str)
-    return property("geometricError", this->_geometricError, o.geometricError);
-  if ("refine"s == str)
-    return property("refine", this->_refine, o.refine);
-  if ("transform"s == str)
-    return property("transform", this->_transform, o.transform);
-  if ("content"s == str)
-    return property("content", this->_content, o.content);
-  if ("contents"s == str)
-    return property("contents", this->_contents, o.contents);
-  if ("metadata"s == str)
-    return property("metadata", this->_metadata, o.metadata);
-  if ("implicitTiling"s == str)
-    return property("implicitTiling", this->_implicitTiling, o.implicitTiling);
-  if ("children"s == str)
-    return property("children", this->_children, o.children);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 6:
+    if (str == "refine"sv)
+      return property("refine", this->_refine, o.refine);
+    break;
+  case 7:
+    if (str == "content"sv)
+      return property("content", this->_content, o.content);
+    break;
+  case 8:
+    switch (str[1]) {
+    case 'o':
+      if (str == "contents"sv)
+        return property("contents", this->_contents, o.contents);
+      break;
+    case 'e':
+      if (str == "metadata"sv)
+        return property("metadata", this->_metadata, o.metadata);
+      break;
+    case 'h':
+      if (str == "children"sv)
+        return property("children", this->_children, o.children);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 9:
+    if (str == "transform"sv)
+      return property("transform", this->_transform, o.transform);
+    break;
+  case 14:
+    switch (str[0]) {
+    case 'b':
+      if (str == "boundingVolume"sv)
+        return property(
+            "boundingVolume",
+            this->_boundingVolume,
+            o.boundingVolume);
+      break;
+    case 'g':
+      if (str == "geometricError"sv)
+        return property(
+            "geometricError",
+            this->_geometricError,
+            o.geometricError);
+      break;
+    case 'i':
+      if (str == "implicitTiling"sv)
+        return property(
+            "implicitTiling",
+            this->_implicitTiling,
+            o.implicitTiling);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 19:
+    if (str == "viewerRequestVolume"sv)
+      return property(
+          "viewerRequestVolume",
+          this->_viewerRequestVolume,
+          o.viewerRequestVolume);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1811,22 +2214,34 @@ ImplicitTilingJsonHandler::readObjectKeyImplicitTiling(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::ImplicitTiling& o) {
-  using namespace std::string_literals;
-
-  if ("subdivisionScheme"s == str)
-    return property(
-        "subdivisionScheme",
-        this->_subdivisionScheme,
-        o.subdivisionScheme);
-  if ("subtreeLevels"s == str)
-    return property("subtreeLevels", this->_subtreeLevels, o.subtreeLevels);
-  if ("availableLevels"s == str)
-    return property(
-        "availableLevels",
-        this->_availableLevels,
-        o.availableLevels);
-  if ("subtrees"s == str)
-    return property("subtrees", this->_subtrees, o.subtrees);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 8:
+    if (str == "subtrees"sv)
+      return property("subtrees", this->_subtrees, o.subtrees);
+    break;
+  case 13:
+    if (str == "subtreeLevels"sv)
+      return property("subtreeLevels", this->_subtreeLevels, o.subtreeLevels);
+    break;
+  case 15:
+    if (str == "availableLevels"sv)
+      return property(
+          "availableLevels",
+          this->_availableLevels,
+          o.availableLevels);
+    break;
+  case 17:
+    if (str == "subdivisionScheme"sv)
+      return property(
+          "subdivisionScheme",
+          this->_subdivisionScheme,
+          o.subdivisionScheme);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1905,10 +2320,16 @@ CesiumJsonReader::IJsonHandler* SubtreesJsonHandler::readObjectKeySubtrees(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Subtrees& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("uri"s == str)
-    return property("uri", this->_uri, o.uri);
+  switch (str.size()) {
+  case 3:
+    if (str == "uri"sv)
+      return property("uri", this->_uri, o.uri);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1987,16 +2408,31 @@ CesiumJsonReader::IJsonHandler* ContentJsonHandler::readObjectKeyContent(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Content& o) {
-  using namespace std::string_literals;
-
-  if ("boundingVolume"s == str)
-    return property("boundingVolume", this->_boundingVolume, o.boundingVolume);
-  if ("uri"s == str)
-    return property("uri", this->_uri, o.uri);
-  if ("metadata"s == str)
-    return property("metadata", this->_metadata, o.metadata);
-  if ("group"s == str)
-    return property("group", this->_group, o.group);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    if (str == "uri"sv)
+      return property("uri", this->_uri, o.uri);
+    break;
+  case 5:
+    if (str == "group"sv)
+      return property("group", this->_group, o.group);
+    break;
+  case 8:
+    if (str == "metadata"sv)
+      return property("metadata", this->_metadata, o.metadata);
+    break;
+  case 14:
+    if (str == "boundingVolume"sv)
+      return property(
+          "boundingVolume",
+          this->_boundingVolume,
+          o.boundingVolume);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2074,14 +2510,30 @@ BoundingVolumeJsonHandler::readObjectKeyBoundingVolume(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::BoundingVolume& o) {
-  using namespace std::string_literals;
-
-  if ("box"s == str)
-    return property("box", this->_box, o.box);
-  if ("region"s == str)
-    return property("region", this->_region, o.region);
-  if ("sphere"s == str)
-    return property("sphere", this->_sphere, o.sphere);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    if (str == "box"sv)
+      return property("box", this->_box, o.box);
+    break;
+  case 6:
+    switch (str[0]) {
+    case 'r':
+      if (str == "region"sv)
+        return property("region", this->_region, o.region);
+      break;
+    case 's':
+      if (str == "sphere"sv)
+        return property("sphere", this->_sphere, o.sphere);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2161,8 +2613,6 @@ GroupMetadataJsonHandler::readObjectKeyGroupMetadata(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::GroupMetadata& o) {
-  using namespace std::string_literals;
-
   (void)o;
 
   return this->readObjectKeyMetadataEntity(objectType, str, *this->_pObject);
@@ -2244,12 +2694,26 @@ CesiumJsonReader::IJsonHandler* PropertiesJsonHandler::readObjectKeyProperties(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Properties& o) {
-  using namespace std::string_literals;
-
-  if ("maximum"s == str)
-    return property("maximum", this->_maximum, o.maximum);
-  if ("minimum"s == str)
-    return property("minimum", this->_minimum, o.minimum);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 7:
+    switch (str[1]) {
+    case 'a':
+      if (str == "maximum"sv)
+        return property("maximum", this->_maximum, o.maximum);
+      break;
+    case 'i':
+      if (str == "minimum"sv)
+        return property("minimum", this->_minimum, o.minimum);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2329,12 +2793,23 @@ CesiumJsonReader::IJsonHandler* AssetJsonHandler::readObjectKeyAsset(
     const std::string& objectType,
     const std::string_view& str,
     Cesium3DTiles::Asset& o) {
-  using namespace std::string_literals;
-
-  if ("version"s == str)
-    return property("version", this->_version, o.version);
-  if ("tilesetVersion"s == str)
-    return property("tilesetVersion", this->_tilesetVersion, o.tilesetVersion);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 7:
+    if (str == "version"sv)
+      return property("version", this->_version, o.version);
+    break;
+  case 14:
+    if (str == "tilesetVersion"sv)
+      return property(
+          "tilesetVersion",
+          this->_tilesetVersion,
+          o.tilesetVersion);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
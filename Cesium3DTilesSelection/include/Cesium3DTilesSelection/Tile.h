@@ -7,6 +7,7 @@
 #include "TileID.h"
 #include "TileRefine.h"
 #include "TileSelectionState.h"
+#include "TileTreeMemoryUsage.h"
 
 #include <CesiumUtility/DoublyLinkedList.h>
 
@@ -14,6 +15,7 @@
 #include <gsl/span>
 
 #include <atomic>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -233,9 +235,7 @@ public:
    *
    * @return The viewer request volume, or an empty optional.
    */
-  const std::optional<BoundingVolume>& getViewerRequestVolume() const noexcept {
-    return this->_viewerRequestVolume;
-  }
+  const std::optional<BoundingVolume>& getViewerRequestVolume() const noexcept;
 
   /**
    * @brief Set the viewer request volume of this tile.
@@ -244,10 +244,7 @@ public:
    *
    * @param value The viewer request volume.
    */
-  void
-  setViewerRequestVolume(const std::optional<BoundingVolume>& value) noexcept {
-    this->_viewerRequestVolume = value;
-  }
+  void setViewerRequestVolume(const std::optional<BoundingVolume>& value);
 
   /**
    * @brief Returns the geometric error of this tile.
@@ -383,9 +380,7 @@ public:
    * @see Tile::getBoundingVolume
    */
   const std::optional<BoundingVolume>&
-  getContentBoundingVolume() const noexcept {
-    return this->_contentBoundingVolume;
-  }
+  getContentBoundingVolume() const noexcept;
 
   /**
    * @brief Set the {@link BoundingVolume} of the renderable content of this
@@ -395,10 +390,7 @@ public:
    *
    * @param value The content bounding volume
    */
-  void setContentBoundingVolume(
-      const std::optional<BoundingVolume>& value) noexcept {
-    this->_contentBoundingVolume = value;
-  }
+  void setContentBoundingVolume(const std::optional<BoundingVolume>& value);
 
   /**
    * @brief Returns the {@link TileSelectionState} of this tile.
@@ -433,6 +425,12 @@ public:
    */
   int64_t computeByteSize() const noexcept;
 
+  /**
+   * @brief Determines the memory used by this tile and its descendants, not
+   * including their loaded content.
+   */
+  TileTreeMemoryUsage computeTreeMemoryUsage() const noexcept;
+
   /**
    * @brief Returns the raster overlay tiles that have been mapped to this tile.
    */
@@ -528,15 +526,30 @@ private:
   // These are immutable after the tile leaves TileState::Unloaded.
   TileID _id;
   BoundingVolume _boundingVolume;
-  std::optional<BoundingVolume> _viewerRequestVolume;
-  std::optional<BoundingVolume> _contentBoundingVolume;
   double _geometricError;
   TileRefine _refine;
   glm::dmat4x4 _transform;
 
+  // Properties that many tiles don't have, stored out of line so that they
+  // don't take up space in every tile.
+  struct ColdData {
+    std::optional<BoundingVolume> viewerRequestVolume;
+    std::optional<BoundingVolume> contentBoundingVolume;
+  };
+  std::unique_ptr<ColdData> _pColdData;
+
   // Selection state
   TileSelectionState _lastSelectionState;
 
+  // The frustum plane that this tile was last found to be outside of. It is
+  // tested first next time, because it most likely culls the tile again.
+  mutable uint8_t _lastCullingPlane;
+
+  // The index of this tile's evaluation in Tileset::_precomputedTileEvaluations
+  // if it was precomputed this frame. It is only valid if the evaluation at
+  // that index refers back to this tile.
+  mutable uint32_t _precomputedEvaluationIndex;
+
   // tile content
   CesiumUtility::DoublyLinkedListPointers<Tile> _loadedTilesLinks;
   TileContent _content;
@@ -547,6 +560,7 @@ private:
   // mapped raster overlay
   std::vector<RasterMappedTo3DTile> _rasterTiles;
 
+  friend class Tileset;
   friend class TilesetContentManager;
   friend class MockTilesetContentManagerTestFixture;
 
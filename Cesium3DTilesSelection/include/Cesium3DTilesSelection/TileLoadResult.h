@@ -9,6 +9,7 @@
 #include <CesiumGltf/Model.h>
 #include <CesiumRasterOverlays/RasterOverlayDetails.h>
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -130,6 +131,16 @@ struct CESIUM3DTILESSELECTION_API TileLoadResult {
   CesiumGeospatial::Ellipsoid ellipsoid =
       CesiumGeospatial::Ellipsoid::UNIT_SPHERE;
 
+  /**
+   * @brief The time that the loader spent decoding the content, for example
+   * converting a b3dm to glTF, if it measured it.
+   *
+   * This is recorded in the metrics of the tileset. It does not include the
+   * time to fetch the content, but it does include the time to fetch any
+   * external resources that the content refers to while it is decoded.
+   */
+  std::optional<std::chrono::steady_clock::duration> decodeTime{};
+
   /**
    * @brief Create a result with Failed state
    *
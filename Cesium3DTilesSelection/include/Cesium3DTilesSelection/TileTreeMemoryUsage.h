@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Library.h"
+
+#include <cstdint>
+
+namespace Cesium3DTilesSelection {
+
+/**
+ * @brief Reports the memory used by a tree of {@link Tile} instances, not
+ * including the content that is loaded into the tiles.
+ *
+ * @see Tile::computeTreeMemoryUsage
+ * @see Tileset::computeTileTreeMemoryUsage
+ */
+struct CESIUM3DTILESSELECTION_API TileTreeMemoryUsage {
+  /**
+   * @brief The number of tiles in the tree.
+   */
+  int64_t tileCount = 0;
+
+  /**
+   * @brief The number of bytes used by the {@link Tile} instances themselves,
+   * including unused capacity in the vectors that hold them.
+   */
+  int64_t tileBytes = 0;
+
+  /**
+   * @brief The number of bytes allocated for tile properties that are stored
+   * out of line, such as viewer request volumes and content bounding volumes.
+   */
+  int64_t coldDataBytes = 0;
+
+  /**
+   * @brief The number of bytes allocated for string tile IDs that are too long
+   * to be stored within the tile itself.
+   */
+  int64_t tileIDBytes = 0;
+
+  /**
+   * @brief The number of bytes allocated for the raster overlay tiles mapped
+   * to the tiles.
+   */
+  int64_t rasterMappingBytes = 0;
+
+  /**
+   * @brief Gets the total number of bytes used by the tree.
+   */
+  int64_t getTotalBytes() const noexcept {
+    return this->tileBytes + this->coldDataBytes + this->tileIDBytes +
+           this->rasterMappingBytes;
+  }
+};
+
+} // namespace Cesium3DTilesSelection
@@ -4,6 +4,7 @@
 #include "RasterOverlayCollection.h"
 #include "SampleHeightResult.h"
 #include "Tile.h"
+#include "TileTreeMemoryUsage.h"
 #include "TilesetContentLoader.h"
 #include "TilesetExternals.h"
 #include "TilesetLoadFailureDetails.h"
@@ -20,6 +21,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Cesium3DTilesSelection {
@@ -241,6 +243,15 @@ public:
    */
   int64_t getTotalDataBytes() const noexcept;
 
+  /**
+   * @brief Determines the memory used by this tileset's tree of tiles, not
+   * including their loaded content.
+   *
+   * Unlike {@link Tileset::getTotalDataBytes}, this walks every tile in the
+   * tree, so it is not meant to be called every frame.
+   */
+  TileTreeMemoryUsage computeTileTreeMemoryUsage() const noexcept;
+
   /**
    * @brief Gets the {@link TilesetMetadata} associated with the main or
    * external tileset.json that contains a given tile. If the metadata is not
@@ -408,21 +419,74 @@ private:
     bool culled = false;
   };
 
+  /**
+   * @brief The results of evaluating a tile against all of the frustums.
+   *
+   * These depend only on the tile's bounding volume and geometric error and on
+   * the frame state, so they can be computed ahead of the traversal.
+   */
+  struct TileEvaluation {
+    // the load priority of the tile
+    double priority = 0.0;
+    // the largest screen-space error of the tile in any frustum
+    double largestSse = 0.0;
+    // the geometric error of the tile that largestSse was computed with
+    double geometricError = 0.0;
+    // whether the tile is hidden by fog in every frustum
+    bool fogCulled = false;
+  };
+
+  struct PrecomputedTileEvaluation {
+    // the tile that was evaluated
+    const Tile* pTile = nullptr;
+    TileEvaluation evaluation;
+    // whether the tile's bounding volume is visible in any frustum
+    bool visible = false;
+  };
+
   // TODO: abstract these into a composable culling interface.
   void _frustumCull(
       const Tile& tile,
       const FrameState& frameState,
+      uint32_t depth,
       bool cullWithChildrenBounds,
       CullResult& cullResult);
-  void _fogCull(
+  void _fogCull(const TileEvaluation& evaluation, CullResult& cullResult)
+      const noexcept;
+  bool _meetsSse(double largestSse, bool culled) const noexcept;
+
+  TileEvaluation _evaluateTile(
+      const Tile& tile,
       const FrameState& frameState,
-      const std::vector<double>& distances,
-      CullResult& cullResult);
-  bool _meetsSse(
-      const std::vector<ViewState>& frustums,
+      std::vector<double>& distances) const;
+  TileEvaluation
+  _getTileEvaluation(const Tile& tile, const FrameState& frameState);
+  bool _isVisible(
       const Tile& tile,
-      const std::vector<double>& distances,
-      bool culled) const noexcept;
+      const FrameState& frameState,
+      const uint32_t* pParentPlaneMasks,
+      uint32_t* pPlaneMasks) const;
+
+  const PrecomputedTileEvaluation*
+  _findPrecomputedTileEvaluation(const Tile& tile) const noexcept;
+  PrecomputedTileEvaluation _precomputeTileEvaluation(
+      const Tile& tile,
+      const FrameState& frameState,
+      std::vector<double>& distances,
+      const uint32_t* pParentPlaneMasks,
+      uint32_t* pPlaneMasks) const;
+  bool _shouldPrecomputeChildren(
+      const Tile& tile,
+      const PrecomputedTileEvaluation& precomputed) const noexcept;
+  void _precomputeSubtreeEvaluations(
+      const Tile& tile,
+      const FrameState& frameState,
+      std::vector<double>& distances,
+      std::vector<uint32_t>& planeMasks,
+      std::vector<PrecomputedTileEvaluation>& evaluations) const;
+  void _precomputeTileEvaluationsInParallel(
+      const FrameState& frameState,
+      const Tile& rootTile);
 
   TraversalDetails _visitTileIfNeeded(
       const FrameState& frameState,
@@ -461,7 +525,8 @@ private:
   void _processWorkerThreadLoadQueue();
   void _processMainThreadLoadQueue();
 
-  void _unloadCachedTiles(double timeBudget) noexcept;
+  void
+  _unloadCachedTiles(double timeBudget, ViewUpdateResult& result) noexcept;
   void _markTileVisited(Tile& tile) noexcept;
 
   void _updateLodTransitions(
@@ -526,6 +591,16 @@ private:
       else
         return this->group > rhs.group;
     }
+
+    /**
+     * @brief Compares two tasks for use with `std::make_heap` and
+     * `std::pop_heap`, so that the task that should load first is at the top
+     * of the heap.
+     */
+    static bool
+    heapCompare(const TileLoadTask& lhs, const TileLoadTask& rhs) noexcept {
+      return rhs < lhs;
+    }
   };
 
   std::vector<TileLoadTask> _mainThreadLoadQueue;
@@ -538,6 +613,32 @@ private:
   // selection.
   std::vector<double> _distances;
 
+  struct ChildDistance {
+    double distanceSquared;
+    Tile* pTile;
+  };
+
+  // Holds the frustum plane masks of the tiles currently being visited, one
+  // per frustum for each depth, so that a tile only needs to test the planes
+  // that its parent intersects.
+  std::vector<uint32_t> _planeMasks;
+
+  // Holds the children of the tiles currently being visited, sorted
+  // near-to-far, to avoid allocating them on the heap during tile selection.
+  std::vector<ChildDistance> _childrenNearToFar;
+
+  // Holds the tile evaluations computed by worker threads when
+  // TilesetOptions::enableParallelTileEvaluation is set, in the order in which
+  // they were computed. Each evaluated tile stores its index in this vector.
+  // Cleared (but not deallocated) each frame.
+  std::vector<PrecomputedTileEvaluation> _precomputedTileEvaluations;
+
+  // Holds the evaluations of each independent subtree while they are being
+  // computed in parallel, before they are appended to
+  // _precomputedTileEvaluations. Cleared (but not deallocated) each frame.
+  std::vector<std::vector<PrecomputedTileEvaluation>>
+      _precomputedSubtreeEvaluations;
+
   // Holds the occlusion proxies of the children of a tile. Store them in this
   // scratch variable so that it can allocate only when growing bigger.
   std::vector<const TileOcclusionRendererProxy*> _childOcclusionProxies;
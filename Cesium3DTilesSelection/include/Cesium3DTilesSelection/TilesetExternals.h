@@ -16,7 +16,8 @@ class ITaskProcessor;
 
 namespace CesiumUtility {
 class CreditSystem;
-}
+class IMetricsSink;
+} // namespace CesiumUtility
 
 namespace Cesium3DTilesSelection {
 class IPrepareRendererResources;
@@ -77,6 +78,15 @@ public:
    */
   CesiumUtility::IntrusivePointer<TilesetSharedAssetSystem> pSharedAssetSystem =
       TilesetSharedAssetSystem::getDefault();
+
+  /**
+   * @brief A sink that will receive runtime metrics about tile loading and
+   * selection, such as tile load latencies, load queue lengths, and the bytes
+   * evicted each frame.
+   *
+   * If not specified, no metrics are recorded.
+   */
+  std::shared_ptr<CesiumUtility::IMetricsSink> pMetricsSink = nullptr;
 };
 
 } // namespace Cesium3DTilesSelection
@@ -206,6 +206,20 @@ struct CESIUM3DTILESSELECTION_API TilesetOptions {
    */
   int64_t maximumCachedBytes = 512 * 1024 * 1024;
 
+  /**
+   * @brief The fraction of {@link maximumCachedBytes} to unload down to once
+   * the cache exceeds that limit.
+   *
+   * When the total number of loaded bytes grows past
+   * {@link maximumCachedBytes}, tiles are unloaded until the total is under
+   * `maximumCachedBytes * cacheUnloadTargetFraction`, or until only required
+   * tiles remain. A value less than 1.0 frees a little more than necessary
+   * each time, so that unloading doesn't need to run again on every frame
+   * while new tiles are streaming in. The value is clamped to the range
+   * [0.0, 1.0].
+   */
+  double cacheUnloadTargetFraction = 1.0;
+
   /**
    * @brief A table that maps the camera height above the ellipsoid to a fog
    * density. Tiles that are in full fog are culled. The density of the fog
@@ -238,6 +252,43 @@ struct CESIUM3DTILESSELECTION_API TilesetOptions {
    */
   bool renderTilesUnderCamera = true;
 
+  /**
+   * @brief Whether to evaluate tiles against the view frustums in worker
+   * threads.
+   *
+   * When enabled, {@link Tileset::updateView} first fans independent subtrees
+   * of the tile tree out to the worker threads of the
+   * {@link CesiumAsync::AsyncSystem}, which compute the load priority,
+   * visibility, fog culling, and screen-space error of the tiles that are
+   * likely to be visited. The main thread evaluates subtrees too, so it does
+   * not wait for worker threads that are busy loading tiles. It then selects
+   * tiles as usual, using the precomputed values where available, so the
+   * selection results are identical to those obtained without this option.
+   *
+   * This is most useful when {@link Tileset::updateView} is given many
+   * frustums, for example when rendering cube maps or shadow cascades.
+   */
+  bool enableParallelTileEvaluation = false;
+
+  /**
+   * @brief Whether to create the tiles of a tileset.json only when a traversal
+   * of the tileset first reaches them, rather than all at once when the
+   * tileset.json is loaded.
+   *
+   * When enabled, only the root tile and its children are created when the
+   * tileset.json is loaded. The parsed JSON is kept in memory, and the
+   * children of any other tile are created from it the first time that the
+   * tile is visited. For a tileset.json with many tiles, this makes the
+   * tileset ready to render much sooner, and avoids creating the tiles that
+   * are never visited at all.
+   *
+   * This applies to a tileset loaded from a URL and to any external tilesets
+   * that it references. It does not apply to implicit tilesets, whose tiles
+   * are always created as they're needed, or to tilesets loaded from Cesium
+   * ion.
+   */
+  bool enableLazyTileCreation = false;
+
   /**
    * @brief A list of interfaces that are given an opportunity to exclude tiles
    * from loading and rendering. If any of the excluders indicate that a tile
@@ -12,6 +12,7 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
+#include <cstdint>
 #include <vector>
 
 namespace Cesium3DTilesSelection {
@@ -50,6 +51,57 @@ public:
       double verticalFieldOfView,
       const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
 
+  /**
+   * @brief Creates a new instance of a view state whose frustum has near and
+   * far planes.
+   *
+   * Bounding volumes that are entirely closer to the camera than the near
+   * plane, or entirely farther away than the far plane, are not visible.
+   *
+   * @param position The position of the eye point of the camera.
+   * @param direction The view direction vector of the camera.
+   * @param up The up vector of the camera.
+   * @param viewportSize The size of the viewport, in pixels.
+   * @param horizontalFieldOfView The horizontal field-of-view (opening)
+   * angle of the camera, in radians.
+   * @param verticalFieldOfView The vertical field-of-view (opening)
+   * angle of the camera, in radians.
+   * @param nearDistance The distance from the camera to the near plane.
+   * @param farDistance The distance from the camera to the far plane.
+   * @param ellipsoid The ellipsoid that will be used to compute the
+   * {@link ViewState#getPositionCartographic cartographic position}
+   * from the cartesian position.
+   * Default value: {@link CesiumGeospatial::Ellipsoid::WGS84}.
+   */
+  static ViewState create(
+      const glm::dvec3& position,
+      const glm::dvec3& direction,
+      const glm::dvec3& up,
+      const glm::dvec2& viewportSize,
+      double horizontalFieldOfView,
+      double verticalFieldOfView,
+      double nearDistance,
+      double farDistance,
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
+
+  /**
+   * @brief A plane mask indicating that a bounding volume is entirely outside
+   * of at least one plane of the frustum, so it is not visible.
+   */
+  static constexpr uint32_t PLANE_MASK_OUTSIDE = 0xffffffff;
+
+  /**
+   * @brief A plane mask indicating that a bounding volume is entirely inside
+   * all of the planes of the frustum.
+   */
+  static constexpr uint32_t PLANE_MASK_INSIDE = 0;
+
+  /**
+   * @brief A plane mask indicating that it is not known which planes of the
+   * frustum a bounding volume intersects, so all of them must be tested.
+   */
+  static constexpr uint32_t PLANE_MASK_INDETERMINATE = 0x7fffffff;
+
   /**
    * @brief Gets the position of the camera in Earth-centered, Earth-fixed
    * coordinates.
@@ -113,6 +165,35 @@ public:
   bool
   isBoundingVolumeVisible(const BoundingVolume& boundingVolume) const noexcept;
 
+  /**
+   * @brief Determines which planes of this camera's frustum the given
+   * {@link BoundingVolume} intersects.
+   *
+   * In the returned plane mask, bit `i` is set if the bounding volume
+   * intersects plane `i` of the frustum. The planes are numbered left, right,
+   * top, bottom, and then near and far if the frustum has them. If the
+   * bounding volume is entirely outside of any plane, the result is
+   * {@link PLANE_MASK_OUTSIDE}.
+   *
+   * Only the planes whose bits are set in `parentPlaneMask` are tested. This
+   * should be the plane mask of a bounding volume that encloses this one,
+   * such as that of a parent tile, or {@link PLANE_MASK_INDETERMINATE} to test
+   * every plane. If the enclosing volume was entirely inside a plane, then so
+   * is this one, and if it was entirely outside a plane, then so is this one.
+   *
+   * @param boundingVolume The bounding volume.
+   * @param parentPlaneMask The plane mask of a bounding volume that encloses
+   * this one.
+   * @param lastCullingPlane The plane that is tested first. If the bounding
+   * volume is found to be outside of a plane, this is set to that plane, so
+   * that it is tested first next time. Initialize it to zero.
+   * @return The plane mask of the bounding volume.
+   */
+  uint32_t computeVisibilityWithPlaneMask(
+      const BoundingVolume& boundingVolume,
+      uint32_t parentPlaneMask,
+      uint8_t& lastCullingPlane) const noexcept;
+
   /**
    * @brief Computes the squared distance to the given {@link BoundingVolume}.
    *
@@ -154,6 +235,10 @@ private:
    * angle of the camera, in radians.
    * @param verticalFieldOfView The vertical field-of-view (opening)
    * angle of the camera, in radians.
+   * @param positionCartographic The position of the camera as a longitude /
+   * latitude / height.
+   * @param ellipsoid The ellipsoid.
+   * @param cullingVolume The culling volume of the camera's frustum.
    */
   ViewState(
       const glm::dvec3& position,
@@ -163,7 +248,8 @@ private:
       double horizontalFieldOfView,
       double verticalFieldOfView,
       const std::optional<CesiumGeospatial::Cartographic>& positionCartographic,
-      const CesiumGeospatial::Ellipsoid& ellipsoid);
+      const CesiumGeospatial::Ellipsoid& ellipsoid,
+      const CullingVolume& cullingVolume);
 
   const glm::dvec3 _position;
   const glm::dvec3 _direction;
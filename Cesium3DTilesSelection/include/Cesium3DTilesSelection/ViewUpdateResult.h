@@ -59,6 +59,24 @@ public:
   uint32_t maxDepthVisited = 0;
   //! @endcond
 
+  /**
+   * @brief The number of tiles that were unloaded this frame to reduce the
+   * size of the tile cache.
+   */
+  uint32_t tilesEvicted = 0;
+
+  /**
+   * @brief The number of tiles that were considered for unloading this frame
+   * but could not be unloaded yet, for example because they are fading out or
+   * still loading.
+   */
+  uint32_t tilesSkippedForEviction = 0;
+
+  /**
+   * @brief The number of bytes that were freed by unloading tiles this frame.
+   */
+  int64_t bytesEvicted = 0;
+
   int32_t frameNumber = 0;
 };
 
@@ -12,6 +12,7 @@
 
 #include <spdlog/logger.h>
 
+#include <chrono>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -188,9 +189,20 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
               tileTransform,
               requestHeaders,
               CesiumGeometry::Axis::Y};
-          return converter(responseData, gltfOptions, assetFetcher)
-              .thenImmediately([ellipsoid, pLogger, tileUrl, pCompletedRequest](
-                                   GltfConverterResult&& result) {
+          const auto decodeStart = std::chrono::steady_clock::now();
+          return GltfConverters::convert(
+                     converter,
+                     *pCompletedRequest,
+                     gltfOptions,
+                     assetFetcher)
+              .thenImmediately([pLogger,
+                                tileUrl,
+                                pCompletedRequest,
+                                ellipsoid,
+                                decodeStart](GltfConverterResult&& result) {
+                const auto decodeTime =
+                    std::chrono::steady_clock::now() - decodeStart;
+
                 // Report any errors if there are any
                 logTileLoadResult(pLogger, tileUrl, result.errors);
                 if (result.errors || !result.model) {
@@ -207,7 +219,8 @@ CesiumAsync::Future<TileLoadResult> requestTileContent(
                     std::move(pCompletedRequest),
                     {},
                     TileLoadResultState::Success,
-                    ellipsoid};
+                    ellipsoid,
+                    decodeTime};
               });
         }
         // content type is not supported
@@ -9,6 +9,12 @@
 #include <CesiumUtility/Tracing.h>
 
 #include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <variant>
 
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
@@ -47,12 +53,13 @@ Tile::Tile(
       _children(),
       _id(""s),
       _boundingVolume(OrientedBoundingBox(glm::dvec3(), glm::dmat3())),
-      _viewerRequestVolume(),
-      _contentBoundingVolume(),
       _geometricError(0.0),
       _refine(TileRefine::Replace),
       _transform(1.0),
+      _pColdData(),
       _lastSelectionState(),
+      _lastCullingPlane(0),
+      _precomputedEvaluationIndex(std::numeric_limits<uint32_t>::max()),
       _loadedTilesLinks(),
       _content{std::forward<TileContentArgs>(args)...},
       _pLoader{pLoader},
@@ -64,12 +71,13 @@ Tile::Tile(Tile&& rhs) noexcept
       _children(std::move(rhs._children)),
       _id(std::move(rhs._id)),
       _boundingVolume(rhs._boundingVolume),
-      _viewerRequestVolume(rhs._viewerRequestVolume),
-      _contentBoundingVolume(rhs._contentBoundingVolume),
       _geometricError(rhs._geometricError),
       _refine(rhs._refine),
       _transform(rhs._transform),
+      _pColdData(std::move(rhs._pColdData)),
       _lastSelectionState(rhs._lastSelectionState),
+      _lastCullingPlane(rhs._lastCullingPlane),
+      _precomputedEvaluationIndex(std::numeric_limits<uint32_t>::max()),
       _loadedTilesLinks(),
       _content(std::move(rhs._content)),
       _pLoader{rhs._pLoader},
@@ -96,12 +104,13 @@ Tile& Tile::operator=(Tile&& rhs) noexcept {
 
     this->_id = std::move(rhs._id);
     this->_boundingVolume = rhs._boundingVolume;
-    this->_viewerRequestVolume = rhs._viewerRequestVolume;
-    this->_contentBoundingVolume = rhs._contentBoundingVolume;
     this->_geometricError = rhs._geometricError;
     this->_refine = rhs._refine;
     this->_transform = rhs._transform;
+    this->_pColdData = std::move(rhs._pColdData);
     this->_lastSelectionState = rhs._lastSelectionState;
+    this->_lastCullingPlane = rhs._lastCullingPlane;
+    this->_precomputedEvaluationIndex = std::numeric_limits<uint32_t>::max();
     this->_content = std::move(rhs._content);
     this->_pLoader = rhs._pLoader;
     this->_loadState = rhs._loadState;
@@ -122,6 +131,45 @@ void Tile::createChildTiles(std::vector<Tile>&& children) {
   }
 }
 
+namespace {
+const std::optional<BoundingVolume> noBoundingVolume;
+}
+
+const std::optional<BoundingVolume>&
+Tile::getViewerRequestVolume() const noexcept {
+  return this->_pColdData ? this->_pColdData->viewerRequestVolume
+                          : noBoundingVolume;
+}
+
+void Tile::setViewerRequestVolume(const std::optional<BoundingVolume>& value) {
+  if (!this->_pColdData) {
+    if (!value) {
+      return;
+    }
+    this->_pColdData = std::make_unique<ColdData>();
+  }
+
+  this->_pColdData->viewerRequestVolume = value;
+}
+
+const std::optional<BoundingVolume>&
+Tile::getContentBoundingVolume() const noexcept {
+  return this->_pColdData ? this->_pColdData->contentBoundingVolume
+                          : noBoundingVolume;
+}
+
+void Tile::setContentBoundingVolume(
+    const std::optional<BoundingVolume>& value) {
+  if (!this->_pColdData) {
+    if (!value) {
+      return;
+    }
+    this->_pColdData = std::make_unique<ColdData>();
+  }
+
+  this->_pColdData->contentBoundingVolume = value;
+}
+
 double Tile::getNonZeroGeometricError() const noexcept {
   double geometricError = this->getGeometricError();
   if (geometricError > Math::Epsilon5) {
@@ -184,6 +232,48 @@ int64_t Tile::computeByteSize() const noexcept {
   return bytes;
 }
 
+TileTreeMemoryUsage Tile::computeTreeMemoryUsage() const noexcept {
+  TileTreeMemoryUsage usage;
+  usage.tileCount = 1;
+
+  // The children are counted below, but the unused capacity of the vector that
+  // holds them is counted here.
+  usage.tileBytes = int64_t(
+      sizeof(Tile) +
+      (this->_children.capacity() - this->_children.size()) * sizeof(Tile));
+
+  if (this->_pColdData) {
+    usage.coldDataBytes = int64_t(sizeof(ColdData));
+  }
+
+  // Short strings are stored within the std::string itself, so they don't
+  // allocate.
+  const std::string* pUrl = std::get_if<std::string>(&this->_id);
+  if (pUrl) {
+    const char* pData = pUrl->data();
+    const char* pInlineBegin = reinterpret_cast<const char*>(pUrl);
+    const char* pInlineEnd = pInlineBegin + sizeof(std::string);
+    if (std::less<const char*>()(pData, pInlineBegin) ||
+        !std::less<const char*>()(pData, pInlineEnd)) {
+      usage.tileIDBytes = int64_t(pUrl->capacity() + 1);
+    }
+  }
+
+  usage.rasterMappingBytes =
+      int64_t(this->_rasterTiles.capacity() * sizeof(RasterMappedTo3DTile));
+
+  for (const Tile& child : this->_children) {
+    const TileTreeMemoryUsage childUsage = child.computeTreeMemoryUsage();
+    usage.tileCount += childUsage.tileCount;
+    usage.tileBytes += childUsage.tileBytes;
+    usage.coldDataBytes += childUsage.coldDataBytes;
+    usage.tileIDBytes += childUsage.tileIDBytes;
+    usage.rasterMappingBytes += childUsage.rasterMappingBytes;
+  }
+
+  return usage;
+}
+
 bool Tile::isRenderable() const noexcept {
   if (getState() == TileLoadState::Failed) {
     // Explicitly treat failed tiles as "renderable" - we just treat them like
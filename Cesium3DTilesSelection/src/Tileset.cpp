@@ -1,6 +1,7 @@
 #include "TileUtilities.h"
 #include "TilesetContentManager.h"
 #include "TilesetHeightQuery.h"
+#include "TilesetMetrics.h"
 
 #include <Cesium3DTilesSelection/ITileExcluder.h>
 #include <Cesium3DTilesSelection/TileID.h>
@@ -9,12 +10,14 @@
 #include <Cesium3DTilesSelection/TilesetMetadata.h>
 #include <Cesium3DTilesSelection/spdlog-cesium.h>
 #include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/forEachInParallel.h>
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumRasterOverlays/RasterOverlayTile.h>
 #include <CesiumUtility/Assert.h>
 #include <CesiumUtility/CreditSystem.h>
 #include <CesiumUtility/Math.h>
+#include <CesiumUtility/Metrics.h>
 #include <CesiumUtility/ScopeGuard.h>
 #include <CesiumUtility/Tracing.h>
 #include <CesiumUtility/joinToString.h>
@@ -23,9 +26,12 @@
 #include <rapidjson/document.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <unordered_set>
+#include <utility>
 
 using namespace CesiumAsync;
 using namespace CesiumGeometry;
@@ -45,6 +51,7 @@ Tileset::Tileset(
       _options(options),
       _previousFrameNumber(0),
       _distances(),
+      _childrenNearToFar(),
       _childOcclusionProxies(),
       _pTilesetContentManager{
           new TilesetContentManager(
@@ -68,6 +75,7 @@ Tileset::Tileset(
       _options(options),
       _previousFrameNumber(0),
       _distances(),
+      _childrenNearToFar(),
       _childOcclusionProxies(),
       _pTilesetContentManager{
           new TilesetContentManager(
@@ -91,6 +99,7 @@ Tileset::Tileset(
       _options(options),
       _previousFrameNumber(0),
       _distances(),
+      _childrenNearToFar(),
       _childOcclusionProxies(),
       _pTilesetContentManager{new TilesetContentManager(
           _externals,
@@ -320,6 +329,8 @@ Tileset::updateViewOffline(const std::vector<ViewState>& frustums) {
 const ViewUpdateResult&
 Tileset::updateView(const std::vector<ViewState>& frustums, float deltaTime) {
   CESIUM_TRACE("Tileset::updateView");
+  const auto updateStart = std::chrono::steady_clock::now();
+
   // Fixup TilesetOptions to ensure lod transitions works correctly.
   _options.enableFrustumCulling =
       _options.enableFrustumCulling && !_options.enableLodTransitionPeriod;
@@ -341,6 +352,9 @@ Tileset::updateView(const std::vector<ViewState>& frustums, float deltaTime) {
   result.tilesWaitingForOcclusionResults = 0;
   result.tilesKicked = 0;
   result.maxDepthVisited = 0;
+  result.tilesEvicted = 0;
+  result.tilesSkippedForEviction = 0;
+  result.bytesEvicted = 0;
 
   if (!_options.enableLodTransitionPeriod) {
     result.tilesFadingOut.clear();
@@ -367,6 +381,8 @@ Tileset::updateView(const std::vector<ViewState>& frustums, float deltaTime) {
 
   this->_workerThreadLoadQueue.clear();
   this->_mainThreadLoadQueue.clear();
+  this->_childrenNearToFar.clear();
+  this->_precomputedTileEvaluations.clear();
 
   std::vector<double> fogDensities(frustums.size());
   std::transform(
@@ -385,6 +401,9 @@ Tileset::updateView(const std::vector<ViewState>& frustums, float deltaTime) {
       currentFrameNumber};
 
   if (!frustums.empty()) {
+    if (this->_options.enableParallelTileEvaluation) {
+      this->_precomputeTileEvaluationsInParallel(frameState, *pRootTile);
+    }
     this->_visitTileIfNeeded(frameState, 0, false, *pRootTile, result);
   } else {
     result = ViewUpdateResult();
@@ -402,13 +421,26 @@ Tileset::updateView(const std::vector<ViewState>& frustums, float deltaTime) {
   result.mainThreadTileLoadQueueLength =
       static_cast<int32_t>(this->_mainThreadLoadQueue.size());
 
+  const TilesetMetrics& metrics = this->_pTilesetContentManager->getMetrics();
+  if (metrics.pSink) {
+    metrics.pWorkerThreadLoadQueueLength->record(
+        result.workerThreadTileLoadQueueLength);
+    metrics.pMainThreadLoadQueueLength->record(
+        result.mainThreadTileLoadQueueLength);
+  }
+
   const std::shared_ptr<TileOcclusionRendererProxyPool>& pOcclusionPool =
       this->getExternals().pTileOcclusionProxyPool;
   if (pOcclusionPool) {
     pOcclusionPool->pruneOcclusionProxyMappings();
   }
 
-  this->_unloadCachedTiles(this->_options.tileCacheUnloadTimeLimit);
+  this->_unloadCachedTiles(this->_options.tileCacheUnloadTimeLimit, result);
+  if (metrics.pSink) {
+    metrics.pBytesEvicted->add(result.bytesEvicted);
+    metrics.pBytesEvictedPerFrame->record(result.bytesEvicted);
+  }
+
   this->_processWorkerThreadLoadQueue();
   this->_processMainThreadLoadQueue();
   this->_updateLodTransitions(frameState, deltaTime, result);
@@ -466,6 +498,10 @@ Tileset::updateView(const std::vector<ViewState>& frustums, float deltaTime) {
 
   this->_previousFrameNumber = currentFrameNumber;
 
+  if (metrics.pUpdateViewMicroseconds) {
+    metrics.pUpdateViewMicroseconds->recordElapsedSince(updateStart);
+  }
+
   return result;
 }
 int32_t Tileset::getNumberOfTilesLoaded() const {
@@ -509,6 +545,15 @@ int64_t Tileset::getTotalDataBytes() const noexcept {
   return this->_pTilesetContentManager->getTotalDataUsed();
 }
 
+TileTreeMemoryUsage Tileset::computeTileTreeMemoryUsage() const noexcept {
+  const Tile* pRootTile = this->getRootTile();
+  if (!pRootTile) {
+    return TileTreeMemoryUsage();
+  }
+
+  return pRootTile->computeTreeMemoryUsage();
+}
+
 const TilesetMetadata* Tileset::getMetadata(const Tile* pTile) const {
   if (pTile == nullptr) {
     pTile = this->getRootTile();
@@ -644,29 +689,20 @@ static void markTileAndChildrenNonRendered(
 }
 
 /**
- * @brief Returns whether a tile with the given bounding volume is visible for
- * the camera.
+ * @brief Returns whether the camera is above a tile with the given bounding
+ * volume, so the tile must be rendered if
+ * {@link Cesium3DTilesSelection::TilesetOptions::renderTilesUnderCamera} is
+ * set.
  *
  * @param viewState The {@link ViewState}
  * @param boundingVolume The bounding volume of the tile
- * @param forceRenderTilesUnderCamera Whether tiles under the camera should
- * always be considered visible and rendered (see
- * {@link Cesium3DTilesSelection::TilesetOptions}).
- * @return Whether the tile is visible according to the current camera
- * configuration
+ * @param ellipsoid The ellipsoid
+ * @return Whether the tile is under the camera
  */
-static bool isVisibleFromCamera(
+static bool isUnderCamera(
     const ViewState& viewState,
     const BoundingVolume& boundingVolume,
-    const Ellipsoid& ellipsoid,
-    bool forceRenderTilesUnderCamera) {
-  if (viewState.isBoundingVolumeVisible(boundingVolume)) {
-    return true;
-  }
-  if (!forceRenderTilesUnderCamera) {
-    return false;
-  }
-
+    const Ellipsoid& ellipsoid) {
   const std::optional<CesiumGeospatial::Cartographic>& position =
       viewState.getPositionCartographic();
 
@@ -681,6 +717,68 @@ static bool isVisibleFromCamera(
   return false;
 }
 
+/**
+ * @brief Returns whether a tile with the given bounding volume is visible in
+ * any of the frustums.
+ *
+ * The plane masks of the tile's parent are used to skip the frustum planes
+ * that the parent was entirely inside of, and the plane masks computed for the
+ * tile are written to `pPlaneMasks` so that its children can do the same.
+ * This relies on the requirement that a tile's bounding volume encloses the
+ * bounding volumes of its children.
+ *
+ * @param frustums The frustums
+ * @param boundingVolume The bounding volume of the tile
+ * @param lastCullingPlane The frustum plane to test first, which is updated
+ * to the plane that culled the tile, if any.
+ * @param ellipsoid The ellipsoid
+ * @param forceRenderTilesUnderCamera Whether tiles under the camera should
+ * always be considered visible and rendered (see
+ * {@link Cesium3DTilesSelection::TilesetOptions}).
+ * @param pParentPlaneMasks The plane mask of the tile's parent in each
+ * frustum, or nullptr if they are not known.
+ * @param pPlaneMasks Receives the plane mask of the tile in each frustum, or
+ * nullptr if they are not needed.
+ * @return Whether the tile is visible according to the current camera
+ * configuration
+ */
+static bool isVisibleFromAnyCamera(
+    const std::vector<ViewState>& frustums,
+    const BoundingVolume& boundingVolume,
+    uint8_t& lastCullingPlane,
+    const Ellipsoid& ellipsoid,
+    bool forceRenderTilesUnderCamera,
+    const uint32_t* pParentPlaneMasks,
+    uint32_t* pPlaneMasks) {
+  bool visible = false;
+  for (size_t i = 0; i < frustums.size(); ++i) {
+    const uint32_t parentPlaneMask = pParentPlaneMasks
+                                         ? pParentPlaneMasks[i]
+                                         : ViewState::PLANE_MASK_INDETERMINATE;
+    const uint32_t planeMask = frustums[i].computeVisibilityWithPlaneMask(
+        boundingVolume,
+        parentPlaneMask,
+        lastCullingPlane);
+    if (pPlaneMasks) {
+      pPlaneMasks[i] = planeMask;
+    } else if (planeMask != ViewState::PLANE_MASK_OUTSIDE) {
+      return true;
+    }
+    visible = visible || planeMask != ViewState::PLANE_MASK_OUTSIDE;
+  }
+
+  if (visible || !forceRenderTilesUnderCamera) {
+    return visible;
+  }
+
+  return std::any_of(
+      frustums.begin(),
+      frustums.end(),
+      [&boundingVolume, &ellipsoid](const ViewState& frustum) {
+        return isUnderCamera(frustum, boundingVolume, ellipsoid);
+      });
+}
+
 /**
  * @brief Returns whether a tile at the given distance is visible in the fog.
  *
@@ -700,55 +798,58 @@ static bool isVisibleInFog(double distance, double fogDensity) noexcept {
 void Tileset::_frustumCull(
     const Tile& tile,
     const FrameState& frameState,
+    uint32_t depth,
     bool cullWithChildrenBounds,
     CullResult& cullResult) {
+  // The plane masks of the tiles currently being visited are stored by depth,
+  // so the masks of this tile's parent are the ones just before this tile's.
+  const size_t frustumCount = frameState.frustums.size();
+  const size_t planeMasksOffset = size_t(depth) * frustumCount;
+  if (this->_planeMasks.size() < planeMasksOffset + frustumCount) {
+    this->_planeMasks.resize(
+        planeMasksOffset + frustumCount,
+        ViewState::PLANE_MASK_INDETERMINATE);
+  }
+  uint32_t* pPlaneMasks = this->_planeMasks.data() + planeMasksOffset;
+  const uint32_t* pParentPlaneMasks =
+      depth > 0 ? pPlaneMasks - frustumCount : nullptr;
 
   if (!cullResult.shouldVisit || cullResult.culled) {
+    // The children of this tile may still be visited, so make sure that they
+    // don't use stale plane masks.
+    std::fill_n(
+        pPlaneMasks,
+        frustumCount,
+        ViewState::PLANE_MASK_INDETERMINATE);
     return;
   }
 
-  const CesiumGeospatial::Ellipsoid& ellipsoid = this->getEllipsoid();
-
-  const std::vector<ViewState>& frustums = frameState.frustums;
   // Frustum cull using the children's bounds.
   if (cullWithChildrenBounds) {
-    if (std::any_of(
-            frustums.begin(),
-            frustums.end(),
-            [&ellipsoid,
-             children = tile.getChildren(),
-             renderTilesUnderCamera = this->_options.renderTilesUnderCamera](
-                const ViewState& frustum) {
-              for (const Tile& child : children) {
-                if (isVisibleFromCamera(
-                        frustum,
-                        child.getBoundingVolume(),
-                        ellipsoid,
-                        renderTilesUnderCamera)) {
-                  return true;
-                }
-              }
-
-              return false;
-            })) {
-      // At least one child is visible in at least one frustum, so don't cull.
-      return;
+    // This tile's own bounding volume isn't tested, but it is enclosed by its
+    // parent's, so the parent's plane masks are valid for it as well.
+    if (pParentPlaneMasks) {
+      std::copy_n(pParentPlaneMasks, frustumCount, pPlaneMasks);
+    } else {
+      std::fill_n(
+          pPlaneMasks,
+          frustumCount,
+          ViewState::PLANE_MASK_INDETERMINATE);
+    }
+
+    for (const Tile& child : tile.getChildren()) {
+      if (this->_isVisible(child, frameState, pPlaneMasks, nullptr)) {
+        // At least one child is visible in at least one frustum, so don't
+        // cull.
+        return;
+      }
     }
     // Frustum cull based on the actual tile's bounds.
-  } else if (std::any_of(
-                 frustums.begin(),
-                 frustums.end(),
-                 [&ellipsoid,
-                  &boundingVolume = tile.getBoundingVolume(),
-                  renderTilesUnderCamera =
-                      this->_options.renderTilesUnderCamera](
-                     const ViewState& frustum) {
-                   return isVisibleFromCamera(
-                       frustum,
-                       boundingVolume,
-                       ellipsoid,
-                       renderTilesUnderCamera);
-                 })) {
+  } else if (this->_isVisible(
+                 tile,
+                 frameState,
+                 pParentPlaneMasks,
+                 pPlaneMasks)) {
     // The tile is visible in at least one frustum, so don't cull.
     return;
   }
@@ -762,31 +863,27 @@ void Tileset::_frustumCull(
   }
 }
 
-void Tileset::_fogCull(
-    const FrameState& frameState,
-    const std::vector<double>& distances,
-    CullResult& cullResult) {
-
-  if (!cullResult.shouldVisit || cullResult.culled) {
-    return;
+static bool isFogCulled(
+    const std::vector<double>& fogDensities,
+    const std::vector<double>& distances) {
+  for (size_t i = 0; i < fogDensities.size() && i < distances.size(); ++i) {
+    if (isVisibleInFog(distances[i], fogDensities[i])) {
+      return false;
+    }
   }
 
-  const std::vector<ViewState>& frustums = frameState.frustums;
-  const std::vector<double>& fogDensities = frameState.fogDensities;
-
-  bool isFogCulled = true;
+  return true;
+}
 
-  for (size_t i = 0; i < frustums.size(); ++i) {
-    const double distance = distances[i];
-    const double fogDensity = fogDensities[i];
+void Tileset::_fogCull(
+    const TileEvaluation& evaluation,
+    CullResult& cullResult) const noexcept {
 
-    if (isVisibleInFog(distance, fogDensity)) {
-      isFogCulled = false;
-      break;
-    }
+  if (!cullResult.shouldVisit || cullResult.culled) {
+    return;
   }
 
-  if (isFogCulled) {
+  if (evaluation.fogCulled) {
     // this tile is occluded by fog so it is a culled tile
     cullResult.culled = true;
     if (this->_options.enableFogCulling) {
@@ -844,12 +941,23 @@ void computeDistances(
       });
 }
 
-bool Tileset::_meetsSse(
-    const std::vector<ViewState>& frustums,
+static double computeDistanceSquaredToNearestFrustum(
     const Tile& tile,
-    const std::vector<double>& distances,
-    bool culled) const noexcept {
+    const std::vector<ViewState>& frustums) {
+  double nearest = std::numeric_limits<double>::max();
+  for (const ViewState& frustum : frustums) {
+    nearest = glm::min(
+        nearest,
+        frustum.computeDistanceSquaredToBoundingVolume(
+            tile.getBoundingVolume()));
+  }
+  return nearest;
+}
 
+static double computeLargestSse(
+    const Tile& tile,
+    const std::vector<ViewState>& frustums,
+    const std::vector<double>& distances) {
   double largestSse = 0.0;
 
   for (size_t i = 0; i < frustums.size() && i < distances.size(); ++i) {
@@ -864,11 +972,249 @@ bool Tileset::_meetsSse(
     }
   }
 
+  return largestSse;
+}
+
+bool Tileset::_meetsSse(double largestSse, bool culled) const noexcept {
   return culled ? !this->_options.enforceCulledScreenSpaceError ||
                       largestSse < this->_options.culledScreenSpaceError
                 : largestSse < this->_options.maximumScreenSpaceError;
 }
 
+Tileset::TileEvaluation Tileset::_evaluateTile(
+    const Tile& tile,
+    const FrameState& frameState,
+    std::vector<double>& distances) const {
+  computeDistances(tile, frameState.frustums, distances);
+
+  TileEvaluation evaluation;
+  evaluation.priority =
+      computeTilePriority(tile, frameState.frustums, distances);
+  evaluation.largestSse =
+      computeLargestSse(tile, frameState.frustums, distances);
+  evaluation.geometricError = tile.getGeometricError();
+  evaluation.fogCulled = isFogCulled(frameState.fogDensities, distances);
+  return evaluation;
+}
+
+const Tileset::PrecomputedTileEvaluation*
+Tileset::_findPrecomputedTileEvaluation(const Tile& tile) const noexcept {
+  const size_t index = size_t(tile._precomputedEvaluationIndex);
+  if (index >= this->_precomputedTileEvaluations.size()) {
+    return nullptr;
+  }
+
+  // The index may be left over from an earlier frame, in which case it refers
+  // to some other tile's evaluation, or none at all.
+  const PrecomputedTileEvaluation& precomputed =
+      this->_precomputedTileEvaluations[index];
+  return precomputed.pTile == &tile ? &precomputed : nullptr;
+}
+
+Tileset::TileEvaluation
+Tileset::_getTileEvaluation(const Tile& tile, const FrameState& frameState) {
+  const PrecomputedTileEvaluation* pPrecomputed =
+      this->_findPrecomputedTileEvaluation(tile);
+  if (pPrecomputed) {
+    return pPrecomputed->evaluation;
+  }
+
+  return this->_evaluateTile(tile, frameState, this->_distances);
+}
+
+bool Tileset::_isVisible(
+    const Tile& tile,
+    const FrameState& frameState,
+    const uint32_t* pParentPlaneMasks,
+    uint32_t* pPlaneMasks) const {
+  const PrecomputedTileEvaluation* pPrecomputed =
+      this->_findPrecomputedTileEvaluation(tile);
+  if (pPrecomputed) {
+    if (pPlaneMasks) {
+      std::fill_n(
+          pPlaneMasks,
+          frameState.frustums.size(),
+          ViewState::PLANE_MASK_INDETERMINATE);
+    }
+    return pPrecomputed->visible;
+  }
+
+  return isVisibleFromAnyCamera(
+      frameState.frustums,
+      tile.getBoundingVolume(),
+      tile._lastCullingPlane,
+      this->getEllipsoid(),
+      this->_options.renderTilesUnderCamera,
+      pParentPlaneMasks,
+      pPlaneMasks);
+}
+
+Tileset::PrecomputedTileEvaluation Tileset::_precomputeTileEvaluation(
+    const Tile& tile,
+    const FrameState& frameState,
+    std::vector<double>& distances,
+    const uint32_t* pParentPlaneMasks,
+    uint32_t* pPlaneMasks) const {
+  PrecomputedTileEvaluation result;
+  result.pTile = &tile;
+  result.evaluation = this->_evaluateTile(tile, frameState, distances);
+  result.visible = isVisibleFromAnyCamera(
+      frameState.frustums,
+      tile.getBoundingVolume(),
+      tile._lastCullingPlane,
+      this->getEllipsoid(),
+      this->_options.renderTilesUnderCamera,
+      pParentPlaneMasks,
+      pPlaneMasks);
+  return result;
+}
+
+bool Tileset::_shouldPrecomputeChildren(
+    const Tile& tile,
+    const PrecomputedTileEvaluation& precomputed) const noexcept {
+  if (tile.getChildren().empty()) {
+    return false;
+  }
+
+  // This only needs to be a good guess of which tiles the selection algorithm
+  // will visit. Any tiles that it visits but that weren't precomputed are
+  // simply evaluated in the main thread instead.
+  if (tile.getUnconditionallyRefine()) {
+    return true;
+  }
+
+  const TileEvaluation& evaluation = precomputed.evaluation;
+  if ((!precomputed.visible && this->_options.enableFrustumCulling) ||
+      (evaluation.fogCulled && this->_options.enableFogCulling)) {
+    return false;
+  }
+
+  const bool culled = !precomputed.visible || evaluation.fogCulled;
+  return !this->_meetsSse(evaluation.largestSse, culled);
+}
+
+void Tileset::_precomputeSubtreeEvaluations(
+    const Tile& tile,
+    const FrameState& frameState,
+    std::vector<double>& distances,
+    std::vector<uint32_t>& planeMasks,
+    std::vector<PrecomputedTileEvaluation>& evaluations) const {
+  // The plane masks of this tile's parent, if any, are the last ones on the
+  // stack. Push this tile's plane masks for its children to use.
+  const size_t frustumCount = frameState.frustums.size();
+  const size_t planeMasksOffset = planeMasks.size();
+  planeMasks.resize(planeMasksOffset + frustumCount);
+  const PrecomputedTileEvaluation precomputed =
+      this->_precomputeTileEvaluation(
+          tile,
+          frameState,
+          distances,
+          planeMasksOffset >= frustumCount
+              ? planeMasks.data() + planeMasksOffset - frustumCount
+              : nullptr,
+          planeMasks.data() + planeMasksOffset);
+  evaluations.emplace_back(precomputed);
+
+  if (this->_shouldPrecomputeChildren(tile, precomputed)) {
+    for (const Tile& child : tile.getChildren()) {
+      this->_precomputeSubtreeEvaluations(
+          child,
+          frameState,
+          distances,
+          planeMasks,
+          evaluations);
+    }
+  }
+
+  planeMasks.resize(planeMasksOffset);
+}
+
+namespace {
+// The number of independent subtrees to find before fanning out to worker
+// threads. This is deliberately larger than a typical number of cores so that
+// the (unevenly sized) subtrees balance out across the thread pool.
+constexpr size_t minimumParallelSubtrees = 64;
+} // namespace
+
+void Tileset::_precomputeTileEvaluationsInParallel(
+    const FrameState& frameState,
+    const Tile& rootTile) {
+  CESIUM_TRACE("Tileset::_precomputeTileEvaluationsInParallel");
+
+  std::vector<PrecomputedTileEvaluation>& evaluations =
+      this->_precomputedTileEvaluations;
+
+  // Walk the top of the tree in the main thread, breadth-first, until there
+  // are enough independent subtrees to keep the worker threads busy.
+  std::vector<const Tile*> subtreeRoots{&rootTile};
+  std::vector<const Tile*> nextSubtreeRoots;
+  while (!subtreeRoots.empty() &&
+         subtreeRoots.size() < minimumParallelSubtrees) {
+    nextSubtreeRoots.clear();
+    for (const Tile* pTile : subtreeRoots) {
+      const PrecomputedTileEvaluation precomputed =
+          this->_precomputeTileEvaluation(
+              *pTile,
+              frameState,
+              this->_distances,
+              nullptr,
+              nullptr);
+      pTile->_precomputedEvaluationIndex = uint32_t(evaluations.size());
+      evaluations.emplace_back(precomputed);
+
+      if (this->_shouldPrecomputeChildren(*pTile, precomputed)) {
+        for (const Tile& child : pTile->getChildren()) {
+          nextSubtreeRoots.push_back(&child);
+        }
+      }
+    }
+
+    std::swap(subtreeRoots, nextSubtreeRoots);
+  }
+
+  if (subtreeRoots.empty()) {
+    return;
+  }
+
+  std::vector<std::vector<PrecomputedTileEvaluation>>& subtreeEvaluations =
+      this->_precomputedSubtreeEvaluations;
+  if (subtreeEvaluations.size() < subtreeRoots.size()) {
+    subtreeEvaluations.resize(subtreeRoots.size());
+  }
+
+  // The main thread evaluates subtrees too, and only waits for the ones that
+  // worker threads have already started. So when the worker threads are busy
+  // loading tiles, it simply evaluates every subtree itself. Main thread tasks
+  // are _not_ dispatched while waiting, because they may modify the tiles that
+  // the worker threads are reading.
+  forEachInParallel(
+      &this->_asyncSystem,
+      subtreeRoots.size(),
+      [this, &subtreeRoots, &subtreeEvaluations, &frameState](size_t i) {
+        std::vector<PrecomputedTileEvaluation>& evaluationsOfSubtree =
+            subtreeEvaluations[i];
+        evaluationsOfSubtree.clear();
+        std::vector<double> distances;
+        std::vector<uint32_t> planeMasks;
+        this->_precomputeSubtreeEvaluations(
+            *subtreeRoots[i],
+            frameState,
+            distances,
+            planeMasks,
+            evaluationsOfSubtree);
+      });
+
+  // The evaluations are pure functions of each tile and the frame state, so
+  // the order in which the subtrees are appended doesn't affect the selection.
+  for (size_t i = 0; i < subtreeRoots.size(); ++i) {
+    for (const PrecomputedTileEvaluation& precomputed : subtreeEvaluations[i]) {
+      precomputed.pTile->_precomputedEvaluationIndex =
+          uint32_t(evaluations.size());
+      evaluations.emplace_back(precomputed);
+    }
+  }
+}
+
 // Visits a tile for possible rendering. When we call this function with a tile:
 //   * It is not yet known whether the tile is visible.
 //   * Its parent tile does _not_ meet the SSE (unless ancestorMeetsSse=true,
@@ -882,14 +1228,22 @@ Tileset::TraversalDetails Tileset::_visitTileIfNeeded(
     Tile& tile,
     ViewUpdateResult& result) {
 
-  std::vector<double>& distances = this->_distances;
-  computeDistances(tile, frameState.frustums, distances);
-  double tilePriority =
-      computeTilePriority(tile, frameState.frustums, distances);
+  TileEvaluation evaluation = this->_getTileEvaluation(tile, frameState);
+  double tilePriority = evaluation.priority;
 
   this->_pTilesetContentManager->updateTileContent(tile, _options);
   this->_markTileVisited(tile);
 
+  // Updating the content may subdivide a leaf tile for its raster overlays,
+  // which gives it a non-zero geometric error. The tile must be judged on its
+  // new geometric error in this frame, or it won't refine until the next one.
+  if (tile.getGeometricError() != evaluation.geometricError) {
+    computeDistances(tile, frameState.frustums, this->_distances);
+    evaluation.largestSse =
+        computeLargestSse(tile, frameState.frustums, this->_distances);
+    evaluation.geometricError = tile.getGeometricError();
+  }
+
   CullResult cullResult{};
 
   // Culling with children bounds will give us incorrect results with Add
@@ -914,8 +1268,13 @@ Tileset::TraversalDetails Tileset::_visitTileIfNeeded(
   }
 
   // TODO: abstract culling stages into composable interface?
-  this->_frustumCull(tile, frameState, cullWithChildrenBounds, cullResult);
-  this->_fogCull(frameState, distances, cullResult);
+  this->_frustumCull(
+      tile,
+      frameState,
+      depth,
+      cullWithChildrenBounds,
+      cullResult);
+  this->_fogCull(evaluation, cullResult);
 
   if (!cullResult.shouldVisit && tile.getUnconditionallyRefine()) {
     // Unconditionally refined tiles must always be visited in forbidHoles
@@ -964,8 +1323,7 @@ Tileset::TraversalDetails Tileset::_visitTileIfNeeded(
     ++result.culledTilesVisited;
   }
 
-  bool meetsSse =
-      this->_meetsSse(frameState.frustums, tile, distances, cullResult.culled);
+  bool meetsSse = this->_meetsSse(evaluation.largestSse, cullResult.culled);
 
   return this->_visitTile(
       frameState,
@@ -1456,9 +1814,41 @@ Tileset::TraversalDetails Tileset::_visitVisibleChildrenNearToFar(
     ViewUpdateResult& result) {
   TraversalDetails traversalDetails;
 
-  // TODO: actually visit near-to-far, rather than in order of occurrence.
+  // Sort the children by their distance to the nearest frustum so that the
+  // closest children are visited first. These are usually the most important
+  // ones, so they get the first shot at the load queue and at the
+  // loadingDescendantLimit.
+  //
+  // The scratch vector is shared by every level of the recursion: each level
+  // appends its children to the end and truncates them again when it is done.
+  // Elements must be accessed by index because visiting a child may grow (and
+  // reallocate) the vector.
+  std::vector<ChildDistance>& nearToFar = this->_childrenNearToFar;
+  const size_t firstChildIndex = nearToFar.size();
+
   gsl::span<Tile> children = tile.getChildren();
   for (Tile& child : children) {
+    nearToFar.push_back(ChildDistance{
+        computeDistanceSquaredToNearestFrustum(child, frameState.frustums),
+        &child});
+  }
+
+  // Ties are broken by the position of the child in the tile's children, so
+  // that the visit order is deterministic.
+  std::sort(
+      nearToFar.begin() +
+          static_cast<std::vector<ChildDistance>::difference_type>(
+              firstChildIndex),
+      nearToFar.end(),
+      [](const ChildDistance& lhs, const ChildDistance& rhs) noexcept {
+        if (lhs.distanceSquared == rhs.distanceSquared)
+          return lhs.pTile < rhs.pTile;
+        return lhs.distanceSquared < rhs.distanceSquared;
+      });
+
+  const size_t endChildIndex = nearToFar.size();
+  for (size_t i = firstChildIndex; i < endChildIndex; ++i) {
+    Tile& child = *nearToFar[i].pTile;
     const TraversalDetails childTraversal = this->_visitTileIfNeeded(
         frameState,
         depth + 1,
@@ -1473,6 +1863,8 @@ Tileset::TraversalDetails Tileset::_visitVisibleChildrenNearToFar(
         childTraversal.notYetRenderableCount;
   }
 
+  nearToFar.resize(firstChildIndex);
+
   return traversalDetails;
 }
 
@@ -1487,14 +1879,20 @@ void Tileset::_processWorkerThreadLoadQueue() {
     return;
   }
 
-  std::sort(
-      this->_workerThreadLoadQueue.begin(),
-      this->_workerThreadLoadQueue.end());
+  // Usually only a handful of the tiles in the queue can start loading this
+  // frame, so rather than sorting the entire queue, arrange it into a heap
+  // and pop the highest priority tiles off of it one at a time. Popped tiles
+  // are moved to the end of the vector, so the heap is the range
+  // [begin, visHeapEnd).
+  std::vector<TileLoadTask>& visQueue = this->_workerThreadLoadQueue;
+  std::make_heap(visQueue.begin(), visQueue.end(), TileLoadTask::heapCompare);
+  auto visHeapEnd = visQueue.end();
+
+  CESIUM_TRACE_COUNTER("workerThreadLoadQueueLength", visQueue.size());
 
   // Select tiles alternately from the two queues. Each frame, switch which
   // queue we pull the first tile from. The goal is to schedule both height
   // query and visualization tile loads fairly.
-  auto visIt = this->_workerThreadLoadQueue.begin();
   auto queryIt = this->_heightQueryLoadQueue.begin();
 
   bool nextIsVis = (this->_previousFrameNumber % 2) == 0;
@@ -1507,11 +1905,14 @@ void Tileset::_processWorkerThreadLoadQueue() {
     int32_t originalNumberOfTilesLoading =
         this->_pTilesetContentManager->getNumberOfTilesLoading();
     if (nextIsVis) {
-      while (visIt != this->_workerThreadLoadQueue.end() &&
+      while (visHeapEnd != visQueue.begin() &&
              originalNumberOfTilesLoading ==
                  this->_pTilesetContentManager->getNumberOfTilesLoading()) {
-        this->_pTilesetContentManager->loadTileContent(*visIt->pTile, _options);
-        ++visIt;
+        std::pop_heap(visQueue.begin(), visHeapEnd, TileLoadTask::heapCompare);
+        --visHeapEnd;
+        this->_pTilesetContentManager->loadTileContent(
+            *visHeapEnd->pTile,
+            _options);
       }
     } else {
       while (queryIt != this->_heightQueryLoadQueue.end() &&
@@ -1522,7 +1923,7 @@ void Tileset::_processWorkerThreadLoadQueue() {
       }
     }
 
-    if (visIt == this->_workerThreadLoadQueue.end() &&
+    if (visHeapEnd == visQueue.begin() &&
         queryIt == this->_heightQueryLoadQueue.end()) {
       // No more work in either queue
       break;
@@ -1531,29 +1932,44 @@ void Tileset::_processWorkerThreadLoadQueue() {
     // Get the next tile from the other queue.
     nextIsVis = !nextIsVis;
   }
+
+  CESIUM_TRACE_COUNTER(
+      "workerThreadLoadQueuePopped",
+      visQueue.end() - visHeapEnd);
 }
 
 void Tileset::_processMainThreadLoadQueue() {
   CESIUM_TRACE("Tileset::_processMainThreadLoadQueue");
   // Process deferred main-thread load tasks with a time budget.
 
-  std::sort(
-      this->_mainThreadLoadQueue.begin(),
-      this->_mainThreadLoadQueue.end());
+  // The time budget usually runs out long before the queue is empty, so pop
+  // tiles off of a heap instead of sorting the entire queue.
+  std::vector<TileLoadTask>& queue = this->_mainThreadLoadQueue;
+  std::make_heap(queue.begin(), queue.end(), TileLoadTask::heapCompare);
+  auto heapEnd = queue.end();
+
+  CESIUM_TRACE_COUNTER("mainThreadLoadQueueLength", queue.size());
+
+  const TilesetMetrics& metrics = this->_pTilesetContentManager->getMetrics();
+  const auto metricsStart = std::chrono::steady_clock::now();
 
   double timeBudget = this->_options.mainThreadLoadingTimeLimit;
 
   auto start = std::chrono::system_clock::now();
   auto end =
       start + std::chrono::milliseconds(static_cast<long long>(timeBudget));
-  for (TileLoadTask& task : this->_mainThreadLoadQueue) {
+  while (heapEnd != queue.begin()) {
+    std::pop_heap(queue.begin(), heapEnd, TileLoadTask::heapCompare);
+    --heapEnd;
+
     // We double-check that the tile is still in the ContentLoaded state here,
     // in case something (such as a child that needs to upsample from this
     // parent) already pushed the tile into the Done state. Because in that
     // case, calling finishLoading here would assert or crash.
-    if (task.pTile->getState() == TileLoadState::ContentLoaded &&
-        task.pTile->isRenderContent()) {
-      this->_pTilesetContentManager->finishLoading(*task.pTile, this->_options);
+    Tile& tile = *heapEnd->pTile;
+    if (tile.getState() == TileLoadState::ContentLoaded &&
+        tile.isRenderContent()) {
+      this->_pTilesetContentManager->finishLoading(tile, this->_options);
     }
     auto time = std::chrono::system_clock::now();
     if (timeBudget > 0.0 && time >= end) {
@@ -1561,15 +1977,43 @@ void Tileset::_processMainThreadLoadQueue() {
     }
   }
 
+  CESIUM_TRACE_COUNTER("mainThreadLoadQueuePopped", queue.end() - heapEnd);
+
+  if (metrics.pSink && !queue.empty()) {
+    metrics.pMainThreadLoadMicroseconds->recordElapsedSince(metricsStart);
+    if (heapEnd != queue.begin()) {
+      // The time budget ran out before the queue was empty.
+      metrics.pMainThreadBudgetOverruns->add();
+    }
+  }
+
   this->_mainThreadLoadQueue.clear();
 }
 
-void Tileset::_unloadCachedTiles(double timeBudget) noexcept {
+void Tileset::_unloadCachedTiles(
+    double timeBudget,
+    ViewUpdateResult& result) noexcept {
   const int64_t maxBytes = this->getOptions().maximumCachedBytes;
 
+  const int64_t startBytes = this->getTotalDataBytes();
+  if (startBytes <= maxBytes) {
+    return;
+  }
+
+  // Once we're over the limit, unload down to the target rather than just
+  // under the limit, so that we don't have to unload again next frame.
+  const int64_t targetBytes = static_cast<int64_t>(
+      static_cast<double>(maxBytes) *
+      glm::clamp(this->getOptions().cacheUnloadTargetFraction, 0.0, 1.0));
+
   const Tile* pRootTile = this->_pTilesetContentManager->getRootTile();
   Tile* pTile = this->_loadedTiles.head();
 
+  // The first tile that could not be unloaded and was moved to the tail of the
+  // list. If we reach it again, every remaining tile has already been
+  // considered this frame.
+  const Tile* pFirstSkippedTile = nullptr;
+
   // A time budget of 0.0 indicates we shouldn't throttle cache unloads. So set
   // the end time to the max time_point in that case.
   auto start = std::chrono::system_clock::now();
@@ -1578,36 +2022,54 @@ void Tileset::_unloadCachedTiles(double timeBudget) noexcept {
                  : (start + std::chrono::milliseconds(
                                 static_cast<long long>(timeBudget)));
 
-  while (this->getTotalDataBytes() > maxBytes) {
-    if (pTile == nullptr || pTile == pRootTile) {
-      // We've either removed all tiles or the next tile is the root.
-      // The root tile marks the beginning of the tiles that were used
-      // for rendering last frame.
-      break;
-    }
+  const std::unordered_set<Tile*>& tilesFadingOut =
+      this->_updateResult.tilesFadingOut;
 
-    // Don't unload this tile if it is still fading out.
-    if (_updateResult.tilesFadingOut.find(pTile) !=
-        _updateResult.tilesFadingOut.end()) {
-      pTile = this->_loadedTiles.next(*pTile);
-      continue;
+  while (this->getTotalDataBytes() > targetBytes) {
+    if (pTile == nullptr || pTile == pRootTile || pTile == pFirstSkippedTile) {
+      // We've either removed all tiles, the next tile is the root, or we've
+      // wrapped around to the tiles we skipped. The root tile marks the
+      // beginning of the tiles that were used for rendering last frame.
+      break;
     }
 
     Tile* pNext = this->_loadedTiles.next(*pTile);
 
+    // Don't unload this tile if it is still fading out.
     const bool removed =
+        (tilesFadingOut.empty() ||
+         tilesFadingOut.find(pTile) == tilesFadingOut.end()) &&
         this->_pTilesetContentManager->unloadTileContent(*pTile);
     if (removed) {
       this->_loadedTiles.remove(*pTile);
+      ++result.tilesEvicted;
+    } else {
+      // This tile can't be unloaded right now, either because it is fading
+      // out, is still loading, or has content that is never unloaded. Move it
+      // to the tail so that it isn't considered again until all of the tiles
+      // that were used less recently have been.
+      this->_loadedTiles.insertAtTail(*pTile);
+      if (pFirstSkippedTile == nullptr) {
+        pFirstSkippedTile = pTile;
+      }
+      ++result.tilesSkippedForEviction;
     }
 
     pTile = pNext;
 
     auto time = std::chrono::system_clock::now();
     if (time >= end) {
+      CesiumUtility::MetricCounter* pOverruns =
+          this->_pTilesetContentManager->getMetrics()
+              .pCacheUnloadBudgetOverruns;
+      if (pOverruns && this->getTotalDataBytes() > targetBytes) {
+        pOverruns->add();
+      }
       break;
     }
   }
+
+  result.bytesEvicted = startBytes - this->getTotalDataBytes();
 }
 
 void Tileset::_markTileVisited(Tile& tile) noexcept {
@@ -19,8 +19,11 @@
 #include <CesiumUtility/joinToString.h>
 
 #include <rapidjson/document.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
 
 #include <chrono>
+#include <string_view>
 
 using namespace CesiumGltfContent;
 using namespace CesiumRasterOverlays;
@@ -75,6 +78,61 @@ struct ContentKindSetter {
   void* pRenderResources;
 };
 
+// Finds whether a JSON file is a tileset.json or a layer.json by reading only
+// its top-level keys, without building a rapidjson::Document. Reading stops as
+// soon as a `root` property is found.
+struct TilesetJsonSniffer : public rapidjson::BaseReaderHandler<
+                                rapidjson::UTF8<>,
+                                TilesetJsonSniffer> {
+  bool StartObject() {
+    ++depth;
+    return true;
+  }
+
+  bool EndObject(rapidjson::SizeType /*memberCount*/) {
+    --depth;
+    return true;
+  }
+
+  bool StartArray() {
+    ++depth;
+    return true;
+  }
+
+  bool EndArray(rapidjson::SizeType /*elementCount*/) {
+    --depth;
+    return true;
+  }
+
+  bool Key(const char* str, rapidjson::SizeType length, bool /*copy*/) {
+    if (depth == 1) {
+      const std::string_view key(str, length);
+      if (key == "root") {
+        hasRoot = true;
+        return false;
+      }
+
+      isFormatNext = key == "format";
+    }
+
+    return true;
+  }
+
+  bool String(const char* str, rapidjson::SizeType length, bool /*copy*/) {
+    // A string at the top level is always the value of the last key.
+    if (depth == 1 && isFormatNext) {
+      format.assign(str, length);
+    }
+
+    return true;
+  }
+
+  int32_t depth = 0;
+  bool isFormatNext = false;
+  bool hasRoot = false;
+  std::string format;
+};
+
 void unloadTileRecursively(
     Tile& tile,
     TilesetContentManager& tilesetContentManager) {
@@ -431,6 +489,7 @@ void calcRasterOverlayDetailsInWorkerThread(
   // the existing one
   auto overlayDetails =
       RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+          tileLoadInfo.asyncSystem,
           model,
           tileLoadInfo.tileTransform,
           pRegion ? std::make_optional(pRegion->getRectangle()) : std::nullopt,
@@ -668,6 +727,7 @@ TilesetContentManager::TilesetContentManager(
       _loadedTilesCount{0},
       _tilesDataUsed{0},
       _pSharedAssetSystem(externals.pSharedAssetSystem),
+      _metrics(externals.pMetricsSink),
       _destructionCompletePromise{externals.asyncSystem.createPromise<void>()},
       _destructionCompleteFuture{
           this->_destructionCompletePromise.getFuture().share()},
@@ -698,6 +758,7 @@ TilesetContentManager::TilesetContentManager(
       _loadedTilesCount{0},
       _tilesDataUsed{0},
       _pSharedAssetSystem(externals.pSharedAssetSystem),
+      _metrics(externals.pMetricsSink),
       _destructionCompletePromise{externals.asyncSystem.createPromise<void>()},
       _destructionCompleteFuture{
           this->_destructionCompletePromise.getFuture().share()},
@@ -718,7 +779,8 @@ TilesetContentManager::TilesetContentManager(
              pLogger = externals.pLogger,
              asyncSystem = externals.asyncSystem,
              pAssetAccessor = externals.pAssetAccessor,
-             contentOptions = tilesetOptions.contentOptions](
+             contentOptions = tilesetOptions.contentOptions,
+             createTilesLazily = tilesetOptions.enableLazyTileCreation](
                 const std::shared_ptr<CesiumAsync::IAssetRequest>&
                     pCompletedRequest) {
               // Check if request is successful
@@ -743,67 +805,68 @@ TilesetContentManager::TilesetContentManager(
                 return asyncSystem.createResolvedFuture(std::move(result));
               }
 
-              // Parse Json response
+              // Check if the json is a tileset.json format or layer.json format
+              // and create corresponding loader
               gsl::span<const std::byte> tilesetJsonBinary = pResponse->data();
-              rapidjson::Document tilesetJson;
-              tilesetJson.Parse(
+              TilesetJsonSniffer sniffer;
+              rapidjson::Reader reader;
+              rapidjson::MemoryStream inputStream(
                   reinterpret_cast<const char*>(tilesetJsonBinary.data()),
                   tilesetJsonBinary.size());
-              if (tilesetJson.HasParseError()) {
+              const rapidjson::ParseResult sniffResult =
+                  reader.Parse(inputStream, sniffer);
+
+              if (sniffer.hasRoot) {
+                // A tileset.json is read in a single streaming pass, unless
+                // its tiles are created lazily.
+                return TilesetJsonLoader::createLoader(
+                           asyncSystem,
+                           pLogger,
+                           url,
+                           tilesetJsonBinary,
+                           ellipsoid,
+                           createTilesLazily)
+                    .thenImmediately(
+                        [](TilesetContentLoaderResult<TilesetJsonLoader>&&
+                               result) { return std::move(result); });
+              }
+
+              if (sniffResult.IsError()) {
                 TilesetContentLoaderResult<TilesetContentLoader> result;
                 result.errors.emplaceError(fmt::format(
                     "Error when parsing tileset JSON, error code {} at byte "
                     "offset {}",
-                    tilesetJson.GetParseError(),
-                    tilesetJson.GetErrorOffset()));
+                    sniffResult.Code(),
+                    sniffResult.Offset()));
                 return asyncSystem.createResolvedFuture(std::move(result));
               }
 
-              // Check if the json is a tileset.json format or layer.json format
-              // and create corresponding loader
-              const auto rootIt = tilesetJson.FindMember("root");
-              if (rootIt != tilesetJson.MemberEnd()) {
-                return TilesetJsonLoader::createLoader(
+              if (sniffer.format == "quantized-mesh-1.0") {
+                rapidjson::Document layerJson;
+                layerJson.Parse(
+                    reinterpret_cast<const char*>(tilesetJsonBinary.data()),
+                    tilesetJsonBinary.size());
+                const CesiumAsync::HttpHeaders& completedRequestHeaders =
+                    pCompletedRequest->headers();
+                std::vector<CesiumAsync::IAssetAccessor::THeader> flatHeaders(
+                    completedRequestHeaders.begin(),
+                    completedRequestHeaders.end());
+                return LayerJsonTerrainLoader::createLoader(
                            asyncSystem,
                            pAssetAccessor,
-                           pLogger,
+                           contentOptions,
                            url,
-                           pCompletedRequest->headers(),
-                           tilesetJson,
+                           flatHeaders,
+                           layerJson,
                            ellipsoid)
                     .thenImmediately(
                         [](TilesetContentLoaderResult<TilesetContentLoader>&&
                                result) { return std::move(result); });
-              } else {
-                const auto formatIt = tilesetJson.FindMember("format");
-                bool isLayerJsonFormat = formatIt != tilesetJson.MemberEnd() &&
-                                         formatIt->value.IsString();
-                isLayerJsonFormat = isLayerJsonFormat &&
-                                    std::string(formatIt->value.GetString()) ==
-                                        "quantized-mesh-1.0";
-                if (isLayerJsonFormat) {
-                  const CesiumAsync::HttpHeaders& completedRequestHeaders =
-                      pCompletedRequest->headers();
-                  std::vector<CesiumAsync::IAssetAccessor::THeader> flatHeaders(
-                      completedRequestHeaders.begin(),
-                      completedRequestHeaders.end());
-                  return LayerJsonTerrainLoader::createLoader(
-                             asyncSystem,
-                             pAssetAccessor,
-                             contentOptions,
-                             url,
-                             flatHeaders,
-                             tilesetJson,
-                             ellipsoid)
-                      .thenImmediately(
-                          [](TilesetContentLoaderResult<TilesetContentLoader>&&
-                                 result) { return std::move(result); });
-                }
-
-                TilesetContentLoaderResult<TilesetContentLoader> result;
-                result.errors.emplaceError("tileset json has unsupport format");
-                return asyncSystem.createResolvedFuture(std::move(result));
               }
+
+              TilesetContentLoaderResult<TilesetContentLoader> result;
+              result.errors.emplaceError("tileset json has unsupport format");
+              return asyncSystem.createResolvedFuture(std::move(result));
             })
         .thenInMainThread(
             [thiz, errorCallback = tilesetOptions.loadErrorCallback](
@@ -850,6 +913,7 @@ TilesetContentManager::TilesetContentManager(
       _loadedTilesCount{0},
       _tilesDataUsed{0},
       _pSharedAssetSystem(externals.pSharedAssetSystem),
+      _metrics(externals.pMetricsSink),
       _destructionCompletePromise{externals.asyncSystem.createPromise<void>()},
       _destructionCompleteFuture{
           this->_destructionCompletePromise.getFuture().share()},
@@ -1000,7 +1064,8 @@ void TilesetContentManager::loadTileContent(
       tile};
 
   TilesetContentLoader* pLoader;
-  if (tile.getLoader() == &this->_upsampler) {
+  const bool upsampled = tile.getLoader() == &this->_upsampler;
+  if (upsampled) {
     pLoader = &this->_upsampler;
   } else {
     pLoader = this->_pLoader.get();
@@ -1018,11 +1083,20 @@ void TilesetContentManager::loadTileContent(
   // Keep the manager alive while the load is in progress.
   CesiumUtility::IntrusivePointer<TilesetContentManager> thiz = this;
 
+  // The manager, and so the metrics, outlive the load.
+  const TilesetMetrics* pMetrics = &this->_metrics;
+  const auto loadStart = std::chrono::steady_clock::now();
+
   pLoader->loadTileContent(loadInput)
       .thenImmediately([tileLoadInfo = std::move(tileLoadInfo),
                         projections = std::move(projections),
-                        rendererOptions = tilesetOptions.rendererOptions](
-                           TileLoadResult&& result) mutable {
+                        rendererOptions = tilesetOptions.rendererOptions,
+                        pMetrics,
+                        upsampled,
+                        loadStart](TileLoadResult&& result) mutable {
+        pMetrics->recordContentFetchAndLoad(result, upsampled, loadStart);
+        pMetrics->recordContentDecode(result);
+
         // the reason we run immediate continuation, instead of in the
         // worker thread, is that the loader may run the task in the main
         // thread. And most often than not, those main thread task is very
@@ -1037,12 +1111,23 @@ void TilesetContentManager::loadTileContent(
                 [result = std::move(result),
                  projections = std::move(projections),
                  tileLoadInfo = std::move(tileLoadInfo),
-                 rendererOptions]() mutable {
+                 rendererOptions,
+                 pMetrics]() mutable {
+                  const auto processStart = std::chrono::steady_clock::now();
                   return postProcessContentInWorkerThread(
-                      std::move(result),
-                      std::move(projections),
-                      std::move(tileLoadInfo),
-                      rendererOptions);
+                             std::move(result),
+                             std::move(projections),
+                             std::move(tileLoadInfo),
+                             rendererOptions)
+                      .thenImmediately(
+                          [pMetrics, processStart](
+                              TileLoadResultAndRenderResources&& pair) {
+                            if (pMetrics->pWorkerThreadProcessingMicroseconds) {
+                              pMetrics->pWorkerThreadProcessingMicroseconds
+                                  ->recordElapsedSince(processStart);
+                            }
+                            return std::move(pair);
+                          });
                 });
           }
         }
@@ -1051,7 +1136,16 @@ void TilesetContentManager::loadTileContent(
             .createResolvedFuture<TileLoadResultAndRenderResources>(
                 {std::move(result), nullptr});
       })
-      .thenInMainThread([&tile, thiz](TileLoadResultAndRenderResources&& pair) {
+      .thenInMainThread([&tile, thiz, loadStart](
+                            TileLoadResultAndRenderResources&& pair) {
+        const TilesetMetrics& metrics = thiz->_metrics;
+        if (metrics.pTileLoadMicroseconds) {
+          metrics.pTileLoadMicroseconds->recordElapsedSince(loadStart);
+          if (pair.result.state == TileLoadResultState::Failed) {
+            metrics.pFailedTileLoads->add();
+          }
+        }
+
         setTileContent(tile, std::move(pair.result), pair.pRenderResources);
 
         thiz->notifyTileDoneLoading(&tile);
@@ -1243,6 +1337,10 @@ TilesetContentManager::getSharedAssetSystem() const noexcept {
   return this->_pSharedAssetSystem;
 }
 
+const TilesetMetrics& TilesetContentManager::getMetrics() const noexcept {
+  return this->_metrics;
+}
+
 int32_t TilesetContentManager::getNumberOfTilesLoading() const noexcept {
   return this->_tileLoadsInProgress;
 }
@@ -1536,6 +1634,9 @@ void TilesetContentManager::unloadDoneState(Tile& tile) {
 void TilesetContentManager::notifyTileStartLoading(
     [[maybe_unused]] const Tile* pTile) noexcept {
   ++this->_tileLoadsInProgress;
+  if (this->_metrics.pTilesLoading) {
+    this->_metrics.pTilesLoading->add(1);
+  }
 }
 
 void TilesetContentManager::notifyTileDoneLoading(const Tile* pTile) noexcept {
@@ -1544,6 +1645,9 @@ void TilesetContentManager::notifyTileDoneLoading(const Tile* pTile) noexcept {
       "There are no tile loads currently in flight");
   --this->_tileLoadsInProgress;
   ++this->_loadedTilesCount;
+  if (this->_metrics.pTilesLoading) {
+    this->_metrics.pTilesLoading->add(-1);
+  }
 
   if (pTile) {
     this->_tilesDataUsed += pTile->computeByteSize();
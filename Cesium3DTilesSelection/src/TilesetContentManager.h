@@ -2,6 +2,7 @@
 
 #include "RasterOverlayUpsampler.h"
 #include "TilesetContentLoaderResult.h"
+#include "TilesetMetrics.h"
 
 #include <Cesium3DTilesSelection/RasterOverlayCollection.h>
 #include <Cesium3DTilesSelection/Tile.h>
@@ -120,6 +121,8 @@ public:
   const CesiumUtility::IntrusivePointer<TilesetSharedAssetSystem>&
   getSharedAssetSystem() const noexcept;
 
+  const TilesetMetrics& getMetrics() const noexcept;
+
   int32_t getNumberOfTilesLoading() const noexcept;
 
   int32_t getNumberOfTilesLoaded() const noexcept;
@@ -175,6 +178,8 @@ private:
   // Stores assets that might be shared between tiles.
   CesiumUtility::IntrusivePointer<TilesetSharedAssetSystem> _pSharedAssetSystem;
 
+  TilesetMetrics _metrics;
+
   CesiumAsync::Promise<void> _destructionCompletePromise;
   CesiumAsync::SharedFuture<void> _destructionCompleteFuture;
 
@@ -0,0 +1,515 @@
+#include "TilesetJsonHandler.h"
+
+#include <Cesium3DTilesSelection/TileContent.h>
+#include <CesiumGeometry/BoundingSphere.h>
+#include <CesiumGeometry/OrientedBoundingBox.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/S2CellBoundingVolume.h>
+#include <CesiumGeospatial/S2CellID.h>
+#include <CesiumUtility/Assert.h>
+
+#include <glm/mat3x3.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+using namespace CesiumJsonReader;
+using namespace CesiumUtility;
+
+namespace Cesium3DTilesSelection {
+
+std::optional<TileRefine>
+parseTileRefine(const std::string& refine, std::string& warning) {
+  if (refine == "REPLACE") {
+    return TileRefine::Replace;
+  }
+  if (refine == "ADD") {
+    return TileRefine::Add;
+  }
+
+  std::string refineUpper = refine;
+  std::transform(
+      refineUpper.begin(),
+      refineUpper.end(),
+      refineUpper.begin(),
+      [](unsigned char c) -> unsigned char {
+        return static_cast<unsigned char>(std::toupper(c));
+      });
+  if (refineUpper == "REPLACE" || refineUpper == "ADD") {
+    warning = "Tile refine value '" + refine + "' should be uppercase: '" +
+              refineUpper + "'";
+    return refineUpper == "REPLACE" ? TileRefine::Replace : TileRefine::Add;
+  }
+
+  warning = "Tile contained an unknown refine value: " + refine;
+  return std::nullopt;
+}
+
+std::optional<BoundingVolume> BoundingVolumeJson::create(
+    const CesiumGeospatial::Ellipsoid& ellipsoid) const {
+  const JsonValue* pS2 =
+      this->extensions.getValuePtrForKey("3DTILES_bounding_volume_S2");
+  if (pS2 && pS2->isObject()) {
+    const JsonValue* pToken = pS2->getValuePtrForKey("token");
+    const JsonValue* pMinimumHeight = pS2->getValuePtrForKey("minimumHeight");
+    const JsonValue* pMaximumHeight = pS2->getValuePtrForKey("maximumHeight");
+    return CesiumGeospatial::S2CellBoundingVolume(
+        CesiumGeospatial::S2CellID::fromToken(
+            pToken ? pToken->getStringOrDefault("1") : "1"),
+        pMinimumHeight ? pMinimumHeight->getSafeNumberOrDefault(0.0) : 0.0,
+        pMaximumHeight ? pMaximumHeight->getSafeNumberOrDefault(0.0) : 0.0,
+        ellipsoid);
+  }
+
+  if (this->box.size() >= 12) {
+    const std::vector<double>& a = this->box;
+    return CesiumGeometry::OrientedBoundingBox(
+        glm::dvec3(a[0], a[1], a[2]),
+        glm::dmat3(a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10], a[11]));
+  }
+
+  if (this->region.size() >= 6) {
+    const std::vector<double>& a = this->region;
+    return CesiumGeospatial::BoundingRegion(
+        CesiumGeospatial::GlobeRectangle(a[0], a[1], a[2], a[3]),
+        a[4],
+        a[5],
+        ellipsoid);
+  }
+
+  if (this->sphere.size() >= 4) {
+    const std::vector<double>& a = this->sphere;
+    return CesiumGeometry::BoundingSphere(glm::dvec3(a[0], a[1], a[2]), a[3]);
+  }
+
+  return std::nullopt;
+}
+
+BoundingVolumeJsonHandler::BoundingVolumeJsonHandler() noexcept
+    : ObjectJsonHandler(), _box(), _region(), _sphere(), _extensions() {}
+
+void BoundingVolumeJsonHandler::reset(
+    IJsonHandler* pParentHandler,
+    BoundingVolumeJson* pObject) {
+  ObjectJsonHandler::reset(pParentHandler);
+  this->_pObject = pObject;
+}
+
+IJsonHandler*
+BoundingVolumeJsonHandler::readObjectKey(const std::string_view& str) {
+  CESIUM_ASSERT(this->_pObject);
+
+  using namespace std::string_view_literals;
+
+  if (str == "box"sv) {
+    return property("box", this->_box, this->_pObject->box);
+  }
+  if (str == "region"sv) {
+    return property("region", this->_region, this->_pObject->region);
+  }
+  if (str == "sphere"sv) {
+    return property("sphere", this->_sphere, this->_pObject->sphere);
+  }
+  if (str == "extensions"sv) {
+    return property(
+        "extensions",
+        this->_extensions,
+        this->_pObject->extensions);
+  }
+
+  return this->ignoreAndContinue();
+}
+
+TileContentJsonHandler::TileContentJsonHandler() noexcept
+    : ObjectJsonHandler(), _uri(), _url(), _boundingVolume() {}
+
+void TileContentJsonHandler::reset(
+    IJsonHandler* pParentHandler,
+    TileContentJson* pObject) {
+  ObjectJsonHandler::reset(pParentHandler);
+  this->_pObject = pObject;
+}
+
+IJsonHandler*
+TileContentJsonHandler::readObjectKey(const std::string_view& str) {
+  CESIUM_ASSERT(this->_pObject);
+
+  using namespace std::string_view_literals;
+
+  if (str == "uri"sv) {
+    return property("uri", this->_uri, this->_pObject->uri);
+  }
+  if (str == "url"sv) {
+    return property("url", this->_url, this->_pObject->url);
+  }
+  if (str == "boundingVolume"sv) {
+    return property(
+        "boundingVolume",
+        this->_boundingVolume,
+        this->_pObject->boundingVolume);
+  }
+
+  return this->ignoreAndContinue();
+}
+
+TileChildrenJsonHandler::TileChildrenJsonHandler(
+    const TilesetJsonHandlerContext& context) noexcept
+    : JsonHandler(), _context(context), _pTileHandler() {}
+
+TileChildrenJsonHandler::~TileChildrenJsonHandler() noexcept = default;
+
+void TileChildrenJsonHandler::reset(
+    IJsonHandler* pParentHandler,
+    std::vector<Tile>* pTiles) {
+  JsonHandler::reset(pParentHandler);
+  this->_pTiles = pTiles;
+  this->_arrayIsOpen = false;
+  this->_index = 0;
+}
+
+IJsonHandler* TileChildrenJsonHandler::readNull() {
+  return this->invalid("A null")->readNull();
+}
+
+IJsonHandler* TileChildrenJsonHandler::readBool(bool b) {
+  return this->invalid("A boolean")->readBool(b);
+}
+
+IJsonHandler* TileChildrenJsonHandler::readInt32(int32_t i) {
+  return this->invalid("An integer")->readInt32(i);
+}
+
+IJsonHandler* TileChildrenJsonHandler::readUint32(uint32_t i) {
+  return this->invalid("An integer")->readUint32(i);
+}
+
+IJsonHandler* TileChildrenJsonHandler::readInt64(int64_t i) {
+  return this->invalid("An integer")->readInt64(i);
+}
+
+IJsonHandler* TileChildrenJsonHandler::readUint64(uint64_t i) {
+  return this->invalid("An integer")->readUint64(i);
+}
+
+IJsonHandler* TileChildrenJsonHandler::readDouble(double d) {
+  return this->invalid("A double (floating-point)")->readDouble(d);
+}
+
+IJsonHandler*
+TileChildrenJsonHandler::readString(const std::string_view& str) {
+  return this->invalid("A string")->readString(str);
+}
+
+IJsonHandler* TileChildrenJsonHandler::readObjectStart() {
+  if (!this->_arrayIsOpen) {
+    return this->invalid("An object")->readObjectStart();
+  }
+
+  if (!this->_pTileHandler) {
+    this->_pTileHandler = std::make_unique<TileJsonHandler>(this->_context);
+  }
+
+  ++this->_index;
+  this->_pTileHandler->reset(this, this->_pTiles);
+  return this->_pTileHandler->readObjectStart();
+}
+
+IJsonHandler* TileChildrenJsonHandler::readArrayStart() {
+  if (this->_arrayIsOpen) {
+    return this->invalid("An array")->readArrayStart();
+  }
+
+  this->_arrayIsOpen = true;
+  return this;
+}
+
+IJsonHandler* TileChildrenJsonHandler::readArrayEnd() {
+  return this->parent();
+}
+
+void TileChildrenJsonHandler::reportWarning(
+    const std::string& warning,
+    std::vector<std::string>&& context) {
+  if (this->_arrayIsOpen && this->_index > 0) {
+    context.emplace_back("[" + std::to_string(this->_index - 1) + "]");
+  }
+  this->parent()->reportWarning(warning, std::move(context));
+}
+
+IJsonHandler* TileChildrenJsonHandler::invalid(const std::string& type) {
+  if (this->_arrayIsOpen) {
+    ++this->_index;
+    this->reportWarning(
+        type + " value is not allowed in the children array and has been "
+               "ignored.");
+    return this->ignoreAndContinue();
+  }
+
+  this->reportWarning(type + " is not allowed and has been ignored.");
+  return this->ignoreAndReturnToParent();
+}
+
+TileJsonHandler::TileJsonHandler(
+    const TilesetJsonHandlerContext& context) noexcept
+    : ObjectJsonHandler(),
+      _context(context),
+      _transformHandler(),
+      _boundingVolumeHandler(),
+      _viewerRequestVolumeHandler(),
+      _geometricErrorHandler(),
+      _refineHandler(),
+      _contentHandler(),
+      _implicitTilingHandler(),
+      _extensionsHandler(),
+      _childrenHandler(context) {}
+
+void TileJsonHandler::reset(
+    IJsonHandler* pParentHandler,
+    std::vector<Tile>* pTiles) {
+  ObjectJsonHandler::reset(pParentHandler);
+  this->_pTiles = pTiles;
+}
+
+IJsonHandler* TileJsonHandler::readObjectStart() {
+  // Reserve this tile's place in the pre-order list of fixups before any of
+  // its descendants take theirs.
+  std::vector<TileJsonFixup>& fixups = *this->_context.pTileFixups;
+  this->_fixupIndex = fixups.size();
+  fixups.emplace_back();
+
+  this->_transform.reset();
+  this->_boundingVolume.reset();
+  this->_viewerRequestVolume.reset();
+  this->_geometricError = std::numeric_limits<double>::quiet_NaN();
+  this->_refine.reset();
+  this->_content.reset();
+  this->_implicitTiling.reset();
+  this->_extensions.reset();
+  this->_children.clear();
+
+  return ObjectJsonHandler::readObjectStart();
+}
+
+IJsonHandler* TileJsonHandler::readObjectKey(const std::string_view& str) {
+  using namespace std::string_view_literals;
+
+  if (str == "transform"sv) {
+    return property("transform", this->_transformHandler, this->_transform);
+  }
+  if (str == "boundingVolume"sv) {
+    return property(
+        "boundingVolume",
+        this->_boundingVolumeHandler,
+        this->_boundingVolume);
+  }
+  if (str == "viewerRequestVolume"sv) {
+    return property(
+        "viewerRequestVolume",
+        this->_viewerRequestVolumeHandler,
+        this->_viewerRequestVolume);
+  }
+  if (str == "geometricError"sv) {
+    return property(
+        "geometricError",
+        this->_geometricErrorHandler,
+        this->_geometricError);
+  }
+  if (str == "refine"sv) {
+    return property("refine", this->_refineHandler, this->_refine);
+  }
+  if (str == "content"sv) {
+    return property("content", this->_contentHandler, this->_content);
+  }
+  if (str == "implicitTiling"sv) {
+    return property(
+        "implicitTiling",
+        this->_implicitTilingHandler,
+        this->_implicitTiling);
+  }
+  if (str == "extensions"sv) {
+    return property("extensions", this->_extensionsHandler, this->_extensions);
+  }
+  if (str == "children"sv) {
+    return property("children", this->_childrenHandler, this->_children);
+  }
+
+  return this->ignoreAndContinue();
+}
+
+IJsonHandler* TileJsonHandler::readObjectEnd() {
+  this->setCurrentKey(nullptr);
+  this->createTile();
+  return ObjectJsonHandler::readObjectEnd();
+}
+
+void TileJsonHandler::createTile() {
+  std::vector<TileJsonFixup>& fixups = *this->_context.pTileFixups;
+  const CesiumGeospatial::Ellipsoid& ellipsoid = *this->_context.pEllipsoid;
+
+  std::optional<BoundingVolume> boundingVolume;
+  if (this->_boundingVolume) {
+    boundingVolume = this->_boundingVolume->create(ellipsoid);
+  }
+
+  if (!boundingVolume) {
+    this->reportWarning(
+        "Tile did not contain a boundingVolume and has been ignored.");
+    fixups.erase(
+        fixups.begin() + std::ptrdiff_t(this->_fixupIndex),
+        fixups.end());
+    this->_children.clear();
+    return;
+  }
+
+  std::optional<TileRefine> refine;
+  if (this->_refine) {
+    std::string warning;
+    refine = parseTileRefine(*this->_refine, warning);
+    if (!warning.empty()) {
+      this->reportWarning(warning);
+    }
+  }
+
+  const std::string* pContentUri = nullptr;
+  if (this->_content) {
+    if (this->_content->uri) {
+      pContentUri = &*this->_content->uri;
+    } else if (this->_content->url) {
+      pContentUri = &*this->_content->url;
+    }
+  }
+
+  // The implicitTiling property takes precedence over the legacy 3D Tiles
+  // Next extension.
+  JsonValue* pImplicitTiling = nullptr;
+  if (this->_implicitTiling && this->_implicitTiling->isObject()) {
+    pImplicitTiling = &*this->_implicitTiling;
+  } else if (this->_extensions) {
+    pImplicitTiling =
+        this->_extensions->getValuePtrForKey("3DTILES_implicit_tiling");
+    if (pImplicitTiling && !pImplicitTiling->isObject()) {
+      pImplicitTiling = nullptr;
+    }
+  }
+
+  TileJsonFixup& fixup = fixups[this->_fixupIndex];
+  fixup.hasRefine = refine.has_value();
+
+  std::optional<Tile> maybeTile;
+  if (pImplicitTiling) {
+    // This is an external tile pointing to an implicit tileset. Its children
+    // are created by the implicit loader instead.
+    maybeTile.emplace(
+        this->_context.pLoader,
+        std::make_unique<TileExternalContent>());
+    maybeTile->setTileID("");
+
+    fixup.pImplicitTiling = std::make_unique<ImplicitTilingJson>();
+    fixup.pImplicitTiling->implicitTiling = std::move(*pImplicitTiling);
+    if (pContentUri) {
+      fixup.pImplicitTiling->contentUri = *pContentUri;
+    }
+
+    fixups.erase(
+        fixups.begin() + std::ptrdiff_t(this->_fixupIndex + 1),
+        fixups.end());
+    this->_children.clear();
+  } else {
+    if (pContentUri) {
+      maybeTile.emplace(this->_context.pLoader);
+      maybeTile->setTileID(*pContentUri);
+    } else {
+      maybeTile.emplace(this->_context.pLoader, TileEmptyContent{});
+      maybeTile->setTileID("");
+    }
+
+    if (this->_content && this->_content->boundingVolume) {
+      maybeTile->setContentBoundingVolume(
+          this->_content->boundingVolume->create(ellipsoid));
+    }
+
+    maybeTile->createChildTiles(std::move(this->_children));
+    this->_children.clear();
+  }
+
+  Tile& tile = *maybeTile;
+  if (this->_transform && this->_transform->size() >= 16) {
+    const std::vector<double>& a = *this->_transform;
+    tile.setTransform(glm::dmat4(
+        glm::dvec4(a[0], a[1], a[2], a[3]),
+        glm::dvec4(a[4], a[5], a[6], a[7]),
+        glm::dvec4(a[8], a[9], a[10], a[11]),
+        glm::dvec4(a[12], a[13], a[14], a[15])));
+  }
+
+  tile.setBoundingVolume(*boundingVolume);
+  if (this->_viewerRequestVolume) {
+    tile.setViewerRequestVolume(this->_viewerRequestVolume->create(ellipsoid));
+  }
+  tile.setGeometricError(this->_geometricError);
+  tile.setRefine(refine.value_or(TileRefine::Replace));
+
+  this->_pTiles->emplace_back(std::move(tile));
+}
+
+TilesetJsonHandler::TilesetJsonHandler(
+    TilesetJsonLoader& loader,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) noexcept
+    : ObjectJsonHandler(),
+      _rootTile(),
+      _context{&loader, &ellipsoid, nullptr},
+      _root(_context),
+      _property() {}
+
+void TilesetJsonHandler::reset(
+    IJsonHandler* pParentHandler,
+    TilesetJson* pObject) {
+  ObjectJsonHandler::reset(pParentHandler);
+  this->_pObject = pObject;
+  this->_context.pTileFixups = &pObject->tileFixups;
+  this->_rootTile.clear();
+}
+
+IJsonHandler*
+TilesetJsonHandler::readObjectKey(const std::string_view& str) {
+  CESIUM_ASSERT(this->_pObject);
+
+  using namespace std::string_view_literals;
+
+  if (str == "root"sv) {
+    this->setCurrentKey("root");
+    this->_rootTile.clear();
+    this->_pObject->tileFixups.clear();
+    this->_root.reset(this, &this->_rootTile);
+    return &this->_root;
+  }
+
+  // Only the properties that are needed once the tiles are created are kept.
+  for (const char* key :
+       {"asset", "schema", "schemaUri", "metadata", "groups"}) {
+    if (key == str) {
+      this->setCurrentKey(key);
+      this->_property.reset(this, &this->_pObject->properties[key]);
+      return &this->_property;
+    }
+  }
+
+  return this->ignoreAndContinue();
+}
+
+IJsonHandler* TilesetJsonHandler::readObjectEnd() {
+  if (!this->_rootTile.empty()) {
+    this->_pObject->rootTile.emplace(std::move(this->_rootTile.back()));
+    this->_rootTile.clear();
+  }
+
+  return ObjectJsonHandler::readObjectEnd();
+}
+
+} // namespace Cesium3DTilesSelection
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <Cesium3DTilesSelection/BoundingVolume.h>
+#include <Cesium3DTilesSelection/Tile.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumJsonReader/ArrayJsonHandler.h>
+#include <CesiumJsonReader/DoubleJsonHandler.h>
+#include <CesiumJsonReader/JsonObjectJsonHandler.h>
+#include <CesiumJsonReader/ObjectJsonHandler.h>
+#include <CesiumJsonReader/StringJsonHandler.h>
+#include <CesiumUtility/JsonValue.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Cesium3DTilesSelection {
+class TilesetJsonLoader;
+
+/**
+ * @brief Parses the value of a tile's `refine` property.
+ *
+ * Lowercase values are accepted, but a warning is written to `warning`.
+ *
+ * @param refine The value of the `refine` property.
+ * @param warning Receives a warning if the value is not strictly valid.
+ * @return The refinement, or `std::nullopt` if the value is unknown.
+ */
+std::optional<TileRefine>
+parseTileRefine(const std::string& refine, std::string& warning);
+
+/**
+ * @brief The `implicitTiling` of a tile read by a {@link TileJsonHandler},
+ * along with the content URI template that goes with it.
+ */
+struct ImplicitTilingJson {
+  CesiumUtility::JsonValue implicitTiling;
+  std::optional<std::string> contentUri;
+};
+
+/**
+ * @brief The properties of a tile read by a {@link TileJsonHandler} that
+ * depend on its ancestors.
+ *
+ * A tile's transform, refinement, and geometric error are relative to, or
+ * inherited from, its parent's. But the parent's properties may appear after
+ * its `children` in the JSON, so a streaming reader creates each {@link Tile}
+ * with only its own properties: its local transform, its untransformed
+ * bounding volumes, and a geometric error of NaN when it has none. These are
+ * resolved afterward in a single top-down pass over the tree, which visits
+ * the tiles in the same order as the fixups.
+ */
+struct TileJsonFixup {
+  /**
+   * @brief Whether the tile has a valid `refine` property. If not, it
+   * inherits its parent's refinement.
+   */
+  bool hasRefine = false;
+
+  /**
+   * @brief The implicit tiling of the tile, if it has any. An implicit tile's
+   * `children` are ignored.
+   */
+  std::unique_ptr<ImplicitTilingJson> pImplicitTiling;
+};
+
+/**
+ * @brief A tileset.json read by a {@link TilesetJsonHandler}.
+ */
+struct TilesetJson {
+  /**
+   * @brief The root tile and its descendants, with the properties that
+   * depend on their ancestors still unresolved.
+   */
+  std::optional<Tile> rootTile;
+
+  /**
+   * @brief The unresolved properties of each tile in {@link rootTile}, in
+   * depth-first pre-order.
+   */
+  std::vector<TileJsonFixup> tileFixups;
+
+  /**
+   * @brief The top-level properties of the tileset other than `root`, such as
+   * `asset`, `schema`, and `metadata`.
+   */
+  CesiumUtility::JsonValue::Object properties;
+};
+
+/**
+ * @brief The state shared by all of the handlers reading a tileset.json.
+ */
+struct TilesetJsonHandlerContext {
+  TilesetJsonLoader* pLoader;
+  const CesiumGeospatial::Ellipsoid* pEllipsoid;
+  std::vector<TileJsonFixup>* pTileFixups;
+};
+
+using DoubleArrayJsonHandler = CesiumJsonReader::
+    ArrayJsonHandler<double, CesiumJsonReader::DoubleJsonHandler>;
+
+struct BoundingVolumeJson {
+  std::vector<double> box;
+  std::vector<double> region;
+  std::vector<double> sphere;
+  CesiumUtility::JsonValue extensions;
+
+  /**
+   * @brief Creates the bounding volume described by this JSON, preferring the
+   * `3DTILES_bounding_volume_S2` extension, then `box`, `region`, and
+   * `sphere`, in that order.
+   */
+  std::optional<BoundingVolume>
+  create(const CesiumGeospatial::Ellipsoid& ellipsoid) const;
+};
+
+class BoundingVolumeJsonHandler : public CesiumJsonReader::ObjectJsonHandler {
+public:
+  using ValueType = BoundingVolumeJson;
+
+  BoundingVolumeJsonHandler() noexcept;
+  void reset(IJsonHandler* pParentHandler, BoundingVolumeJson* pObject);
+
+  virtual IJsonHandler* readObjectKey(const std::string_view& str) override;
+
+private:
+  BoundingVolumeJson* _pObject = nullptr;
+  DoubleArrayJsonHandler _box;
+  DoubleArrayJsonHandler _region;
+  DoubleArrayJsonHandler _sphere;
+  CesiumJsonReader::JsonObjectJsonHandler _extensions;
+};
+
+struct TileContentJson {
+  std::optional<std::string> uri;
+  std::optional<std::string> url;
+  std::optional<BoundingVolumeJson> boundingVolume;
+};
+
+class TileContentJsonHandler : public CesiumJsonReader::ObjectJsonHandler {
+public:
+  using ValueType = TileContentJson;
+
+  TileContentJsonHandler() noexcept;
+  void reset(IJsonHandler* pParentHandler, TileContentJson* pObject);
+
+  virtual IJsonHandler* readObjectKey(const std::string_view& str) override;
+
+private:
+  TileContentJson* _pObject = nullptr;
+  CesiumJsonReader::StringJsonHandler _uri;
+  CesiumJsonReader::StringJsonHandler _url;
+  BoundingVolumeJsonHandler _boundingVolume;
+};
+
+class TileJsonHandler;
+
+/**
+ * @brief Reads the `children` of a tile, creating a {@link Tile} for each
+ * valid child as soon as the end of its JSON object is reached.
+ */
+class TileChildrenJsonHandler : public CesiumJsonReader::JsonHandler {
+public:
+  TileChildrenJsonHandler(const TilesetJsonHandlerContext& context) noexcept;
+  ~TileChildrenJsonHandler() noexcept;
+  void reset(IJsonHandler* pParentHandler, std::vector<Tile>* pTiles);
+
+  virtual IJsonHandler* readNull() override;
+  virtual IJsonHandler* readBool(bool b) override;
+  virtual IJsonHandler* readInt32(int32_t i) override;
+  virtual IJsonHandler* readUint32(uint32_t i) override;
+  virtual IJsonHandler* readInt64(int64_t i) override;
+  virtual IJsonHandler* readUint64(uint64_t i) override;
+  virtual IJsonHandler* readDouble(double d) override;
+  virtual IJsonHandler* readString(const std::string_view& str) override;
+  virtual IJsonHandler* readObjectStart() override;
+  virtual IJsonHandler* readArrayStart() override;
+  virtual IJsonHandler* readArrayEnd() override;
+
+  virtual void reportWarning(
+      const std::string& warning,
+      std::vector<std::string>&& context =
+          std::vector<std::string>()) override;
+
+private:
+  IJsonHandler* invalid(const std::string& type);
+
+  const TilesetJsonHandlerContext& _context;
+  std::vector<Tile>* _pTiles = nullptr;
+  bool _arrayIsOpen = false;
+  size_t _index = 0;
+
+  // Created on first use, so that each level of the tree reuses a single
+  // handler for all of the tiles at that level.
+  std::unique_ptr<TileJsonHandler> _pTileHandler;
+};
+
+/**
+ * @brief Reads a tile and its descendants, appending a {@link Tile} to a
+ * vector when the end of its JSON object is reached.
+ *
+ * A tile without a valid bounding volume is skipped, along with its
+ * descendants, as is the case when reading a `rapidjson::Document`.
+ */
+class TileJsonHandler : public CesiumJsonReader::ObjectJsonHandler {
+public:
+  TileJsonHandler(const TilesetJsonHandlerContext& context) noexcept;
+  void reset(IJsonHandler* pParentHandler, std::vector<Tile>* pTiles);
+
+  virtual IJsonHandler* readObjectStart() override;
+  virtual IJsonHandler* readObjectKey(const std::string_view& str) override;
+  virtual IJsonHandler* readObjectEnd() override;
+
+private:
+  void createTile();
+
+  const TilesetJsonHandlerContext& _context;
+  std::vector<Tile>* _pTiles = nullptr;
+  size_t _fixupIndex = 0;
+
+  std::optional<std::vector<double>> _transform;
+  std::optional<BoundingVolumeJson> _boundingVolume;
+  std::optional<BoundingVolumeJson> _viewerRequestVolume;
+  double _geometricError = 0.0;
+  std::optional<std::string> _refine;
+  std::optional<TileContentJson> _content;
+  std::optional<CesiumUtility::JsonValue> _implicitTiling;
+  std::optional<CesiumUtility::JsonValue> _extensions;
+  std::vector<Tile> _children;
+
+  DoubleArrayJsonHandler _transformHandler;
+  BoundingVolumeJsonHandler _boundingVolumeHandler;
+  BoundingVolumeJsonHandler _viewerRequestVolumeHandler;
+  CesiumJsonReader::DoubleJsonHandler _geometricErrorHandler;
+  CesiumJsonReader::StringJsonHandler _refineHandler;
+  TileContentJsonHandler _contentHandler;
+  CesiumJsonReader::JsonObjectJsonHandler _implicitTilingHandler;
+  CesiumJsonReader::JsonObjectJsonHandler _extensionsHandler;
+  TileChildrenJsonHandler _childrenHandler;
+};
+
+/**
+ * @brief Reads a tileset.json with `CesiumJsonReader::JsonReader`, creating
+ * its tiles as it goes rather than building a `rapidjson::Document` first.
+ *
+ * Only one set of tile handlers exists for each level of the tree, and the
+ * JSON of each tile is discarded as soon as its {@link Tile} is created, so
+ * the memory used beyond that of the tiles themselves is proportional to the
+ * depth of the tree rather than to the size of the JSON.
+ */
+class TilesetJsonHandler : public CesiumJsonReader::ObjectJsonHandler {
+public:
+  using ValueType = TilesetJson;
+
+  /**
+   * @brief Creates a handler for a tileset.json.
+   *
+   * @param loader The loader of the tiles that are read.
+   * @param ellipsoid The ellipsoid of the bounding regions and S2 cells of
+   * the tiles.
+   */
+  TilesetJsonHandler(
+      TilesetJsonLoader& loader,
+      const CesiumGeospatial::Ellipsoid& ellipsoid) noexcept;
+
+  void reset(IJsonHandler* pParentHandler, TilesetJson* pObject);
+
+  virtual IJsonHandler* readObjectKey(const std::string_view& str) override;
+  virtual IJsonHandler* readObjectEnd() override;
+
+private:
+  TilesetJson* _pObject = nullptr;
+  std::vector<Tile> _rootTile;
+  TilesetJsonHandlerContext _context;
+  TileJsonHandler _root;
+  CesiumJsonReader::JsonObjectJsonHandler _property;
+};
+
+} // namespace Cesium3DTilesSelection
@@ -2,6 +2,7 @@
 
 #include "ImplicitOctreeLoader.h"
 #include "ImplicitQuadtreeLoader.h"
+#include "TilesetJsonHandler.h"
 #include "logTileLoadResult.h"
 
 #include <Cesium3DTilesContent/GltfConverters.h>
@@ -15,6 +16,7 @@
 #include <CesiumGeometry/OrientedBoundingBox.h>
 #include <CesiumGeospatial/BoundingRegion.h>
 #include <CesiumGeospatial/S2CellBoundingVolume.h>
+#include <CesiumJsonReader/JsonReader.h>
 #include <CesiumUtility/Assert.h>
 #include <CesiumUtility/JsonHelpers.h>
 #include <CesiumUtility/Log.h>
@@ -23,7 +25,9 @@
 
 #include <rapidjson/document.h>
 
-#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 
 using namespace CesiumUtility;
 using namespace Cesium3DTilesContent;
@@ -394,6 +398,13 @@ void parseImplicitTileset(
   }
 }
 
+/**
+ * @brief Creates a tile and its descendants from the tile's JSON.
+ *
+ * If `ppLatentChildren` is not null, the tile's children are not created.
+ * Instead, it receives the tile's `children` JSON, or null if the tile has no
+ * children, so that they can be created later.
+ */
 std::optional<Tile> parseTileJsonRecursively(
     const std::shared_ptr<spdlog::logger>& pLogger,
     const rapidjson::Value& tileJson,
@@ -401,7 +412,8 @@ std::optional<Tile> parseTileJsonRecursively(
     TileRefine parentRefine,
     double parentGeometricError,
     TilesetJsonLoader& currentLoader,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    const rapidjson::Value** ppLatentChildren) {
   if (!tileJson.IsObject()) {
     return std::nullopt;
   }
@@ -454,36 +466,13 @@ std::optional<Tile> parseTileJsonRecursively(
   TileRefine tileRefine = parentRefine;
   const auto refineIt = tileJson.FindMember("refine");
   if (refineIt != tileJson.MemberEnd() && refineIt->value.IsString()) {
-    std::string refine = refineIt->value.GetString();
-    if (refine == "REPLACE") {
-      tileRefine = TileRefine::Replace;
-    } else if (refine == "ADD") {
-      tileRefine = TileRefine::Add;
-    } else {
-      std::string refineUpper = refine;
-      std::transform(
-          refineUpper.begin(),
-          refineUpper.end(),
-          refineUpper.begin(),
-          [](unsigned char c) -> unsigned char {
-            return static_cast<unsigned char>(std::toupper(c));
-          });
-      if (refineUpper == "REPLACE" || refineUpper == "ADD") {
-        SPDLOG_LOGGER_WARN(
-            pLogger,
-            "Tile refine value '{}' should be uppercase: '{}'",
-            refine,
-            refineUpper);
-        tileRefine =
-            refineUpper == "REPLACE" ? TileRefine::Replace : TileRefine::Add;
-      } else {
-        SPDLOG_LOGGER_WARN(
-            pLogger,
-            "Tile contained an unknown refine value: {}",
-            refine);
-      }
+    std::string warning;
+    std::optional<TileRefine> refine =
+        parseTileRefine(refineIt->value.GetString(), warning);
+    if (!warning.empty()) {
+      SPDLOG_LOGGER_WARN(pLogger, "{}", warning);
     }
-  } else {
+    tileRefine = refine.value_or(parentRefine);
   }
 
   // Parse content member to determine tile content Url.
@@ -552,10 +541,15 @@ std::optional<Tile> parseTileJsonRecursively(
     }
   }
 
-  // parse tile's children
+  // parse tile's children, unless they are to be created later
   std::vector<Tile> childTiles;
   const auto childrenIt = tileJson.FindMember("children");
-  if (childrenIt != tileJson.MemberEnd() && childrenIt->value.IsArray()) {
+  const bool hasChildren = childrenIt != tileJson.MemberEnd() &&
+                           childrenIt->value.IsArray() &&
+                           !childrenIt->value.Empty();
+  if (hasChildren && ppLatentChildren) {
+    *ppLatentChildren = &childrenIt->value;
+  } else if (hasChildren) {
     const auto& childrenJson = childrenIt->value;
     childTiles.reserve(childrenJson.Size());
     for (rapidjson::SizeType i = 0; i < childrenJson.Size(); ++i) {
@@ -567,7 +561,8 @@ std::optional<Tile> parseTileJsonRecursively(
           tileRefine,
           tileGeometricError,
           currentLoader,
-          ellipsoid);
+          ellipsoid,
+          nullptr);
 
       if (maybeChild) {
         childTiles.emplace_back(std::move(*maybeChild));
@@ -608,7 +603,8 @@ TilesetContentLoaderResult<TilesetJsonLoader> parseTilesetJson(
     const rapidjson::Document& tilesetJson,
     const glm::dmat4& parentTransform,
     TileRefine parentRefine,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    bool createTilesLazily) {
   std::unique_ptr<Tile> pRootTile;
   auto gltfUpAxis = obtainGltfUpAxis(tilesetJson, pLogger);
   auto pLoader =
@@ -616,6 +612,7 @@ TilesetContentLoaderResult<TilesetJsonLoader> parseTilesetJson(
   const auto rootIt = tilesetJson.FindMember("root");
   if (rootIt != tilesetJson.MemberEnd()) {
     const rapidjson::Value& rootJson = rootIt->value;
+    const rapidjson::Value* pLatentChildren = nullptr;
     auto maybeRootTile = parseTileJsonRecursively(
         pLogger,
         rootJson,
@@ -623,7 +620,19 @@ TilesetContentLoaderResult<TilesetJsonLoader> parseTilesetJson(
         parentRefine,
         10000000.0,
         *pLoader,
-        ellipsoid);
+        ellipsoid,
+        createTilesLazily ? &pLatentChildren : nullptr);
+
+    if (maybeRootTile && pLatentChildren) {
+      // The root tile is moved before it's added to the tree, so its children
+      // can't be identified by its address later. Create them now instead.
+      maybeRootTile->createChildTiles(pLoader->createLatentChildren(
+          pLogger,
+          *maybeRootTile,
+          *pLatentChildren,
+          maybeRootTile->getGeometricError(),
+          ellipsoid));
+    }
 
     if (maybeRootTile) {
       pRootTile = std::make_unique<Tile>(std::move(*maybeRootTile));
@@ -676,6 +685,316 @@ void parseTilesetMetadata(
   }
 }
 
+rapidjson::Value toRapidJsonValue(
+    const JsonValue& value,
+    rapidjson::Document::AllocatorType& allocator) {
+  if (const bool* pBool = std::get_if<bool>(&value.value)) {
+    return rapidjson::Value(*pBool);
+  }
+  if (const double* pDouble = std::get_if<double>(&value.value)) {
+    return rapidjson::Value(*pDouble);
+  }
+  if (const int64_t* pInt64 = std::get_if<int64_t>(&value.value)) {
+    return rapidjson::Value(*pInt64);
+  }
+  if (const uint64_t* pUint64 = std::get_if<uint64_t>(&value.value)) {
+    return rapidjson::Value(*pUint64);
+  }
+  if (const JsonValue::String* pString =
+          std::get_if<JsonValue::String>(&value.value)) {
+    return rapidjson::Value(
+        pString->data(),
+        rapidjson::SizeType(pString->size()),
+        allocator);
+  }
+  if (const JsonValue::Object* pObject =
+          std::get_if<JsonValue::Object>(&value.value)) {
+    rapidjson::Value result(rapidjson::kObjectType);
+    for (const auto& [key, member] : *pObject) {
+      rapidjson::Value keyJson(
+          key.data(),
+          rapidjson::SizeType(key.size()),
+          allocator);
+      rapidjson::Value memberJson = toRapidJsonValue(member, allocator);
+      result.AddMember(keyJson, memberJson, allocator);
+    }
+    return result;
+  }
+  if (const JsonValue::Array* pArray =
+          std::get_if<JsonValue::Array>(&value.value)) {
+    rapidjson::Value result(rapidjson::kArrayType);
+    result.Reserve(rapidjson::SizeType(pArray->size()), allocator);
+    for (const JsonValue& element : *pArray) {
+      rapidjson::Value elementJson = toRapidJsonValue(element, allocator);
+      result.PushBack(elementJson, allocator);
+    }
+    return result;
+  }
+
+  return rapidjson::Value(rapidjson::kNullType);
+}
+
+/**
+ * @brief Resolves the properties of a tile created by a
+ * {@link TilesetJsonHandler} that depend on its ancestors, and then does the
+ * same for its descendants.
+ *
+ * This gives each tile the same properties that
+ * {@link parseTileJsonRecursively} would have.
+ */
+void resolveTileJsonFixups(
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    Tile& tile,
+    std::vector<TileJsonFixup>& fixups,
+    size_t& fixupIndex,
+    const glm::dmat4& parentTransform,
+    TileRefine parentRefine,
+    double parentGeometricError,
+    TilesetJsonLoader& currentLoader) {
+  CESIUM_ASSERT(fixupIndex < fixups.size());
+  const TileJsonFixup& fixup = fixups[fixupIndex++];
+
+  const glm::dmat4x4 tileTransform = parentTransform * tile.getTransform();
+  tile.setTransform(tileTransform);
+  tile.setBoundingVolume(
+      transformBoundingVolume(tileTransform, tile.getBoundingVolume()));
+
+  const std::optional<BoundingVolume>& viewerRequestVolume =
+      tile.getViewerRequestVolume();
+  if (viewerRequestVolume) {
+    tile.setViewerRequestVolume(
+        transformBoundingVolume(tileTransform, *viewerRequestVolume));
+  }
+
+  const std::optional<BoundingVolume>& contentBoundingVolume =
+      tile.getContentBoundingVolume();
+  if (contentBoundingVolume) {
+    tile.setContentBoundingVolume(
+        transformBoundingVolume(tileTransform, *contentBoundingVolume));
+  }
+
+  double geometricError = tile.getGeometricError();
+  if (std::isnan(geometricError)) {
+    geometricError = parentGeometricError * 0.5;
+    SPDLOG_LOGGER_WARN(
+        pLogger,
+        "Tile did not contain a geometricError. "
+        "Using half of the parent tile's geometric error.");
+  }
+
+  const glm::dvec3 scale = glm::dvec3(
+      glm::length(tileTransform[0]),
+      glm::length(tileTransform[1]),
+      glm::length(tileTransform[2]));
+  const double maxScaleComponent =
+      glm::max(scale.x, glm::max(scale.y, scale.z));
+  tile.setGeometricError(geometricError * maxScaleComponent);
+
+  if (!fixup.hasRefine) {
+    tile.setRefine(parentRefine);
+  }
+
+  if (fixup.pImplicitTiling) {
+    rapidjson::Document document;
+    const rapidjson::Value implicitTilingJson = toRapidJsonValue(
+        fixup.pImplicitTiling->implicitTiling,
+        document.GetAllocator());
+    const std::optional<std::string>& contentUri =
+        fixup.pImplicitTiling->contentUri;
+    parseImplicitTileset(
+        implicitTilingJson,
+        contentUri ? contentUri->c_str() : nullptr,
+        tile,
+        currentLoader);
+    return;
+  }
+
+  for (Tile& child : tile.getChildren()) {
+    resolveTileJsonFixups(
+        pLogger,
+        child,
+        fixups,
+        fixupIndex,
+        tileTransform,
+        tile.getRefine(),
+        tile.getGeometricError(),
+        currentLoader);
+  }
+}
+
+/**
+ * @brief Reads a tileset.json with a {@link TilesetJsonHandler}, without
+ * building a `rapidjson::Document` of the whole tileset first.
+ *
+ * This creates the same tiles as {@link parseTilesetJson}, and populates the
+ * given external content with the tileset's metadata, as
+ * {@link parseTilesetMetadata} does.
+ */
+TilesetContentLoaderResult<TilesetJsonLoader> readTilesetJson(
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    const std::string& baseUrl,
+    const gsl::span<const std::byte>& data,
+    const glm::dmat4& parentTransform,
+    TileRefine parentRefine,
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    TileExternalContent& externalContent) {
+  auto pLoader = std::make_unique<TilesetJsonLoader>(
+      baseUrl,
+      CesiumGeometry::Axis::Y,
+      ellipsoid);
+
+  TilesetJsonHandler handler(*pLoader, ellipsoid);
+  CesiumJsonReader::ReadJsonResult<TilesetJson> tilesetJson =
+      CesiumJsonReader::JsonReader::readJson(data, handler);
+  if (!tilesetJson.value) {
+    TilesetContentLoaderResult<TilesetJsonLoader> result;
+    for (const std::string& error : tilesetJson.errors) {
+      result.errors.emplaceError(
+          fmt::format("Error when parsing tileset JSON: {}", error));
+    }
+    return result;
+  }
+
+  for (const std::string& warning : tilesetJson.warnings) {
+    SPDLOG_LOGGER_WARN(pLogger, "{}", warning);
+  }
+
+  // The top-level properties other than the root tile are small, so they are
+  // read with the same functions as a full rapidjson::Document.
+  rapidjson::Document properties;
+  properties.SetObject();
+  for (const auto& [key, value] : tilesetJson.value->properties) {
+    rapidjson::Value keyJson(
+        key.data(),
+        rapidjson::SizeType(key.size()),
+        properties.GetAllocator());
+    rapidjson::Value valueJson =
+        toRapidJsonValue(value, properties.GetAllocator());
+    properties.AddMember(keyJson, valueJson, properties.GetAllocator());
+  }
+
+  pLoader->setUpAxis(obtainGltfUpAxis(properties, pLogger));
+  parseTilesetMetadata(baseUrl, properties, externalContent);
+
+  std::unique_ptr<Tile> pRootTile;
+  std::optional<Tile>& maybeRootTile = tilesetJson.value->rootTile;
+  if (maybeRootTile) {
+    size_t fixupIndex = 0;
+    resolveTileJsonFixups(
+        pLogger,
+        *maybeRootTile,
+        tilesetJson.value->tileFixups,
+        fixupIndex,
+        parentTransform,
+        parentRefine,
+        10000000.0,
+        *pLoader);
+    pRootTile = std::make_unique<Tile>(std::move(*maybeRootTile));
+  }
+
+  return {
+      std::move(pLoader),
+      std::move(pRootTile),
+      std::vector<LoaderCreditResult>{},
+      std::vector<CesiumAsync::IAssetAccessor::THeader>{},
+      ErrorList{}};
+}
+
+/**
+ * @brief Creates the root tile of a parsed tileset.json and its children, and
+ * has the loader retain the JSON so that the other tiles can be created when
+ * they are first needed.
+ *
+ * This populates the given external content with the tileset's metadata, as
+ * {@link parseTilesetMetadata} does.
+ */
+TilesetContentLoaderResult<TilesetJsonLoader> parseTilesetJsonLazily(
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    const std::string& baseUrl,
+    const std::shared_ptr<const rapidjson::Document>& pTilesetJson,
+    const glm::dmat4& parentTransform,
+    TileRefine parentRefine,
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    TileExternalContent& externalContent) {
+  TilesetContentLoaderResult<TilesetJsonLoader> result = parseTilesetJson(
+      pLogger,
+      baseUrl,
+      *pTilesetJson,
+      parentTransform,
+      parentRefine,
+      ellipsoid,
+      true);
+  parseTilesetMetadata(baseUrl, *pTilesetJson, externalContent);
+  result.pLoader->retainTilesetJson(pLogger, pTilesetJson);
+  return result;
+}
+
+/**
+ * @brief Parses a tileset.json and creates its tiles with
+ * {@link parseTilesetJsonLazily}.
+ */
+TilesetContentLoaderResult<TilesetJsonLoader> readTilesetJsonLazily(
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    const std::string& baseUrl,
+    const gsl::span<const std::byte>& data,
+    const glm::dmat4& parentTransform,
+    TileRefine parentRefine,
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    TileExternalContent& externalContent) {
+  auto pTilesetJson = std::make_shared<rapidjson::Document>();
+  pTilesetJson->Parse(reinterpret_cast<const char*>(data.data()), data.size());
+  if (pTilesetJson->HasParseError()) {
+    TilesetContentLoaderResult<TilesetJsonLoader> result;
+    result.errors.emplaceError(fmt::format(
+        "Error when parsing tileset JSON, error code {} at byte offset {}",
+        pTilesetJson->GetParseError(),
+        pTilesetJson->GetErrorOffset()));
+    return result;
+  }
+
+  if (!pTilesetJson->IsObject()) {
+    TilesetContentLoaderResult<TilesetJsonLoader> result;
+    result.errors.emplaceError("Tileset JSON must be an object");
+    return result;
+  }
+
+  return parseTilesetJsonLazily(
+      pLogger,
+      baseUrl,
+      pTilesetJson,
+      parentTransform,
+      parentRefine,
+      ellipsoid,
+      externalContent);
+}
+
+/**
+ * @brief Replaces the root tile of the result with one that represents the
+ * tileset.json itself, with the given content, whose only child is the
+ * original root tile.
+ */
+void createExternalRootTile(
+    TilesetContentLoaderResult<TilesetJsonLoader>& result,
+    TileExternalContent&& externalContent) {
+  if (!result.pRootTile) {
+    return;
+  }
+
+  std::vector<Tile> children;
+  children.emplace_back(std::move(*result.pRootTile));
+
+  result.pRootTile = std::make_unique<Tile>(
+      children[0].getLoader(),
+      std::make_unique<TileExternalContent>(std::move(externalContent)));
+
+  result.pRootTile->setTileID("");
+  result.pRootTile->setTransform(children[0].getTransform());
+  result.pRootTile->setBoundingVolume(children[0].getBoundingVolume());
+  result.pRootTile->setUnconditionallyRefine();
+  result.pRootTile->setRefine(children[0].getRefine());
+  result.pRootTile->createChildTiles(std::move(children));
+}
+
 TileLoadResult parseExternalTilesetInWorkerThread(
     const glm::dmat4& tileTransform,
     CesiumGeometry::Axis upAxis,
@@ -683,41 +1002,24 @@ TileLoadResult parseExternalTilesetInWorkerThread(
     const std::shared_ptr<spdlog::logger>& pLogger,
     std::shared_ptr<CesiumAsync::IAssetRequest>&& pCompletedRequest,
     ExternalContentInitializer&& externalContentInitializer,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    bool createTilesLazily) {
   // create external tileset
   const CesiumAsync::IAssetResponse* pResponse = pCompletedRequest->response();
   const auto& responseData = pResponse->data();
   const auto& tileUrl = pCompletedRequest->url();
 
-  rapidjson::Document tilesetJson;
-  tilesetJson.Parse(
-      reinterpret_cast<const char*>(responseData.data()),
-      responseData.size());
-  if (tilesetJson.HasParseError()) {
-    SPDLOG_LOGGER_ERROR(
-        pLogger,
-        "Error when parsing tileset JSON, error code {} at byte offset {}",
-        tilesetJson.GetParseError(),
-        tilesetJson.GetErrorOffset());
-    return TileLoadResult::createFailedResult(std::move(pCompletedRequest));
-  }
-
   // Save the parsed external tileset into custom data.
   // We will propagate it back to tile later in the main
   // thread
-  TilesetContentLoaderResult<TilesetJsonLoader> externalTilesetLoader =
-      parseTilesetJson(
-          pLogger,
-          tileUrl,
-          tilesetJson,
-          tileTransform,
-          tileRefine,
-          ellipsoid);
-
-  // Populate the root tile with metadata
-  parseTilesetMetadata(
+  auto read = createTilesLazily ? readTilesetJsonLazily : readTilesetJson;
+  TilesetContentLoaderResult<TilesetJsonLoader> externalTilesetLoader = read(
+      pLogger,
       tileUrl,
-      tilesetJson,
+      responseData,
+      tileTransform,
+      tileRefine,
+      ellipsoid,
       externalContentInitializer.externalContent);
 
   // check and log any errors
@@ -759,13 +1061,14 @@ TilesetJsonLoader::createLoader(
     const TilesetExternals& externals,
     const std::string& tilesetJsonUrl,
     const std::vector<CesiumAsync::IAssetAccessor::THeader>& requestHeaders,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    bool createTilesLazily) {
 
   return externals.pAssetAccessor
       ->get(externals.asyncSystem, tilesetJsonUrl, requestHeaders)
       .thenInWorkerThread([ellipsoid,
+                           createTilesLazily,
                            asyncSystem = externals.asyncSystem,
-                           pAssetAccessor = externals.pAssetAccessor,
                            pLogger = externals.pLogger](
                               const std::shared_ptr<CesiumAsync::IAssetRequest>&
                                   pCompletedRequest) {
@@ -791,33 +1094,41 @@ TilesetJsonLoader::createLoader(
           return asyncSystem.createResolvedFuture(std::move(result));
         }
 
-        gsl::span<const std::byte> data = pResponse->data();
-
-        rapidjson::Document tilesetJson;
-        tilesetJson.Parse(
-            reinterpret_cast<const char*>(data.data()),
-            data.size());
-        if (tilesetJson.HasParseError()) {
-          TilesetContentLoaderResult<TilesetJsonLoader> result;
-          result.errors.emplaceError(fmt::format(
-              "Error when parsing tileset JSON, error code {} at byte offset "
-              "{}",
-              tilesetJson.GetParseError(),
-              tilesetJson.GetErrorOffset()));
-          return asyncSystem.createResolvedFuture(std::move(result));
-        }
-
         return TilesetJsonLoader::createLoader(
             asyncSystem,
-            pAssetAccessor,
             pLogger,
-            pCompletedRequest->url(),
-            pCompletedRequest->headers(),
-            tilesetJson,
-            ellipsoid);
+            tileUrl,
+            pResponse->data(),
+            ellipsoid,
+            createTilesLazily);
       });
 }
 
+CesiumAsync::Future<TilesetContentLoaderResult<TilesetJsonLoader>>
+TilesetJsonLoader::createLoader(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    const std::string& tilesetJsonUrl,
+    const gsl::span<const std::byte>& tilesetJson,
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    bool createTilesLazily) {
+  TileExternalContent externalContent;
+  auto read = createTilesLazily ? readTilesetJsonLazily : readTilesetJson;
+  TilesetContentLoaderResult<TilesetJsonLoader> result = read(
+      pLogger,
+      tilesetJsonUrl,
+      tilesetJson,
+      glm::dmat4(1.0),
+      TileRefine::Replace,
+      ellipsoid,
+      externalContent);
+  if (!result.errors) {
+    createExternalRootTile(result, std::move(externalContent));
+  }
+
+  return asyncSystem.createResolvedFuture(std::move(result));
+}
+
 CesiumAsync::Future<TilesetContentLoaderResult<TilesetJsonLoader>>
 TilesetJsonLoader::createLoader(
     const CesiumAsync::AsyncSystem& asyncSystem,
@@ -833,30 +1144,37 @@ TilesetJsonLoader::createLoader(
       tilesetJson,
       glm::dmat4(1.0),
       TileRefine::Replace,
-      ellipsoid);
+      ellipsoid,
+      false);
 
-  // Create a root tile to represent the tileset.json itself.
-  std::vector<Tile> children;
-  children.emplace_back(std::move(*result.pRootTile));
-
-  result.pRootTile = std::make_unique<Tile>(
-      children[0].getLoader(),
-      std::make_unique<TileExternalContent>());
+  // Create a root tile to represent the tileset.json itself, populated with
+  // the tileset's metadata.
+  TileExternalContent externalContent;
+  parseTilesetMetadata(tilesetJsonUrl, tilesetJson, externalContent);
+  createExternalRootTile(result, std::move(externalContent));
 
-  result.pRootTile->setTileID("");
-  result.pRootTile->setTransform(children[0].getTransform());
-  result.pRootTile->setBoundingVolume(children[0].getBoundingVolume());
-  result.pRootTile->setUnconditionallyRefine();
-  result.pRootTile->setRefine(children[0].getRefine());
-  result.pRootTile->createChildTiles(std::move(children));
+  return asyncSystem.createResolvedFuture(std::move(result));
+}
 
-  // Populate the root tile with metadata
-  TileExternalContent* pExternal =
-      result.pRootTile->getContent().getExternalContent();
-  CESIUM_ASSERT(pExternal);
-  if (pExternal) {
-    parseTilesetMetadata(tilesetJsonUrl, tilesetJson, *pExternal);
-  }
+CesiumAsync::Future<TilesetContentLoaderResult<TilesetJsonLoader>>
+TilesetJsonLoader::createLoader(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    const std::shared_ptr<CesiumAsync::IAssetAccessor>& /*pAssetAccessor*/,
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    const std::string& tilesetJsonUrl,
+    const CesiumAsync::HttpHeaders& /*requestHeaders*/,
+    const std::shared_ptr<const rapidjson::Document>& pTilesetJson,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  TileExternalContent externalContent;
+  TilesetContentLoaderResult<TilesetJsonLoader> result = parseTilesetJsonLazily(
+      pLogger,
+      tilesetJsonUrl,
+      pTilesetJson,
+      glm::dmat4(1.0),
+      TileRefine::Replace,
+      ellipsoid,
+      externalContent);
+  createExternalRootTile(result, std::move(externalContent));
 
   return asyncSystem.createResolvedFuture(std::move(result));
 }
@@ -896,6 +1214,7 @@ TilesetJsonLoader::loadTileContent(const TileLoadInput& loadInput) {
                            tileTransform,
                            tileRefine,
                            ellipsoid,
+                           createTilesLazily = this->_pTilesetJson != nullptr,
                            upAxis = _upAxis,
                            externalContentInitializer =
                                std::move(externalContentInitializer),
@@ -947,26 +1266,38 @@ TilesetJsonLoader::loadTileContent(const TileLoadInput& loadInput) {
               contentOptions.ktx2TranscodeTargets;
           gltfOptions.applyTextureTransform =
               contentOptions.applyTextureTransform;
-          return converter(responseData, gltfOptions, assetFetcher)
-              .thenImmediately(
-                  [ellipsoid, pLogger, upAxis, tileUrl, pCompletedRequest](
-                      GltfConverterResult&& result) {
-                    logTileLoadResult(pLogger, tileUrl, result.errors);
-                    if (result.errors) {
-                      return TileLoadResult::createFailedResult(
-                          std::move(pCompletedRequest));
-                    }
-                    return TileLoadResult{
-                        std::move(*result.model),
-                        upAxis,
-                        std::nullopt,
-                        std::nullopt,
-                        std::nullopt,
-                        std::move(pCompletedRequest),
-                        {},
-                        TileLoadResultState::Success,
-                        ellipsoid};
-                  });
+          const auto decodeStart = std::chrono::steady_clock::now();
+          return GltfConverters::convert(
+                     converter,
+                     *pCompletedRequest,
+                     gltfOptions,
+                     assetFetcher)
+              .thenImmediately([ellipsoid,
+                                pLogger,
+                                upAxis,
+                                tileUrl,
+                                pCompletedRequest,
+                                decodeStart](GltfConverterResult&& result) {
+                const auto decodeTime =
+                    std::chrono::steady_clock::now() - decodeStart;
+
+                logTileLoadResult(pLogger, tileUrl, result.errors);
+                if (result.errors) {
+                  return TileLoadResult::createFailedResult(
+                      std::move(pCompletedRequest));
+                }
+                return TileLoadResult{
+                    std::move(*result.model),
+                    upAxis,
+                    std::nullopt,
+                    std::nullopt,
+                    std::nullopt,
+                    std::move(pCompletedRequest),
+                    {},
+                    TileLoadResultState::Success,
+                    ellipsoid,
+                    decodeTime};
+              });
         } else {
           // not a renderable content, then it must be external tileset
           return asyncSystem.createResolvedFuture(
@@ -977,7 +1308,8 @@ TilesetJsonLoader::loadTileContent(const TileLoadInput& loadInput) {
                   pLogger,
                   std::move(pCompletedRequest),
                   std::move(externalContentInitializer),
-                  ellipsoid));
+                  ellipsoid,
+                  createTilesLazily));
         }
       });
 }
@@ -990,7 +1322,22 @@ TileChildrenResult TilesetJsonLoader::createTileChildren(
     return pLoader->createTileChildren(tile, ellipsoid);
   }
 
-  return {{}, TileLoadResultState::Failed};
+  auto it = this->_latentChildren.find(&tile);
+  if (it == this->_latentChildren.end()) {
+    return {{}, TileLoadResultState::Failed};
+  }
+
+  const LatentChildren latentChildren = it->second;
+  this->_latentChildren.erase(it);
+
+  return {
+      this->createLatentChildren(
+          this->_pLogger,
+          tile,
+          *latentChildren.pChildrenJson,
+          latentChildren.geometricError,
+          ellipsoid),
+      TileLoadResultState::Success};
 }
 
 const std::string& TilesetJsonLoader::getBaseUrl() const noexcept {
@@ -1001,8 +1348,59 @@ CesiumGeometry::Axis TilesetJsonLoader::getUpAxis() const noexcept {
   return _upAxis;
 }
 
+void TilesetJsonLoader::setUpAxis(CesiumGeometry::Axis upAxis) noexcept {
+  this->_upAxis = upAxis;
+}
+
 void TilesetJsonLoader::addChildLoader(
     std::unique_ptr<TilesetContentLoader> pLoader) {
   this->_children.emplace_back(std::move(pLoader));
 }
+
+std::vector<Tile> TilesetJsonLoader::createLatentChildren(
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    const Tile& tile,
+    const rapidjson::Value& childrenJson,
+    double geometricError,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  std::vector<Tile> children;
+  if (!childrenJson.IsArray()) {
+    return children;
+  }
+
+  // Reserve all of the children up front, so that they never move. Moving the
+  // vector into the parent tile doesn't move them either.
+  children.reserve(childrenJson.Size());
+  for (const rapidjson::Value& childJson : childrenJson.GetArray()) {
+    const rapidjson::Value* pLatentChildren = nullptr;
+    std::optional<Tile> maybeChild = parseTileJsonRecursively(
+        pLogger,
+        childJson,
+        tile.getTransform(),
+        tile.getRefine(),
+        geometricError,
+        *this,
+        ellipsoid,
+        &pLatentChildren);
+    if (!maybeChild) {
+      continue;
+    }
+
+    const Tile& child = children.emplace_back(std::move(*maybeChild));
+    if (pLatentChildren) {
+      this->_latentChildren.emplace(
+          &child,
+          LatentChildren{pLatentChildren, child.getGeometricError()});
+    }
+  }
+
+  return children;
+}
+
+void TilesetJsonLoader::retainTilesetJson(
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    const std::shared_ptr<const rapidjson::Document>& pTilesetJson) {
+  this->_pLogger = pLogger;
+  this->_pTilesetJson = pTilesetJson;
+}
 } // namespace Cesium3DTilesSelection
@@ -8,10 +8,13 @@
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
 
+#include <gsl/span>
 #include <rapidjson/fwd.h>
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Cesium3DTilesSelection {
@@ -34,14 +37,95 @@ public:
 
   CesiumGeometry::Axis getUpAxis() const noexcept;
 
+  /**
+   * @brief Sets the axis that was declared as the "up-axis" for glTF content.
+   *
+   * This is used when the tiles are created before the tileset's `asset`
+   * property has been read.
+   */
+  void setUpAxis(CesiumGeometry::Axis upAxis) noexcept;
+
   void addChildLoader(std::unique_ptr<TilesetContentLoader> pLoader);
 
+  /**
+   * @brief Creates the tiles in the `children` of a tile's JSON, but not their
+   * descendants.
+   *
+   * The `children` JSON of each new tile is recorded, so that its own children
+   * are created by {@link createTileChildren} the first time that it is called
+   * for the tile. So the JSON must remain valid for as long as this loader
+   * exists, which is what {@link retainTilesetJson} is for.
+   *
+   * @param pLogger The logger that receives warnings about invalid tiles.
+   * @param tile The tile, whose transform and refinement must already be
+   * resolved.
+   * @param childrenJson The `children` array of the tile's JSON.
+   * @param geometricError The tile's geometric error as it was created, which
+   * is inherited by children without one.
+   * @param ellipsoid The ellipsoid of the tiles' bounding volumes.
+   * @return The children of the tile.
+   */
+  std::vector<Tile> createLatentChildren(
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      const Tile& tile,
+      const rapidjson::Value& childrenJson,
+      double geometricError,
+      const CesiumGeospatial::Ellipsoid& ellipsoid);
+
+  /**
+   * @brief Keeps the tileset.json that this loader's tiles were created from,
+   * so that the children recorded by {@link createLatentChildren} can be
+   * created later.
+   *
+   * A loader that retains its tileset.json also creates the tiles of any
+   * external tileset that it loads lazily.
+   */
+  void retainTilesetJson(
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      const std::shared_ptr<const rapidjson::Document>& pTilesetJson);
+
+  /**
+   * @brief Creates a loader for the tileset.json at the given URL.
+   *
+   * @param externals The external interfaces to use.
+   * @param tilesetJsonUrl The URL of the tileset.json.
+   * @param requestHeaders The headers of the request for the tileset.json.
+   * @param ellipsoid The ellipsoid of the tiles' bounding volumes.
+   * @param createTilesLazily Whether to create only the root tile and its
+   * children up front, as the overload that takes a
+   * `std::shared_ptr<const rapidjson::Document>` does, rather than every tile.
+   */
   static CesiumAsync::Future<TilesetContentLoaderResult<TilesetJsonLoader>>
   createLoader(
       const TilesetExternals& externals,
       const std::string& tilesetJsonUrl,
       const std::vector<CesiumAsync::IAssetAccessor::THeader>& requestHeaders,
-      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID,
+      bool createTilesLazily = false);
+
+  /**
+   * @brief Creates a loader from the content of a tileset.json.
+   *
+   * Unless tiles are created lazily, the tileset.json is read in a single
+   * streaming pass, without first building a `rapidjson::Document`.
+   *
+   * @param asyncSystem The async system that resolves the returned future.
+   * @param pLogger The logger that receives warnings about the tileset.json.
+   * @param tilesetJsonUrl The URL of the tileset.json.
+   * @param tilesetJson The content of the tileset.json.
+   * @param ellipsoid The ellipsoid of the tiles' bounding volumes.
+   * @param createTilesLazily Whether to create only the root tile and its
+   * children up front, as the overload that takes a
+   * `std::shared_ptr<const rapidjson::Document>` does, rather than every tile.
+   */
+  static CesiumAsync::Future<TilesetContentLoaderResult<TilesetJsonLoader>>
+  createLoader(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      const std::string& tilesetJsonUrl,
+      const gsl::span<const std::byte>& tilesetJson,
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID,
+      bool createTilesLazily = false);
 
   static CesiumAsync::Future<TilesetContentLoaderResult<TilesetJsonLoader>>
   createLoader(
@@ -53,7 +137,32 @@ public:
       const rapidjson::Document& tilesetJson,
       const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
 
+  /**
+   * @brief Creates a loader from a parsed tileset.json, creating only the root
+   * tile and its children up front.
+   *
+   * The loader retains the tileset.json, and creates the children of any other
+   * tile from it the first time that {@link createTileChildren} is called for
+   * the tile, which happens when a traversal of the tileset first reaches the
+   * tile. This makes a tileset.json with many tiles ready to use much sooner,
+   * at the cost of keeping the whole JSON in memory.
+   */
+  static CesiumAsync::Future<TilesetContentLoaderResult<TilesetJsonLoader>>
+  createLoader(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      const std::string& tilesetJsonUrl,
+      const CesiumAsync::HttpHeaders& requestHeaders,
+      const std::shared_ptr<const rapidjson::Document>& pTilesetJson,
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
+
 private:
+  struct LatentChildren {
+    const rapidjson::Value* pChildrenJson;
+    double geometricError;
+  };
+
   std::string _baseUrl;
   CesiumGeospatial::Ellipsoid _ellipsoid;
   CesiumUtility::IntrusivePointer<TilesetSharedAssetSystem> _pSharedAssetSystem;
@@ -71,5 +180,21 @@ private:
   CesiumGeometry::Axis _upAxis;
 
   std::vector<std::unique_ptr<TilesetContentLoader>> _children;
+
+  /**
+   * @brief The tileset.json that the tiles were created from, which is only
+   * retained when the tiles are created lazily.
+   */
+  std::shared_ptr<const rapidjson::Document> _pTilesetJson;
+  std::shared_ptr<spdlog::logger> _pLogger;
+
+  /**
+   * @brief The `children` JSON of each tile whose children have not been
+   * created yet.
+   *
+   * The tiles never move once they are in a vector of children, so they can
+   * be identified by their address.
+   */
+  std::unordered_map<const Tile*, LatentChildren> _latentChildren;
 };
 } // namespace Cesium3DTilesSelection
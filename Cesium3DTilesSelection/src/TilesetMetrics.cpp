@@ -0,0 +1,215 @@
+#include "TilesetMetrics.h"
+
+#include <CesiumAsync/IAssetRequest.h>
+#include <CesiumAsync/IAssetResponse.h>
+
+#include <gsl/span>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+using namespace CesiumAsync;
+using namespace CesiumUtility;
+
+namespace Cesium3DTilesSelection {
+
+namespace {
+
+const char* const contentTypeNames[TilesetMetrics::contentTypeCount] = {
+    "b3dm",
+    "i3dm",
+    "pnts",
+    "cmpt",
+    "glb",
+    "upsampled",
+    "other"};
+
+template <typename TMetric>
+TMetric* getMetric(
+    IMetricsSink* pSink,
+    TMetric& (IMetricsSink::*get)(const std::string&),
+    const std::string& name) {
+  return pSink ? &(pSink->*get)(name) : nullptr;
+}
+
+} // namespace
+
+TilesetMetrics::TilesetMetrics(const std::shared_ptr<IMetricsSink>& pSink_)
+    : pSink(pSink_),
+      pTilesLoading(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getGauge,
+          "tileset.tilesLoading")),
+      pFailedTileLoads(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getCounter,
+          "tileset.failedTileLoads")),
+      pTileLoadMicroseconds(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getHistogram,
+          "tileset.tileLoadMicroseconds")),
+      contentFetchAndLoadMicroseconds(),
+      contentDecodeMicroseconds(),
+      pWorkerThreadProcessingMicroseconds(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getHistogram,
+          "tileset.workerThreadProcessingMicroseconds")),
+      pUpdateViewMicroseconds(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getHistogram,
+          "tileset.updateViewMicroseconds")),
+      pWorkerThreadLoadQueueLength(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getHistogram,
+          "tileset.workerThreadLoadQueueLength")),
+      pMainThreadLoadQueueLength(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getHistogram,
+          "tileset.mainThreadLoadQueueLength")),
+      pMainThreadLoadMicroseconds(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getHistogram,
+          "tileset.mainThreadLoadMicroseconds")),
+      pMainThreadBudgetOverruns(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getCounter,
+          "tileset.mainThreadBudgetOverruns")),
+      pCacheUnloadBudgetOverruns(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getCounter,
+          "tileset.cacheUnloadBudgetOverruns")),
+      pBytesEvicted(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getCounter,
+          "tileset.bytesEvicted")),
+      pBytesEvictedPerFrame(getMetric(
+          pSink_.get(),
+          &IMetricsSink::getHistogram,
+          "tileset.bytesEvictedPerFrame")) {
+  for (size_t i = 0; i < contentTypeCount; ++i) {
+    this->contentFetchAndLoadMicroseconds[i] = getMetric(
+        pSink_.get(),
+        &IMetricsSink::getHistogram,
+        std::string("tileset.contentFetchAndLoadMicroseconds.") +
+            contentTypeNames[i]);
+    this->contentDecodeMicroseconds[i] = getMetric(
+        pSink_.get(),
+        &IMetricsSink::getHistogram,
+        std::string("tileset.contentDecodeMicroseconds.") +
+            contentTypeNames[i]);
+  }
+}
+
+/*static*/ TilesetMetrics::ContentType TilesetMetrics::getContentType(
+    const TileLoadResult& result,
+    bool upsampled) noexcept {
+  if (upsampled) {
+    return ContentType::Upsampled;
+  }
+
+  const IAssetRequest* pRequest = result.pCompletedRequest.get();
+  const IAssetResponse* pResponse = pRequest ? pRequest->response() : nullptr;
+  if (!pResponse) {
+    return ContentType::Other;
+  }
+
+  const gsl::span<const std::byte> data = pResponse->data();
+  if (data.size() >= 4) {
+    const std::byte* pMagic = data.data();
+    auto is = [pMagic](const char* magic) {
+      for (size_t i = 0; i < 4; ++i) {
+        if (pMagic[i] != std::byte(magic[i])) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    if (is("b3dm")) {
+      return ContentType::B3dm;
+    }
+    if (is("i3dm")) {
+      return ContentType::I3dm;
+    }
+    if (is("pnts")) {
+      return ContentType::Pnts;
+    }
+    if (is("cmpt")) {
+      return ContentType::Cmpt;
+    }
+    if (is("glTF")) {
+      return ContentType::Glb;
+    }
+    return ContentType::Other;
+  }
+
+  // The loader may have taken the data out of the response to avoid copying
+  // it, so fall back to the file extension of the URL.
+  const std::string& url = pRequest->url();
+  const std::string_view path = std::string_view(url).substr(0, url.find('?'));
+  const size_t extensionPos = path.rfind('.');
+  if (extensionPos == std::string_view::npos) {
+    return ContentType::Other;
+  }
+
+  const std::string_view extension = path.substr(extensionPos);
+  auto is = [extension](std::string_view expected) {
+    return extension.size() == expected.size() &&
+           std::equal(
+               extension.begin(),
+               extension.end(),
+               expected.begin(),
+               [](char c, char expectedChar) {
+                 return std::tolower(static_cast<unsigned char>(c)) ==
+                        expectedChar;
+               });
+  };
+
+  if (is(".b3dm")) {
+    return ContentType::B3dm;
+  }
+  if (is(".i3dm")) {
+    return ContentType::I3dm;
+  }
+  if (is(".pnts")) {
+    return ContentType::Pnts;
+  }
+  if (is(".cmpt")) {
+    return ContentType::Cmpt;
+  }
+  if (is(".glb")) {
+    return ContentType::Glb;
+  }
+  return ContentType::Other;
+}
+
+void TilesetMetrics::recordContentFetchAndLoad(
+    const TileLoadResult& result,
+    bool upsampled,
+    std::chrono::steady_clock::time_point start) const noexcept {
+  if (!this->pSink) {
+    return;
+  }
+
+  const ContentType type = getContentType(result, upsampled);
+  this->contentFetchAndLoadMicroseconds[size_t(type)]->recordElapsedSince(
+      start);
+}
+
+void TilesetMetrics::recordContentDecode(
+    const TileLoadResult& result) const noexcept {
+  if (!this->pSink || !result.decodeTime) {
+    return;
+  }
+
+  // Upsampled content is never decoded.
+  const ContentType type = getContentType(result, false);
+  this->contentDecodeMicroseconds[size_t(type)]->record(
+      std::chrono::duration_cast<std::chrono::microseconds>(*result.decodeTime)
+          .count());
+}
+
+} // namespace Cesium3DTilesSelection
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Cesium3DTilesSelection/TileLoadResult.h>
+#include <CesiumUtility/Metrics.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace Cesium3DTilesSelection {
+
+/**
+ * @brief The metrics that a {@link Tileset} records in
+ * {@link TilesetExternals::pMetricsSink}.
+ *
+ * Every pointer is nullptr if the tileset has no metrics sink. The metrics are
+ * shared by all of the tilesets that use the same sink.
+ */
+struct TilesetMetrics {
+  /**
+   * @brief The kinds of content whose fetch and load times, and decode times,
+   * are recorded separately.
+   */
+  enum class ContentType { B3dm, I3dm, Pnts, Cmpt, Glb, Upsampled, Other };
+
+  static constexpr size_t contentTypeCount = 7;
+
+  explicit TilesetMetrics(
+      const std::shared_ptr<CesiumUtility::IMetricsSink>& pSink_);
+
+  /**
+   * @brief Gets the type of the content of a tile, from the magic of its
+   * response, or from the file extension of its URL if the loader took the
+   * data out of the response.
+   */
+  static ContentType
+  getContentType(const TileLoadResult& result, bool upsampled) noexcept;
+
+  /**
+   * @brief Records the time from when a loader was asked for the content of a
+   * tile until it returned the content. This includes the time waiting for
+   * the network and for a worker thread, as well as the time to decode the
+   * content.
+   */
+  void recordContentFetchAndLoad(
+      const TileLoadResult& result,
+      bool upsampled,
+      std::chrono::steady_clock::time_point start) const noexcept;
+
+  /**
+   * @brief Records the time that a loader spent decoding the content of a
+   * tile, if it measured it in {@link TileLoadResult::decodeTime}.
+   */
+  void recordContentDecode(const TileLoadResult& result) const noexcept;
+
+  // Keeps the metrics below alive.
+  std::shared_ptr<CesiumUtility::IMetricsSink> pSink;
+
+  // Recorded by TilesetContentManager.
+  CesiumUtility::MetricGauge* pTilesLoading;
+  CesiumUtility::MetricCounter* pFailedTileLoads;
+  CesiumUtility::MetricHistogram* pTileLoadMicroseconds;
+  std::array<CesiumUtility::MetricHistogram*, contentTypeCount>
+      contentFetchAndLoadMicroseconds;
+  std::array<CesiumUtility::MetricHistogram*, contentTypeCount>
+      contentDecodeMicroseconds;
+  CesiumUtility::MetricHistogram* pWorkerThreadProcessingMicroseconds;
+
+  // Recorded by Tileset::updateView.
+  CesiumUtility::MetricHistogram* pUpdateViewMicroseconds;
+  CesiumUtility::MetricHistogram* pWorkerThreadLoadQueueLength;
+  CesiumUtility::MetricHistogram* pMainThreadLoadQueueLength;
+  CesiumUtility::MetricHistogram* pMainThreadLoadMicroseconds;
+  CesiumUtility::MetricCounter* pMainThreadBudgetOverruns;
+  CesiumUtility::MetricCounter* pCacheUnloadBudgetOverruns;
+  CesiumUtility::MetricCounter* pBytesEvicted;
+  CesiumUtility::MetricHistogram* pBytesEvictedPerFrame;
+};
+
+} // namespace Cesium3DTilesSelection
@@ -4,6 +4,9 @@
 
 #include <glm/trigonometric.hpp>
 
+#include <array>
+#include <cstdint>
+
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
 
@@ -25,7 +28,42 @@ namespace Cesium3DTilesSelection {
       horizontalFieldOfView,
       verticalFieldOfView,
       ellipsoid.cartesianToCartographic(position),
-      ellipsoid);
+      ellipsoid,
+      createCullingVolume(
+          position,
+          direction,
+          up,
+          horizontalFieldOfView,
+          verticalFieldOfView));
+}
+
+/* static */ ViewState ViewState::create(
+    const glm::dvec3& position,
+    const glm::dvec3& direction,
+    const glm::dvec3& up,
+    const glm::dvec2& viewportSize,
+    double horizontalFieldOfView,
+    double verticalFieldOfView,
+    double nearDistance,
+    double farDistance,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  return ViewState(
+      position,
+      direction,
+      up,
+      viewportSize,
+      horizontalFieldOfView,
+      verticalFieldOfView,
+      ellipsoid.cartesianToCartographic(position),
+      ellipsoid,
+      createCullingVolume(
+          position,
+          direction,
+          up,
+          horizontalFieldOfView,
+          verticalFieldOfView,
+          nearDistance,
+          farDistance));
 }
 
 ViewState::ViewState(
@@ -36,7 +74,8 @@ ViewState::ViewState(
     double horizontalFieldOfView,
     double verticalFieldOfView,
     const std::optional<CesiumGeospatial::Cartographic>& positionCartographic,
-    const CesiumGeospatial::Ellipsoid& ellipsoid)
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    const CullingVolume& cullingVolume)
     : _position(position),
       _direction(direction),
       _up(up),
@@ -46,83 +85,144 @@ ViewState::ViewState(
       _ellipsoid(ellipsoid),
       _sseDenominator(2.0 * glm::tan(0.5 * verticalFieldOfView)),
       _positionCartographic(positionCartographic),
-      _cullingVolume(createCullingVolume(
-          position,
-          direction,
-          up,
-          horizontalFieldOfView,
-          verticalFieldOfView)) {}
+      _cullingVolume(cullingVolume) {}
+
+namespace {
+
+// The planes of a culling volume, in plane mask bit order.
+struct CullingPlanes {
+  std::array<const Plane*, 6> planes;
+  uint8_t count;
+};
+
+CullingPlanes getCullingPlanes(const CullingVolume& cullingVolume) noexcept {
+  CullingPlanes result{
+      {&cullingVolume.leftPlane,
+       &cullingVolume.rightPlane,
+       &cullingVolume.topPlane,
+       &cullingVolume.bottomPlane,
+       nullptr,
+       nullptr},
+      4};
+  if (cullingVolume.nearPlane) {
+    result.planes[result.count++] = &*cullingVolume.nearPlane;
+  }
+  if (cullingVolume.farPlane) {
+    result.planes[result.count++] = &*cullingVolume.farPlane;
+  }
+  return result;
+}
 
 template <class T>
-static bool isBoundingVolumeVisible(
+uint32_t computeVisibilityWithPlaneMask(
     const T& boundingVolume,
-    const CullingVolume& cullingVolume) noexcept {
-  const CullingResult left =
-      boundingVolume.intersectPlane(cullingVolume.leftPlane);
-  if (left == CullingResult::Outside) {
-    return false;
+    const CullingVolume& cullingVolume,
+    uint32_t parentPlaneMask,
+    uint8_t& lastCullingPlane) noexcept {
+  // If the enclosing volume was entirely outside of a plane, or entirely inside
+  // of all of them, then so is this volume.
+  if (parentPlaneMask == ViewState::PLANE_MASK_OUTSIDE ||
+      parentPlaneMask == ViewState::PLANE_MASK_INSIDE) {
+    return parentPlaneMask;
   }
 
-  const CullingResult right =
-      boundingVolume.intersectPlane(cullingVolume.rightPlane);
-  if (right == CullingResult::Outside) {
-    return false;
-  }
+  const CullingPlanes cullingPlanes = getCullingPlanes(cullingVolume);
+  const uint8_t firstPlane =
+      lastCullingPlane < cullingPlanes.count ? lastCullingPlane : 0;
 
-  const CullingResult top =
-      boundingVolume.intersectPlane(cullingVolume.topPlane);
-  if (top == CullingResult::Outside) {
-    return false;
-  }
+  // Start with the plane that this volume was last outside of, because a
+  // volume that was culled in one frame is usually culled by the same plane in
+  // the next.
+  uint32_t mask = ViewState::PLANE_MASK_INSIDE;
+  for (uint8_t i = 0; i < cullingPlanes.count; ++i) {
+    const uint8_t planeIndex =
+        static_cast<uint8_t>((firstPlane + i) % cullingPlanes.count);
+    const uint32_t planeBit = 1U << planeIndex;
+    if ((parentPlaneMask & planeBit) == 0) {
+      // The enclosing volume is entirely inside this plane.
+      continue;
+    }
+
+    const CullingResult result =
+        boundingVolume.intersectPlane(*cullingPlanes.planes[planeIndex]);
+    if (result == CullingResult::Outside) {
+      lastCullingPlane = planeIndex;
+      return ViewState::PLANE_MASK_OUTSIDE;
+    }
 
-  const CullingResult bottom =
-      boundingVolume.intersectPlane(cullingVolume.bottomPlane);
-  if (bottom == CullingResult::Outside) {
-    return false;
+    if (result == CullingResult::Intersecting) {
+      mask |= planeBit;
+    }
   }
 
-  return true;
+  return mask;
 }
 
+} // namespace
+
 bool ViewState::isBoundingVolumeVisible(
     const BoundingVolume& boundingVolume) const noexcept {
-  // TODO: use plane masks
+  uint8_t lastCullingPlane = 0;
+  return this->computeVisibilityWithPlaneMask(
+             boundingVolume,
+             PLANE_MASK_INDETERMINATE,
+             lastCullingPlane) != PLANE_MASK_OUTSIDE;
+}
+
+uint32_t ViewState::computeVisibilityWithPlaneMask(
+    const BoundingVolume& boundingVolume,
+    uint32_t parentPlaneMask,
+    uint8_t& lastCullingPlane) const noexcept {
   struct Operation {
     const ViewState& viewState;
+    uint32_t parentPlaneMask;
+    uint8_t& lastCullingPlane;
 
-    bool operator()(const OrientedBoundingBox& boundingBox) noexcept {
-      return Cesium3DTilesSelection::isBoundingVolumeVisible(
+    uint32_t operator()(const OrientedBoundingBox& boundingBox) noexcept {
+      return Cesium3DTilesSelection::computeVisibilityWithPlaneMask(
           boundingBox,
-          viewState._cullingVolume);
+          viewState._cullingVolume,
+          parentPlaneMask,
+          lastCullingPlane);
     }
 
-    bool operator()(const BoundingRegion& boundingRegion) noexcept {
-      return Cesium3DTilesSelection::isBoundingVolumeVisible(
+    uint32_t operator()(const BoundingRegion& boundingRegion) noexcept {
+      return Cesium3DTilesSelection::computeVisibilityWithPlaneMask(
           boundingRegion,
-          viewState._cullingVolume);
+          viewState._cullingVolume,
+          parentPlaneMask,
+          lastCullingPlane);
     }
 
-    bool operator()(const BoundingSphere& boundingSphere) noexcept {
-      return Cesium3DTilesSelection::isBoundingVolumeVisible(
+    uint32_t operator()(const BoundingSphere& boundingSphere) noexcept {
+      return Cesium3DTilesSelection::computeVisibilityWithPlaneMask(
           boundingSphere,
-          viewState._cullingVolume);
+          viewState._cullingVolume,
+          parentPlaneMask,
+          lastCullingPlane);
     }
 
-    bool operator()(
+    uint32_t operator()(
         const BoundingRegionWithLooseFittingHeights& boundingRegion) noexcept {
-      return Cesium3DTilesSelection::isBoundingVolumeVisible(
+      return Cesium3DTilesSelection::computeVisibilityWithPlaneMask(
           boundingRegion.getBoundingRegion(),
-          viewState._cullingVolume);
+          viewState._cullingVolume,
+          parentPlaneMask,
+          lastCullingPlane);
     }
 
-    bool operator()(const S2CellBoundingVolume& s2Cell) noexcept {
-      return Cesium3DTilesSelection::isBoundingVolumeVisible(
+    uint32_t operator()(const S2CellBoundingVolume& s2Cell) noexcept {
+      return Cesium3DTilesSelection::computeVisibilityWithPlaneMask(
           s2Cell,
-          viewState._cullingVolume);
+          viewState._cullingVolume,
+          parentPlaneMask,
+          lastCullingPlane);
     }
   };
 
-  return std::visit(Operation{*this}, boundingVolume);
+  return std::visit(
+      Operation{*this, parentPlaneMask, lastCullingPlane},
+      boundingVolume);
 }
 
 double ViewState::computeDistanceSquaredToBoundingVolume(
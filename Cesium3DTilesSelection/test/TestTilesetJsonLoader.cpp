@@ -1,23 +1,37 @@
 #include "TestTilesetJsonLoader.h"
 
+#include "ImplicitOctreeLoader.h"
 #include "ImplicitQuadtreeLoader.h"
 #include "SimplePrepareRendererResource.h"
 #include "TilesetJsonLoader.h"
 
 #include <Cesium3DTilesContent/registerAllTileContentTypes.h>
+#include <Cesium3DTilesSelection/BoundingVolume.h>
 #include <Cesium3DTilesSelection/Tile.h>
+#include <Cesium3DTilesSelection/TileID.h>
+#include <Cesium3DTilesSelection/TileTreeMemoryUsage.h>
+#include <CesiumGeometry/BoundingSphere.h>
+#include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumNativeTests/SimpleAssetAccessor.h>
 #include <CesiumNativeTests/SimpleAssetRequest.h>
 #include <CesiumNativeTests/SimpleAssetResponse.h>
 #include <CesiumNativeTests/SimpleTaskProcessor.h>
 #include <CesiumNativeTests/readFile.h>
+#include <CesiumUtility/CreditSystem.h>
 
 #include <catch2/catch.hpp>
+#include <rapidjson/document.h>
+#include <spdlog/spdlog.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 using namespace CesiumAsync;
 using namespace Cesium3DTilesSelection;
@@ -66,6 +80,212 @@ TileLoadResult loadTileContent(
 
   return tileLoadResultFuture.wait();
 }
+
+// Appends a tile of a synthetic quadtree tileset.json, and its descendants
+// down to the given maximum level, to the JSON string. The tile covers the
+// given rectangle, in radians.
+void appendSyntheticTileJson(
+    std::string& json,
+    uint32_t level,
+    uint32_t x,
+    uint32_t y,
+    uint32_t maximumLevel,
+    double west,
+    double south,
+    double east,
+    double north) {
+  json += "{\"boundingVolume\":{\"region\":[" + std::to_string(west) + "," +
+          std::to_string(south) + "," + std::to_string(east) + "," +
+          std::to_string(north) + ",0,100]},";
+  json += "\"geometricError\":" + std::to_string(1000.0 / (level + 1)) + ",";
+  json += "\"content\":{\"uri\":\"tiles/" + std::to_string(level) + "/" +
+          std::to_string(x) + "/" + std::to_string(y) + ".b3dm\"}";
+
+  if (level < maximumLevel) {
+    const double centerX = 0.5 * (west + east);
+    const double centerY = 0.5 * (south + north);
+    json += ",\"children\":[";
+    for (uint32_t i = 0; i < 4; ++i) {
+      if (i > 0) {
+        json += ",";
+      }
+      const uint32_t childX = 2 * x + (i & 1);
+      const uint32_t childY = 2 * y + (i >> 1);
+      appendSyntheticTileJson(
+          json,
+          level + 1,
+          childX,
+          childY,
+          maximumLevel,
+          (i & 1) ? centerX : west,
+          (i >> 1) ? centerY : south,
+          (i & 1) ? east : centerX,
+          (i >> 1) ? north : centerY);
+    }
+    json += "]";
+  }
+
+  json += "}";
+}
+
+std::string createSyntheticTilesetJson(uint32_t maximumLevel) {
+  std::string json = "{\"asset\":{\"version\":\"1.0\"},";
+  json += "\"geometricError\":2000,\"root\":";
+  appendSyntheticTileJson(json, 0, 0, 0, maximumLevel, -0.1, -0.1, 0.1, 0.1);
+  json += "}";
+  return json;
+}
+
+TilesetContentLoaderResult<TilesetJsonLoader>
+createTilesetJsonLoaderFromDocument(const std::string& json) {
+  rapidjson::Document document;
+  document.Parse(json.data(), json.size());
+  REQUIRE(!document.HasParseError());
+
+  AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+  return TilesetJsonLoader::createLoader(
+             asyncSystem,
+             nullptr,
+             spdlog::default_logger(),
+             "tileset.json",
+             {},
+             document)
+      .wait();
+}
+
+TilesetContentLoaderResult<TilesetJsonLoader>
+createTilesetJsonLoaderLazily(const std::string& json) {
+  auto pDocument = std::make_shared<rapidjson::Document>();
+  pDocument->Parse(json.data(), json.size());
+  REQUIRE(!pDocument->HasParseError());
+
+  AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+  return TilesetJsonLoader::createLoader(
+             asyncSystem,
+             nullptr,
+             spdlog::default_logger(),
+             "tileset.json",
+             {},
+             std::shared_ptr<const rapidjson::Document>(std::move(pDocument)))
+      .wait();
+}
+
+TilesetContentLoaderResult<TilesetJsonLoader> createTilesetJsonLoaderFromString(
+    const std::string& json,
+    bool createTilesLazily = false) {
+  const std::byte* pBegin = reinterpret_cast<const std::byte*>(json.data());
+  auto pMockCompletedRequest = std::make_shared<SimpleAssetRequest>(
+      "GET",
+      "tileset.json",
+      CesiumAsync::HttpHeaders{},
+      std::make_unique<SimpleAssetResponse>(
+          static_cast<uint16_t>(200),
+          "doesn't matter",
+          CesiumAsync::HttpHeaders{},
+          std::vector<std::byte>(pBegin, pBegin + json.size())));
+
+  std::map<std::string, std::shared_ptr<SimpleAssetRequest>>
+      mockCompletedRequests;
+  mockCompletedRequests.insert(
+      {"tileset.json", std::move(pMockCompletedRequest)});
+
+  TilesetExternals externals{
+      std::make_shared<SimpleAssetAccessor>(std::move(mockCompletedRequests)),
+      std::make_shared<SimplePrepareRendererResource>(),
+      AsyncSystem{std::make_shared<SimpleTaskProcessor>()},
+      std::make_shared<CreditSystem>()};
+
+  auto loaderResultFuture = TilesetJsonLoader::createLoader(
+      externals,
+      "tileset.json",
+      {},
+      CesiumGeospatial::Ellipsoid::WGS84,
+      createTilesLazily);
+  externals.asyncSystem.dispatchMainThreadTasks();
+
+  return loaderResultFuture.wait();
+}
+
+// Creates the children of every tile of a TilesetJsonLoader that doesn't have
+// any yet, as traversing the whole tileset would.
+void createAllLatentChildren(Tile& tile) {
+  TilesetJsonLoader* pLoader =
+      dynamic_cast<TilesetJsonLoader*>(tile.getLoader());
+  if (pLoader && tile.getChildren().empty()) {
+    TileChildrenResult result = pLoader->createTileChildren(tile);
+    if (result.state == TileLoadResultState::Success) {
+      tile.createChildTiles(std::move(result.children));
+    }
+  }
+
+  for (Tile& child : tile.getChildren()) {
+    createAllLatentChildren(child);
+  }
+}
+
+// Checks that two tile trees have the same properties, as far as the
+// TilesetJsonLoader sets them.
+void checkSameTiles(const Tile& expected, const Tile& actual) {
+  CHECK(
+      TileIdUtilities::createTileIdString(actual.getTileID()) ==
+      TileIdUtilities::createTileIdString(expected.getTileID()));
+  CHECK(actual.getTransform() == expected.getTransform());
+  CHECK(
+      actual.getBoundingVolume().index() ==
+      expected.getBoundingVolume().index());
+  CHECK(
+      getBoundingVolumeCenter(actual.getBoundingVolume()) ==
+      getBoundingVolumeCenter(expected.getBoundingVolume()));
+  CHECK(
+      actual.getViewerRequestVolume().has_value() ==
+      expected.getViewerRequestVolume().has_value());
+  CHECK(
+      actual.getContentBoundingVolume().has_value() ==
+      expected.getContentBoundingVolume().has_value());
+  CHECK(actual.getGeometricError() == Approx(expected.getGeometricError()));
+  CHECK(actual.getRefine() == expected.getRefine());
+  CHECK(
+      actual.getContent().isExternalContent() ==
+      expected.getContent().isExternalContent());
+  CHECK(
+      actual.getContent().isEmptyContent() ==
+      expected.getContent().isEmptyContent());
+  CHECK(
+      (dynamic_cast<const ImplicitQuadtreeLoader*>(actual.getLoader()) !=
+       nullptr) ==
+      (dynamic_cast<const ImplicitQuadtreeLoader*>(expected.getLoader()) !=
+       nullptr));
+  CHECK(
+      (dynamic_cast<const ImplicitOctreeLoader*>(actual.getLoader()) !=
+       nullptr) ==
+      (dynamic_cast<const ImplicitOctreeLoader*>(expected.getLoader()) !=
+       nullptr));
+
+  REQUIRE(actual.getChildren().size() == expected.getChildren().size());
+  for (size_t i = 0; i < actual.getChildren().size(); ++i) {
+    checkSameTiles(expected.getChildren()[i], actual.getChildren()[i]);
+  }
+}
+
+#ifdef __linux__
+// Resets the peak resident set size of this process to its current resident
+// set size.
+void resetPeakResidentSetSize() {
+  std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+// Gets a field of /proc/self/status, in bytes.
+int64_t getProcessMemoryStatus(const std::string& field) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, field.size(), field) == 0) {
+      return std::stoll(line.substr(field.size())) * 1024;
+    }
+  }
+  return 0;
+}
+#endif
 } // namespace
 
 TEST_CASE("Test creating tileset json loader") {
@@ -580,52 +800,318 @@ TEST_CASE("Test loading individual tile of tileset json") {
     CHECK(pLoader->getAvailableLevels() == 2);
   }
 }
-Cesium3DTilesSelection::TilesetContentLoaderResult<TilesetJsonLoader>
-Cesium3DTilesSelection::createTilesetJsonLoader(
-    const std::filesystem::path& tilesetPath) {
-  std::string tilesetPathStr = tilesetPath.string();
-  auto pAccessor = std::make_shared<SimpleAssetAccessor>(
-      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>());
-  auto externals = createMockJsonTilesetExternals(tilesetPathStr, pAccessor);
-  auto loaderResultFuture =
-      TilesetJsonLoader::createLoader(externals, tilesetPathStr, {});
-  externals.asyncSystem.dispatchMainThreadTasks();
 
-  return loaderResultFuture.wait();
+TEST_CASE("Streaming and DOM tileset.json readers create the same tiles") {
+  Cesium3DTilesContent::registerAllTileContentTypes();
+
+  SECTION("for the test tilesets") {
+    for (const std::filesystem::path& tilesetPath :
+         {testDataPath / "ReplaceTileset" / "tileset.json",
+          testDataPath / "AddTileset" / "tileset.json",
+          testDataPath / "WithMetadata" / "tileset.json",
+          testDataPath / "MultipleKindsOfTilesets" /
+              "BoxBoundingVolumeTileset.json",
+          testDataPath / "MultipleKindsOfTilesets" / "EmptyTileTileset.json",
+          testDataPath / "MultipleKindsOfTilesets" /
+              "NoBoundingVolumeTileset.json",
+          testDataPath / "MultipleKindsOfTilesets" /
+              "NoCapitalizedRefineTileset.json",
+          testDataPath / "MultipleKindsOfTilesets" /
+              "NoGeometricErrorTileset.json",
+          testDataPath / "MultipleKindsOfTilesets" /
+              "OctreeImplicitTileset.json",
+          testDataPath / "MultipleKindsOfTilesets" /
+              "QuadtreeImplicitTileset.json",
+          testDataPath / "MultipleKindsOfTilesets" /
+              "ScaleGeometricErrorTileset.json",
+          testDataPath / "MultipleKindsOfTilesets" /
+              "SphereBoundingVolumeTileset.json"}) {
+      INFO(tilesetPath.string());
+      const std::vector<std::byte> data = readFile(tilesetPath);
+      const std::string json(
+          reinterpret_cast<const char*>(data.data()),
+          data.size());
+
+      const auto expected = createTilesetJsonLoaderFromDocument(json);
+      const auto actual = createTilesetJsonLoaderFromString(json);
+      CHECK(!actual.errors.hasErrors());
+      REQUIRE(expected.pRootTile);
+      REQUIRE(actual.pRootTile);
+      CHECK(actual.pLoader->getUpAxis() == expected.pLoader->getUpAxis());
+      checkSameTiles(*expected.pRootTile, *actual.pRootTile);
+    }
+  }
+
+  SECTION("when a tile's properties follow its children") {
+    const std::string json = R"({
+      "asset": { "version": "1.0", "gltfUpAxis": "Z" },
+      "root": {
+        "children": [{
+          "boundingVolume": { "sphere": [0, 0, 0, 1] },
+          "content": { "uri": "child.b3dm" },
+          "children": [{
+            "boundingVolume": { "box": [0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1] }
+          }]
+        }],
+        "boundingVolume": { "sphere": [0, 0, 0, 10] },
+        "geometricError": 100,
+        "refine": "ADD",
+        "transform": [2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 10, 20, 30, 1]
+      }
+    })";
+
+    const auto expected = createTilesetJsonLoaderFromDocument(json);
+    const auto actual = createTilesetJsonLoaderFromString(json);
+    REQUIRE(actual.pRootTile);
+    CHECK(actual.pLoader->getUpAxis() == CesiumGeometry::Axis::Z);
+    checkSameTiles(*expected.pRootTile, *actual.pRootTile);
+
+    REQUIRE(actual.pRootTile->getChildren().size() == 1);
+    const Tile& root = actual.pRootTile->getChildren()[0];
+    CHECK(root.getGeometricError() == Approx(200.0));
+    REQUIRE(root.getChildren().size() == 1);
+
+    const Tile& child = root.getChildren()[0];
+    CHECK(child.getRefine() == TileRefine::Add);
+    CHECK(child.getTransform() == root.getTransform());
+    CHECK(child.getGeometricError() == Approx(200.0));
+    const auto& sphere =
+        std::get<CesiumGeometry::BoundingSphere>(child.getBoundingVolume());
+    CHECK(sphere.getCenter() == glm::dvec3(10.0, 20.0, 30.0));
+    CHECK(sphere.getRadius() == Approx(2.0));
+    REQUIRE(child.getChildren().size() == 1);
+    CHECK(child.getChildren()[0].getRefine() == TileRefine::Add);
+  }
+
+  SECTION("for a large tileset") {
+    const std::string json = createSyntheticTilesetJson(4);
+    const auto expected = createTilesetJsonLoaderFromDocument(json);
+    const auto actual = createTilesetJsonLoaderFromString(json);
+    REQUIRE(actual.pRootTile);
+    checkSameTiles(*expected.pRootTile, *actual.pRootTile);
+  }
+
+  SECTION("reports invalid JSON as an error") {
+    const auto result =
+        createTilesetJsonLoaderFromString(R"({"root": {"boundingVolume": )");
+    CHECK(result.errors.hasErrors());
+    CHECK(!result.pRootTile);
+  }
 }
-Cesium3DTilesSelection::TilesetExternals
-Cesium3DTilesSelection::createMockJsonTilesetExternals(
-    const std::string& tilesetPath,
-    std::shared_ptr<CesiumNativeTests::SimpleAssetAccessor>& pAssetAccessor) {
-  auto tilesetContent = readFile(tilesetPath);
-  auto pMockCompletedResponse =
-      std::make_unique<CesiumNativeTests::SimpleAssetResponse>(
-          static_cast<uint16_t>(200),
-          "doesn't matter",
-          CesiumAsync::HttpHeaders{},
-          std::move(tilesetContent));
 
-  auto pMockCompletedRequest =
-      std::make_shared<CesiumNativeTests::SimpleAssetRequest>(
-          "GET",
-          "tileset.json",
-          CesiumAsync::HttpHeaders{},
-          std::move(pMockCompletedResponse));
+TEST_CASE("Lazily and eagerly created tiles are the same") {
+  Cesium3DTilesContent::registerAllTileContentTypes();
+
+  SECTION("only the root tile and its children are created up front") {
+    const std::string json = createSyntheticTilesetJson(3);
+    const auto lazy = createTilesetJsonLoaderLazily(json);
+    REQUIRE(lazy.pRootTile);
+    REQUIRE(lazy.pRootTile->getChildren().size() == 1);
+
+    Tile& root = lazy.pRootTile->getChildren()[0];
+    REQUIRE(root.getChildren().size() == 4);
+    for (Tile& child : root.getChildren()) {
+      CHECK(child.getChildren().empty());
+    }
 
-  pAssetAccessor->mockCompletedRequests.insert(
-      {tilesetPath, std::move(pMockCompletedRequest)});
+    TileChildrenResult result =
+        lazy.pLoader->createTileChildren(root.getChildren()[0]);
+    CHECK(result.state == TileLoadResultState::Success);
+    CHECK(result.children.size() == 4);
+    root.getChildren()[0].createChildTiles(std::move(result.children));
+
+    // The children are only created once.
+    result = lazy.pLoader->createTileChildren(root.getChildren()[0]);
+    CHECK(result.state == TileLoadResultState::Failed);
+
+    // A leaf tile has no children to create.
+    Tile& grandchild = root.getChildren()[0].getChildren()[0];
+    createAllLatentChildren(grandchild);
+    REQUIRE(grandchild.getChildren().size() == 4);
+    result = lazy.pLoader->createTileChildren(grandchild.getChildren()[0]);
+    CHECK(result.state == TileLoadResultState::Failed);
+  }
+
+  SECTION("for a large tileset") {
+    const std::string json = createSyntheticTilesetJson(4);
+    const auto expected = createTilesetJsonLoaderFromDocument(json);
+    for (const bool streaming : {false, true}) {
+      const auto actual = streaming
+                              ? createTilesetJsonLoaderFromString(json, true)
+                              : createTilesetJsonLoaderLazily(json);
+      REQUIRE(actual.pRootTile);
+      createAllLatentChildren(*actual.pRootTile);
+      checkSameTiles(*expected.pRootTile, *actual.pRootTile);
+    }
+  }
+
+  SECTION("when tiles inherit their properties from their parents") {
+    const std::string json = R"({
+      "asset": { "version": "1.0" },
+      "root": {
+        "boundingVolume": { "sphere": [0, 0, 0, 10] },
+        "geometricError": 100,
+        "refine": "ADD",
+        "transform": [2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 10, 20, 30, 1],
+        "children": [{
+          "boundingVolume": { "sphere": [0, 0, 0, 5] },
+          "transform": [1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 2, 3, 1],
+          "children": [{
+            "boundingVolume": { "sphere": [0, 0, 0, 2] },
+            "content": { "uri": "grandchild.b3dm" },
+            "children": [{
+              "boundingVolume": { "sphere": [0, 0, 0, 1] },
+              "refine": "REPLACE"
+            }, {
+              "content": { "uri": "no-bounding-volume.b3dm" }
+            }]
+          }]
+        }]
+      }
+    })";
+
+    const auto expected = createTilesetJsonLoaderFromDocument(json);
+    const auto actual = createTilesetJsonLoaderLazily(json);
+    REQUIRE(actual.pRootTile);
+    createAllLatentChildren(*actual.pRootTile);
+    checkSameTiles(*expected.pRootTile, *actual.pRootTile);
+  }
+}
+
+TEST_CASE("Tile tree memory usage") {
+  Tile root(nullptr);
+  root.setTileID("root.b3dm");
+
+  std::vector<Tile> children;
+  children.emplace_back(nullptr);
+  children.emplace_back(nullptr);
+  children[0].setTileID(
+      "a/long/path/that/does/not/fit/within/the/string/child.b3dm");
+  root.createChildTiles(std::move(children));
+
+  SECTION("tiles without rarely-used properties don't allocate them") {
+    CHECK(!root.getViewerRequestVolume());
+    CHECK(!root.getContentBoundingVolume());
+
+    // Clearing a property that isn't set doesn't allocate either.
+    root.setViewerRequestVolume(std::nullopt);
+
+    const TileTreeMemoryUsage usage = root.computeTreeMemoryUsage();
+    CHECK(usage.tileCount == 3);
+    CHECK(usage.tileBytes >= int64_t(3 * sizeof(Tile)));
+    CHECK(usage.coldDataBytes == 0);
+    CHECK(usage.tileIDBytes > 0);
+    CHECK(usage.rasterMappingBytes == 0);
+    CHECK(
+        usage.getTotalBytes() == usage.tileBytes + usage.tileIDBytes +
+                                     usage.coldDataBytes +
+                                     usage.rasterMappingBytes);
+  }
+
+  SECTION("rarely-used properties are stored out of line") {
+    const BoundingVolume sphere =
+        CesiumGeometry::BoundingSphere(glm::dvec3(1.0, 2.0, 3.0), 4.0);
+    Tile& child = root.getChildren()[1];
+    child.setContentBoundingVolume(sphere);
 
-  auto pMockPrepareRendererResource =
-      std::make_shared<SimplePrepareRendererResource>();
+    CHECK(!child.getViewerRequestVolume());
+    REQUIRE(child.getContentBoundingVolume());
+    CHECK(
+        std::get<CesiumGeometry::BoundingSphere>(
+            *child.getContentBoundingVolume())
+            .getRadius() == 4.0);
 
-  auto pMockCreditSystem = std::make_shared<CesiumUtility::CreditSystem>();
+    const int64_t coldDataBytes = root.computeTreeMemoryUsage().coldDataBytes;
+    CHECK(coldDataBytes > 0);
 
-  CesiumAsync::AsyncSystem asyncSystem{
-      std::make_shared<CesiumNativeTests::SimpleTaskProcessor>()};
+    child.setViewerRequestVolume(sphere);
+    REQUIRE(child.getViewerRequestVolume());
+    CHECK(root.computeTreeMemoryUsage().coldDataBytes == coldDataBytes);
 
-  return TilesetExternals{
-      std::move(pAssetAccessor),
-      std::move(pMockPrepareRendererResource),
-      std::move(asyncSystem),
-      std::move(pMockCreditSystem)};
+    child.setContentBoundingVolume(std::nullopt);
+    CHECK(!child.getContentBoundingVolume());
+    CHECK(child.getViewerRequestVolume());
+  }
+}
+
+TEST_CASE("Benchmark loading a large tileset.json", "[.][benchmark]") {
+  // A complete quadtree with 9 levels has 87,381 tiles.
+  const std::string json = createSyntheticTilesetJson(8);
+  rapidjson::Document document;
+  document.Parse(json.data(), json.size());
+  REQUIRE(!document.HasParseError());
+
+  AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+  auto pAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>());
+
+  auto loadTileset = [&]() {
+    return TilesetJsonLoader::createLoader(
+               asyncSystem,
+               pAccessor,
+               spdlog::default_logger(),
+               "tileset.json",
+               {},
+               document)
+        .wait();
+  };
+
+  const TilesetContentLoaderResult<TilesetJsonLoader> loaderResult =
+      loadTileset();
+  REQUIRE(loaderResult.pRootTile);
+
+  const TileTreeMemoryUsage usage =
+      loaderResult.pRootTile->computeTreeMemoryUsage();
+  WARN(
+      "Tile tree of " << usage.tileCount << " tiles uses "
+                      << usage.getTotalBytes() << " bytes, "
+                      << usage.getTotalBytes() / usage.tileCount
+                      << " bytes per tile");
+
+  const std::string suffix =
+      " tileset.json with " + std::to_string(usage.tileCount) + " tiles";
+
+#ifdef __linux__
+  // The peak memory used while reading, beyond what was already resident.
+  // Each reader is run once outside of the benchmark so that the peak isn't
+  // shared with the other.
+  for (const bool streaming : {false, true}) {
+    const int64_t resident = getProcessMemoryStatus("VmRSS:");
+    resetPeakResidentSetSize();
+    {
+      const auto result = streaming ? createTilesetJsonLoaderFromString(json)
+                                    : createTilesetJsonLoaderFromDocument(json);
+      REQUIRE(result.pRootTile);
+    }
+    WARN(
+        (streaming ? "Streaming" : "DOM") << " read of" << suffix
+                                          << " used a peak of "
+                                          << getProcessMemoryStatus("VmHWM:") -
+                                                 resident
+                                          << " additional resident bytes");
+  }
+#endif
+
+  BENCHMARK("Create tiles from a parsed" + suffix) { return loadTileset(); };
+
+  auto pDocument = std::make_shared<rapidjson::Document>();
+  pDocument->Parse(json.data(), json.size());
+  BENCHMARK("Create the root tile and its children from a parsed" + suffix) {
+    return TilesetJsonLoader::createLoader(
+               asyncSystem,
+               pAccessor,
+               spdlog::default_logger(),
+               "tileset.json",
+               {},
+               pDocument)
+        .wait();
+  };
+
+  BENCHMARK("Parse and create tiles from a DOM" + suffix) {
+    return createTilesetJsonLoaderFromDocument(json);
+  };
+
+  BENCHMARK("Stream and create tiles from a" + suffix) {
+    return createTilesetJsonLoaderFromString(json);
+  };
 }
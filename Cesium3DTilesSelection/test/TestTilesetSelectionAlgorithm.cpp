@@ -11,6 +11,7 @@
 #include <CesiumNativeTests/SimpleTaskProcessor.h>
 #include <CesiumNativeTests/readFile.h>
 #include <CesiumUtility/Math.h>
+#include <CesiumUtility/Metrics.h>
 
 #include <catch2/catch.hpp>
 #include <glm/mat4x4.hpp>
@@ -100,6 +101,13 @@ static ViewState zoomToTile(const Tile& tile) {
       Ellipsoid::WGS84);
 }
 
+static bool isInRenderList(const ViewUpdateResult& result, const Tile* pTile) {
+  return std::find(
+             result.tilesToRenderThisFrame.begin(),
+             result.tilesToRenderThisFrame.end(),
+             pTile) != result.tilesToRenderThisFrame.end();
+}
+
 static ViewState zoomToTileset(const Tileset& tileset) {
   const Tile* root = tileset.getRootTile();
   REQUIRE(root != nullptr);
@@ -375,11 +383,13 @@ TEST_CASE("Test replace refinement for render") {
       }
 
       // check result
+      // Children are visited near-to-far, so the order of the render list
+      // depends on the camera position.
       REQUIRE(result.tilesToRenderThisFrame.size() == 4);
-      REQUIRE(result.tilesToRenderThisFrame[0] == &ll_ll);
-      REQUIRE(result.tilesToRenderThisFrame[1] == &root->getChildren()[1]);
-      REQUIRE(result.tilesToRenderThisFrame[2] == &root->getChildren()[2]);
-      REQUIRE(result.tilesToRenderThisFrame[3] == &root->getChildren()[3]);
+      REQUIRE(isInRenderList(result, &ll_ll));
+      REQUIRE(isInRenderList(result, &root->getChildren()[1]));
+      REQUIRE(isInRenderList(result, &root->getChildren()[2]));
+      REQUIRE(isInRenderList(result, &root->getChildren()[3]));
 
       REQUIRE(result.tilesFadingOut.size() == 1);
 
@@ -429,11 +439,13 @@ TEST_CASE("Test replace refinement for render") {
       }
 
       // check result
+      // Children are visited near-to-far, so the order of the render list
+      // depends on the camera position.
       REQUIRE(result.tilesToRenderThisFrame.size() == 4);
-      REQUIRE(result.tilesToRenderThisFrame[0] == &ll);
-      REQUIRE(result.tilesToRenderThisFrame[1] == &root->getChildren()[1]);
-      REQUIRE(result.tilesToRenderThisFrame[2] == &root->getChildren()[2]);
-      REQUIRE(result.tilesToRenderThisFrame[3] == &root->getChildren()[3]);
+      REQUIRE(isInRenderList(result, &ll));
+      REQUIRE(isInRenderList(result, &root->getChildren()[1]));
+      REQUIRE(isInRenderList(result, &root->getChildren()[2]));
+      REQUIRE(isInRenderList(result, &root->getChildren()[3]));
 
       REQUIRE(result.tilesFadingOut.size() == 1);
 
@@ -1678,3 +1690,81 @@ TEST_CASE("Additive-refined tiles are added to the tilesFadingOut array") {
   CHECK(updateResult.tilesToRenderThisFrame.size() == 2);
   CHECK(updateResult.tilesFadingOut.size() == 2);
 }
+
+TEST_CASE("Tileset records metrics in the metrics sink") {
+  Cesium3DTilesContent::registerAllTileContentTypes();
+
+  std::filesystem::path testDataPath = Cesium3DTilesSelection_TEST_DATA_DIR;
+  testDataPath = testDataPath / "AdditiveThreeLevels";
+  std::vector<std::string> files{"tileset.json", "content.b3dm"};
+
+  std::map<std::string, std::shared_ptr<SimpleAssetRequest>>
+      mockCompletedRequests;
+  for (const auto& file : files) {
+    std::unique_ptr<SimpleAssetResponse> mockCompletedResponse =
+        std::make_unique<SimpleAssetResponse>(
+            static_cast<uint16_t>(200),
+            "doesn't matter",
+            CesiumAsync::HttpHeaders{},
+            readFile(testDataPath / file));
+    mockCompletedRequests.insert(
+        {file,
+         std::make_shared<SimpleAssetRequest>(
+             "GET",
+             file,
+             CesiumAsync::HttpHeaders{},
+             std::move(mockCompletedResponse))});
+  }
+
+  std::shared_ptr<SimpleAssetAccessor> mockAssetAccessor =
+      std::make_shared<SimpleAssetAccessor>(std::move(mockCompletedRequests));
+  std::shared_ptr<InMemoryMetricsSink> pSink =
+      std::make_shared<InMemoryMetricsSink>();
+  TilesetExternals tilesetExternals{
+      mockAssetAccessor,
+      std::make_shared<SimplePrepareRendererResource>(),
+      AsyncSystem(std::make_shared<SimpleTaskProcessor>()),
+      nullptr};
+  tilesetExternals.pMetricsSink = pSink;
+
+  Tileset tileset(tilesetExternals, "tileset.json");
+  initializeTileset(tileset);
+
+  ViewState viewState = zoomToTileset(tileset);
+  int64_t frames = 0;
+  while (tileset.getNumberOfTilesLoaded() == 0 ||
+         tileset.computeLoadProgress() < 100.0f) {
+    tileset.updateView({viewState});
+    ++frames;
+  }
+
+  const MetricHistogram* pUpdateView =
+      pSink->findHistogram("tileset.updateViewMicroseconds");
+  REQUIRE(pUpdateView != nullptr);
+  CHECK(pUpdateView->getCount() >= frames);
+  CHECK(
+      pSink->getHistogram("tileset.workerThreadLoadQueueLength").getCount() ==
+      pUpdateView->getCount());
+
+  // Every tile load has finished, and they all loaded b3dm content.
+  CHECK(pSink->getGauge("tileset.tilesLoading").get() == 0);
+  CHECK(pSink->getCounter("tileset.failedTileLoads").get() == 0);
+  CHECK(pSink->getHistogram("tileset.tileLoadMicroseconds").getCount() > 0);
+  CHECK(
+      pSink->getHistogram("tileset.contentFetchAndLoadMicroseconds.b3dm")
+          .getCount() > 0);
+  CHECK(
+      pSink->getHistogram("tileset.contentFetchAndLoadMicroseconds.pnts")
+          .getCount() == 0);
+
+  // Every b3dm was decoded by the loader, and its decode time recorded
+  // separately from the fetch and load time.
+  CHECK(
+      pSink->getHistogram("tileset.contentDecodeMicroseconds.b3dm")
+          .getCount() ==
+      pSink->getHistogram("tileset.contentFetchAndLoadMicroseconds.b3dm")
+          .getCount());
+  CHECK(
+      pSink->getHistogram("tileset.contentDecodeMicroseconds.pnts")
+          .getCount() == 0);
+}
@@ -0,0 +1,717 @@
+#include "SimplePrepareRendererResource.h"
+
+#include <Cesium3DTilesSelection/Tileset.h>
+#include <Cesium3DTilesSelection/TilesetContentLoader.h>
+#include <Cesium3DTilesSelection/ViewState.h>
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GeographicProjection.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/Projection.h>
+#include <CesiumGltf/ImageAsset.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumNativeTests/ThreadTaskProcessor.h>
+#include <CesiumRasterOverlays/RasterOverlay.h>
+#include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
+#include <CesiumUtility/IntrusivePointer.h>
+#include <CesiumUtility/Math.h>
+
+#include <catch2/catch.hpp>
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <variant>
+#include <vector>
+
+using namespace CesiumAsync;
+using namespace Cesium3DTilesSelection;
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
+
+namespace {
+
+/**
+ * @brief A loader for a synthetic, fully-populated quadtree of replacement
+ * refined tiles. Every tile loads instantly with a glTF that has no meshes,
+ * optionally with a buffer of the given size so that it counts toward the
+ * tile cache.
+ */
+class SyntheticQuadtreeLoader : public TilesetContentLoader {
+public:
+  static constexpr double rootGeometricError = 100000.0;
+
+  explicit SyntheticQuadtreeLoader(size_t bufferBytes = 0)
+      : _bufferBytes(bufferBytes) {}
+
+  std::unique_ptr<Tile>
+  createRootTile(const GlobeRectangle& rectangle, uint32_t maximumLevel) {
+    auto pRootTile = std::make_unique<Tile>(this);
+    initializeTile(*pRootTile, QuadtreeTileID(0, 0, 0), rectangle);
+    createChildren(
+        *pRootTile,
+        QuadtreeTileID(0, 0, 0),
+        rectangle,
+        maximumLevel);
+    return pRootTile;
+  }
+
+  virtual CesiumAsync::Future<TileLoadResult>
+  loadTileContent(const TileLoadInput& input) override {
+    CesiumGltf::Model model;
+    if (this->_bufferBytes > 0) {
+      model.buffers.emplace_back().cesium.data.resize(this->_bufferBytes);
+    }
+
+    TileLoadResult result{};
+    result.contentKind = std::move(model);
+    return input.asyncSystem.createResolvedFuture(std::move(result));
+  }
+
+  virtual TileChildrenResult createTileChildren(
+      const Tile&,
+      const CesiumGeospatial::Ellipsoid&) override {
+    return TileChildrenResult{{}, TileLoadResultState::Failed};
+  }
+
+private:
+  static void initializeTile(
+      Tile& tile,
+      const QuadtreeTileID& id,
+      const GlobeRectangle& rectangle) {
+    tile.setTileID(id);
+    tile.setRefine(TileRefine::Replace);
+    tile.setBoundingVolume(
+        BoundingRegion(rectangle, 0.0, 10.0, Ellipsoid::WGS84));
+    tile.setGeometricError(
+        rootGeometricError / static_cast<double>(1U << id.level));
+  }
+
+  void createChildren(
+      Tile& parent,
+      const QuadtreeTileID& parentID,
+      const GlobeRectangle& parentRectangle,
+      uint32_t maximumLevel) {
+    if (parentID.level >= maximumLevel) {
+      return;
+    }
+
+    const Cartographic center = parentRectangle.computeCenter();
+
+    std::vector<GlobeRectangle> rectangles;
+    std::vector<Tile> children;
+    children.reserve(4);
+    for (uint32_t y = 0; y < 2; ++y) {
+      for (uint32_t x = 0; x < 2; ++x) {
+        GlobeRectangle rectangle(
+            x == 0 ? parentRectangle.getWest() : center.longitude,
+            y == 0 ? parentRectangle.getSouth() : center.latitude,
+            x == 0 ? center.longitude : parentRectangle.getEast(),
+            y == 0 ? center.latitude : parentRectangle.getNorth());
+        QuadtreeTileID id(
+            parentID.level + 1,
+            parentID.x * 2 + x,
+            parentID.y * 2 + y);
+
+        Tile& child = children.emplace_back(this);
+        initializeTile(child, id, rectangle);
+        rectangles.emplace_back(rectangle);
+      }
+    }
+
+    parent.createChildTiles(std::move(children));
+
+    for (size_t i = 0; i < parent.getChildren().size(); ++i) {
+      Tile& child = parent.getChildren()[i];
+      createChildren(
+          child,
+          std::get<QuadtreeTileID>(child.getTileID()),
+          rectangles[i],
+          maximumLevel);
+    }
+  }
+
+  size_t _bufferBytes;
+};
+
+GlobeRectangle createSyntheticRectangle() {
+  const Cartographic center = Cartographic::fromDegrees(118.0, 32.0, 0.0);
+  return GlobeRectangle(
+      center.longitude - 0.01,
+      center.latitude - 0.01,
+      center.longitude + 0.01,
+      center.latitude + 0.01);
+}
+
+std::unique_ptr<Tileset> createSyntheticTileset(
+    uint32_t maximumLevel,
+    const TilesetOptions& options,
+    const std::shared_ptr<ITaskProcessor>& pTaskProcessor =
+        std::make_shared<SimpleTaskProcessor>(),
+    size_t bufferBytesPerTile = 0) {
+  TilesetExternals tilesetExternals{
+      nullptr,
+      std::make_shared<SimplePrepareRendererResource>(),
+      AsyncSystem(pTaskProcessor),
+      nullptr};
+
+  auto pLoader = std::make_unique<SyntheticQuadtreeLoader>(bufferBytesPerTile);
+  std::unique_ptr<Tile> pRootTile =
+      pLoader->createRootTile(createSyntheticRectangle(), maximumLevel);
+
+  return std::make_unique<Tileset>(
+      tilesetExternals,
+      std::move(pLoader),
+      std::move(pRootTile),
+      options);
+}
+
+// Looks slightly down and across the tileset toward its center, from a point
+// just above the given fraction of its width and height. By default, that is
+// near its south-west corner.
+ViewState createSyntheticViewState(double x = 0.1, double y = 0.1) {
+  const GlobeRectangle rectangle = createSyntheticRectangle();
+  const Cartographic position(
+      rectangle.getWest() + rectangle.computeWidth() * x,
+      rectangle.getSouth() + rectangle.computeHeight() * y,
+      100.0);
+  const Cartographic target = rectangle.computeCenter();
+
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+  glm::dvec3 viewPosition = ellipsoid.cartographicToCartesian(position);
+  glm::dvec3 viewFocus = ellipsoid.cartographicToCartesian(target);
+  glm::dvec3 viewUp = ellipsoid.geodeticSurfaceNormal(viewPosition);
+  glm::dvec2 viewPortSize{1024.0, 1024.0};
+  double horizontalFieldOfView = Math::degreesToRadians(60.0);
+
+  return ViewState::create(
+      viewPosition,
+      glm::normalize(viewFocus - viewPosition),
+      viewUp,
+      viewPortSize,
+      horizontalFieldOfView,
+      horizontalFieldOfView,
+      ellipsoid);
+}
+
+const Tile* findLeafUnderCamera(const Tile& root, const ViewState& viewState) {
+  const std::optional<Cartographic>& position =
+      viewState.getPositionCartographic();
+  REQUIRE(position);
+
+  const Tile* pTile = &root;
+  while (!pTile->getChildren().empty()) {
+    const Tile* pNext = nullptr;
+    for (const Tile& child : pTile->getChildren()) {
+      const BoundingRegion* pRegion =
+          std::get_if<BoundingRegion>(&child.getBoundingVolume());
+      if (pRegion && pRegion->getRectangle().contains(*position)) {
+        pNext = &child;
+        break;
+      }
+    }
+
+    REQUIRE(pNext != nullptr);
+    pTile = pNext;
+  }
+
+  return pTile;
+}
+
+std::vector<ViewState> createSyntheticViewStates() {
+  return {
+      createSyntheticViewState(0.1, 0.1),
+      createSyntheticViewState(0.9, 0.1),
+      createSyntheticViewState(0.1, 0.9),
+      createSyntheticViewState(0.9, 0.9),
+      createSyntheticViewState(0.3, 0.6),
+      createSyntheticViewState(0.6, 0.3)};
+}
+
+void loadUntilComplete(
+    Tileset& tileset,
+    const std::vector<ViewState>& frustums) {
+  while (tileset.getNumberOfTilesLoaded() == 0 ||
+         tileset.computeLoadProgress() < 100.0f) {
+    tileset.updateView(frustums);
+  }
+}
+
+std::vector<QuadtreeTileID> getRenderedTileIDs(const ViewUpdateResult& result) {
+  std::vector<QuadtreeTileID> ids;
+  for (const Tile* pTile : result.tilesToRenderThisFrame) {
+    ids.emplace_back(std::get<QuadtreeTileID>(pTile->getTileID()));
+  }
+  return ids;
+}
+
+// Returns the number of frames it takes until the leaf tile directly under the
+// camera is rendered.
+int32_t
+updateUntilFirstMeaningfulFrame(Tileset& tileset, const ViewState& viewState) {
+  const Tile* pRootTile = tileset.getRootTile();
+  REQUIRE(pRootTile);
+  const Tile* pLeaf = findLeafUnderCamera(*pRootTile, viewState);
+
+  const std::vector<ViewState> frustums{viewState};
+  for (int32_t frame = 1; frame < 100000; ++frame) {
+    const ViewUpdateResult& result = tileset.updateView(frustums);
+    if (std::find(
+            result.tilesToRenderThisFrame.begin(),
+            result.tilesToRenderThisFrame.end(),
+            pLeaf) != result.tilesToRenderThisFrame.end()) {
+      return frame;
+    }
+  }
+
+  return -1;
+}
+
+/**
+ * @brief A loader for a root tile with a single leaf child that has a zero
+ * geometric error. The leaf loads a glTF with a quad that covers its bounding
+ * region, so that raster overlays can be draped over it.
+ */
+class ZeroErrorLeafLoader : public TilesetContentLoader {
+public:
+  std::unique_ptr<Tile> createRootTile(const GlobeRectangle& rectangle) {
+    auto pRootTile = std::make_unique<Tile>(this);
+    pRootTile->setTileID(QuadtreeTileID(0, 0, 0));
+    pRootTile->setRefine(TileRefine::Replace);
+    pRootTile->setBoundingVolume(
+        BoundingRegion(rectangle, 0.0, 10.0, Ellipsoid::WGS84));
+    pRootTile->setGeometricError(100000.0);
+
+    std::vector<Tile> children;
+    Tile& leaf = children.emplace_back(this);
+    leaf.setTileID(QuadtreeTileID(1, 0, 0));
+    leaf.setRefine(TileRefine::Replace);
+    leaf.setBoundingVolume(pRootTile->getBoundingVolume());
+    leaf.setGeometricError(0.0);
+    pRootTile->createChildTiles(std::move(children));
+
+    this->_rectangle = rectangle;
+    return pRootTile;
+  }
+
+  virtual CesiumAsync::Future<TileLoadResult>
+  loadTileContent(const TileLoadInput& input) override {
+    TileLoadResult result{};
+    result.glTFUpAxis = Axis::Z;
+    if (input.tile.getParent() == nullptr) {
+      result.contentKind = CesiumGltf::Model();
+    } else {
+      result.contentKind = createQuad(this->_rectangle);
+    }
+    return input.asyncSystem.createResolvedFuture(std::move(result));
+  }
+
+  virtual TileChildrenResult createTileChildren(
+      const Tile&,
+      const CesiumGeospatial::Ellipsoid&) override {
+    return TileChildrenResult{{}, TileLoadResultState::Failed};
+  }
+
+private:
+  static CesiumGltf::Model createQuad(const GlobeRectangle& rectangle) {
+    const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+    const glm::dvec3 corners[4]{
+        ellipsoid.cartographicToCartesian(rectangle.getSouthwest()),
+        ellipsoid.cartographicToCartesian(rectangle.getSoutheast()),
+        ellipsoid.cartographicToCartesian(rectangle.getNorthwest()),
+        ellipsoid.cartographicToCartesian(rectangle.getNortheast())};
+    const glm::dvec3 center =
+        ellipsoid.cartographicToCartesian(rectangle.computeCenter());
+
+    std::vector<glm::vec3> positions;
+    for (const glm::dvec3& corner : corners) {
+      positions.emplace_back(glm::vec3(corner - center));
+    }
+    const std::vector<uint16_t> indices{0, 1, 2, 1, 3, 2};
+
+    CesiumGltf::Model model;
+    CesiumGltf::Buffer& buffer = model.buffers.emplace_back();
+    const size_t positionsBytes = positions.size() * sizeof(glm::vec3);
+    const size_t indicesBytes = indices.size() * sizeof(uint16_t);
+    buffer.cesium.data.resize(positionsBytes + indicesBytes);
+    buffer.byteLength = static_cast<int64_t>(buffer.cesium.data.size());
+    std::memcpy(buffer.cesium.data.data(), positions.data(), positionsBytes);
+    std::memcpy(
+        buffer.cesium.data.data() + positionsBytes,
+        indices.data(),
+        indicesBytes);
+
+    CesiumGltf::BufferView& positionsView = model.bufferViews.emplace_back();
+    positionsView.buffer = 0;
+    positionsView.byteLength = static_cast<int64_t>(positionsBytes);
+
+    CesiumGltf::BufferView& indicesView = model.bufferViews.emplace_back();
+    indicesView.buffer = 0;
+    indicesView.byteOffset = static_cast<int64_t>(positionsBytes);
+    indicesView.byteLength = static_cast<int64_t>(indicesBytes);
+
+    CesiumGltf::Accessor& positionsAccessor = model.accessors.emplace_back();
+    positionsAccessor.bufferView = 0;
+    positionsAccessor.componentType =
+        CesiumGltf::Accessor::ComponentType::FLOAT;
+    positionsAccessor.count = static_cast<int64_t>(positions.size());
+    positionsAccessor.type = CesiumGltf::Accessor::Type::VEC3;
+
+    CesiumGltf::Accessor& indicesAccessor = model.accessors.emplace_back();
+    indicesAccessor.bufferView = 1;
+    indicesAccessor.componentType =
+        CesiumGltf::Accessor::ComponentType::UNSIGNED_SHORT;
+    indicesAccessor.count = static_cast<int64_t>(indices.size());
+    indicesAccessor.type = CesiumGltf::Accessor::Type::SCALAR;
+
+    CesiumGltf::MeshPrimitive& primitive =
+        model.meshes.emplace_back().primitives.emplace_back();
+    primitive.attributes["POSITION"] = 0;
+    primitive.indices = 1;
+
+    CesiumGltf::Node& node = model.nodes.emplace_back();
+    node.translation = {center.x, center.y, center.z};
+    node.mesh = 0;
+    model.scenes.emplace_back().nodes.emplace_back(0);
+
+    return model;
+  }
+
+  GlobeRectangle _rectangle = GlobeRectangle::EMPTY;
+};
+
+/**
+ * @brief A raster overlay whose every tile is a single white pixel, and
+ * always claims that more detail is available.
+ */
+class AlwaysMoreDetailRasterOverlay : public RasterOverlay {
+public:
+  AlwaysMoreDetailRasterOverlay() : RasterOverlay("AlwaysMoreDetail") {}
+
+  CesiumAsync::Future<CreateTileProviderResult> createTileProvider(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+      const std::shared_ptr<CesiumUtility::CreditSystem>& /* pCreditSystem */,
+      const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+          pPrepareRendererResources,
+      const std::shared_ptr<spdlog::logger>& pLogger,
+      CesiumUtility::IntrusivePointer<const RasterOverlay> pOwner)
+      const override {
+    return asyncSystem.createResolvedFuture(CreateTileProviderResult(
+        CesiumUtility::IntrusivePointer<RasterOverlayTileProvider>(
+            new Provider(
+                pOwner ? pOwner : this,
+                asyncSystem,
+                pAssetAccessor,
+                pPrepareRendererResources,
+                pLogger))));
+  }
+
+private:
+  class Provider : public RasterOverlayTileProvider {
+  public:
+    Provider(
+        const CesiumUtility::IntrusivePointer<const RasterOverlay>& pOwner,
+        const CesiumAsync::AsyncSystem& asyncSystem,
+        const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+        const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+            pPrepareRendererResources,
+        const std::shared_ptr<spdlog::logger>& pLogger)
+        : RasterOverlayTileProvider(
+              pOwner,
+              asyncSystem,
+              pAssetAccessor,
+              std::nullopt,
+              pPrepareRendererResources,
+              pLogger,
+              GeographicProjection(),
+              projectRectangleSimple(
+                  GeographicProjection(),
+                  GlobeRectangle::MAXIMUM)) {}
+
+    CesiumAsync::Future<LoadedRasterOverlayImage>
+    loadTileImage(RasterOverlayTile& overlayTile) override {
+      CesiumUtility::IntrusivePointer<CesiumGltf::ImageAsset> pImage;
+      CesiumGltf::ImageAsset& image = pImage.emplace();
+      image.width = 1;
+      image.height = 1;
+      image.channels = 1;
+      image.bytesPerChannel = 1;
+      image.pixelData.resize(1, std::byte(255));
+
+      return this->getAsyncSystem().createResolvedFuture(
+          LoadedRasterOverlayImage{
+              std::move(pImage),
+              overlayTile.getRectangle(),
+              {},
+              {},
+              true});
+    }
+  };
+};
+
+} // namespace
+
+TEST_CASE("Tileset visits children near-to-far") {
+  std::unique_ptr<Tileset> pTileset =
+      createSyntheticTileset(1, TilesetOptions());
+  ViewState viewState = createSyntheticViewState();
+
+  // Load until complete.
+  const std::vector<ViewState> frustums{viewState};
+  ViewUpdateResult result;
+  while (pTileset->getNumberOfTilesLoaded() == 0 ||
+         pTileset->computeLoadProgress() < 100.0f) {
+    result = pTileset->updateView(frustums);
+  }
+  result = pTileset->updateView(frustums);
+
+  // All four leaves are rendered, and since they are all renderable they end
+  // up in the render list in the order in which they were visited.
+  REQUIRE(result.tilesToRenderThisFrame.size() == 4);
+
+  double lastDistanceSquared = 0.0;
+  for (const Tile* pTile : result.tilesToRenderThisFrame) {
+    const double distanceSquared =
+        viewState.computeDistanceSquaredToBoundingVolume(
+            pTile->getBoundingVolume());
+    CHECK(distanceSquared >= lastDistanceSquared);
+    lastDistanceSquared = distanceSquared;
+  }
+
+  // The nearest child is the one the camera is above.
+  CHECK(
+      result.tilesToRenderThisFrame.front() ==
+      findLeafUnderCamera(*pTileset->getRootTile(), viewState));
+}
+
+TEST_CASE("Parallel tile evaluation selects the same tiles") {
+  TilesetOptions parallelOptions;
+  parallelOptions.enableParallelTileEvaluation = true;
+
+  std::unique_ptr<Tileset> pSerial =
+      createSyntheticTileset(5, TilesetOptions());
+  std::unique_ptr<Tileset> pParallel =
+      createSyntheticTileset(5, parallelOptions);
+
+  const std::vector<ViewState> frustums = createSyntheticViewStates();
+
+  // Compare every frame while loading, and a few after loading is complete.
+  int32_t framesAfterLoad = 0;
+  while (framesAfterLoad < 3) {
+    const ViewUpdateResult serial = pSerial->updateView(frustums);
+    const ViewUpdateResult parallel = pParallel->updateView(frustums);
+
+    CHECK(getRenderedTileIDs(serial) == getRenderedTileIDs(parallel));
+    CHECK(serial.tilesFadingOut.size() == parallel.tilesFadingOut.size());
+    CHECK(serial.tilesVisited == parallel.tilesVisited);
+    CHECK(serial.culledTilesVisited == parallel.culledTilesVisited);
+    CHECK(serial.tilesCulled == parallel.tilesCulled);
+    CHECK(serial.tilesKicked == parallel.tilesKicked);
+    CHECK(serial.maxDepthVisited == parallel.maxDepthVisited);
+    CHECK(
+        serial.workerThreadTileLoadQueueLength ==
+        parallel.workerThreadTileLoadQueueLength);
+    CHECK(
+        serial.mainThreadTileLoadQueueLength ==
+        parallel.mainThreadTileLoadQueueLength);
+    CHECK(
+        pSerial->getNumberOfTilesLoaded() ==
+        pParallel->getNumberOfTilesLoaded());
+
+    if (pSerial->getNumberOfTilesLoaded() > 0 &&
+        pSerial->computeLoadProgress() >= 100.0f) {
+      ++framesAfterLoad;
+    }
+  }
+}
+
+TEST_CASE("Parallel tile evaluation selects the same tiles with a thread "
+          "pool") {
+  TilesetOptions parallelOptions;
+  parallelOptions.enableParallelTileEvaluation = true;
+
+  std::unique_ptr<Tileset> pSerial = createSyntheticTileset(
+      5,
+      TilesetOptions(),
+      std::make_shared<ThreadTaskProcessor>());
+  std::unique_ptr<Tileset> pParallel = createSyntheticTileset(
+      5,
+      parallelOptions,
+      std::make_shared<ThreadTaskProcessor>());
+
+  const std::vector<ViewState> frustums = createSyntheticViewStates();
+
+  // Tiles load in a nondeterministic order with a thread pool, so only compare
+  // the frames after loading is complete, where the worker threads evaluate
+  // the subtrees while the main thread evaluates the ones they haven't
+  // started.
+  loadUntilComplete(*pSerial, frustums);
+  loadUntilComplete(*pParallel, frustums);
+
+  for (int32_t i = 0; i < 3; ++i) {
+    const ViewUpdateResult serial = pSerial->updateView(frustums);
+    const ViewUpdateResult parallel = pParallel->updateView(frustums);
+
+    CHECK(getRenderedTileIDs(serial) == getRenderedTileIDs(parallel));
+    CHECK(serial.tilesVisited == parallel.tilesVisited);
+    CHECK(serial.culledTilesVisited == parallel.culledTilesVisited);
+    CHECK(serial.tilesCulled == parallel.tilesCulled);
+    CHECK(serial.maxDepthVisited == parallel.maxDepthVisited);
+  }
+}
+
+TEST_CASE("Tileset unloads cached tiles down to the target") {
+  const int64_t bytesPerTile = 1000;
+
+  // Loads all the tiles needed for one view, and then switches to a view of
+  // the opposite corner with a cache limit just below the number of bytes
+  // loaded so far. Returns the result of the first frame after switching.
+  auto switchViews = [bytesPerTile](double cacheUnloadTargetFraction) {
+    TilesetOptions options;
+    options.enableLodTransitionPeriod = false;
+    std::unique_ptr<Tileset> pTileset = createSyntheticTileset(
+        4,
+        options,
+        std::make_shared<SimpleTaskProcessor>(),
+        static_cast<size_t>(bytesPerTile));
+
+    loadUntilComplete(*pTileset, {createSyntheticViewState(0.1, 0.1)});
+
+    const int64_t loadedBytes = pTileset->getTotalDataBytes();
+    REQUIRE(loadedBytes > 0);
+    REQUIRE(loadedBytes % bytesPerTile == 0);
+
+    pTileset->getOptions().maximumCachedBytes = loadedBytes - 1;
+    pTileset->getOptions().cacheUnloadTargetFraction =
+        cacheUnloadTargetFraction;
+
+    ViewUpdateResult result =
+        pTileset->updateView({createSyntheticViewState(0.9, 0.9)});
+    CHECK(result.bytesEvicted == result.tilesEvicted * bytesPerTile);
+    return result;
+  };
+
+  SECTION("by default, only enough tiles to get under the limit") {
+    ViewUpdateResult result = switchViews(1.0);
+    CHECK(result.tilesEvicted == 1);
+    CHECK(result.bytesEvicted == bytesPerTile);
+  }
+
+  SECTION("to a lower watermark, more tiles") {
+    ViewUpdateResult result = switchViews(0.5);
+    CHECK(result.tilesEvicted > 1);
+  }
+}
+
+TEST_CASE("Tileset refines a zero-error leaf in the frame in which it is "
+          "subdivided for raster overlays") {
+  TilesetOptions options;
+  options.enableParallelTileEvaluation = GENERATE(false, true);
+
+  TilesetExternals tilesetExternals{
+      nullptr,
+      std::make_shared<SimplePrepareRendererResource>(),
+      AsyncSystem(std::make_shared<SimpleTaskProcessor>()),
+      nullptr};
+
+  auto pLoader = std::make_unique<ZeroErrorLeafLoader>();
+  std::unique_ptr<Tile> pRootTile =
+      pLoader->createRootTile(createSyntheticRectangle());
+  Tileset tileset(
+      tilesetExternals,
+      std::move(pLoader),
+      std::move(pRootTile),
+      options);
+  tileset.getOverlays().add(new AlwaysMoreDetailRasterOverlay());
+
+  const Tile* pRoot = tileset.getRootTile();
+  REQUIRE(pRoot);
+  REQUIRE(pRoot->getChildren().size() == 1);
+  const Tile& leaf = pRoot->getChildren()[0];
+
+  // The leaf is subdivided while it is visited, once it has loaded and its
+  // raster overlay tile reports that more detail is available.
+  const std::vector<ViewState> frustums{createSyntheticViewState()};
+  ViewUpdateResult result;
+  for (int32_t i = 0; i < 100 && leaf.getChildren().empty(); ++i) {
+    result = tileset.updateView(frustums);
+  }
+
+  REQUIRE(leaf.getChildren().size() == 4);
+  CHECK(leaf.getGeometricError() > 0.0);
+
+  // The leaf's new geometric error doesn't meet the screen-space error from
+  // this view, so its children are visited in the same frame.
+  for (const Tile& child : leaf.getChildren()) {
+    CHECK(child.getLastSelectionState().getFrameNumber() == result.frameNumber);
+  }
+}
+
+TEST_CASE("Benchmark tile selection", "[.][benchmark]") {
+  // A complete quadtree with 9 levels has 87,381 tiles.
+  const uint32_t maximumLevel = 8;
+  const ViewState viewState = createSyntheticViewState();
+
+  BENCHMARK_ADVANCED("First meaningful frame")
+  (Catch::Benchmark::Chronometer meter) {
+    std::vector<std::unique_ptr<Tileset>> tilesets(
+        static_cast<size_t>(meter.runs()));
+    for (std::unique_ptr<Tileset>& pTileset : tilesets) {
+      pTileset = createSyntheticTileset(maximumLevel, TilesetOptions());
+    }
+
+    meter.measure([&tilesets, &viewState](int i) {
+      return updateUntilFirstMeaningfulFrame(
+          *tilesets[static_cast<size_t>(i)],
+          viewState);
+    });
+  };
+
+  std::unique_ptr<Tileset> pTileset =
+      createSyntheticTileset(maximumLevel, TilesetOptions());
+  const std::vector<ViewState> frustums{viewState};
+  pTileset->updateView(frustums);
+
+  BENCHMARK("updateView") {
+    return pTileset->updateView(frustums).tilesVisited;
+  };
+
+  BENCHMARK_ADVANCED("updateView with many frustums")
+  (Catch::Benchmark::Chronometer meter) {
+    const std::vector<ViewState> manyFrustums = createSyntheticViewStates();
+    std::unique_ptr<Tileset> pSerial =
+        createSyntheticTileset(maximumLevel, TilesetOptions());
+    loadUntilComplete(*pSerial, manyFrustums);
+
+    meter.measure([&pSerial, &manyFrustums]() {
+      return pSerial->updateView(manyFrustums).tilesVisited;
+    });
+  };
+
+  BENCHMARK_ADVANCED("updateView with many frustums in parallel")
+  (Catch::Benchmark::Chronometer meter) {
+    TilesetOptions options;
+    options.enableParallelTileEvaluation = true;
+
+    const std::vector<ViewState> manyFrustums = createSyntheticViewStates();
+    std::unique_ptr<Tileset> pParallel = createSyntheticTileset(
+        maximumLevel,
+        options,
+        std::make_shared<ThreadTaskProcessor>());
+    loadUntilComplete(*pParallel, manyFrustums);
+
+    meter.measure([&pParallel, &manyFrustums]() {
+      return pParallel->updateView(manyFrustums).tilesVisited;
+    });
+  };
+}
@@ -0,0 +1,223 @@
+#include <Cesium3DTilesSelection/BoundingVolume.h>
+#include <Cesium3DTilesSelection/ViewState.h>
+#include <CesiumGeometry/BoundingSphere.h>
+#include <CesiumUtility/Math.h>
+
+#include <catch2/catch.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace Cesium3DTilesSelection;
+using namespace CesiumGeometry;
+using namespace CesiumUtility;
+
+namespace {
+
+// Looks along the X axis from the origin, with Z up. The left plane is on the
+// +Y side and the top plane is on the +Z side.
+ViewState createViewState() {
+  return ViewState::create(
+      glm::dvec3(0.0),
+      glm::dvec3(1.0, 0.0, 0.0),
+      glm::dvec3(0.0, 0.0, 1.0),
+      glm::dvec2(1024.0, 1024.0),
+      Math::degreesToRadians(90.0),
+      Math::degreesToRadians(90.0));
+}
+
+ViewState createViewState(double nearDistance, double farDistance) {
+  return ViewState::create(
+      glm::dvec3(0.0),
+      glm::dvec3(1.0, 0.0, 0.0),
+      glm::dvec3(0.0, 0.0, 1.0),
+      glm::dvec2(1024.0, 1024.0),
+      Math::degreesToRadians(90.0),
+      Math::degreesToRadians(90.0),
+      nearDistance,
+      farDistance);
+}
+
+struct SphereTile {
+  BoundingSphere sphere;
+  std::vector<SphereTile> children;
+};
+
+// Creates a quadtree of spheres in which every sphere is enclosed by its
+// parent's, as the 3D Tiles specification requires of tile bounding volumes.
+SphereTile createSphereTree(const BoundingSphere& sphere, uint32_t levels) {
+  SphereTile tile{sphere, {}};
+  if (levels == 0) {
+    return tile;
+  }
+
+  const double radius = sphere.getRadius();
+  for (const double y : {-0.25, 0.25}) {
+    for (const double z : {-0.25, 0.25}) {
+      tile.children.emplace_back(createSphereTree(
+          BoundingSphere(
+              sphere.getCenter() + glm::dvec3(0.0, y, z) * radius,
+              0.5 * radius),
+          levels - 1));
+    }
+  }
+
+  return tile;
+}
+
+// Counts the visible spheres, testing each against every frustum plane.
+size_t countVisible(const ViewState& viewState, const SphereTile& tile) {
+  if (!viewState.isBoundingVolumeVisible(tile.sphere)) {
+    return 0;
+  }
+
+  size_t result = 1;
+  for (const SphereTile& child : tile.children) {
+    result += countVisible(viewState, child);
+  }
+  return result;
+}
+
+// Counts the visible spheres, testing each against only the frustum planes
+// that its parent intersects.
+size_t countVisibleWithPlaneMask(
+    const ViewState& viewState,
+    const SphereTile& tile,
+    uint32_t parentPlaneMask) {
+  uint8_t lastCullingPlane = 0;
+  const uint32_t planeMask = viewState.computeVisibilityWithPlaneMask(
+      tile.sphere,
+      parentPlaneMask,
+      lastCullingPlane);
+  if (planeMask == ViewState::PLANE_MASK_OUTSIDE) {
+    return 0;
+  }
+
+  size_t result = 1;
+  for (const SphereTile& child : tile.children) {
+    result += countVisibleWithPlaneMask(viewState, child, planeMask);
+  }
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("ViewState::computeVisibilityWithPlaneMask") {
+  const ViewState viewState = createViewState();
+  uint8_t lastCullingPlane = 0;
+
+  SECTION("a volume in the middle of the frustum is inside every plane") {
+    CHECK(
+        viewState.computeVisibilityWithPlaneMask(
+            BoundingSphere(glm::dvec3(10.0, 0.0, 0.0), 1.0),
+            ViewState::PLANE_MASK_INDETERMINATE,
+            lastCullingPlane) == ViewState::PLANE_MASK_INSIDE);
+  }
+
+  SECTION("a volume on the edge of the frustum intersects that plane") {
+    CHECK(
+        viewState.computeVisibilityWithPlaneMask(
+            BoundingSphere(glm::dvec3(10.0, 10.0, 0.0), 1.0),
+            ViewState::PLANE_MASK_INDETERMINATE,
+            lastCullingPlane) == 1U << 0);
+    CHECK(
+        viewState.computeVisibilityWithPlaneMask(
+            BoundingSphere(glm::dvec3(10.0, 0.0, 10.0), 1.0),
+            ViewState::PLANE_MASK_INDETERMINATE,
+            lastCullingPlane) == 1U << 2);
+    CHECK(lastCullingPlane == 0);
+  }
+
+  SECTION("a volume outside of a plane is culled by it") {
+    CHECK(
+        viewState.computeVisibilityWithPlaneMask(
+            BoundingSphere(glm::dvec3(10.0, -30.0, 0.0), 1.0),
+            ViewState::PLANE_MASK_INDETERMINATE,
+            lastCullingPlane) == ViewState::PLANE_MASK_OUTSIDE);
+    CHECK(lastCullingPlane == 1);
+    CHECK_FALSE(viewState.isBoundingVolumeVisible(
+        BoundingSphere(glm::dvec3(10.0, -30.0, 0.0), 1.0)));
+  }
+
+  SECTION("only the planes in the parent's plane mask are tested") {
+    const BoundingVolume boundingVolume =
+        BoundingSphere(glm::dvec3(10.0, 10.0, 0.0), 1.0);
+    CHECK(
+        viewState.computeVisibilityWithPlaneMask(
+            boundingVolume,
+            1U << 1,
+            lastCullingPlane) == ViewState::PLANE_MASK_INSIDE);
+    CHECK(
+        viewState.computeVisibilityWithPlaneMask(
+            boundingVolume,
+            ViewState::PLANE_MASK_INSIDE,
+            lastCullingPlane) == ViewState::PLANE_MASK_INSIDE);
+    CHECK(
+        viewState.computeVisibilityWithPlaneMask(
+            boundingVolume,
+            ViewState::PLANE_MASK_OUTSIDE,
+            lastCullingPlane) == ViewState::PLANE_MASK_OUTSIDE);
+  }
+
+  SECTION("the near and far planes are tested when the frustum has them") {
+    const ViewState nearFarViewState = createViewState(1.0, 100.0);
+    const BoundingVolume beyondFar =
+        BoundingSphere(glm::dvec3(200.0, 0.0, 0.0), 1.0);
+    const BoundingVolume beforeNear =
+        BoundingSphere(glm::dvec3(0.5, 0.0, 0.0), 0.1);
+
+    CHECK(viewState.isBoundingVolumeVisible(beyondFar));
+    CHECK_FALSE(nearFarViewState.isBoundingVolumeVisible(beyondFar));
+    CHECK_FALSE(nearFarViewState.isBoundingVolumeVisible(beforeNear));
+
+    CHECK(
+        nearFarViewState.computeVisibilityWithPlaneMask(
+            beyondFar,
+            ViewState::PLANE_MASK_INDETERMINATE,
+            lastCullingPlane) == ViewState::PLANE_MASK_OUTSIDE);
+    CHECK(lastCullingPlane == 5);
+    CHECK(
+        nearFarViewState.computeVisibilityWithPlaneMask(
+            BoundingSphere(glm::dvec3(100.0, 0.0, 0.0), 1.0),
+            ViewState::PLANE_MASK_INDETERMINATE,
+            lastCullingPlane) == 1U << 5);
+    CHECK(
+        nearFarViewState.computeVisibilityWithPlaneMask(
+            beforeNear,
+            ViewState::PLANE_MASK_INDETERMINATE,
+            lastCullingPlane) == ViewState::PLANE_MASK_OUTSIDE);
+    CHECK(lastCullingPlane == 4);
+  }
+
+  SECTION("hierarchical plane masks cull the same volumes") {
+    const SphereTile root =
+        createSphereTree(BoundingSphere(glm::dvec3(50.0, 40.0, 0.0), 60.0), 5);
+    const size_t visible = countVisible(viewState, root);
+    CHECK(visible > 1);
+    CHECK(
+        countVisibleWithPlaneMask(
+            viewState,
+            root,
+            ViewState::PLANE_MASK_INDETERMINATE) == visible);
+  }
+}
+
+TEST_CASE("Benchmark frustum culling", "[.][benchmark]") {
+  const ViewState viewState = createViewState(1.0, 1000.0);
+  const SphereTile root =
+      createSphereTree(BoundingSphere(glm::dvec3(50.0, 40.0, 0.0), 60.0), 8);
+
+  BENCHMARK("Cull 87,381 spheres against every plane") {
+    return countVisible(viewState, root);
+  };
+
+  BENCHMARK("Cull 87,381 spheres with hierarchical plane masks") {
+    return countVisibleWithPlaneMask(
+        viewState,
+        root,
+        ViewState::PLANE_MASK_INDETERMINATE);
+  };
+}
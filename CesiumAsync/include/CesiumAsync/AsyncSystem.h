@@ -11,6 +11,7 @@
 
 #include <CesiumUtility/Tracing.h>
 
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 
@@ -299,6 +300,12 @@ public:
    */
   ThreadPool createThreadPool(int32_t numberOfThreads) const;
 
+  /**
+   * @brief Gets the number of worker thread tasks that can run at the same
+   * time, as reported by {@link ITaskProcessor::getMaximumConcurrency}.
+   */
+  size_t getMaximumWorkerConcurrency() const noexcept;
+
   /**
    * Returns true if this instance and the right-hand side can be used
    * interchangeably because they schedule continuations identically. Otherwise,
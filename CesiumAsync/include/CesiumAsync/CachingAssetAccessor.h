@@ -12,6 +12,10 @@
 #include <memory>
 #include <string>
 
+namespace CesiumUtility {
+class IMetricsSink;
+}
+
 namespace CesiumAsync {
 class AsyncSystem;
 
@@ -35,12 +39,21 @@ public:
    * responses.
    * @param requestsPerCachePrune The number of requests to handle before each
    * {@link ICacheDatabase::prune} of old cached results from the database.
+   * @param pMetricsSink The sink that receives metrics about the requests, or
+   * nullptr to not record any. The metrics are the counters
+   * `cachingAssetAccessor.requests`, `cachingAssetAccessor.cacheHits`,
+   * `cachingAssetAccessor.cacheRevalidations`, and
+   * `cachingAssetAccessor.cacheMisses`, and the histogram
+   * `cachingAssetAccessor.requestMicroseconds` of the time taken by each
+   * request, whether or not it was in the cache.
    */
   CachingAssetAccessor(
       const std::shared_ptr<spdlog::logger>& pLogger,
       const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
       const std::shared_ptr<ICacheDatabase>& pCacheDatabase,
-      int32_t requestsPerCachePrune = 10000);
+      int32_t requestsPerCachePrune = 10000,
+      const std::shared_ptr<CesiumUtility::IMetricsSink>& pMetricsSink =
+          nullptr);
 
   virtual ~CachingAssetAccessor() noexcept override;
 
@@ -61,12 +74,15 @@ public:
   virtual void tick() noexcept override;
 
 private:
+  struct Metrics;
+
   int32_t _requestsPerCachePrune;
   std::atomic<int32_t> _requestSinceLastPrune;
   std::shared_ptr<spdlog::logger> _pLogger;
   std::shared_ptr<IAssetAccessor> _pAssetAccessor;
   std::shared_ptr<ICacheDatabase> _pCacheDatabase;
   ThreadPool _cacheThreadPool;
+  std::shared_ptr<const Metrics> _pMetrics;
   CESIUM_TRACE_DECLARE_TRACK_SET(_pruneSlots, "Prune cache database");
 };
 } // namespace CesiumAsync
@@ -3,8 +3,11 @@
 #include "HttpHeaders.h"
 #include "Library.h"
 
+#include <cstddef>
 #include <functional>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace CesiumAsync {
 
@@ -40,6 +43,25 @@ public:
    * This method may be called from any thread.
    */
   virtual const IAssetResponse* response() const = 0;
+
+  /**
+   * @brief Takes ownership of the data of the response, if the request can give
+   * it up without copying it.
+   *
+   * If this returns the data, the response's {@link IAssetResponse::data} is
+   * empty afterward. So only call this when nothing else will read the data,
+   * for example just before parsing it into an object that keeps it. This
+   * method may be called from any thread, but not while another thread is
+   * reading the response.
+   *
+   * The default implementation returns `std::nullopt`.
+   *
+   * @return The data of the response, or `std::nullopt` if the request can't
+   * give it up. In that case, the response is unchanged.
+   */
+  virtual std::optional<std::vector<std::byte>> releaseResponseData() {
+    return std::nullopt;
+  }
 };
 
 } // namespace CesiumAsync
@@ -2,7 +2,10 @@
 
 #include "Library.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <thread>
 
 namespace CesiumAsync {
 /**
@@ -25,5 +28,19 @@ public:
    * @param f The function to execute
    */
   virtual void startTask(std::function<void()> f) = 0;
+
+  /**
+   * @brief Gets the number of tasks that this processor can run at the same
+   * time.
+   *
+   * This is used to decide how many worker threads to ask for help when work
+   * is divided among them. The default implementation returns the number of
+   * hardware threads.
+   *
+   * @return The number of tasks that can run at once. This is at least 1.
+   */
+  virtual size_t getMaximumConcurrency() const noexcept {
+    return std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+  }
 };
 } // namespace CesiumAsync
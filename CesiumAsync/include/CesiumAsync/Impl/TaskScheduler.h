@@ -3,6 +3,7 @@
 #include "../ITaskProcessor.h"
 #include "ImmediateScheduler.h"
 
+#include <cstddef>
 #include <memory>
 
 namespace CesiumAsync {
@@ -12,6 +13,7 @@ class TaskScheduler {
 public:
   TaskScheduler(const std::shared_ptr<ITaskProcessor>& pTaskProcessor);
   void schedule(async::task_run_handle t);
+  size_t getMaximumConcurrency() const noexcept;
 
   ImmediateScheduler<TaskScheduler> immediate{this};
 
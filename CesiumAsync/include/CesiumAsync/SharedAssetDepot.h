@@ -6,11 +6,16 @@
 #include <CesiumUtility/DoublyLinkedList.h>
 #include <CesiumUtility/IDepotOwningAsset.h>
 #include <CesiumUtility/IntrusivePointer.h>
+#include <CesiumUtility/Metrics.h>
 #include <CesiumUtility/ReferenceCounted.h>
 #include <CesiumUtility/Result.h>
 
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -26,6 +31,10 @@ namespace CesiumAsync {
 /**
  * @brief A depot for {@link SharedAsset} instances, which are potentially shared between multiple objects.
  *
+ * The depot is split into a number of stripes, selected by the hash of the
+ * asset key, each with its own lock. This allows many threads to get, create,
+ * and release assets at the same time without contending on a single lock.
+ *
  * @tparam TAssetType The type of asset stored in this depot. This should
  * be derived from {@link SharedAsset}.
  */
@@ -45,24 +54,64 @@ public:
    * At that point, assets are cleaned up in the order that they were marked for
    * deletion until the total dips below this threshold again.
    *
+   * This limit applies to the depot as a whole, not to each stripe.
+   *
    * Default is 16MiB.
    */
   int64_t inactiveAssetSizeLimitBytes = 16 * 1024 * 1024;
 
+  /**
+   * @brief The number of independently-locked stripes that the assets in this
+   * depot are divided between.
+   */
+  static constexpr size_t stripeCount = 16;
+
   using FactorySignature =
       CesiumAsync::Future<CesiumUtility::ResultPointer<TAssetType>>(
           const AsyncSystem& asyncSystem,
           const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
           const TAssetKey& key);
 
-  SharedAssetDepot(std::function<FactorySignature> factory)
-      : _assets(),
-        _assetsByPointer(),
-        _deletionCandidates(),
+  /**
+   * @brief Creates a new depot.
+   *
+   * @param factory The function that creates assets that are not in the depot.
+   * @param pMetricsSink The sink that receives metrics about the depot, or
+   * nullptr to not record any. The metrics are the counters `hits` and
+   * `misses` of the requests for assets that were or weren't already in the
+   * depot, the counter `evictedBytes` of the size of the inactive assets that
+   * were deleted, and the gauge `inactiveBytes`, each prefixed with
+   * `metricsPrefix` and a period.
+   * @param metricsPrefix The prefix of the names of the metrics.
+   */
+  SharedAssetDepot(
+      std::function<FactorySignature> factory,
+      const std::shared_ptr<CesiumUtility::IMetricsSink>& pMetricsSink =
+          nullptr,
+      const std::string& metricsPrefix = "sharedAssetDepot")
+      : _stripes(),
         _totalDeletionCandidateMemoryUsage(0),
-        _mutex(),
+        _nextDeletionSequence(0),
+        _activeAssetCount(0),
+        _keepAliveMutex(),
         _factory(std::move(factory)),
-        _pKeepAlive(nullptr) {}
+        _pKeepAlive(nullptr),
+        _pMetricsSink(pMetricsSink),
+        _pHits(
+            pMetricsSink ? &pMetricsSink->getCounter(metricsPrefix + ".hits")
+                         : nullptr),
+        _pMisses(
+            pMetricsSink
+                ? &pMetricsSink->getCounter(metricsPrefix + ".misses")
+                : nullptr),
+        _pEvictedBytes(
+            pMetricsSink
+                ? &pMetricsSink->getCounter(metricsPrefix + ".evictedBytes")
+                : nullptr),
+        _pInactiveBytes(
+            pMetricsSink
+                ? &pMetricsSink->getGauge(metricsPrefix + ".inactiveBytes")
+                : nullptr) {}
 
   virtual ~SharedAssetDepot() {
     // Ideally, when the depot is destroyed, all the assets it owns would become
@@ -84,9 +133,9 @@ public:
     // To avoid this, we use the _pKeepAlive field to maintain an artificial
     // reference to this depot whenever it owns live assets. This should keep
     // this destructor from being called except when all of its assets are also
-    // in the _deletionCandidates list.
+    // in the deletionCandidates lists.
 
-    CESIUM_ASSERT(this->_assets.size() == this->_deletionCandidates.size());
+    CESIUM_ASSERT(this->getAssetCount() == this->getInactiveAssetCount());
   }
 
   /**
@@ -103,14 +152,21 @@ public:
       const AsyncSystem& asyncSystem,
       const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
       const TAssetKey& assetKey) {
+    const size_t stripeIndex = getStripeIndex(assetKey);
+    Stripe& stripe = this->_stripes[stripeIndex];
+
     // We need to take care here to avoid two assets starting to load before the
     // first asset has added an entry and set its maybePendingAsset field.
-    std::unique_lock lock(this->_mutex);
+    std::unique_lock lock(stripe.mutex);
 
-    auto existingIt = this->_assets.find(assetKey);
-    if (existingIt != this->_assets.end()) {
+    auto existingIt = stripe.assets.find(assetKey);
+    if (existingIt != stripe.assets.end()) {
       // We've already loaded (or are loading) an asset with this ID - we can
       // just use that.
+      if (this->_pHits) {
+        this->_pHits->add();
+      }
+
       const AssetEntry& entry = *existingIt->second;
       if (entry.maybePendingAsset) {
         // Asset is currently loading.
@@ -130,6 +186,10 @@ public:
     // So we jump through some hoops here to publish "this thread is working
     // on it", then unlock the mutex, and _then_ actually call the factory
     // function.
+    if (this->_pMisses) {
+      this->_pMisses->add();
+    }
+
     Promise<void> promise = asyncSystem.createPromise<void>();
 
     // We haven't loaded or started to load this asset yet.
@@ -151,15 +211,16 @@ public:
                       std::string("Error creating asset: ") + e.what()));
             })
             .thenInWorkerThread(
-                [pDepot, pEntry](
+                [pDepot, pEntry, stripeIndex](
                     CesiumUtility::Result<
                         CesiumUtility::IntrusivePointer<TAssetType>>&& result) {
-                  std::lock_guard lock(pDepot->_mutex);
+                  Stripe& stripe = pDepot->_stripes[stripeIndex];
+                  std::lock_guard lock(stripe.mutex);
 
                   if (result.pValue) {
                     result.pValue->_pDepot = pDepot.get();
-                    pDepot->_assetsByPointer[result.pValue.get()] =
-                        pEntry.get();
+                    result.pValue->_depotStripe = stripeIndex;
+                    stripe.assetsByPointer[result.pValue.get()] = pEntry.get();
                   }
 
                   // Now that this asset is owned by the depot, we exclusively
@@ -172,7 +233,7 @@ public:
                   // The asset is initially live because we have an
                   // IntrusivePointer to it right here. So make sure the depot
                   // stays alive, too.
-                  pDepot->_pKeepAlive = pDepot;
+                  pDepot->addActiveAsset();
 
                   return pEntry->toResultUnderLock();
                 });
@@ -182,7 +243,7 @@ public:
 
     pEntry->maybePendingAsset = sharedFuture;
 
-    auto [it, added] = this->_assets.emplace(assetKey, pEntry);
+    auto [it, added] = stripe.assets.emplace(assetKey, pEntry);
 
     // Should always be added successfully, because we checked above that the
     // asset key doesn't exist in the map yet.
@@ -200,8 +261,12 @@ public:
    * including both active and inactive assets.
    */
   size_t getAssetCount() const {
-    std::lock_guard lock(this->_mutex);
-    return this->_assets.size();
+    size_t count = 0;
+    for (const Stripe& stripe : this->_stripes) {
+      std::lock_guard lock(stripe.mutex);
+      count += stripe.assets.size();
+    }
+    return count;
   }
 
   /**
@@ -209,8 +274,12 @@ public:
    * meaning that they are currently being used in one or more places.
    */
   size_t getActiveAssetCount() const {
-    std::lock_guard lock(this->_mutex);
-    return this->_assets.size() - this->_deletionCandidates.size();
+    size_t count = 0;
+    for (const Stripe& stripe : this->_stripes) {
+      std::lock_guard lock(stripe.mutex);
+      count += stripe.assets.size() - stripe.deletionCandidates.size();
+    }
+    return count;
   }
 
   /**
@@ -218,8 +287,12 @@ public:
    * meaning that they are not currently being used.
    */
   size_t getInactiveAssetCount() const {
-    std::lock_guard lock(this->_mutex);
-    return this->_deletionCandidates.size();
+    size_t count = 0;
+    for (const Stripe& stripe : this->_stripes) {
+      std::lock_guard lock(stripe.mutex);
+      count += stripe.deletionCandidates.size();
+    }
+    return count;
   }
 
   /**
@@ -227,11 +300,13 @@ public:
    * depot.
    */
   int64_t getInactiveAssetTotalSizeBytes() const {
-    std::lock_guard lock(this->_mutex);
-    return this->_totalDeletionCandidateMemoryUsage;
+    return this->_totalDeletionCandidateMemoryUsage.load();
   }
 
 private:
+  struct AssetEntry;
+  struct Stripe;
+
   // Disable copy
   void operator=(const SharedAssetDepot<TAssetType, TAssetKey>& other) = delete;
 
@@ -241,22 +316,35 @@ private:
    *
    * @param asset The asset to mark for deletion.
    * @param threadOwnsDepotLock True if the calling thread already owns the
-   * depot lock; otherwise, false.
+   * lock of the stripe containing the asset; otherwise, false.
    */
   void markDeletionCandidate(const TAssetType& asset, bool threadOwnsDepotLock)
       override {
+    Stripe& stripe = this->_stripes[asset._depotStripe];
     if (threadOwnsDepotLock) {
-      this->markDeletionCandidateUnderLock(asset);
+      this->markDeletionCandidateUnderLock(stripe, asset);
     } else {
-      std::lock_guard lock(this->_mutex);
-      this->markDeletionCandidateUnderLock(asset);
+      {
+        std::lock_guard lock(stripe.mutex);
+        this->markDeletionCandidateUnderLock(stripe, asset);
+      }
+
+      // Deleting assets may require locking other stripes, so only do it when
+      // this thread doesn't own any stripe lock. If it does, the assets will
+      // be deleted the next time an asset is marked for deletion.
+      this->deleteInactiveAssetsOverLimit();
     }
+
+    // If this depot is not managing any live assets, then we no longer need to
+    // keep it alive. This may destroy the depot, so it must be done last.
+    this->removeActiveAsset();
   }
 
-  void markDeletionCandidateUnderLock(const TAssetType& asset) {
-    auto it = this->_assetsByPointer.find(const_cast<TAssetType*>(&asset));
-    CESIUM_ASSERT(it != this->_assetsByPointer.end());
-    if (it == this->_assetsByPointer.end()) {
+  void
+  markDeletionCandidateUnderLock(Stripe& stripe, const TAssetType& asset) {
+    auto it = stripe.assetsByPointer.find(const_cast<TAssetType*>(&asset));
+    CESIUM_ASSERT(it != stripe.assetsByPointer.end());
+    if (it == stripe.assetsByPointer.end()) {
       return;
     }
 
@@ -264,39 +352,78 @@ private:
 
     AssetEntry& entry = *it->second;
     entry.sizeInDeletionList = asset.getSizeBytes();
+    entry.deletionSequence = this->_nextDeletionSequence++;
     this->_totalDeletionCandidateMemoryUsage += entry.sizeInDeletionList;
+    this->updateInactiveBytesMetric();
 
-    this->_deletionCandidates.insertAtTail(entry);
-
-    if (this->_totalDeletionCandidateMemoryUsage >
-        this->inactiveAssetSizeLimitBytes) {
-      // Delete the deletion candidates until we're below the limit.
-      while (this->_deletionCandidates.size() > 0 &&
-             this->_totalDeletionCandidateMemoryUsage >
-                 this->inactiveAssetSizeLimitBytes) {
-        AssetEntry* pOldEntry = this->_deletionCandidates.head();
-        this->_deletionCandidates.remove(*pOldEntry);
+    stripe.deletionCandidates.insertAtTail(entry);
+    stripe.updateOldestDeletionCandidate();
+  }
 
-        this->_totalDeletionCandidateMemoryUsage -=
-            pOldEntry->sizeInDeletionList;
+  /**
+   * @brief Deletes the least recently used inactive assets, across all
+   * stripes, until the total size of inactive assets is below
+   * {@link inactiveAssetSizeLimitBytes}. Must be called without owning any
+   * stripe lock.
+   */
+  void deleteInactiveAssetsOverLimit() {
+    while (this->_totalDeletionCandidateMemoryUsage.load() >
+           this->inactiveAssetSizeLimitBytes) {
+      // Find the stripe with the oldest deletion candidate without locking
+      // every stripe. This may be stale by the time we lock the stripe, but
+      // that only means we delete a slightly younger asset.
+      Stripe* pOldestStripe = nullptr;
+      uint64_t oldestSequence = noDeletionCandidates;
+      for (Stripe& stripe : this->_stripes) {
+        const uint64_t sequence = stripe.oldestDeletionCandidate.load();
+        if (sequence < oldestSequence) {
+          oldestSequence = sequence;
+          pOldestStripe = &stripe;
+        }
+      }
 
-        CESIUM_ASSERT(
-            pOldEntry->pAsset == nullptr ||
-            pOldEntry->pAsset->_referenceCount == 0);
+      if (pOldestStripe == nullptr) {
+        break;
+      }
 
-        if (pOldEntry->pAsset) {
-          this->_assetsByPointer.erase(pOldEntry->pAsset.get());
+      // Hold on to the entry until after the stripe is unlocked, so that the
+      // asset is destroyed without holding the lock.
+      CesiumUtility::IntrusivePointer<AssetEntry> pOldEntry;
+
+      {
+        std::lock_guard lock(pOldestStripe->mutex);
+
+        AssetEntry* pHead = pOldestStripe->deletionCandidates.head();
+        if (pHead != nullptr) {
+          pOldestStripe->deletionCandidates.remove(*pHead);
+
+          this->_totalDeletionCandidateMemoryUsage -= pHead->sizeInDeletionList;
+          this->updateInactiveBytesMetric();
+          if (this->_pEvictedBytes) {
+            this->_pEvictedBytes->add(pHead->sizeInDeletionList);
+          }
+
+          CESIUM_ASSERT(
+              pHead->pAsset == nullptr ||
+              pHead->pAsset->_referenceCount == 0);
+
+          if (pHead->pAsset) {
+            pOldestStripe->assetsByPointer.erase(pHead->pAsset.get());
+          }
+
+          auto it = pOldestStripe->assets.find(pHead->key);
+          CESIUM_ASSERT(it != pOldestStripe->assets.end());
+          if (it != pOldestStripe->assets.end()) {
+            pOldEntry = std::move(it->second);
+            pOldestStripe->assets.erase(it);
+          }
         }
 
-        // This will actually delete the asset.
-        this->_assets.erase(pOldEntry->key);
+        pOldestStripe->updateOldestDeletionCandidate();
       }
-    }
 
-    // If this depot is not managing any live assets, then we no longer need to
-    // keep it alive.
-    if (this->_assets.size() == this->_deletionCandidates.size()) {
-      this->_pKeepAlive.reset();
+      // This will actually delete the asset.
+      pOldEntry.reset();
     }
   }
 
@@ -306,40 +433,83 @@ private:
    *
    * @param asset The asset to unmark for deletion.
    * @param threadOwnsDepotLock True if the calling thread already owns the
-   * depot lock; otherwise, false.
+   * lock of the stripe containing the asset; otherwise, false.
    */
   void unmarkDeletionCandidate(
       const TAssetType& asset,
       bool threadOwnsDepotLock) override {
+    Stripe& stripe = this->_stripes[asset._depotStripe];
     if (threadOwnsDepotLock) {
-      this->unmarkDeletionCandidateUnderLock(asset);
+      this->unmarkDeletionCandidateUnderLock(stripe, asset);
     } else {
-      std::lock_guard lock(this->_mutex);
-      this->unmarkDeletionCandidateUnderLock(asset);
+      std::lock_guard lock(stripe.mutex);
+      this->unmarkDeletionCandidateUnderLock(stripe, asset);
     }
+
+    // This depot is now managing at least one live asset, so keep it alive.
+    this->addActiveAsset();
   }
 
-  void unmarkDeletionCandidateUnderLock(const TAssetType& asset) {
-    auto it = this->_assetsByPointer.find(const_cast<TAssetType*>(&asset));
-    CESIUM_ASSERT(it != this->_assetsByPointer.end());
-    if (it == this->_assetsByPointer.end()) {
+  void
+  unmarkDeletionCandidateUnderLock(Stripe& stripe, const TAssetType& asset) {
+    auto it = stripe.assetsByPointer.find(const_cast<TAssetType*>(&asset));
+    CESIUM_ASSERT(it != stripe.assetsByPointer.end());
+    if (it == stripe.assetsByPointer.end()) {
       return;
     }
 
     CESIUM_ASSERT(it->second != nullptr);
 
     AssetEntry& entry = *it->second;
-    bool isFound = this->_deletionCandidates.contains(entry);
+    bool isFound = stripe.deletionCandidates.contains(entry);
 
     CESIUM_ASSERT(isFound);
 
     if (isFound) {
       this->_totalDeletionCandidateMemoryUsage -= entry.sizeInDeletionList;
-      this->_deletionCandidates.remove(entry);
+      this->updateInactiveBytesMetric();
+      stripe.deletionCandidates.remove(entry);
+      stripe.updateOldestDeletionCandidate();
     }
+  }
 
-    // This depot is now managing at least one live asset, so keep it alive.
-    this->_pKeepAlive = this;
+  void updateInactiveBytesMetric() noexcept {
+    if (this->_pInactiveBytes) {
+      this->_pInactiveBytes->set(
+          this->_totalDeletionCandidateMemoryUsage.load(
+              std::memory_order_relaxed));
+    }
+  }
+
+  /**
+   * @brief Records that an asset owned by this depot became active, and keeps
+   * the depot alive while it has any active assets.
+   */
+  void addActiveAsset() {
+    if (this->_activeAssetCount++ == 0) {
+      std::lock_guard lock(this->_keepAliveMutex);
+      if (this->_activeAssetCount > 0) {
+        this->_pKeepAlive = this;
+      }
+    }
+  }
+
+  /**
+   * @brief Records that an asset owned by this depot became inactive, and lets
+   * the depot be destroyed if it no longer has any active assets. The depot
+   * may be destroyed before this method returns.
+   */
+  void removeActiveAsset() {
+    CesiumUtility::IntrusivePointer<SharedAssetDepot<TAssetType, TAssetKey>>
+        pKeepAlive;
+    if (--this->_activeAssetCount == 0) {
+      std::lock_guard lock(this->_keepAliveMutex);
+      if (this->_activeAssetCount == 0) {
+        pKeepAlive = std::move(this->_pKeepAlive);
+      }
+    }
+
+    // pKeepAlive is released here, after the mutex is unlocked.
   }
 
   /**
@@ -355,6 +525,7 @@ private:
           maybePendingAsset(),
           errorsAndWarnings(),
           sizeInDeletionList(0),
+          deletionSequence(0),
           deletionListPointers() {}
 
     AssetEntry(const TAssetKey& key_) : AssetEntry(TAssetKey(key_)) {}
@@ -387,15 +558,22 @@ private:
 
     /**
      * @brief The size of this asset when it was added to the
-     * _deletionCandidates list. This is stored so that the exact same size can
+     * deletionCandidates list. This is stored so that the exact same size can
      * be subtracted later. The value of this field is undefined if the asset is
-     * not currently in the _deletionCandidates list.
+     * not currently in the deletionCandidates list.
      */
     int64_t sizeInDeletionList;
 
+    /**
+     * @brief The order in which this asset was added to a deletionCandidates
+     * list, relative to all other assets in the depot. The value of this field
+     * is undefined if the asset is not currently in a deletionCandidates list.
+     */
+    uint64_t deletionSequence;
+
     /**
      * @brief The next and previous pointers to entries in the
-     * _deletionCandidates list.
+     * deletionCandidates list.
      */
     CesiumUtility::DoublyLinkedListPointers<AssetEntry> deletionListPointers;
 
@@ -411,27 +589,65 @@ private:
     }
   };
 
-  // Maps asset keys to AssetEntry instances. This collection owns the asset
-  // entries.
-  std::unordered_map<TAssetKey, CesiumUtility::IntrusivePointer<AssetEntry>>
-      _assets;
+  // The value of Stripe::oldestDeletionCandidate when the stripe has no
+  // deletion candidates.
+  static constexpr uint64_t noDeletionCandidates =
+      std::numeric_limits<uint64_t>::max();
 
-  // Maps asset pointers to AssetEntry instances. The values in this map refer
-  // to instances owned by the _assets map.
-  std::unordered_map<TAssetType*, AssetEntry*> _assetsByPointer;
+  /**
+   * @brief A subset of the assets in this depot, with its own lock.
+   */
+  struct Stripe {
+    // Mutex serializing access to assets, assetsByPointer, deletionCandidates,
+    // and any AssetEntry owned by this stripe.
+    mutable std::mutex mutex;
+
+    // Maps asset keys to AssetEntry instances. This collection owns the asset
+    // entries.
+    std::unordered_map<TAssetKey, CesiumUtility::IntrusivePointer<AssetEntry>>
+        assets;
+
+    // Maps asset pointers to AssetEntry instances. The values in this map
+    // refer to instances owned by the assets map.
+    std::unordered_map<TAssetType*, AssetEntry*> assetsByPointer;
+
+    // List of assets that are being considered for deletion, in the order that
+    // they became unused.
+    CesiumUtility::
+        DoublyLinkedList<AssetEntry, &AssetEntry::deletionListPointers>
+            deletionCandidates;
+
+    // The deletionSequence of the head of deletionCandidates, or
+    // noDeletionCandidates if it is empty. This can be read without locking
+    // the mutex to find the stripe with the oldest deletion candidate.
+    std::atomic<uint64_t> oldestDeletionCandidate{noDeletionCandidates};
+
+    void updateOldestDeletionCandidate() {
+      const AssetEntry* pHead = this->deletionCandidates.head();
+      this->oldestDeletionCandidate =
+          pHead ? pHead->deletionSequence : noDeletionCandidates;
+    }
+  };
+
+  static size_t getStripeIndex(const TAssetKey& key) {
+    return std::hash<TAssetKey>{}(key) % stripeCount;
+  }
 
-  // List of assets that are being considered for deletion, in the order that
-  // they became unused.
-  CesiumUtility::DoublyLinkedList<AssetEntry, &AssetEntry::deletionListPointers>
-      _deletionCandidates;
+  std::array<Stripe, stripeCount> _stripes;
 
-  // The total amount of memory used by all assets in the _deletionCandidates
-  // list.
-  int64_t _totalDeletionCandidateMemoryUsage;
+  // The total amount of memory used by all assets in the deletionCandidates
+  // lists of all stripes.
+  std::atomic<int64_t> _totalDeletionCandidateMemoryUsage;
 
-  // Mutex serializing access to _assets, _assetsByPointer, _deletionCandidates,
-  // and any AssetEntry owned by this depot.
-  mutable std::mutex _mutex;
+  // The deletionSequence to give to the next asset that becomes a deletion
+  // candidate.
+  std::atomic<uint64_t> _nextDeletionSequence;
+
+  // The number of assets owned by this depot that are currently in use.
+  std::atomic<int64_t> _activeAssetCount;
+
+  // Mutex serializing changes to _pKeepAlive.
+  std::mutex _keepAliveMutex;
 
   // The factory used to create new AssetType instances.
   std::function<FactorySignature> _factory;
@@ -441,6 +657,14 @@ private:
   // it are dropped.
   CesiumUtility::IntrusivePointer<SharedAssetDepot<TAssetType, TAssetKey>>
       _pKeepAlive;
+
+  // The metrics of this depot, which are all nullptr if it has no metrics
+  // sink. The sink is kept alive for as long as the metrics are used.
+  std::shared_ptr<CesiumUtility::IMetricsSink> _pMetricsSink;
+  CesiumUtility::MetricCounter* _pHits;
+  CesiumUtility::MetricCounter* _pMisses;
+  CesiumUtility::MetricCounter* _pEvictedBytes;
+  CesiumUtility::MetricGauge* _pInactiveBytes;
 };
 
 } // namespace CesiumAsync
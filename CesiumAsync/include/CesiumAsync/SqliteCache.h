@@ -4,13 +4,101 @@
 
 #include <spdlog/fwd.h>
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 
+namespace CesiumUtility {
+class IMetricsSink;
+}
+
 namespace CesiumAsync {
 
+/**
+ * @brief Options for a {@link SqliteCache}.
+ */
+struct CESIUMASYNC_API SqliteCacheOptions {
+  /**
+   * @brief Whether writes are queued and written to the database in batches
+   * by a background thread, rather than by the thread that requested them.
+   *
+   * When enabled, {@link SqliteCache::storeEntry}, and the update of the last
+   * accessed time done by {@link SqliteCache::getEntry}, return without
+   * waiting for the database. The queued writes are then written together in a
+   * single transaction. An entry that is still queued is returned by
+   * `getEntry`, so a stored entry is always visible to later reads from the
+   * same `SqliteCache`.
+   */
+  bool enableWriteBehind = false;
+
+  /**
+   * @brief How often queued writes are written to the database when
+   * {@link enableWriteBehind} is true. Must be greater than zero.
+   */
+  std::chrono::milliseconds writeBehindFlushInterval{250};
+
+  /**
+   * @brief The maximum number of bytes of responses that may be queued when
+   * {@link enableWriteBehind} is true.
+   *
+   * If a call to {@link SqliteCache::storeEntry} takes the queue over this
+   * limit, that call writes the entire queue to the database before
+   * returning.
+   */
+  size_t maximumWriteBehindBytes = 32 * 1024 * 1024;
+
+  /**
+   * @brief The maximum number of read-only connections that
+   * {@link SqliteCache::getEntry} may use to read from the database
+   * concurrently.
+   *
+   * Connections are opened when first needed and then reused. A read made while
+   * all of them are in use, or when this is zero, uses the connection that is
+   * used for writes, and so is serialized with writes and with other such
+   * reads.
+   */
+  size_t maximumReadConnections = 4;
+
+  /**
+   * @brief The maximum total size, in bytes, of the response data that is kept
+   * in the database after pruning. If zero, only the number of items is
+   * limited.
+   */
+  uint64_t maximumSizeBytes = 0;
+
+  /**
+   * @brief The maximum time that a single call to {@link SqliteCache::prune}
+   * spends deleting entries.
+   *
+   * Entries are deleted in small batches, and the cache is only locked while
+   * a batch is deleted. When a prune runs out of time, it returns, and the
+   * next prune continues where it left off. At least one batch is deleted by
+   * every prune.
+   */
+  std::chrono::milliseconds maximumPruneTime{10};
+
+  /**
+   * @brief The maximum number of entries deleted in each batch by
+   * {@link SqliteCache::prune}. Must be greater than zero.
+   */
+  size_t pruneBatchSize = 64;
+
+  /**
+   * @brief The sink that receives metrics about the cache, or nullptr to not
+   * record any.
+   *
+   * The metrics are the counters `sqliteCache.hits`, `sqliteCache.misses`, and
+   * `sqliteCache.prunedEntries`, the gauge `sqliteCache.queuedWrites` of the
+   * number of writes waiting for {@link enableWriteBehind}, and the histograms
+   * `sqliteCache.getEntryMicroseconds`, `sqliteCache.storeEntryMicroseconds`,
+   * and `sqliteCache.pruneMicroseconds`.
+   */
+  std::shared_ptr<CesiumUtility::IMetricsSink> pMetricsSink;
+};
+
 /**
  * @brief Cache storage using SQLITE to store completed response.
  */
@@ -27,11 +115,13 @@ public:
    * @param databaseName the database path.
    * @param maxItems the maximum number of items should be kept in the database
    * after prunning.
+   * @param options Options for how the database is accessed.
    */
   SqliteCache(
       const std::shared_ptr<spdlog::logger>& pLogger,
       const std::string& databaseName,
-      uint64_t maxItems = 4096);
+      uint64_t maxItems = 4096,
+      const SqliteCacheOptions& options = SqliteCacheOptions());
   ~SqliteCache();
 
   /** @copydoc ICacheDatabase::getEntry*/
@@ -55,10 +145,29 @@ public:
   /** @copydoc ICacheDatabase::clearAll*/
   virtual bool clearAll() override;
 
+  /**
+   * @brief Writes any queued writes to the database now, rather than waiting
+   * for the next periodic flush. Does nothing if
+   * {@link SqliteCacheOptions::enableWriteBehind} is false.
+   *
+   * @return true if all queued writes succeeded; otherwise, false.
+   */
+  bool flush();
+
 private:
   struct Impl;
+  struct WriteBehindQueue;
+  struct ReadConnectionPool;
   std::unique_ptr<Impl> _pImpl;
+  std::unique_ptr<WriteBehindQueue> _pWriteBehindQueue;
+  std::unique_ptr<ReadConnectionPool> _pReadConnectionPool;
+
+  // Held shared by every public method while it uses _pImpl, and exclusively
+  // by destroyDatabase while it replaces _pImpl.
+  mutable std::shared_mutex _databaseMutex;
+
   void createConnection() const;
-  void destroyDatabase();
+  std::optional<CacheItem> readEntry(const std::string& key) const;
+  void destroyDatabase(uint64_t generation);
 };
 } // namespace CesiumAsync
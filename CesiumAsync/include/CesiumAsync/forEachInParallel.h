@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+namespace CesiumAsync {
+class AsyncSystem;
+
+/**
+ * @brief Calls `process` for every index in `[0, count)`, using the worker
+ * threads of an {@link AsyncSystem} to help the calling thread.
+ *
+ * The calling thread processes indices too, and only waits for the indices
+ * that worker threads have already started. So if the worker threads are busy
+ * with other tasks, the calling thread simply processes every index itself,
+ * and this may be called from a worker thread without waiting for another one
+ * to become available.
+ *
+ * This does not return until every index that was started has finished. If
+ * `process` throws, no more indices are started, and the first exception is
+ * rethrown in the calling thread.
+ *
+ * @param pAsyncSystem The async system whose worker threads help, or nullptr
+ * to process every index in the calling thread.
+ * @param count The number of indices.
+ * @param process The function to call with each index. It is called from
+ * several threads at once, so it must only modify state that belongs to the
+ * index it is given.
+ * @param maximumConcurrency The maximum number of threads, including the
+ * calling thread, that process indices at once. This is further limited by
+ * {@link AsyncSystem::getMaximumWorkerConcurrency}. A value of 0 is treated
+ * like 1.
+ */
+void forEachInParallel(
+    const AsyncSystem* pAsyncSystem,
+    size_t count,
+    std::function<void(size_t)>&& process,
+    size_t maximumConcurrency = std::numeric_limits<size_t>::max());
+
+} // namespace CesiumAsync
@@ -21,6 +21,10 @@ ThreadPool AsyncSystem::createThreadPool(int32_t numberOfThreads) const {
   return ThreadPool(numberOfThreads);
 }
 
+size_t AsyncSystem::getMaximumWorkerConcurrency() const noexcept {
+  return this->_pSchedulers->workerThread.getMaximumConcurrency();
+}
+
 bool AsyncSystem::operator==(const AsyncSystem& rhs) const noexcept {
   return this->_pSchedulers == rhs._pSchedulers;
 }
@@ -6,12 +6,16 @@
 #include "InternalTimegm.h"
 #include "ResponseCacheControl.h"
 
+#include <CesiumUtility/Metrics.h>
+
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <iomanip>
 #include <sstream>
+#include <utility>
 
 namespace CesiumAsync {
 class CacheAssetResponse : public IAssetResponse {
@@ -66,6 +70,11 @@ public:
     return &this->_response;
   }
 
+  virtual std::optional<std::vector<std::byte>>
+  releaseResponseData() noexcept override {
+    return std::exchange(this->_cacheItem.cacheResponse.data, {});
+  }
+
 private:
   CacheItem _cacheItem;
   CacheAssetResponse _response;
@@ -90,17 +99,41 @@ static std::time_t calculateExpiryTime(
 static std::unique_ptr<IAssetRequest>
 updateCacheItem(CacheItem&& cacheItem, const IAssetRequest& request);
 
+struct CachingAssetAccessor::Metrics {
+  Metrics(const std::shared_ptr<CesiumUtility::IMetricsSink>& pSink_)
+      : pSink(pSink_),
+        requests(pSink_->getCounter("cachingAssetAccessor.requests")),
+        cacheHits(pSink_->getCounter("cachingAssetAccessor.cacheHits")),
+        cacheRevalidations(
+            pSink_->getCounter("cachingAssetAccessor.cacheRevalidations")),
+        cacheMisses(pSink_->getCounter("cachingAssetAccessor.cacheMisses")),
+        requestMicroseconds(pSink_->getHistogram(
+            "cachingAssetAccessor.requestMicroseconds")) {}
+
+  // Keeps the metrics below alive.
+  std::shared_ptr<CesiumUtility::IMetricsSink> pSink;
+  CesiumUtility::MetricCounter& requests;
+  CesiumUtility::MetricCounter& cacheHits;
+  CesiumUtility::MetricCounter& cacheRevalidations;
+  CesiumUtility::MetricCounter& cacheMisses;
+  CesiumUtility::MetricHistogram& requestMicroseconds;
+};
+
 CachingAssetAccessor::CachingAssetAccessor(
     const std::shared_ptr<spdlog::logger>& pLogger,
     const std::shared_ptr<IAssetAccessor>& pAssetAccessor,
     const std::shared_ptr<ICacheDatabase>& pCacheDatabase,
-    int32_t requestsPerCachePrune)
+    int32_t requestsPerCachePrune,
+    const std::shared_ptr<CesiumUtility::IMetricsSink>& pMetricsSink)
     : _requestsPerCachePrune(requestsPerCachePrune),
       _requestSinceLastPrune(0),
       _pLogger(pLogger),
       _pAssetAccessor(pAssetAccessor),
       _pCacheDatabase(pCacheDatabase),
-      _cacheThreadPool(1) {}
+      _cacheThreadPool(1),
+      _pMetrics(
+          pMetricsSink ? std::make_shared<Metrics>(pMetricsSink)
+                       : nullptr) {}
 
 CachingAssetAccessor::~CachingAssetAccessor() noexcept {}
 
@@ -124,6 +157,13 @@ Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::get(
 
   const ThreadPool& threadPool = this->_cacheThreadPool;
 
+  const std::shared_ptr<const Metrics>& pMetrics = this->_pMetrics;
+  const std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  if (pMetrics) {
+    pMetrics->requests.add();
+  }
+
   return asyncSystem
       .runInThreadPool(
           this->_cacheThreadPool,
@@ -131,12 +171,17 @@ Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::get(
            pAssetAccessor = this->_pAssetAccessor,
            pCacheDatabase = this->_pCacheDatabase,
            pLogger = this->_pLogger,
+           pMetrics,
            url,
            headers,
            threadPool]() -> Future<std::shared_ptr<IAssetRequest>> {
             std::optional<CacheItem> cacheLookup =
                 pCacheDatabase->getEntry(url);
             if (!cacheLookup) {
+              if (pMetrics) {
+                pMetrics->cacheMisses.add();
+              }
+
               // No cache item found, request directly from the server
               return pAssetAccessor->get(asyncSystem, url, headers)
                   .thenInThreadPool(
@@ -176,6 +221,10 @@ Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::get(
             CacheItem& cacheItem = cacheLookup.value();
 
             if (shouldRevalidateCache(cacheItem)) {
+              if (pMetrics) {
+                pMetrics->cacheRevalidations.add();
+              }
+
               // Cache is stale and needs revalidation
               std::vector<THeader> newHeaders = headers;
               const CacheResponse& cacheResponse = cacheItem.cacheResponse;
@@ -243,12 +292,20 @@ Future<std::shared_ptr<IAssetRequest>> CachingAssetAccessor::get(
 
             // Good cache item that doesn't need to be revalidated, just return
             // it.
+            if (pMetrics) {
+              pMetrics->cacheHits.add();
+            }
+
             std::shared_ptr<IAssetRequest> pRequest =
                 std::make_shared<CacheAssetRequest>(std::move(cacheItem));
             return asyncSystem.createResolvedFuture(std::move(pRequest));
           })
-      .thenImmediately([](std::shared_ptr<IAssetRequest>&& pRequest) noexcept {
+      .thenImmediately([pMetrics, start](
+                           std::shared_ptr<IAssetRequest>&& pRequest) noexcept {
         CESIUM_TRACE_END_IN_TRACK("IAssetAccessor::get (cached)");
+        if (pMetrics) {
+          pMetrics->requestMicroseconds.recordElapsedSince(start);
+        }
         return std::move(pRequest);
       });
 }
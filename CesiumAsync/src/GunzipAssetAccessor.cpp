@@ -4,6 +4,8 @@
 #include "CesiumAsync/IAssetResponse.h"
 #include "CesiumUtility/Gzip.h"
 
+#include <utility>
+
 namespace CesiumAsync {
 
 namespace {
@@ -34,6 +36,12 @@ public:
                             : this->_pAssetResponse->data();
   }
 
+  bool isDataValid() const noexcept { return this->_dataValid; }
+
+  std::vector<std::byte> releaseGunzippedData() noexcept {
+    return std::exchange(this->_gunzippedData, {});
+  }
+
 private:
   const IAssetResponse* _pAssetResponse;
   std::vector<std::byte> _gunzippedData;
@@ -61,6 +69,14 @@ public:
     return &this->_AssetResponse;
   }
 
+  virtual std::optional<std::vector<std::byte>>
+  releaseResponseData() override {
+    if (this->_AssetResponse.isDataValid()) {
+      return this->_AssetResponse.releaseGunzippedData();
+    }
+    return this->_pAssetRequest->releaseResponseData();
+  }
+
 private:
   std::shared_ptr<IAssetRequest> _pAssetRequest;
   GunzippedAssetResponse _AssetResponse;
@@ -3,6 +3,8 @@
 #include "CesiumAsync/IAssetResponse.h"
 
 #include <CesiumAsync/cesium-sqlite3.h>
+#include <CesiumUtility/Metrics.h>
+#include <CesiumUtility/ScopeGuard.h>
 #include <CesiumUtility/Tracing.h>
 
 #include <rapidjson/document.h>
@@ -10,9 +12,16 @@
 #include <spdlog/spdlog.h>
 #include <sqlite3.h>
 
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 using namespace CesiumAsync;
 
@@ -30,6 +39,7 @@ const std::string CACHE_TABLE_REQUEST_HEADER_COLUMN = "requestHeader";
 const std::string CACHE_TABLE_REQUEST_METHOD_COLUMN = "requestMethod";
 const std::string CACHE_TABLE_REQUEST_URL_COLUMN = "requestUrl";
 const std::string CACHE_TABLE_VIRTUAL_TOTAL_ITEMS_COLUMN = "totalItems";
+const std::string CACHE_TABLE_VIRTUAL_TOTAL_SIZE_COLUMN = "totalSize";
 
 // Sql commands for setting up database
 const std::string CREATE_CACHE_TABLE_SQL =
@@ -63,6 +73,15 @@ const std::string UPDATE_LAST_ACCESSED_TIME_SQL =
     "UPDATE " + CACHE_TABLE + " SET " + CACHE_TABLE_LAST_ACCESSED_TIME_COLUMN +
     " = strftime('%s','now') WHERE rowid =?";
 
+const std::string UPDATE_LAST_ACCESSED_TIME_BY_KEY_SQL =
+    "UPDATE " + CACHE_TABLE + " SET " + CACHE_TABLE_LAST_ACCESSED_TIME_COLUMN +
+    " = ? WHERE " + CACHE_TABLE_KEY_COLUMN + " =?";
+
+// Sql commands for batching writes
+const std::string BEGIN_TRANSACTION_SQL = "BEGIN TRANSACTION";
+
+const std::string COMMIT_TRANSACTION_SQL = "COMMIT TRANSACTION";
+
 // Sql commands for storing response
 const std::string STORE_RESPONSE_SQL =
     "REPLACE INTO " + CACHE_TABLE + " (" + CACHE_TABLE_EXPIRY_TIME_COLUMN +
@@ -75,18 +94,39 @@ const std::string STORE_RESPONSE_SQL =
     ", " + CACHE_TABLE_KEY_COLUMN + ") VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)";
 
 // Sql commands for prunning the database
-const std::string TOTAL_ITEMS_QUERY_SQL =
-    "SELECT COUNT(*) " + CACHE_TABLE_VIRTUAL_TOTAL_ITEMS_COLUMN + " FROM " +
-    CACHE_TABLE;
+const std::string CREATE_LAST_ACCESSED_TIME_INDEX_SQL =
+    "CREATE INDEX IF NOT EXISTS " + CACHE_TABLE + "_" +
+    CACHE_TABLE_LAST_ACCESSED_TIME_COLUMN + " ON " + CACHE_TABLE + "(" +
+    CACHE_TABLE_LAST_ACCESSED_TIME_COLUMN + ")";
+
+const std::string CREATE_EXPIRY_TIME_INDEX_SQL =
+    "CREATE INDEX IF NOT EXISTS " + CACHE_TABLE + "_" +
+    CACHE_TABLE_EXPIRY_TIME_COLUMN + " ON " + CACHE_TABLE + "(" +
+    CACHE_TABLE_EXPIRY_TIME_COLUMN + ")";
+
+const std::string TOTALS_QUERY_SQL =
+    "SELECT COUNT(*) " + CACHE_TABLE_VIRTUAL_TOTAL_ITEMS_COLUMN +
+    ", COALESCE(SUM(length(" + CACHE_TABLE_RESPONSE_DATA_COLUMN +
+    ")), 0) " + CACHE_TABLE_VIRTUAL_TOTAL_SIZE_COLUMN + " FROM " + CACHE_TABLE;
+
+const std::string GET_ENTRY_SIZE_SQL =
+    "SELECT length(" + CACHE_TABLE_RESPONSE_DATA_COLUMN + ") FROM " +
+    CACHE_TABLE + " WHERE " + CACHE_TABLE_KEY_COLUMN + "=?";
+
+const std::string SELECT_EXPIRED_ITEMS_SQL =
+    "SELECT rowid, length(" + CACHE_TABLE_RESPONSE_DATA_COLUMN + ") FROM " +
+    CACHE_TABLE + " WHERE " + CACHE_TABLE_EXPIRY_TIME_COLUMN +
+    " < strftime('%s','now') LIMIT ?";
+
+const std::string SELECT_LRU_ITEMS_SQL =
+    "SELECT rowid, length(" + CACHE_TABLE_RESPONSE_DATA_COLUMN + ") FROM " +
+    CACHE_TABLE + " ORDER BY " + CACHE_TABLE_LAST_ACCESSED_TIME_COLUMN +
+    " ASC LIMIT ?";
 
-const std::string DELETE_EXPIRED_ITEMS_SQL =
-    "DELETE FROM " + CACHE_TABLE + " WHERE " + CACHE_TABLE_EXPIRY_TIME_COLUMN +
-    " < strftime('%s','now')";
+const std::string DELETE_ITEM_SQL =
+    "DELETE FROM " + CACHE_TABLE + " WHERE rowid =?";
 
-const std::string DELETE_LRU_ITEMS_SQL =
-    "DELETE FROM " + CACHE_TABLE + " WHERE rowid " + " IN (SELECT rowid FROM " +
-    CACHE_TABLE + " ORDER BY " + CACHE_TABLE_LAST_ACCESSED_TIME_COLUMN +
-    " ASC " + " LIMIT ?)";
+const std::string ROLLBACK_TRANSACTION_SQL = "ROLLBACK TRANSACTION";
 
 // Sql commands for clean all items
 const std::string CLEAR_ALL_SQL = "DELETE FROM " + CACHE_TABLE;
@@ -129,6 +169,14 @@ std::optional<HttpHeaders> convertStringToHeaders(
   return headers;
 }
 
+size_t computeHeadersSize(const HttpHeaders& headers) {
+  size_t size = 0;
+  for (const std::pair<const std::string, std::string>& header : headers) {
+    size += header.first.size() + header.second.size();
+  }
+  return size;
+}
+
 struct DeleteSqliteConnection {
   void operator()(CESIUM_SQLITE(sqlite3*) pConnection) noexcept {
     CESIUM_SQLITE(sqlite3_close_v2)(pConnection);
@@ -163,6 +211,127 @@ SqliteStatementPtr prepareStatement(
   return SqliteStatementPtr(pStmt);
 }
 
+// Looks up an entry with a statement prepared from GET_ENTRY_SQL. Returns the
+// entry and sets rowId if it is found; otherwise, returns std::nullopt.
+std::optional<CacheItem> getEntryWithStatement(
+    CESIUM_SQLITE(sqlite3_stmt*) pStmt,
+    const std::string& key,
+    const std::shared_ptr<spdlog::logger>& pLogger,
+    int64_t& rowId) {
+  int status = CESIUM_SQLITE(sqlite3_reset)(pStmt);
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return std::nullopt;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_clear_bindings)(pStmt);
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return std::nullopt;
+  }
+
+  status = CESIUM_SQLITE(
+      sqlite3_bind_text)(pStmt, 1, key.c_str(), -1, SQLITE_STATIC);
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return std::nullopt;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_step)(pStmt);
+  if (status == SQLITE_DONE) {
+    // Cache miss
+    return std::nullopt;
+  }
+
+  if (status != SQLITE_ROW) {
+    // Something went wrong.
+    SPDLOG_LOGGER_ERROR(pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return std::nullopt;
+  }
+
+  // Cache hit - unpack and return it.
+  rowId = CESIUM_SQLITE(sqlite3_column_int64)(pStmt, 0);
+
+  // parse cache item metadata
+  const std::time_t expiryTime = CESIUM_SQLITE(sqlite3_column_int64)(pStmt, 1);
+
+  // parse response cache
+  std::string serializedResponseHeaders = reinterpret_cast<const char*>(
+      CESIUM_SQLITE(sqlite3_column_text)(pStmt, 2));
+  std::optional<HttpHeaders> responseHeaders =
+      convertStringToHeaders(serializedResponseHeaders, pLogger);
+  if (!responseHeaders) {
+    return std::nullopt;
+  }
+  const uint16_t statusCode =
+      static_cast<uint16_t>(CESIUM_SQLITE(sqlite3_column_int)(pStmt, 3));
+
+  const std::byte* rawResponseData = reinterpret_cast<const std::byte*>(
+      CESIUM_SQLITE(sqlite3_column_blob)(pStmt, 4));
+  const int responseDataSize = CESIUM_SQLITE(sqlite3_column_bytes)(pStmt, 4);
+  std::vector<std::byte> responseData(
+      rawResponseData,
+      rawResponseData + responseDataSize);
+
+  // parse request
+  std::string serializedRequestHeaders = reinterpret_cast<const char*>(
+      CESIUM_SQLITE(sqlite3_column_text)(pStmt, 5));
+  std::optional<HttpHeaders> requestHeaders =
+      convertStringToHeaders(serializedRequestHeaders, pLogger);
+  if (!requestHeaders) {
+    return std::nullopt;
+  }
+
+  std::string requestMethod = reinterpret_cast<const char*>(
+      CESIUM_SQLITE(sqlite3_column_text)(pStmt, 6));
+
+  std::string requestUrl = reinterpret_cast<const char*>(
+      CESIUM_SQLITE(sqlite3_column_text)(pStmt, 7));
+
+  return CacheItem{
+      expiryTime,
+      CacheRequest{
+          std::move(*requestHeaders),
+          std::move(requestMethod),
+          std::move(requestUrl)},
+      CacheResponse{
+          statusCode,
+          std::move(*responseHeaders),
+          std::move(responseData)}};
+}
+
+// The metrics of a SqliteCache. The pointers are all null if it has no metrics
+// sink.
+struct SqliteCacheMetrics {
+  explicit SqliteCacheMetrics(CesiumUtility::IMetricsSink* pSink)
+      : pHits(pSink ? &pSink->getCounter("sqliteCache.hits") : nullptr),
+        pMisses(pSink ? &pSink->getCounter("sqliteCache.misses") : nullptr),
+        pPrunedEntries(
+            pSink ? &pSink->getCounter("sqliteCache.prunedEntries") : nullptr),
+        pGetEntryMicroseconds(
+            pSink ? &pSink->getHistogram("sqliteCache.getEntryMicroseconds")
+                  : nullptr),
+        pStoreEntryMicroseconds(
+            pSink ? &pSink->getHistogram("sqliteCache.storeEntryMicroseconds")
+                  : nullptr),
+        pPruneMicroseconds(
+            pSink ? &pSink->getHistogram("sqliteCache.pruneMicroseconds")
+                  : nullptr) {}
+
+  CesiumUtility::MetricCounter* pHits;
+  CesiumUtility::MetricCounter* pMisses;
+  CesiumUtility::MetricCounter* pPrunedEntries;
+  CesiumUtility::MetricHistogram* pGetEntryMicroseconds;
+  CesiumUtility::MetricHistogram* pStoreEntryMicroseconds;
+  CesiumUtility::MetricHistogram* pPruneMicroseconds;
+};
+
+// Whether a write that failed with the given status may succeed if it is tried
+// again later, because the database was only temporarily unavailable.
+bool isRetryable(int status) {
+  return status == SQLITE_BUSY || status == SQLITE_LOCKED;
+}
+
 } // namespace
 
 namespace CesiumAsync {
@@ -171,39 +340,249 @@ struct SqliteCache::Impl {
   Impl(
       const std::shared_ptr<spdlog::logger>& pLogger,
       const std::string& databaseName,
-      uint64_t maxItems)
+      uint64_t maxItems,
+      const SqliteCacheOptions& options)
       : _pLogger(pLogger),
         _pConnection(nullptr),
         _databaseName(databaseName),
         _maxItems(maxItems),
+        _options(options),
+        _metrics(options.pMetricsSink.get()),
+        _totalItems(0),
+        _totalSizeBytes(0),
+        _generation(0),
         _getEntryStmtWrapper(),
         _updateLastAccessedTimeStmtWrapper(),
+        _updateLastAccessedTimeByKeyStmtWrapper(),
         _storeResponseStmtWrapper(),
-        _totalItemsQueryStmtWrapper(),
-        _deleteExpiredStmtWrapper(),
-        _deleteLRUStmtWrapper(),
+        _getEntrySizeStmtWrapper(),
+        _selectExpiredStmtWrapper(),
+        _selectLRUStmtWrapper(),
+        _deleteItemStmtWrapper(),
         _clearAllStmtWrapper() {}
 
   std::shared_ptr<spdlog::logger> _pLogger;
   SqliteConnectionPtr _pConnection;
   std::string _databaseName;
   uint64_t _maxItems;
+  SqliteCacheOptions _options;
+  SqliteCacheMetrics _metrics;
   mutable std::mutex _mutex;
+
+  // The number of entries in the database, and the total size of their
+  // response data. These are counted when the database is opened, and then
+  // kept up to date by every write, so that prune doesn't need to scan the
+  // table.
+  int64_t _totalItems;
+  int64_t _totalSizeBytes;
+
+  // The number of times that the database was found to be corrupt and was
+  // replaced by a new one.
+  uint64_t _generation;
+
   SqliteStatementPtr _getEntryStmtWrapper;
   SqliteStatementPtr _updateLastAccessedTimeStmtWrapper;
+  SqliteStatementPtr _updateLastAccessedTimeByKeyStmtWrapper;
   SqliteStatementPtr _storeResponseStmtWrapper;
-  SqliteStatementPtr _totalItemsQueryStmtWrapper;
-  SqliteStatementPtr _deleteExpiredStmtWrapper;
-  SqliteStatementPtr _deleteLRUStmtWrapper;
+  SqliteStatementPtr _getEntrySizeStmtWrapper;
+  SqliteStatementPtr _selectExpiredStmtWrapper;
+  SqliteStatementPtr _selectLRUStmtWrapper;
+  SqliteStatementPtr _deleteItemStmtWrapper;
   SqliteStatementPtr _clearAllStmtWrapper;
+
+  // Whether the database holds more entries, or more bytes of responses, than
+  // it is allowed to after pruning. The caller must own _mutex.
+  bool isOverLimitUnderLock() const;
+
+  // Deletes up to one batch of entries, stopping once the database is no
+  // longer over its limits. If expiredOnly is true, only expired entries are
+  // deleted; otherwise, the least recently used entries are deleted. Sets
+  // deletedItems to the number of entries deleted. The caller must own
+  // _mutex. Returns SQLITE_DONE on success; otherwise, logs the error and
+  // returns the status.
+  int pruneBatchUnderLock(bool expiredOnly, int64_t& deletedItems);
+
+  // Stores a response. The caller must own _mutex. Returns SQLITE_DONE if the
+  // entry was stored; otherwise, logs the error and returns the status.
+  int storeEntryUnderLock(
+      const std::string& key,
+      std::time_t expiryTime,
+      std::time_t lastAccessedTime,
+      const std::string& url,
+      const std::string& requestMethod,
+      const HttpHeaders& requestHeaders,
+      uint16_t statusCode,
+      const HttpHeaders& responseHeaders,
+      const gsl::span<const std::byte>& responseData);
+
+  // Sets the last accessed time of an entry. The caller must own _mutex.
+  // Returns SQLITE_DONE on success; otherwise, logs the error and returns the
+  // status.
+  int updateLastAccessedTimeUnderLock(
+      const std::string& key,
+      std::time_t lastAccessedTime);
+
+  // Sets the last accessed time of the entry with the given rowid to now. The
+  // caller must own _mutex. Returns SQLITE_DONE on success; otherwise, logs the
+  // error and returns the status.
+  int updateLastAccessedTimeByRowIdUnderLock(int64_t rowId);
+
+  // Executes a statement that has no parameters or results, such as beginning
+  // or committing a transaction. The caller must own _mutex.
+  bool execUnderLock(const std::string& sql);
+};
+
+/**
+ * @brief Writes that have been requested but not yet written to the database.
+ */
+struct SqliteCache::WriteBehindQueue {
+  struct PendingStore {
+    CacheItem item;
+    std::time_t lastAccessedTime;
+    size_t sizeBytes;
+  };
+
+  WriteBehindQueue(const SqliteCacheOptions& options)
+      : flushInterval(options.writeBehindFlushInterval),
+        maximumBytes(options.maximumWriteBehindBytes),
+        mutex(),
+        condition(),
+        stores(),
+        flushingStores(),
+        lastAccessedTimes(),
+        pendingBytes(0),
+        pQueuedWrites(
+            options.pMetricsSink
+                ? &options.pMetricsSink->getGauge("sqliteCache.queuedWrites")
+                : nullptr),
+        stopping(false),
+        writerThread() {}
+
+  // Updates the queuedWrites metric. The caller must own the mutex.
+  void updateQueuedWritesUnderLock() noexcept {
+    if (this->pQueuedWrites) {
+      this->pQueuedWrites->set(
+          int64_t(this->stores.size() + this->lastAccessedTimes.size()));
+    }
+  }
+
+  std::chrono::milliseconds flushInterval;
+  size_t maximumBytes;
+
+  // Mutex serializing access to the fields below. To avoid deadlocks, a thread
+  // that owns this mutex must never try to lock Impl::_mutex.
+  std::mutex mutex;
+  std::condition_variable condition;
+
+  // The latest entry stored for each key.
+  std::unordered_map<std::string, PendingStore> stores;
+
+  // Stores taken by the flush in progress, if any. Only that flush modifies
+  // them, so it may read them without owning this mutex.
+  std::unordered_map<std::string, PendingStore> flushingStores;
+
+  // Last accessed times for entries that are already in the database.
+  std::unordered_map<std::string, std::time_t> lastAccessedTimes;
+
+  // The total sizeBytes of all stores.
+  size_t pendingBytes;
+
+  CesiumUtility::MetricGauge* pQueuedWrites;
+
+  bool stopping;
+  std::thread writerThread;
+};
+
+/**
+ * @brief Read-only connections used by getEntry, so that reads don't wait for
+ * writes or for each other.
+ *
+ * The database is in WAL mode, so a read-only connection sees the database as
+ * of the last committed write without blocking the writing connection.
+ */
+struct SqliteCache::ReadConnectionPool {
+  struct Connection {
+    SqliteConnectionPtr pConnection;
+    SqliteStatementPtr pGetEntryStmt;
+    uint64_t generation;
+  };
+
+  ReadConnectionPool(
+      const std::shared_ptr<spdlog::logger>& pLogger_,
+      const std::string& databaseName_,
+      size_t maximumConnections_)
+      : pLogger(pLogger_),
+        databaseName(databaseName_),
+        mutex(),
+        idleConnections(),
+        maximumConnections(maximumConnections_),
+        connectionCount(0),
+        generation(0) {}
+
+  // Takes an idle connection, or opens a new one if fewer than
+  // maximumConnections are open. Returns nullptr if all are in use.
+  std::unique_ptr<Connection> acquire();
+
+  // Returns a connection taken by acquire to the pool.
+  void release(std::unique_ptr<Connection> pConnection);
+
+  // Closes all connections, because the database they read from has been
+  // deleted. Connections that are in use are closed when they are released.
+  void invalidate();
+
+  std::shared_ptr<spdlog::logger> pLogger;
+  std::string databaseName;
+
+  // Mutex serializing access to the fields below.
+  std::mutex mutex;
+  std::vector<std::unique_ptr<Connection>> idleConnections;
+  size_t maximumConnections;
+
+  // The number of open connections, including those in use.
+  size_t connectionCount;
+
+  // Incremented by invalidate. Connections opened before then are closed
+  // instead of being reused.
+  uint64_t generation;
 };
 
 SqliteCache::SqliteCache(
     const std::shared_ptr<spdlog::logger>& pLogger,
     const std::string& databaseName,
-    uint64_t maxItems)
-    : _pImpl(std::make_unique<Impl>(pLogger, databaseName, maxItems)) {
+    uint64_t maxItems,
+    const SqliteCacheOptions& options)
+    : _pImpl(
+          std::make_unique<Impl>(pLogger, databaseName, maxItems, options)),
+      _pWriteBehindQueue(),
+      _pReadConnectionPool(),
+      _databaseMutex() {
   createConnection();
+
+  // Other connections can't see a temporary or in-memory database.
+  if (options.maximumReadConnections > 0 && !databaseName.empty() &&
+      databaseName != ":memory:") {
+    this->_pReadConnectionPool = std::make_unique<ReadConnectionPool>(
+        pLogger,
+        databaseName,
+        options.maximumReadConnections);
+  }
+
+  if (options.enableWriteBehind) {
+    this->_pWriteBehindQueue = std::make_unique<WriteBehindQueue>(options);
+    this->_pWriteBehindQueue->writerThread = std::thread([this]() {
+      WriteBehindQueue& queue = *this->_pWriteBehindQueue;
+      std::unique_lock<std::mutex> lock(queue.mutex);
+      while (!queue.stopping) {
+        queue.condition.wait_for(lock, queue.flushInterval, [&queue]() {
+          return queue.stopping;
+        });
+
+        lock.unlock();
+        this->flush();
+        lock.lock();
+      }
+    });
+  }
 }
 
 void SqliteCache::createConnection() const {
@@ -233,6 +612,23 @@ void SqliteCache::createConnection() const {
     throw std::runtime_error(errorStr);
   }
 
+  // index the columns that entries are pruned by
+  for (const std::string& sql :
+       {CREATE_LAST_ACCESSED_TIME_INDEX_SQL, CREATE_EXPIRY_TIME_INDEX_SQL}) {
+    char* createIndexError = nullptr;
+    status = CESIUM_SQLITE(sqlite3_exec)(
+        this->_pImpl->_pConnection.get(),
+        sql.c_str(),
+        nullptr,
+        nullptr,
+        &createIndexError);
+    if (status != SQLITE_OK) {
+      std::string errorStr(createIndexError);
+      CESIUM_SQLITE(sqlite3_free)(createIndexError);
+      throw std::runtime_error(errorStr);
+    }
+  }
+
   // turn on WAL mode
   char* walError = nullptr;
   status = CESIUM_SQLITE(sqlite3_exec)(
@@ -284,479 +680,931 @@ void SqliteCache::createConnection() const {
       this->_pImpl->_pConnection,
       UPDATE_LAST_ACCESSED_TIME_SQL);
 
+  // update last accessed for entry with a given key and time
+  this->_pImpl->_updateLastAccessedTimeByKeyStmtWrapper = prepareStatement(
+      this->_pImpl->_pConnection,
+      UPDATE_LAST_ACCESSED_TIME_BY_KEY_SQL);
+
   // store response
   this->_pImpl->_storeResponseStmtWrapper =
       prepareStatement(this->_pImpl->_pConnection, STORE_RESPONSE_SQL);
 
-  // query total items
-  this->_pImpl->_totalItemsQueryStmtWrapper =
-      prepareStatement(this->_pImpl->_pConnection, TOTAL_ITEMS_QUERY_SQL);
+  // query the size of an existing entry
+  this->_pImpl->_getEntrySizeStmtWrapper =
+      prepareStatement(this->_pImpl->_pConnection, GET_ENTRY_SIZE_SQL);
+
+  // select expired items
+  this->_pImpl->_selectExpiredStmtWrapper =
+      prepareStatement(this->_pImpl->_pConnection, SELECT_EXPIRED_ITEMS_SQL);
 
-  // delete expired items
-  this->_pImpl->_deleteExpiredStmtWrapper =
-      prepareStatement(this->_pImpl->_pConnection, DELETE_EXPIRED_ITEMS_SQL);
+  // select least recently used items
+  this->_pImpl->_selectLRUStmtWrapper =
+      prepareStatement(this->_pImpl->_pConnection, SELECT_LRU_ITEMS_SQL);
 
-  // delete expired items
-  this->_pImpl->_deleteLRUStmtWrapper =
-      prepareStatement(this->_pImpl->_pConnection, DELETE_LRU_ITEMS_SQL);
+  // delete an item
+  this->_pImpl->_deleteItemStmtWrapper =
+      prepareStatement(this->_pImpl->_pConnection, DELETE_ITEM_SQL);
 
   // clear all items
   this->_pImpl->_clearAllStmtWrapper =
       prepareStatement(this->_pImpl->_pConnection, CLEAR_ALL_SQL);
+
+  // count the existing items. After this, the totals are kept up to date as
+  // items are stored and deleted.
+  SqliteStatementPtr pTotalsQueryStmt =
+      prepareStatement(this->_pImpl->_pConnection, TOTALS_QUERY_SQL);
+  status = CESIUM_SQLITE(sqlite3_step)(pTotalsQueryStmt.get());
+  if (status != SQLITE_ROW) {
+    throw std::runtime_error(CESIUM_SQLITE(sqlite3_errstr)(status));
+  }
+  this->_pImpl->_totalItems =
+      CESIUM_SQLITE(sqlite3_column_int64)(pTotalsQueryStmt.get(), 0);
+  this->_pImpl->_totalSizeBytes =
+      CESIUM_SQLITE(sqlite3_column_int64)(pTotalsQueryStmt.get(), 1);
 }
 
-SqliteCache::~SqliteCache() = default;
+SqliteCache::~SqliteCache() {
+  if (this->_pWriteBehindQueue) {
+    {
+      std::lock_guard<std::mutex> lock(this->_pWriteBehindQueue->mutex);
+      this->_pWriteBehindQueue->stopping = true;
+    }
+    this->_pWriteBehindQueue->condition.notify_all();
+    this->_pWriteBehindQueue->writerThread.join();
+
+    // Write anything that was queued after the writer's last flush.
+    this->flush();
+  }
+}
 
 std::optional<CacheItem> SqliteCache::getEntry(const std::string& key) const {
   CESIUM_TRACE("SqliteCache::getEntry");
-  std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
 
-  // get entry based on key
-  int status =
-      CESIUM_SQLITE(sqlite3_reset)(this->_pImpl->_getEntryStmtWrapper.get());
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return std::nullopt;
+  std::shared_lock<std::shared_mutex> databaseLock(this->_databaseMutex);
+
+  const std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  std::optional<CacheItem> maybeItem = this->readEntry(key);
+
+  const SqliteCacheMetrics& metrics = this->_pImpl->_metrics;
+  if (metrics.pGetEntryMicroseconds) {
+    metrics.pGetEntryMicroseconds->recordElapsedSince(start);
+    (maybeItem ? metrics.pHits : metrics.pMisses)->add();
   }
 
-  status = CESIUM_SQLITE(sqlite3_clear_bindings)(
-      this->_pImpl->_getEntryStmtWrapper.get());
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return std::nullopt;
+  return maybeItem;
+}
+
+std::optional<CacheItem>
+SqliteCache::readEntry(const std::string& key) const {
+  if (this->_pWriteBehindQueue) {
+    // An entry that hasn't been written to the database yet is newer than
+    // anything in the database.
+    WriteBehindQueue& queue = *this->_pWriteBehindQueue;
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    auto it = queue.stores.find(key);
+    if (it != queue.stores.end()) {
+      it->second.lastAccessedTime = std::time(nullptr);
+      return it->second.item;
+    }
+
+    // Reads from the read-only connections don't wait for a flush in
+    // progress, so an entry being flushed is read from the queue until it is
+    // committed.
+    auto flushingIt = queue.flushingStores.find(key);
+    if (flushingIt != queue.flushingStores.end()) {
+      queue.lastAccessedTimes.insert_or_assign(key, std::time(nullptr));
+      queue.updateQueuedWritesUnderLock();
+      return flushingIt->second.item;
+    }
   }
 
-  status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_getEntryStmtWrapper.get(),
-      1,
-      key.c_str(),
-      -1,
-      SQLITE_STATIC);
-  if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
+  int64_t rowId = 0;
+  std::optional<CacheItem> maybeItem;
+  std::unique_lock<std::mutex> lock(this->_pImpl->_mutex, std::defer_lock);
+
+  std::unique_ptr<ReadConnectionPool::Connection> pReadConnection =
+      this->_pReadConnectionPool ? this->_pReadConnectionPool->acquire()
+                                 : nullptr;
+  if (pReadConnection) {
+    maybeItem = getEntryWithStatement(
+        pReadConnection->pGetEntryStmt.get(),
+        key,
+        this->_pReadConnectionPool->pLogger,
+        rowId);
+
+    // Don't hold a read transaction open while the connection is idle,
+    // because it stops the write-ahead log from being checkpointed.
+    CESIUM_SQLITE(sqlite3_reset)(pReadConnection->pGetEntryStmt.get());
+    this->_pReadConnectionPool->release(std::move(pReadConnection));
+  } else {
+    lock.lock();
+    maybeItem = getEntryWithStatement(
+        this->_pImpl->_getEntryStmtWrapper.get(),
+        key,
         this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return std::nullopt;
+        rowId);
   }
 
-  status =
-      CESIUM_SQLITE(sqlite3_step)(this->_pImpl->_getEntryStmtWrapper.get());
-  if (status == SQLITE_DONE) {
-    // Cache miss
+  if (!maybeItem) {
     return std::nullopt;
   }
 
-  if (status != SQLITE_ROW) {
-    // Something went wrong.
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return std::nullopt;
+  if (this->_pWriteBehindQueue) {
+    // Queue the update of the last accessed time instead of writing it now.
+    WriteBehindQueue& queue = *this->_pWriteBehindQueue;
+    std::lock_guard<std::mutex> queueLock(queue.mutex);
+    queue.lastAccessedTimes.insert_or_assign(key, std::time(nullptr));
+    queue.updateQueuedWritesUnderLock();
+    return maybeItem;
   }
 
-  // Cache hit - unpack and return it.
-  const int64_t itemIndex = CESIUM_SQLITE(
-      sqlite3_column_int64)(this->_pImpl->_getEntryStmtWrapper.get(), 0);
-
-  // parse cache item metadata
-  const std::time_t expiryTime = CESIUM_SQLITE(
-      sqlite3_column_int64)(this->_pImpl->_getEntryStmtWrapper.get(), 1);
+  // update the last accessed time
+  if (!lock.owns_lock()) {
+    lock.lock();
+  }
 
-  // parse response cache
-  std::string serializedResponseHeaders =
-      reinterpret_cast<const char*>(CESIUM_SQLITE(
-          sqlite3_column_text)(this->_pImpl->_getEntryStmtWrapper.get(), 2));
-  std::optional<HttpHeaders> responseHeaders =
-      convertStringToHeaders(serializedResponseHeaders, this->_pImpl->_pLogger);
-  if (!responseHeaders) {
+  if (this->_pImpl->updateLastAccessedTimeByRowIdUnderLock(rowId) !=
+      SQLITE_DONE) {
     return std::nullopt;
   }
-  const uint16_t statusCode = static_cast<uint16_t>(CESIUM_SQLITE(
-      sqlite3_column_int)(this->_pImpl->_getEntryStmtWrapper.get(), 3));
 
-  const std::byte* rawResponseData =
-      reinterpret_cast<const std::byte*>(CESIUM_SQLITE(
-          sqlite3_column_blob)(this->_pImpl->_getEntryStmtWrapper.get(), 4));
-  const int responseDataSize = CESIUM_SQLITE(
-      sqlite3_column_bytes)(this->_pImpl->_getEntryStmtWrapper.get(), 4);
-  std::vector<std::byte> responseData(
-      rawResponseData,
-      rawResponseData + responseDataSize);
+  return maybeItem;
+}
 
-  // parse request
-  std::string serializedRequestHeaders =
-      reinterpret_cast<const char*>(CESIUM_SQLITE(
-          sqlite3_column_text)(this->_pImpl->_getEntryStmtWrapper.get(), 5));
-  std::optional<HttpHeaders> requestHeaders =
-      convertStringToHeaders(serializedRequestHeaders, this->_pImpl->_pLogger);
-  if (!requestHeaders) {
-    return std::nullopt;
-  }
+bool SqliteCache::storeEntry(
+    const std::string& key,
+    std::time_t expiryTime,
+    const std::string& url,
+    const std::string& requestMethod,
+    const HttpHeaders& requestHeaders,
+    uint16_t statusCode,
+    const HttpHeaders& responseHeaders,
+    const gsl::span<const std::byte>& responseData) {
+  CESIUM_TRACE("SqliteCache::storeEntry");
 
-  std::string requestMethod = reinterpret_cast<const char*>(CESIUM_SQLITE(
-      sqlite3_column_text)(this->_pImpl->_getEntryStmtWrapper.get(), 6));
+  std::shared_lock<std::shared_mutex> databaseLock(this->_databaseMutex);
+
+  // The database may be replaced by a new one during the store, so don't
+  // refer to it to record the duration.
+  CesiumUtility::ScopeGuard recordDuration(
+      [pStoreEntryMicroseconds = this->_pImpl->_metrics.pStoreEntryMicroseconds,
+       start = std::chrono::steady_clock::now()]() {
+        if (pStoreEntryMicroseconds) {
+          pStoreEntryMicroseconds->recordElapsedSince(start);
+        }
+      });
+
+  if (this->_pWriteBehindQueue) {
+    // Queuing the store doesn't use the database, and flush locks it itself.
+    databaseLock.unlock();
+
+    const size_t sizeBytes = key.size() + url.size() + requestMethod.size() +
+                             computeHeadersSize(requestHeaders) +
+                             computeHeadersSize(responseHeaders) +
+                             responseData.size();
+    WriteBehindQueue::PendingStore pendingStore{
+        CacheItem{
+            expiryTime,
+            CacheRequest{
+                HttpHeaders(requestHeaders),
+                std::string(requestMethod),
+                std::string(url)},
+            CacheResponse{
+                statusCode,
+                HttpHeaders(responseHeaders),
+                std::vector<std::byte>(
+                    responseData.begin(),
+                    responseData.end())}},
+        std::time(nullptr),
+        sizeBytes};
+
+    bool queueIsFull = false;
+
+    {
+      WriteBehindQueue& queue = *this->_pWriteBehindQueue;
+      std::lock_guard<std::mutex> lock(queue.mutex);
+
+      auto it = queue.stores.find(key);
+      if (it != queue.stores.end()) {
+        queue.pendingBytes -= it->second.sizeBytes;
+        it->second = std::move(pendingStore);
+      } else {
+        queue.stores.emplace(key, std::move(pendingStore));
+      }
 
-  std::string requestUrl = reinterpret_cast<const char*>(CESIUM_SQLITE(
-      sqlite3_column_text)(this->_pImpl->_getEntryStmtWrapper.get(), 7));
+      // The store sets the last accessed time, too.
+      queue.lastAccessedTimes.erase(key);
+      queue.updateQueuedWritesUnderLock();
 
-  // update the last accessed time
-  int updateStatus = CESIUM_SQLITE(sqlite3_reset)(
-      this->_pImpl->_updateLastAccessedTimeStmtWrapper.get());
-  if (updateStatus != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(updateStatus));
-    return std::nullopt;
-  }
+      queue.pendingBytes += sizeBytes;
+      queueIsFull = queue.pendingBytes > queue.maximumBytes;
+    }
 
-  updateStatus = CESIUM_SQLITE(sqlite3_clear_bindings)(
-      this->_pImpl->_updateLastAccessedTimeStmtWrapper.get());
-  if (updateStatus != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(updateStatus));
-    return std::nullopt;
-  }
+    if (queueIsFull) {
+      return this->flush();
+    }
 
-  updateStatus = CESIUM_SQLITE(sqlite3_bind_int64)(
-      this->_pImpl->_updateLastAccessedTimeStmtWrapper.get(),
-      1,
-      itemIndex);
-  if (updateStatus != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(updateStatus));
-    return std::nullopt;
+    return true;
   }
 
-  updateStatus = CESIUM_SQLITE(sqlite3_step)(
-      this->_pImpl->_updateLastAccessedTimeStmtWrapper.get());
-  if (updateStatus != SQLITE_DONE) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(updateStatus));
-    return std::nullopt;
-  }
+  std::unique_lock<std::mutex> guard(this->_pImpl->_mutex);
 
-  return CacheItem{
+  const int status = this->_pImpl->storeEntryUnderLock(
+      key,
       expiryTime,
-      CacheRequest{
-          std::move(*requestHeaders),
-          std::move(requestMethod),
-          std::move(requestUrl)},
-      CacheResponse{
-          statusCode,
-          std::move(*responseHeaders),
-          std::move(responseData)}};
+      std::time(nullptr),
+      url,
+      requestMethod,
+      requestHeaders,
+      statusCode,
+      responseHeaders,
+      responseData);
+  if (status != SQLITE_DONE) {
+    if (status == SQLITE_CORRUPT) {
+      const uint64_t generation = this->_pImpl->_generation;
+      guard.unlock();
+      databaseLock.unlock();
+      destroyDatabase(generation);
+    }
+    return false;
+  }
+
+  return true;
 }
 
-bool SqliteCache::storeEntry(
+int SqliteCache::Impl::storeEntryUnderLock(
     const std::string& key,
     std::time_t expiryTime,
+    std::time_t lastAccessedTime,
     const std::string& url,
     const std::string& requestMethod,
     const HttpHeaders& requestHeaders,
     uint16_t statusCode,
     const HttpHeaders& responseHeaders,
     const gsl::span<const std::byte>& responseData) {
-  CESIUM_TRACE("SqliteCache::storeEntry");
-  std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
+  // find the size of the entry this replaces, if any, to keep the totals
+  // up to date
+  int status =
+      CESIUM_SQLITE(sqlite3_reset)(this->_getEntrySizeStmtWrapper.get());
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_bind_text)(
+      this->_getEntrySizeStmtWrapper.get(),
+      1,
+      key.c_str(),
+      -1,
+      SQLITE_STATIC);
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_step)(this->_getEntrySizeStmtWrapper.get());
+  if (status != SQLITE_ROW && status != SQLITE_DONE) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  const bool isReplacing = status == SQLITE_ROW;
+  const int64_t replacedSizeBytes =
+      isReplacing ? CESIUM_SQLITE(sqlite3_column_int64)(
+                        this->_getEntrySizeStmtWrapper.get(),
+                        0)
+                  : 0;
+  CESIUM_SQLITE(sqlite3_reset)(this->_getEntrySizeStmtWrapper.get());
 
   // cache the request with the key
-  int status = CESIUM_SQLITE(sqlite3_reset)(
-      this->_pImpl->_storeResponseStmtWrapper.get());
+  status = CESIUM_SQLITE(sqlite3_reset)(this->_storeResponseStmtWrapper.get());
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   status = CESIUM_SQLITE(sqlite3_clear_bindings)(
-      this->_pImpl->_storeResponseStmtWrapper.get());
+      this->_storeResponseStmtWrapper.get());
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   status = CESIUM_SQLITE(sqlite3_bind_int64)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
+      this->_storeResponseStmtWrapper.get(),
       1,
       static_cast<int64_t>(expiryTime));
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   status = CESIUM_SQLITE(sqlite3_bind_int64)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
+      this->_storeResponseStmtWrapper.get(),
       2,
-      static_cast<int64_t>(std::time(nullptr)));
+      static_cast<int64_t>(lastAccessedTime));
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   std::string responseHeaderString = convertHeadersToString(responseHeaders);
   status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
+      this->_storeResponseStmtWrapper.get(),
       3,
       responseHeaderString.c_str(),
       -1,
       SQLITE_STATIC);
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   status = CESIUM_SQLITE(sqlite3_bind_int)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
+      this->_storeResponseStmtWrapper.get(),
       4,
       static_cast<int>(statusCode));
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   status = CESIUM_SQLITE(sqlite3_bind_blob)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
+      this->_storeResponseStmtWrapper.get(),
       5,
       responseData.data(),
       static_cast<int>(responseData.size()),
       SQLITE_STATIC);
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   std::string requestHeaderString = convertHeadersToString(requestHeaders);
   status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
+      this->_storeResponseStmtWrapper.get(),
       6,
       requestHeaderString.c_str(),
       -1,
       SQLITE_STATIC);
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
+      this->_storeResponseStmtWrapper.get(),
       7,
       requestMethod.c_str(),
       -1,
       SQLITE_STATIC);
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
+      this->_storeResponseStmtWrapper.get(),
       8,
       url.c_str(),
       -1,
       SQLITE_STATIC);
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   status = CESIUM_SQLITE(sqlite3_bind_text)(
-      this->_pImpl->_storeResponseStmtWrapper.get(),
+      this->_storeResponseStmtWrapper.get(),
       9,
       key.c_str(),
       -1,
       SQLITE_STATIC);
   if (status != SQLITE_OK) {
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
-    return false;
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_step)(this->_storeResponseStmtWrapper.get());
+  if (status != SQLITE_DONE) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  if (!isReplacing) {
+    ++this->_totalItems;
+  }
+  this->_totalSizeBytes +=
+      static_cast<int64_t>(responseData.size()) - replacedSizeBytes;
+
+  return status;
+}
+
+int SqliteCache::Impl::updateLastAccessedTimeUnderLock(
+    const std::string& key,
+    std::time_t lastAccessedTime) {
+  int status = CESIUM_SQLITE(sqlite3_reset)(
+      this->_updateLastAccessedTimeByKeyStmtWrapper.get());
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_clear_bindings)(
+      this->_updateLastAccessedTimeByKeyStmtWrapper.get());
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_bind_int64)(
+      this->_updateLastAccessedTimeByKeyStmtWrapper.get(),
+      1,
+      static_cast<int64_t>(lastAccessedTime));
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_bind_text)(
+      this->_updateLastAccessedTimeByKeyStmtWrapper.get(),
+      2,
+      key.c_str(),
+      -1,
+      SQLITE_STATIC);
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
   }
 
   status = CESIUM_SQLITE(sqlite3_step)(
-      this->_pImpl->_storeResponseStmtWrapper.get());
+      this->_updateLastAccessedTimeByKeyStmtWrapper.get());
   if (status != SQLITE_DONE) {
-    if (status == SQLITE_CORRUPT) {
-      destroyDatabase();
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+  }
+
+  return status;
+}
+
+int SqliteCache::Impl::updateLastAccessedTimeByRowIdUnderLock(int64_t rowId) {
+  int status = CESIUM_SQLITE(sqlite3_reset)(
+      this->_updateLastAccessedTimeStmtWrapper.get());
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_clear_bindings)(
+      this->_updateLastAccessedTimeStmtWrapper.get());
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_bind_int64)(
+      this->_updateLastAccessedTimeStmtWrapper.get(),
+      1,
+      rowId);
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_step)(
+      this->_updateLastAccessedTimeStmtWrapper.get());
+  if (status != SQLITE_DONE) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+  }
+
+  return status;
+}
+
+bool SqliteCache::Impl::execUnderLock(const std::string& sql) {
+  char* pError = nullptr;
+  const int status = CESIUM_SQLITE(sqlite3_exec)(
+      this->_pConnection.get(),
+      sql.c_str(),
+      nullptr,
+      nullptr,
+      &pError);
+  if (status != SQLITE_OK) {
+    if (pError) {
+      SPDLOG_LOGGER_ERROR(this->_pLogger, pError);
+      CESIUM_SQLITE(sqlite3_free)(pError);
+    } else {
+      SPDLOG_LOGGER_ERROR(
+          this->_pLogger,
+          CESIUM_SQLITE(sqlite3_errstr)(status));
     }
-    SPDLOG_LOGGER_ERROR(
-        this->_pImpl->_pLogger,
-        CESIUM_SQLITE(sqlite3_errstr)(status));
     return false;
   }
 
   return true;
 }
 
-bool SqliteCache::prune() {
-  CESIUM_TRACE("SqliteCache::prune");
-  std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
-
-  int64_t totalItems = 0;
+std::unique_ptr<SqliteCache::ReadConnectionPool::Connection>
+SqliteCache::ReadConnectionPool::acquire() {
+  uint64_t connectionGeneration = 0;
 
-  // query total size of response's data
   {
-    int totalItemsQueryStatus = CESIUM_SQLITE(sqlite3_reset)(
-        this->_pImpl->_totalItemsQueryStmtWrapper.get());
-    if (totalItemsQueryStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(totalItemsQueryStatus));
-      return false;
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (!this->idleConnections.empty()) {
+      std::unique_ptr<Connection> pConnection =
+          std::move(this->idleConnections.back());
+      this->idleConnections.pop_back();
+      return pConnection;
     }
 
-    totalItemsQueryStatus = CESIUM_SQLITE(sqlite3_clear_bindings)(
-        this->_pImpl->_totalItemsQueryStmtWrapper.get());
-    if (totalItemsQueryStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(totalItemsQueryStatus));
-      return false;
+    if (this->connectionCount >= this->maximumConnections) {
+      return nullptr;
     }
 
-    totalItemsQueryStatus = CESIUM_SQLITE(sqlite3_step)(
-        this->_pImpl->_totalItemsQueryStmtWrapper.get());
+    ++this->connectionCount;
+    connectionGeneration = this->generation;
+  }
 
-    if (totalItemsQueryStatus == SQLITE_DONE) {
-      return true;
-    }
+  // Open the new connection without holding the lock.
+  CESIUM_SQLITE(sqlite3*) pRawConnection = nullptr;
+  const int status = CESIUM_SQLITE(sqlite3_open_v2)(
+      this->databaseName.c_str(),
+      &pRawConnection,
+      SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
+      nullptr);
 
-    if (totalItemsQueryStatus != SQLITE_ROW) {
-      if (totalItemsQueryStatus == SQLITE_CORRUPT) {
-        destroyDatabase();
-      }
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(totalItemsQueryStatus));
-      return false;
+  // A connection is usually returned even if it couldn't be opened, and must
+  // still be closed.
+  SqliteConnectionPtr pConnection(pRawConnection);
+
+  if (status == SQLITE_OK) {
+    try {
+      SqliteStatementPtr pGetEntryStmt =
+          prepareStatement(pConnection, GET_ENTRY_SQL);
+      return std::make_unique<Connection>(Connection{
+          std::move(pConnection),
+          std::move(pGetEntryStmt),
+          connectionGeneration});
+    } catch (const std::exception& e) {
+      SPDLOG_LOGGER_WARN(
+          this->pLogger,
+          "Unable to prepare a statement for a read-only cache connection: {}",
+          e.what());
     }
+  } else {
+    SPDLOG_LOGGER_WARN(
+        this->pLogger,
+        "Unable to open a read-only cache connection: {}",
+        CESIUM_SQLITE(sqlite3_errstr)(status));
+  }
 
-    // prune the rows if over maximum
-    totalItems = CESIUM_SQLITE(sqlite3_column_int64)(
-        this->_pImpl->_totalItemsQueryStmtWrapper.get(),
-        0);
-    if (totalItems > 0 &&
-        totalItems <= static_cast<int64_t>(this->_pImpl->_maxItems)) {
-      return true;
-    }
+  // Don't try to open more connections, so that the failure isn't repeated
+  // and logged on every read.
+  std::lock_guard<std::mutex> lock(this->mutex);
+  --this->connectionCount;
+  this->maximumConnections = this->connectionCount;
+  return nullptr;
+}
+
+void SqliteCache::ReadConnectionPool::release(
+    std::unique_ptr<Connection> pConnection) {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  if (pConnection->generation == this->generation) {
+    this->idleConnections.emplace_back(std::move(pConnection));
+  } else {
+    --this->connectionCount;
+  }
+}
+
+void SqliteCache::ReadConnectionPool::invalidate() {
+  std::vector<std::unique_ptr<Connection>> connectionsToClose;
+
+  std::lock_guard<std::mutex> lock(this->mutex);
+  ++this->generation;
+  this->connectionCount -= this->idleConnections.size();
+  connectionsToClose.swap(this->idleConnections);
+}
+
+bool SqliteCache::flush() {
+  if (!this->_pWriteBehindQueue) {
+    return true;
   }
 
-  // delete expired rows first
+  CESIUM_TRACE("SqliteCache::flush");
+
+  std::shared_lock<std::shared_mutex> databaseLock(this->_databaseMutex);
+
+  bool result = true;
+  bool isCorrupt = false;
+
   {
-    int deleteExpiredStatus = CESIUM_SQLITE(sqlite3_reset)(
-        this->_pImpl->_deleteExpiredStmtWrapper.get());
-    if (deleteExpiredStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteExpiredStatus));
-      return false;
+    // Lock the database before taking the queued writes, so that flushes
+    // commit writes in the order they were queued, and so that clearAll can't
+    // run between taking the writes and committing them.
+    std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
+
+    WriteBehindQueue& queue = *this->_pWriteBehindQueue;
+    const std::unordered_map<std::string, WriteBehindQueue::PendingStore>&
+        stores = queue.flushingStores;
+    std::unordered_map<std::string, std::time_t> lastAccessedTimes;
+
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.flushingStores.swap(queue.stores);
+      lastAccessedTimes.swap(queue.lastAccessedTimes);
+      queue.pendingBytes = 0;
+      queue.updateQueuedWritesUnderLock();
     }
 
-    deleteExpiredStatus = CESIUM_SQLITE(sqlite3_clear_bindings)(
-        this->_pImpl->_deleteExpiredStmtWrapper.get());
-    if (deleteExpiredStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteExpiredStatus));
-      return false;
+    if (stores.empty() && lastAccessedTimes.empty()) {
+      return true;
     }
 
-    deleteExpiredStatus = CESIUM_SQLITE(sqlite3_step)(
-        this->_pImpl->_deleteExpiredStmtWrapper.get());
-    if (deleteExpiredStatus != SQLITE_DONE) {
-      if (deleteExpiredStatus == SQLITE_CORRUPT) {
-        destroyDatabase();
+    CESIUM_TRACE_COUNTER(
+        "sqliteCacheWritesFlushed",
+        int64_t(stores.size() + lastAccessedTimes.size()));
+
+    // A failed flush is rolled back, so note the totals to restore them.
+    const int64_t totalItems = this->_pImpl->_totalItems;
+    const int64_t totalSizeBytes = this->_pImpl->_totalSizeBytes;
+
+    // The write that failed, if it can't succeed by being retried. It is
+    // dropped, and the other writes are retried by the next flush.
+    const std::string* pRejectedKey = nullptr;
+
+    bool committed = false;
+    if (this->_pImpl->execUnderLock(BEGIN_TRANSACTION_SQL)) {
+      int status = SQLITE_DONE;
+      for (const auto& [key, pendingStore] : stores) {
+        const CacheItem& item = pendingStore.item;
+        status = this->_pImpl->storeEntryUnderLock(
+            key,
+            item.expiryTime,
+            pendingStore.lastAccessedTime,
+            item.cacheRequest.url,
+            item.cacheRequest.method,
+            item.cacheRequest.headers,
+            item.cacheResponse.statusCode,
+            item.cacheResponse.headers,
+            item.cacheResponse.data);
+        if (status != SQLITE_DONE) {
+          if (!isRetryable(status)) {
+            pRejectedKey = &key;
+          }
+          break;
+        }
       }
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteExpiredStatus));
-      return false;
+
+      if (status == SQLITE_DONE) {
+        for (const auto& [key, lastAccessedTime] : lastAccessedTimes) {
+          status = this->_pImpl->updateLastAccessedTimeUnderLock(
+              key,
+              lastAccessedTime);
+          if (status != SQLITE_DONE) {
+            if (!isRetryable(status)) {
+              pRejectedKey = &key;
+            }
+            break;
+          }
+        }
+      }
+
+      isCorrupt = status == SQLITE_CORRUPT;
+      committed = status == SQLITE_DONE &&
+                  this->_pImpl->execUnderLock(COMMIT_TRANSACTION_SQL);
+
+      if (!committed) {
+        // A failed COMMIT leaves the transaction open, so always roll back.
+        this->_pImpl->execUnderLock(ROLLBACK_TRANSACTION_SQL);
+        this->_pImpl->_totalItems = totalItems;
+        this->_pImpl->_totalSizeBytes = totalSizeBytes;
+      }
+    }
+
+    result = committed;
+
+    std::unordered_map<std::string, WriteBehindQueue::PendingStore> taken;
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (!committed) {
+      // Queue the writes again, unless newer ones were queued during the
+      // flush.
+      for (auto& [key, pendingStore] : queue.flushingStores) {
+        if (&key == pRejectedKey) {
+          continue;
+        }
+
+        auto [it, inserted] =
+            queue.stores.try_emplace(key, std::move(pendingStore));
+        if (inserted) {
+          queue.pendingBytes += it->second.sizeBytes;
+        }
+      }
+
+      for (const auto& [key, lastAccessedTime] : lastAccessedTimes) {
+        if (&key != pRejectedKey &&
+            queue.stores.find(key) == queue.stores.end()) {
+          queue.lastAccessedTimes.try_emplace(key, lastAccessedTime);
+        }
+      }
+
+      queue.updateQueuedWritesUnderLock();
     }
+
+    // The stores are now in the database, or queued again.
+    taken.swap(queue.flushingStores);
+  }
+
+  if (isCorrupt) {
+    const uint64_t generation = this->_pImpl->_generation;
+    databaseLock.unlock();
+    destroyDatabase(generation);
   }
 
-  // check if we should delete more
-  const int deletedRows =
-      CESIUM_SQLITE(sqlite3_changes)(this->_pImpl->_pConnection.get());
-  if (totalItems - deletedRows < static_cast<int>(this->_pImpl->_maxItems)) {
+  return result;
+}
+
+bool SqliteCache::Impl::isOverLimitUnderLock() const {
+  if (this->_totalItems > static_cast<int64_t>(this->_maxItems)) {
     return true;
   }
 
-  totalItems -= deletedRows;
+  return this->_options.maximumSizeBytes > 0 &&
+         this->_totalSizeBytes >
+             static_cast<int64_t>(this->_options.maximumSizeBytes);
+}
 
-  // delete rows LRU if we are still over maximum
-  {
-    int deleteLLRUStatus =
-        CESIUM_SQLITE(sqlite3_reset)(this->_pImpl->_deleteLRUStmtWrapper.get());
-    if (deleteLLRUStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteLLRUStatus));
-      return false;
+int SqliteCache::Impl::pruneBatchUnderLock(
+    bool expiredOnly,
+    int64_t& deletedItems) {
+  deletedItems = 0;
+
+  CESIUM_SQLITE(sqlite3_stmt*) pSelectStmt =
+      expiredOnly ? this->_selectExpiredStmtWrapper.get()
+                  : this->_selectLRUStmtWrapper.get();
+
+  // select the batch of items to delete, with the sizes of their responses
+  int status = CESIUM_SQLITE(sqlite3_reset)(pSelectStmt);
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  status = CESIUM_SQLITE(sqlite3_bind_int64)(
+      pSelectStmt,
+      1,
+      static_cast<int64_t>(this->_options.pruneBatchSize));
+  if (status != SQLITE_OK) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  std::vector<std::pair<int64_t, int64_t>> items;
+  while ((status = CESIUM_SQLITE(sqlite3_step)(pSelectStmt)) == SQLITE_ROW) {
+    items.emplace_back(
+        CESIUM_SQLITE(sqlite3_column_int64)(pSelectStmt, 0),
+        CESIUM_SQLITE(sqlite3_column_int64)(pSelectStmt, 1));
+  }
+
+  if (status != SQLITE_DONE) {
+    SPDLOG_LOGGER_ERROR(this->_pLogger, CESIUM_SQLITE(sqlite3_errstr)(status));
+    return status;
+  }
+
+  if (items.empty()) {
+    return SQLITE_DONE;
+  }
+
+  // delete them in a single transaction, until under the limits
+  if (!this->execUnderLock(BEGIN_TRANSACTION_SQL)) {
+    return SQLITE_ERROR;
+  }
+
+  int64_t deletedSizeBytes = 0;
+  for (const auto& [rowId, sizeBytes] : items) {
+    if (this->_totalItems - deletedItems <=
+            static_cast<int64_t>(this->_maxItems) &&
+        (this->_options.maximumSizeBytes == 0 ||
+         this->_totalSizeBytes - deletedSizeBytes <=
+             static_cast<int64_t>(this->_options.maximumSizeBytes))) {
+      break;
     }
 
-    deleteLLRUStatus = CESIUM_SQLITE(sqlite3_clear_bindings)(
-        this->_pImpl->_deleteLRUStmtWrapper.get());
-    if (deleteLLRUStatus != SQLITE_OK) {
+    status = CESIUM_SQLITE(sqlite3_reset)(this->_deleteItemStmtWrapper.get());
+    if (status == SQLITE_OK) {
+      status = CESIUM_SQLITE(sqlite3_bind_int64)(
+          this->_deleteItemStmtWrapper.get(),
+          1,
+          rowId);
+    }
+    if (status == SQLITE_OK) {
+      status = CESIUM_SQLITE(sqlite3_step)(this->_deleteItemStmtWrapper.get());
+    }
+    if (status != SQLITE_DONE) {
       SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteLLRUStatus));
-      return false;
+          this->_pLogger,
+          CESIUM_SQLITE(sqlite3_errstr)(status));
+      this->execUnderLock(ROLLBACK_TRANSACTION_SQL);
+      deletedItems = 0;
+      return status;
     }
 
-    deleteLLRUStatus = CESIUM_SQLITE(sqlite3_bind_int64)(
-        this->_pImpl->_deleteLRUStmtWrapper.get(),
-        1,
-        totalItems - static_cast<int64_t>(this->_pImpl->_maxItems));
-    if (deleteLLRUStatus != SQLITE_OK) {
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteLLRUStatus));
-      return false;
+    ++deletedItems;
+    deletedSizeBytes += sizeBytes;
+  }
+
+  if (!this->execUnderLock(COMMIT_TRANSACTION_SQL)) {
+    this->execUnderLock(ROLLBACK_TRANSACTION_SQL);
+    deletedItems = 0;
+    return SQLITE_ERROR;
+  }
+
+  this->_totalItems -= deletedItems;
+  this->_totalSizeBytes -= deletedSizeBytes;
+
+  return SQLITE_DONE;
+}
+
+bool SqliteCache::prune() {
+  CESIUM_TRACE("SqliteCache::prune");
+
+  // Count queued entries, too.
+  this->flush();
+
+  std::shared_lock<std::shared_mutex> databaseLock(this->_databaseMutex);
+
+  // The database may be replaced by a new one during the prune, so don't
+  // refer to it to record the metrics.
+  const SqliteCacheMetrics metrics = this->_pImpl->_metrics;
+  CesiumUtility::ScopeGuard recordDuration(
+      [pPruneMicroseconds = metrics.pPruneMicroseconds,
+       start = std::chrono::steady_clock::now()]() {
+        if (pPruneMicroseconds) {
+          pPruneMicroseconds->recordElapsedSince(start);
+        }
+      });
+
+  const std::chrono::steady_clock::time_point deadline =
+      std::chrono::steady_clock::now() +
+      this->_pImpl->_options.maximumPruneTime;
+
+  // Delete expired items first, then the least recently used ones. Release the
+  // lock between batches so that other threads can use the cache.
+  bool expiredOnly = true;
+  int status = SQLITE_DONE;
+
+  for (;;) {
+    std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
+
+    if (!this->_pImpl->isOverLimitUnderLock()) {
+      break;
+    }
+
+    int64_t deletedItems = 0;
+    status = this->_pImpl->pruneBatchUnderLock(expiredOnly, deletedItems);
+    if (status != SQLITE_DONE) {
+      break;
     }
 
-    deleteLLRUStatus =
-        CESIUM_SQLITE(sqlite3_step)(this->_pImpl->_deleteLRUStmtWrapper.get());
-    if (deleteLLRUStatus != SQLITE_DONE) {
-      if (deleteLLRUStatus == SQLITE_CORRUPT) {
-        destroyDatabase();
+    if (metrics.pPrunedEntries) {
+      metrics.pPrunedEntries->add(deletedItems);
+    }
+
+    if (deletedItems == 0) {
+      if (!expiredOnly) {
+        // Nothing is left to delete.
+        break;
       }
-      SPDLOG_LOGGER_ERROR(
-          this->_pImpl->_pLogger,
-          CESIUM_SQLITE(sqlite3_errstr)(deleteLLRUStatus));
-      return false;
+
+      expiredOnly = false;
+    } else if (std::chrono::steady_clock::now() >= deadline) {
+      // The next prune continues from here.
+      break;
     }
   }
 
-  return true;
+  if (status == SQLITE_CORRUPT) {
+    const uint64_t generation = this->_pImpl->_generation;
+    databaseLock.unlock();
+    destroyDatabase(generation);
+  }
+
+  return status == SQLITE_DONE;
 }
 
 bool SqliteCache::clearAll() {
-  std::lock_guard<std::mutex> guard(this->_pImpl->_mutex);
+  std::shared_lock<std::shared_mutex> databaseLock(this->_databaseMutex);
+  std::unique_lock<std::mutex> guard(this->_pImpl->_mutex);
+
+  if (this->_pWriteBehindQueue) {
+    // Drop queued writes. Writes already taken by a flush have been committed,
+    // because the flush owns the mutex we just locked until then.
+    WriteBehindQueue& queue = *this->_pWriteBehindQueue;
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.stores.clear();
+    queue.lastAccessedTimes.clear();
+    queue.pendingBytes = 0;
+    queue.updateQueuedWritesUnderLock();
+  }
 
   int status =
       CESIUM_SQLITE(sqlite3_reset)(this->_pImpl->_clearAllStmtWrapper.get());
@@ -770,24 +1618,44 @@ bool SqliteCache::clearAll() {
   status =
       CESIUM_SQLITE(sqlite3_step)(this->_pImpl->_clearAllStmtWrapper.get());
   if (status != SQLITE_DONE) {
-    if (status == SQLITE_CORRUPT) {
-      destroyDatabase();
-    }
     SPDLOG_LOGGER_ERROR(
         this->_pImpl->_pLogger,
         CESIUM_SQLITE(sqlite3_errstr)(status));
+    if (status == SQLITE_CORRUPT) {
+      const uint64_t generation = this->_pImpl->_generation;
+      guard.unlock();
+      databaseLock.unlock();
+      destroyDatabase(generation);
+    }
     return false;
   }
 
+  this->_pImpl->_totalItems = 0;
+  this->_pImpl->_totalSizeBytes = 0;
+
   return true;
 }
 
-void SqliteCache::destroyDatabase() {
+void SqliteCache::destroyDatabase(uint64_t generation) {
+  // Wait for every other use of the database to finish.
+  std::unique_lock<std::shared_mutex> databaseLock(this->_databaseMutex);
+
+  // Another thread that found the same corruption may have replaced the
+  // database already.
+  if (this->_pImpl->_generation != generation) {
+    return;
+  }
+
   std::shared_ptr<spdlog::logger> pLogger = _pImpl->_pLogger;
   std::string databaseName = _pImpl->_databaseName;
   uint64_t maxItems = _pImpl->_maxItems;
+  SqliteCacheOptions options = _pImpl->_options;
+  if (this->_pReadConnectionPool) {
+    this->_pReadConnectionPool->invalidate();
+  }
   _pImpl.reset();
-  _pImpl = std::make_unique<Impl>(pLogger, databaseName, maxItems);
+  _pImpl = std::make_unique<Impl>(pLogger, databaseName, maxItems, options);
+  _pImpl->_generation = generation + 1;
   if (remove(_pImpl->_databaseName.c_str()) != 0) {
     SPDLOG_LOGGER_ERROR(
         this->_pImpl->_pLogger,
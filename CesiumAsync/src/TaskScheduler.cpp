@@ -25,3 +25,7 @@ void TaskScheduler::schedule(async::task_run_handle t) {
     pReceiver->taskHandle.run();
   });
 }
+
+size_t TaskScheduler::getMaximumConcurrency() const noexcept {
+  return this->_pTaskProcessor->getMaximumConcurrency();
+}
@@ -0,0 +1,109 @@
+#include "CesiumAsync/forEachInParallel.h"
+
+#include "CesiumAsync/AsyncSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace CesiumAsync {
+
+namespace {
+struct ParallelWork {
+  std::function<void(size_t)> process;
+  size_t count = 0;
+  std::atomic<size_t> nextIndex = 0;
+  std::atomic<bool> failed = false;
+  std::mutex mutex;
+  std::condition_variable allCompleted;
+  size_t completedCount = 0;
+  std::exception_ptr pException;
+
+  void fail(std::exception_ptr pNewException) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (!this->pException) {
+      this->pException = std::move(pNewException);
+    }
+    this->failed = true;
+  }
+};
+
+// Processes indices until there are none left to start. Every claimed index
+// is counted as completed, even if processing it throws, so that the calling
+// thread never waits for an index that will not finish.
+void processIndices(ParallelWork& work) {
+  while (true) {
+    const size_t index = work.nextIndex++;
+    if (index >= work.count) {
+      return;
+    }
+
+    if (!work.failed) {
+      try {
+        work.process(index);
+      } catch (...) {
+        work.fail(std::current_exception());
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(work.mutex);
+    if (++work.completedCount == work.count) {
+      work.allCompleted.notify_all();
+    }
+  }
+}
+} // namespace
+
+void forEachInParallel(
+    const AsyncSystem* pAsyncSystem,
+    size_t count,
+    std::function<void(size_t)>&& process,
+    size_t maximumConcurrency) {
+  const size_t threadCount =
+      pAsyncSystem == nullptr
+          ? 1
+          : std::min(
+                {count,
+                 maximumConcurrency,
+                 pAsyncSystem->getMaximumWorkerConcurrency()});
+  if (threadCount <= 1) {
+    for (size_t i = 0; i < count; ++i) {
+      process(i);
+    }
+    return;
+  }
+
+  // The work is shared with the helper tasks, because a helper may start
+  // after this function has returned. A helper that starts after every index
+  // has been claimed does nothing, and in particular never calls `process`,
+  // which may refer to the caller's stack.
+  std::shared_ptr<ParallelWork> pWork = std::make_shared<ParallelWork>();
+  pWork->process = std::move(process);
+  pWork->count = count;
+
+  for (size_t i = 0; i < threadCount - 1; ++i) {
+    try {
+      pAsyncSystem->runInWorkerThread([pWork]() { processIndices(*pWork); });
+    } catch (...) {
+      // Don't unwind while helpers that were already started may still be
+      // processing indices. Finish the work in this thread instead.
+      break;
+    }
+  }
+
+  processIndices(*pWork);
+
+  std::unique_lock<std::mutex> lock(pWork->mutex);
+  pWork->allCompleted.wait(lock, [&work = *pWork]() {
+    return work.completedCount == work.count;
+  });
+
+  if (pWork->pException) {
+    std::rethrow_exception(pWork->pException);
+  }
+}
+
+} // namespace CesiumAsync
@@ -7,4 +7,8 @@
 class MockTaskProcessor : public CesiumAsync::ITaskProcessor {
 public:
   virtual void startTask(std::function<void()> f) override { f(); }
+
+  virtual size_t getMaximumConcurrency() const noexcept override {
+    return 1;
+  }
 };
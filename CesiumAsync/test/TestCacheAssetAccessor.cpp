@@ -8,10 +8,13 @@
 #include "MockTaskProcessor.h"
 #include "ResponseCacheControl.h"
 
+#include <CesiumUtility/Metrics.h>
+
 #include <catch2/catch.hpp>
 #include <spdlog/spdlog.h>
 
 #include <cstddef>
+#include <memory>
 #include <optional>
 
 using namespace CesiumAsync;
@@ -900,3 +903,95 @@ TEST_CASE("Test serving cache item") {
         .wait();
   }
 }
+
+TEST_CASE("CachingAssetAccessor records metrics in the metrics sink") {
+  std::unique_ptr<IAssetResponse> mockResponse =
+      std::make_unique<MockAssetResponse>(
+          static_cast<uint16_t>(200),
+          "app/json",
+          HttpHeaders{{"Content-Type", "app/json"}},
+          std::vector<std::byte>());
+
+  std::shared_ptr<IAssetRequest> mockRequest =
+      std::make_shared<MockAssetRequest>(
+          "GET",
+          "test.com",
+          HttpHeaders{},
+          std::move(mockResponse));
+
+  std::shared_ptr<MockStoreCacheDatabase> pMockCacheDatabase =
+      std::make_shared<MockStoreCacheDatabase>();
+  std::shared_ptr<CesiumUtility::InMemoryMetricsSink> pSink =
+      std::make_shared<CesiumUtility::InMemoryMetricsSink>();
+
+  std::shared_ptr<CachingAssetAccessor> cacheAssetAccessor =
+      std::make_shared<CachingAssetAccessor>(
+          spdlog::default_logger(),
+          std::make_shared<MockAssetAccessor>(mockRequest),
+          pMockCacheDatabase,
+          10000,
+          pSink);
+  std::shared_ptr<MockTaskProcessor> mockTaskProcessor =
+      std::make_shared<MockTaskProcessor>();
+  AsyncSystem asyncSystem(mockTaskProcessor);
+
+  auto makeCacheItem = [](std::time_t expiryTime) {
+    return CacheItem(
+        expiryTime,
+        CacheRequest(HttpHeaders{}, "GET", "cache.com"),
+        CacheResponse(
+            static_cast<uint16_t>(200),
+            HttpHeaders{
+                {"Content-Type", "app/json"},
+                {"Cache-Control", "max-age=100, private"}},
+            std::vector<std::byte>()));
+  };
+
+  auto get = [&]() {
+    cacheAssetAccessor
+        ->get(asyncSystem, "test.com", std::vector<IAssetAccessor::THeader>{})
+        .wait();
+  };
+
+  SECTION("Records a miss when the item is not in the cache") {
+    get();
+
+    CHECK(pSink->getCounter("cachingAssetAccessor.requests").get() == 1);
+    CHECK(pSink->getCounter("cachingAssetAccessor.cacheMisses").get() == 1);
+    CHECK(pSink->getCounter("cachingAssetAccessor.cacheHits").get() == 0);
+    CHECK(
+        pSink->getCounter("cachingAssetAccessor.cacheRevalidations").get() ==
+        0);
+  }
+
+  SECTION("Records a hit when a fresh item is in the cache") {
+    pMockCacheDatabase->cacheItem = makeCacheItem(std::time(nullptr) + 100);
+    get();
+    get();
+
+    CHECK(pSink->getCounter("cachingAssetAccessor.requests").get() == 2);
+    CHECK(pSink->getCounter("cachingAssetAccessor.cacheMisses").get() == 0);
+    CHECK(pSink->getCounter("cachingAssetAccessor.cacheHits").get() == 2);
+    CHECK(
+        pSink->getCounter("cachingAssetAccessor.cacheRevalidations").get() ==
+        0);
+  }
+
+  SECTION("Records a revalidation when a stale item is in the cache") {
+    pMockCacheDatabase->cacheItem = makeCacheItem(std::time(nullptr) - 100);
+    get();
+
+    CHECK(pSink->getCounter("cachingAssetAccessor.requests").get() == 1);
+    CHECK(pSink->getCounter("cachingAssetAccessor.cacheMisses").get() == 0);
+    CHECK(pSink->getCounter("cachingAssetAccessor.cacheHits").get() == 0);
+    CHECK(
+        pSink->getCounter("cachingAssetAccessor.cacheRevalidations").get() ==
+        1);
+  }
+
+  // Every request is timed, whether or not it was served from the cache.
+  CHECK(
+      pSink->getHistogram("cachingAssetAccessor.requestMicroseconds")
+          .getCount() ==
+      pSink->getCounter("cachingAssetAccessor.requests").get());
+}
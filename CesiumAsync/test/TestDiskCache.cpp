@@ -3,10 +3,20 @@
 #include "MockAssetResponse.h"
 #include "ResponseCacheControl.h"
 
+#include <CesiumUtility/Metrics.h>
+
 #include <catch2/catch.hpp>
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace CesiumAsync;
 
@@ -214,3 +224,418 @@ TEST_CASE("Test disk cache with Sqlite") {
     }
   }
 }
+
+namespace {
+bool storeTestEntry(
+    SqliteCache& cache,
+    const std::string& key,
+    size_t responseDataSize = 2) {
+  const HttpHeaders requestHeaders{{"Request-Header", "Request-Value"}};
+  const HttpHeaders responseHeaders{{"Content-Type", "text/html"}};
+  std::vector<std::byte> responseData(responseDataSize);
+  for (size_t i = 0; i < responseDataSize; ++i) {
+    responseData[i] = std::byte(i);
+  }
+  return cache.storeEntry(
+      key,
+      std::time(nullptr) + 60,
+      "test.com",
+      "GET",
+      requestHeaders,
+      200,
+      responseHeaders,
+      responseData);
+}
+
+// Reads keys "Key0" to "Key<keyCount - 1>" from many threads at once, and
+// returns the number of reads that missed.
+int32_t getEntriesConcurrently(
+    const SqliteCache& cache,
+    size_t keyCount,
+    size_t threadCount,
+    size_t iterationsPerThread) {
+  std::atomic<int32_t> misses = 0;
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadCount; ++i) {
+    threads.emplace_back([&cache, &misses, i, keyCount, iterationsPerThread]() {
+      for (size_t j = 0; j < iterationsPerThread; ++j) {
+        const std::string key = "Key" + std::to_string((i + j) % keyCount);
+        if (!cache.getEntry(key)) {
+          ++misses;
+        }
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  return misses.load();
+}
+} // namespace
+
+TEST_CASE("Test disk cache with Sqlite write-behind") {
+  const std::string databaseName = "test-write-behind.db";
+
+  // A second connection to the same database, which only sees what has been
+  // written to it.
+  SqliteCache databaseCache(spdlog::default_logger(), databaseName);
+  REQUIRE(databaseCache.clearAll());
+
+  SqliteCacheOptions options;
+  options.enableWriteBehind = true;
+  options.writeBehindFlushInterval = std::chrono::hours(1);
+
+  SECTION("Stored entries can be read before they are written") {
+    SqliteCache diskCache(spdlog::default_logger(), databaseName, 10, options);
+    REQUIRE(storeTestEntry(diskCache, "TestKey"));
+
+    std::optional<CacheItem> cacheItem = diskCache.getEntry("TestKey");
+    REQUIRE(cacheItem);
+    CHECK(cacheItem->cacheRequest.url == "test.com");
+    CHECK(cacheItem->cacheResponse.statusCode == 200);
+    CHECK(
+        cacheItem->cacheResponse.data ==
+        std::vector<std::byte>{std::byte(0), std::byte(1)});
+    CHECK(!databaseCache.getEntry("TestKey"));
+
+    REQUIRE(diskCache.flush());
+    CHECK(databaseCache.getEntry("TestKey"));
+    CHECK(diskCache.getEntry("TestKey"));
+  }
+
+  SECTION("Queued entries are written when the cache is destroyed") {
+    {
+      SqliteCache diskCache(
+          spdlog::default_logger(),
+          databaseName,
+          10,
+          options);
+      REQUIRE(storeTestEntry(diskCache, "TestKey"));
+    }
+
+    CHECK(databaseCache.getEntry("TestKey"));
+  }
+
+  SECTION("Queued entries are written when the queue is full") {
+    options.maximumWriteBehindBytes = 0;
+    SqliteCache diskCache(spdlog::default_logger(), databaseName, 10, options);
+    REQUIRE(storeTestEntry(diskCache, "TestKey"));
+    CHECK(databaseCache.getEntry("TestKey"));
+  }
+
+  SECTION("Clear all drops queued entries") {
+    SqliteCache diskCache(spdlog::default_logger(), databaseName, 10, options);
+    REQUIRE(storeTestEntry(diskCache, "TestKey"));
+    REQUIRE(diskCache.clearAll());
+    CHECK(!diskCache.getEntry("TestKey"));
+
+    REQUIRE(diskCache.flush());
+    CHECK(!databaseCache.getEntry("TestKey"));
+  }
+}
+
+TEST_CASE("Test disk cache with Sqlite read connections") {
+  SqliteCacheOptions options;
+  options.maximumReadConnections = 4;
+  SqliteCache diskCache(
+      spdlog::default_logger(),
+      "test-read-connections.db",
+      100,
+      options);
+  REQUIRE(diskCache.clearAll());
+
+  for (size_t i = 0; i < 16; ++i) {
+    REQUIRE(storeTestEntry(diskCache, "Key" + std::to_string(i)));
+  }
+
+  SECTION("Stored entries can be read immediately") {
+    REQUIRE(storeTestEntry(diskCache, "NewKey"));
+    std::optional<CacheItem> cacheItem = diskCache.getEntry("NewKey");
+    REQUIRE(cacheItem);
+    CHECK(cacheItem->cacheRequest.url == "test.com");
+    CHECK(cacheItem->cacheResponse.statusCode == 200);
+  }
+
+  SECTION("Entries can be read from more threads than there are connections") {
+    CHECK(getEntriesConcurrently(diskCache, 16, 8, 100) == 0);
+  }
+
+  SECTION("Cleared entries are not read") {
+    REQUIRE(diskCache.clearAll());
+    CHECK(!diskCache.getEntry("Key0"));
+  }
+}
+
+TEST_CASE("Test disk cache with Sqlite prunes by size") {
+  SqliteCacheOptions options;
+  options.maximumSizeBytes = 1000;
+  SqliteCache diskCache(
+      spdlog::default_logger(),
+      "test-prune-size.db",
+      100,
+      options);
+  REQUIRE(diskCache.clearAll());
+
+  SECTION("Least recently used entries are deleted until under the limit") {
+    for (size_t i = 0; i < 20; ++i) {
+      REQUIRE(storeTestEntry(diskCache, "Key" + std::to_string(i), 100));
+    }
+
+    REQUIRE(diskCache.prune());
+    for (size_t i = 0; i < 10; ++i) {
+      CHECK(!diskCache.getEntry("Key" + std::to_string(i)));
+    }
+    for (size_t i = 10; i < 20; ++i) {
+      CHECK(diskCache.getEntry("Key" + std::to_string(i)));
+    }
+  }
+
+  SECTION("Replaced entries no longer count towards the limit") {
+    REQUIRE(storeTestEntry(diskCache, "Key0", 900));
+    REQUIRE(storeTestEntry(diskCache, "Key0", 100));
+    REQUIRE(storeTestEntry(diskCache, "Key1", 100));
+
+    REQUIRE(diskCache.prune());
+    CHECK(diskCache.getEntry("Key0"));
+    CHECK(diskCache.getEntry("Key1"));
+  }
+
+  SECTION("Entries are counted when the database is opened") {
+    for (size_t i = 0; i < 20; ++i) {
+      REQUIRE(storeTestEntry(diskCache, "Key" + std::to_string(i), 100));
+    }
+
+    SqliteCache reopenedCache(
+        spdlog::default_logger(),
+        "test-prune-size.db",
+        100,
+        options);
+    REQUIRE(reopenedCache.prune());
+    CHECK(!reopenedCache.getEntry("Key9"));
+    CHECK(reopenedCache.getEntry("Key10"));
+  }
+}
+
+TEST_CASE("Test disk cache with Sqlite prunes incrementally") {
+  SqliteCacheOptions options;
+  options.maximumSizeBytes = 1000;
+  options.maximumPruneTime = std::chrono::milliseconds(0);
+  options.pruneBatchSize = 1;
+  SqliteCache diskCache(
+      spdlog::default_logger(),
+      "test-prune-incremental.db",
+      100,
+      options);
+  REQUIRE(diskCache.clearAll());
+
+  for (size_t i = 0; i < 20; ++i) {
+    REQUIRE(storeTestEntry(diskCache, "Key" + std::to_string(i), 100));
+  }
+
+  // Each prune deletes a single batch, and the next continues from there.
+  REQUIRE(diskCache.prune());
+  CHECK(!diskCache.getEntry("Key0"));
+
+  for (size_t i = 1; i < 10; ++i) {
+    REQUIRE(diskCache.prune());
+  }
+
+  for (size_t i = 0; i < 10; ++i) {
+    CHECK(!diskCache.getEntry("Key" + std::to_string(i)));
+  }
+  for (size_t i = 10; i < 20; ++i) {
+    CHECK(diskCache.getEntry("Key" + std::to_string(i)));
+  }
+
+  // Once under the limit, prune doesn't delete anything more.
+  REQUIRE(diskCache.prune());
+  CHECK(diskCache.getEntry("Key10"));
+}
+
+TEST_CASE("Test disk cache with Sqlite records metrics") {
+  const std::string databaseName = "test-metrics.db";
+
+  std::shared_ptr<CesiumUtility::InMemoryMetricsSink> pSink =
+      std::make_shared<CesiumUtility::InMemoryMetricsSink>();
+  SqliteCacheOptions options;
+  options.pMetricsSink = pSink;
+
+  SECTION("Hits, misses, and stores are recorded") {
+    SqliteCache diskCache(spdlog::default_logger(), databaseName, 10, options);
+    REQUIRE(diskCache.clearAll());
+
+    REQUIRE(storeTestEntry(diskCache, "Key0"));
+    CHECK(diskCache.getEntry("Key0"));
+    CHECK(diskCache.getEntry("Key0"));
+    CHECK(!diskCache.getEntry("Missing"));
+
+    CHECK(pSink->getCounter("sqliteCache.hits").get() == 2);
+    CHECK(pSink->getCounter("sqliteCache.misses").get() == 1);
+    CHECK(
+        pSink->getHistogram("sqliteCache.getEntryMicroseconds").getCount() ==
+        3);
+    CHECK(
+        pSink->getHistogram("sqliteCache.storeEntryMicroseconds").getCount() ==
+        1);
+  }
+
+  SECTION("Pruned entries are recorded") {
+    SqliteCache diskCache(spdlog::default_logger(), databaseName, 10, options);
+    REQUIRE(diskCache.clearAll());
+
+    for (size_t i = 0; i < 15; ++i) {
+      REQUIRE(storeTestEntry(diskCache, "Key" + std::to_string(i)));
+    }
+
+    REQUIRE(diskCache.prune());
+    CHECK(pSink->getCounter("sqliteCache.prunedEntries").get() == 5);
+    CHECK(pSink->getHistogram("sqliteCache.pruneMicroseconds").getCount() == 1);
+
+    // A prune that has nothing to delete is still timed.
+    REQUIRE(diskCache.prune());
+    CHECK(pSink->getCounter("sqliteCache.prunedEntries").get() == 5);
+    CHECK(pSink->getHistogram("sqliteCache.pruneMicroseconds").getCount() == 2);
+  }
+
+  SECTION("Queued writes are recorded") {
+    options.enableWriteBehind = true;
+    options.writeBehindFlushInterval = std::chrono::hours(1);
+    SqliteCache diskCache(spdlog::default_logger(), databaseName, 10, options);
+    REQUIRE(diskCache.clearAll());
+
+    const CesiumUtility::MetricGauge& queuedWrites =
+        pSink->getGauge("sqliteCache.queuedWrites");
+
+    REQUIRE(storeTestEntry(diskCache, "Key0"));
+    REQUIRE(storeTestEntry(diskCache, "Key1"));
+    CHECK(queuedWrites.get() == 2);
+
+    // Storing an entry that is already queued replaces it.
+    REQUIRE(storeTestEntry(diskCache, "Key1"));
+    CHECK(queuedWrites.get() == 2);
+
+    REQUIRE(diskCache.flush());
+    CHECK(queuedWrites.get() == 0);
+
+    // Reading an entry from the database queues the update of its last
+    // accessed time.
+    CHECK(diskCache.getEntry("Key0"));
+    CHECK(queuedWrites.get() == 1);
+    CHECK(pSink->getCounter("sqliteCache.hits").get() == 1);
+
+    REQUIRE(diskCache.flush());
+    CHECK(queuedWrites.get() == 0);
+  }
+}
+
+TEST_CASE("Test disk cache with Sqlite replaces a corrupt database in use") {
+  const std::string databaseName = "test-corrupt.db";
+  const size_t corruptResponseSize = 256 * 1024;
+
+  // Start from a new database, even if an earlier run left a corrupt one.
+  for (const char* suffix : {"", "-wal", "-shm"}) {
+    std::remove((databaseName + suffix).c_str());
+  }
+
+  {
+    SqliteCache diskCache(spdlog::default_logger(), databaseName);
+    REQUIRE(diskCache.clearAll());
+    REQUIRE(storeTestEntry(diskCache, "Key", corruptResponseSize));
+  }
+
+  // The end of the file holds the overflow pages of the large response, so
+  // the database can still be opened and counted, but reading or replacing
+  // that entry fails with SQLITE_CORRUPT.
+  {
+    std::fstream file(
+        databaseName,
+        std::ios::in | std::ios::out | std::ios::binary);
+    REQUIRE(file);
+    const std::streamoff corruptSize = 128 * 1024;
+    file.seekp(-corruptSize, std::ios::end);
+    const std::vector<char> garbage(size_t(corruptSize), char(0xff));
+    file.write(garbage.data(), corruptSize);
+    REQUIRE(file);
+  }
+
+  SqliteCacheOptions options;
+  options.maximumReadConnections = 2;
+
+  SECTION("Without write-behind") {}
+
+  SECTION("With write-behind") {
+    options.enableWriteBehind = true;
+    options.maximumWriteBehindBytes = 0;
+  }
+
+  SqliteCache diskCache(spdlog::default_logger(), databaseName, 100, options);
+
+  // Replacing the entry finds the corruption and replaces the database while
+  // other threads read, store, and prune.
+  std::atomic<int32_t> corruptReads = 0;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 8; ++i) {
+    threads.emplace_back([&diskCache, &corruptReads, i]() {
+      for (size_t j = 0; j < 50; ++j) {
+        switch ((i + j) % 4) {
+        case 0:
+          storeTestEntry(diskCache, "Key");
+          break;
+        case 1:
+          storeTestEntry(diskCache, "Key" + std::to_string(i));
+          break;
+        case 2:
+          diskCache.prune();
+          break;
+        default: {
+          std::optional<CacheItem> cacheItem = diskCache.getEntry("Key");
+          if (cacheItem && cacheItem->cacheResponse.data.size() != 2) {
+            ++corruptReads;
+          }
+          break;
+        }
+        }
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  CHECK(corruptReads == 0);
+
+  // The new database can be used.
+  REQUIRE(diskCache.flush());
+  REQUIRE(storeTestEntry(diskCache, "NewKey"));
+  CHECK(diskCache.getEntry("NewKey"));
+
+  std::optional<CacheItem> cacheItem = diskCache.getEntry("Key");
+  REQUIRE(cacheItem);
+  CHECK(cacheItem->cacheResponse.data.size() == 2);
+}
+
+TEST_CASE("Benchmark SqliteCache hits", "[.][benchmark]") {
+  const size_t keyCount = 256;
+
+  for (size_t threadCount : {size_t(1), size_t(4), size_t(16)}) {
+    SqliteCacheOptions options;
+    options.maximumReadConnections = threadCount;
+    SqliteCache diskCache(
+        spdlog::default_logger(),
+        "test-benchmark.db",
+        keyCount,
+        options);
+    REQUIRE(diskCache.clearAll());
+    for (size_t i = 0; i < keyCount; ++i) {
+      REQUIRE(storeTestEntry(diskCache, "Key" + std::to_string(i)));
+    }
+
+    BENCHMARK("getEntry with " + std::to_string(threadCount) + " threads") {
+      return getEntriesConcurrently(diskCache, keyCount, threadCount, 1000);
+    };
+  }
+}
@@ -0,0 +1,95 @@
+#include "CesiumAsync/AsyncSystem.h"
+#include "CesiumAsync/forEachInParallel.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace CesiumAsync;
+
+namespace {
+
+class ThreadPerTaskProcessor : public ITaskProcessor {
+public:
+  std::atomic<int32_t> tasksStarted = 0;
+
+  virtual void startTask(std::function<void()> f) override {
+    ++tasksStarted;
+    std::thread(f).detach();
+  }
+
+  virtual size_t getMaximumConcurrency() const noexcept override { return 4; }
+};
+
+} // namespace
+
+TEST_CASE("forEachInParallel") {
+  std::shared_ptr<ThreadPerTaskProcessor> pTaskProcessor =
+      std::make_shared<ThreadPerTaskProcessor>();
+  AsyncSystem asyncSystem(pTaskProcessor);
+
+  SECTION("processes every index exactly once") {
+    std::vector<std::atomic<int32_t>> calls(1000);
+    forEachInParallel(&asyncSystem, calls.size(), [&calls](size_t i) {
+      ++calls[i];
+    });
+
+    for (const std::atomic<int32_t>& count : calls) {
+      CHECK(count == 1);
+    }
+    CHECK(pTaskProcessor->tasksStarted <= 3);
+  }
+
+  SECTION("processes inline without an async system") {
+    const std::thread::id callingThread = std::this_thread::get_id();
+    std::vector<int32_t> calls(100);
+    forEachInParallel(nullptr, calls.size(), [&](size_t i) {
+      CHECK(std::this_thread::get_id() == callingThread);
+      ++calls[i];
+    });
+
+    for (int32_t count : calls) {
+      CHECK(count == 1);
+    }
+  }
+
+  SECTION("respects the maximum concurrency") {
+    std::vector<std::atomic<int32_t>> calls(100);
+    forEachInParallel(
+        &asyncSystem,
+        calls.size(),
+        [&calls](size_t i) { ++calls[i]; },
+        1);
+
+    for (const std::atomic<int32_t>& count : calls) {
+      CHECK(count == 1);
+    }
+    CHECK(pTaskProcessor->tasksStarted == 0);
+  }
+
+  SECTION("rethrows an exception in the calling thread without hanging") {
+    CHECK_THROWS_AS(
+        forEachInParallel(
+            &asyncSystem,
+            1000,
+            [](size_t i) {
+              if (i % 100 == 10) {
+                throw std::runtime_error("failed");
+              }
+            }),
+        std::runtime_error);
+  }
+
+  SECTION("rethrows an exception thrown while processing inline") {
+    CHECK_THROWS_AS(
+        forEachInParallel(
+            nullptr,
+            10,
+            [](size_t) { throw std::runtime_error("failed"); }),
+        std::runtime_error);
+  }
+}
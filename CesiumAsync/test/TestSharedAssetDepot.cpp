@@ -1,10 +1,17 @@
 #include <CesiumAsync/SharedAssetDepot.h>
 #include <CesiumNativeTests/SimpleAssetAccessor.h>
 #include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumUtility/Metrics.h>
 #include <CesiumUtility/SharedAsset.h>
 
 #include <catch2/catch.hpp>
 
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace CesiumAsync;
 using namespace CesiumNativeTests;
 using namespace CesiumUtility;
@@ -18,15 +25,62 @@ public:
   int64_t getSizeBytes() const { return int64_t(this->someValue.size()); }
 };
 
-IntrusivePointer<SharedAssetDepot<TestAsset, std::string>> createDepot() {
+IntrusivePointer<SharedAssetDepot<TestAsset, std::string>> createDepot(
+    std::atomic<int32_t>* pCreateCount = nullptr,
+    const std::shared_ptr<IMetricsSink>& pMetricsSink = nullptr) {
   return new SharedAssetDepot<TestAsset, std::string>(
-      [](const AsyncSystem& asyncSystem,
-         const std::shared_ptr<IAssetAccessor>& /* pAssetAccessor */,
-         const std::string& assetKey) {
+      [pCreateCount](
+          const AsyncSystem& asyncSystem,
+          const std::shared_ptr<IAssetAccessor>& /* pAssetAccessor */,
+          const std::string& assetKey) {
+        if (pCreateCount) {
+          ++*pCreateCount;
+        }
         IntrusivePointer<TestAsset> p = new TestAsset();
         p->someValue = assetKey;
         return asyncSystem.createResolvedFuture(ResultPointer<TestAsset>(p));
-      });
+      },
+      pMetricsSink);
+}
+
+std::vector<std::string> createKeys(size_t count) {
+  std::vector<std::string> keys;
+  for (size_t i = 0; i < count; ++i) {
+    keys.emplace_back("asset" + std::to_string(100 + i));
+  }
+  return keys;
+}
+
+// Gets and releases assets from many threads at once. Each thread cycles
+// through all of the keys, starting at a different offset. Returns the number
+// of times an asset could not be gotten.
+int32_t getAndReleaseConcurrently(
+    SharedAssetDepot<TestAsset, std::string>& depot,
+    const AsyncSystem& asyncSystem,
+    const std::vector<std::string>& keys,
+    size_t threadCount,
+    size_t iterationsPerThread) {
+  std::atomic<int32_t> failures = 0;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadCount; ++i) {
+    threads.emplace_back(
+        [&depot, &asyncSystem, &keys, &failures, i, iterationsPerThread]() {
+          for (size_t j = 0; j < iterationsPerThread; ++j) {
+            const std::string& key = keys[(i * 7 + j) % keys.size()];
+            ResultPointer<TestAsset> asset =
+                depot.getOrCreate(asyncSystem, nullptr, key).wait();
+            if (asset.pValue == nullptr) {
+              ++failures;
+            }
+          }
+        });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  return failures.load();
 }
 
 } // namespace
@@ -123,4 +177,110 @@ TEST_CASE("SharedAssetDepot") {
     CHECK(pDepot->getActiveAssetCount() == 0);
     CHECK(pDepot->getInactiveAssetCount() == 1);
   }
+
+  SECTION("records hits, misses, and evictions in a metrics sink") {
+    auto pSink = std::make_shared<InMemoryMetricsSink>();
+    auto pDepot = createDepot(nullptr, pSink);
+
+    pDepot->inactiveAssetSizeLimitBytes =
+        int64_t(std::string("one").size() + 1);
+
+    ResultPointer<TestAsset> assetOne =
+        pDepot->getOrCreate(asyncSystem, nullptr, "one").waitInMainThread();
+    ResultPointer<TestAsset> assetOneAgain =
+        pDepot->getOrCreate(asyncSystem, nullptr, "one").waitInMainThread();
+    ResultPointer<TestAsset> assetTwo =
+        pDepot->getOrCreate(asyncSystem, nullptr, "two").waitInMainThread();
+
+    CHECK(pSink->getCounter("sharedAssetDepot.hits").get() == 1);
+    CHECK(pSink->getCounter("sharedAssetDepot.misses").get() == 2);
+
+    assetOne.pValue.reset();
+    assetOneAgain.pValue.reset();
+    CHECK(pSink->getGauge("sharedAssetDepot.inactiveBytes").get() == 3);
+
+    assetTwo.pValue.reset();
+    CHECK(pSink->getCounter("sharedAssetDepot.evictedBytes").get() == 3);
+    CHECK(pSink->getGauge("sharedAssetDepot.inactiveBytes").get() == 3);
+  }
+}
+
+TEST_CASE("SharedAssetDepot deletes the least recently used assets across "
+          "stripes") {
+  AsyncSystem asyncSystem(std::make_shared<SimpleTaskProcessor>());
+  std::atomic<int32_t> createCount = 0;
+  auto pDepot = createDepot(&createCount);
+
+  // Keys are all the same length, so this leaves room for five of them.
+  const std::vector<std::string> keys = createKeys(10);
+  pDepot->inactiveAssetSizeLimitBytes = int64_t(keys[0].size() * 5);
+
+  std::vector<ResultPointer<TestAsset>> assets;
+  for (const std::string& key : keys) {
+    assets.emplace_back(
+        pDepot->getOrCreate(asyncSystem, nullptr, key).waitInMainThread());
+  }
+  CHECK(createCount.load() == 10);
+
+  // Release the assets in order. They will be spread across many stripes, but
+  // the ones released first should be deleted first.
+  for (ResultPointer<TestAsset>& asset : assets) {
+    asset.pValue.reset();
+  }
+
+  CHECK(pDepot->getAssetCount() == 5);
+  CHECK(pDepot->getInactiveAssetCount() == 5);
+  CHECK(
+      pDepot->getInactiveAssetTotalSizeBytes() <=
+      pDepot->inactiveAssetSizeLimitBytes);
+
+  for (size_t i = 5; i < keys.size(); ++i) {
+    ResultPointer<TestAsset> asset =
+        pDepot->getOrCreate(asyncSystem, nullptr, keys[i]).waitInMainThread();
+    CHECK(asset.pValue != nullptr);
+  }
+  CHECK(createCount.load() == 10);
+
+  ResultPointer<TestAsset> asset =
+      pDepot->getOrCreate(asyncSystem, nullptr, keys[0]).waitInMainThread();
+  CHECK(asset.pValue != nullptr);
+  CHECK(createCount.load() == 11);
+}
+
+TEST_CASE("SharedAssetDepot can be used from many threads at once") {
+  AsyncSystem asyncSystem(std::make_shared<SimpleTaskProcessor>());
+  std::atomic<int32_t> createCount = 0;
+  auto pDepot = createDepot(&createCount);
+
+  const std::vector<std::string> keys = createKeys(64);
+  pDepot->inactiveAssetSizeLimitBytes = int64_t(keys[0].size() * 16);
+
+  CHECK(getAndReleaseConcurrently(*pDepot, asyncSystem, keys, 8, 2000) == 0);
+
+  CHECK(createCount.load() >= 64);
+  CHECK(pDepot->getActiveAssetCount() == 0);
+  CHECK(pDepot->getAssetCount() == pDepot->getInactiveAssetCount());
+  CHECK(
+      pDepot->getInactiveAssetTotalSizeBytes() <=
+      pDepot->inactiveAssetSizeLimitBytes);
+}
+
+TEST_CASE("Benchmark SharedAssetDepot contention", "[.][benchmark]") {
+  AsyncSystem asyncSystem(std::make_shared<SimpleTaskProcessor>());
+  const std::vector<std::string> keys = createKeys(256);
+
+  for (size_t threadCount : {size_t(1), size_t(4), size_t(16)}) {
+    auto pDepot = createDepot();
+
+    BENCHMARK(
+        "getOrCreate and release with " + std::to_string(threadCount) +
+        " threads") {
+      return getAndReleaseConcurrently(
+          *pDepot,
+          asyncSystem,
+          keys,
+          threadCount,
+          10000);
+    };
+  }
 }
@@ -2,10 +2,13 @@
 
 #include "Plane.h"
 
+#include <optional>
+
 namespace Cesium3DTilesSelection {
 
 /**
- * @brief A culling volume, defined by four planes.
+ * @brief A culling volume, defined by four planes, and optionally a near and a
+ * far plane.
  *
  * The planes describe the culling volume that may be created for
  * the view frustum of a camera. The normals of these planes will
@@ -40,6 +43,18 @@ struct CullingVolume final {
    * Defaults to (0,0,1), with a distance of 0.
    */
   CesiumGeometry::Plane bottomPlane{glm::dvec3(0.0, 0.0, 1.0), 0.0};
+
+  /**
+   * @brief The near plane of the culling volume, or `std::nullopt` if
+   * the volume is not limited in the viewing direction.
+   */
+  std::optional<CesiumGeometry::Plane> nearPlane{};
+
+  /**
+   * @brief The far plane of the culling volume, or `std::nullopt` if the
+   * volume extends infinitely far in the viewing direction.
+   */
+  std::optional<CesiumGeometry::Plane> farPlane{};
 };
 
 /**
@@ -58,4 +73,26 @@ CullingVolume createCullingVolume(
     const glm::dvec3& up,
     double fovx,
     double fovy) noexcept;
+
+/**
+ * @brief Creates a {@link CullingVolume} for a perspective frustum with near
+ * and far planes.
+ *
+ * @param position The eye position
+ * @param direction The viewing direction
+ * @param up The up-vector of the frustum
+ * @param fovx The horizontal Field-Of-View angle, in radians
+ * @param fovy The vertical Field-Of-View angle, in radians
+ * @param nearDistance The distance from the eye position to the near plane
+ * @param farDistance The distance from the eye position to the far plane
+ * @return The {@link CullingVolume}
+ */
+CullingVolume createCullingVolume(
+    const glm::dvec3& position,
+    const glm::dvec3& direction,
+    const glm::dvec3& up,
+    double fovx,
+    double fovy,
+    double nearDistance,
+    double farDistance) noexcept;
 } // namespace Cesium3DTilesSelection
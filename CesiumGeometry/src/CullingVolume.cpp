@@ -66,4 +66,24 @@ CullingVolume createCullingVolume(
 
   return {leftPlane, rightPlane, topPlane, bottomPlane};
 }
+
+CullingVolume createCullingVolume(
+    const glm::dvec3& position,
+    const glm::dvec3& direction,
+    const glm::dvec3& up,
+    const double fovx,
+    const double fovy,
+    const double nearDistance,
+    const double farDistance) noexcept {
+  CullingVolume result =
+      createCullingVolume(position, direction, up, fovx, fovy);
+
+  const glm::dvec3 normal = glm::normalize(direction);
+  result.nearPlane =
+      CesiumGeometry::Plane(position + normal * nearDistance, normal);
+  result.farPlane =
+      CesiumGeometry::Plane(position + normal * farDistance, -normal);
+
+  return result;
+}
 } // namespace Cesium3DTilesSelection
@@ -67,6 +67,22 @@ public:
    */
   bool expandToIncludePosition(const Cartographic& position);
 
+  /**
+   * @brief Expands the bounding region to include the region of another
+   * builder.
+   *
+   * This allows separate builders to be used for separate sets of positions,
+   * for example in different threads, and combined afterwards. The longitude
+   * range is the union of the two longitude ranges, so it may be larger than
+   * the range obtained by giving all of the positions to a single builder when
+   * the positions span more than half of the globe.
+   *
+   * @param other The builder whose region is to be included in this one.
+   * @returns True if the region was modified, or false if the region already
+   * contained the other region.
+   */
+  bool expandToIncludeRegion(const BoundingRegionBuilder& other);
+
 private:
   /**
    * @brief When a position's latitude is within this distance in radians from
@@ -6,6 +6,7 @@
 #include <CesiumUtility/Math.h>
 
 #include <glm/vec3.hpp>
+#include <gsl/span>
 
 #include <optional>
 
@@ -126,6 +127,80 @@ public:
   std::optional<Cartographic>
   cartesianToCartographic(const glm::dvec3& cartesian) const noexcept;
 
+  /**
+   * @brief Computes the normals of the planes tangent to the surface of the
+   * ellipsoid at many positions at once.
+   *
+   * The positions and normals are each given as three separate arrays of X, Y,
+   * and Z components, which allows the computation to be vectorized. All of
+   * the spans must be the same size. The results are the same as calling
+   * {@link geodeticSurfaceNormal(const glm::dvec3&) const} for each position.
+   *
+   * @param x The X components of the cartesian positions.
+   * @param y The Y components of the cartesian positions.
+   * @param z The Z components of the cartesian positions.
+   * @param normalX Receives the X components of the normals.
+   * @param normalY Receives the Y components of the normals.
+   * @param normalZ Receives the Z components of the normals.
+   */
+  void geodeticSurfaceNormal(
+      const gsl::span<const double>& x,
+      const gsl::span<const double>& y,
+      const gsl::span<const double>& z,
+      const gsl::span<double>& normalX,
+      const gsl::span<double>& normalY,
+      const gsl::span<double>& normalZ) const noexcept;
+
+  /**
+   * @brief Converts many cartographic positions to cartesian at once.
+   *
+   * The positions are each given as three separate arrays of components, which
+   * allows the computation to be vectorized. All of the spans must be the same
+   * size. The results are the same as calling
+   * {@link cartographicToCartesian(const Cartographic&) const} for each
+   * position.
+   *
+   * @param longitudes The longitudes of the positions, in radians.
+   * @param latitudes The latitudes of the positions, in radians.
+   * @param heights The heights of the positions above the ellipsoid.
+   * @param x Receives the X components of the cartesian positions.
+   * @param y Receives the Y components of the cartesian positions.
+   * @param z Receives the Z components of the cartesian positions.
+   */
+  void cartographicToCartesian(
+      const gsl::span<const double>& longitudes,
+      const gsl::span<const double>& latitudes,
+      const gsl::span<const double>& heights,
+      const gsl::span<double>& x,
+      const gsl::span<double>& y,
+      const gsl::span<double>& z) const noexcept;
+
+  /**
+   * @brief Converts many cartesian positions to cartographic at once.
+   *
+   * The positions are each given as three separate arrays of components, which
+   * allows the computation to be vectorized. All of the spans must be the same
+   * size. The results are the same as calling
+   * {@link cartesianToCartographic(const glm::dvec3&) const} for each
+   * position, except that a position at the center of this ellipsoid, which
+   * has no cartographic representation, produces a longitude, latitude, and
+   * height that are all NaN.
+   *
+   * @param x The X components of the cartesian positions.
+   * @param y The Y components of the cartesian positions.
+   * @param z The Z components of the cartesian positions.
+   * @param longitudes Receives the longitudes of the positions, in radians.
+   * @param latitudes Receives the latitudes of the positions, in radians.
+   * @param heights Receives the heights of the positions above the ellipsoid.
+   */
+  void cartesianToCartographic(
+      const gsl::span<const double>& x,
+      const gsl::span<const double>& y,
+      const gsl::span<const double>& z,
+      const gsl::span<double>& longitudes,
+      const gsl::span<double>& latitudes,
+      const gsl::span<double>& heights) const noexcept;
+
   /**
    * @brief Scales the given cartesian position along the geodetic surface
    * normal so that it is on the surface of this ellipsoid.
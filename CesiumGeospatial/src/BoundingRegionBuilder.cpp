@@ -13,6 +13,12 @@ bool isCloseToPole(double latitude, double tolerance) {
   return Math::PiOverTwo - glm::abs(latitude) < tolerance;
 }
 
+// The distance from one longitude eastward to another, in [0, 2Pi).
+double computeEastwardDistance(double fromLongitude, double toLongitude) {
+  const double distance = toLongitude - fromLongitude;
+  return distance < 0.0 ? distance + Math::TwoPi : distance;
+}
+
 } // namespace
 
 namespace CesiumGeospatial {
@@ -120,4 +126,73 @@ bool BoundingRegionBuilder::expandToIncludePosition(
   return modified;
 }
 
+bool BoundingRegionBuilder::expandToIncludeRegion(
+    const BoundingRegionBuilder& other) {
+  bool modified = false;
+
+  if (other._rectangle.getSouth() < this->_rectangle.getSouth()) {
+    this->_rectangle.setSouth(other._rectangle.getSouth());
+    modified = true;
+  }
+
+  if (other._rectangle.getNorth() > this->_rectangle.getNorth()) {
+    this->_rectangle.setNorth(other._rectangle.getNorth());
+    modified = true;
+  }
+
+  if (other._minimumHeight < this->_minimumHeight) {
+    this->_minimumHeight = other._minimumHeight;
+    modified = true;
+  }
+
+  if (other._maximumHeight > this->_maximumHeight) {
+    this->_maximumHeight = other._maximumHeight;
+    modified = true;
+  }
+
+  if (other._longitudeRangeIsEmpty) {
+    return modified;
+  }
+
+  if (this->_longitudeRangeIsEmpty) {
+    this->_rectangle.setWest(other._rectangle.getWest());
+    this->_rectangle.setEast(other._rectangle.getEast());
+    this->_longitudeRangeIsEmpty = false;
+    return true;
+  }
+
+  // Find the smallest longitude range that contains both ranges. It starts
+  // at the West edge of one of them and ends at the East edge of one of them.
+  const GlobeRectangle& a = this->_rectangle;
+  const GlobeRectangle& b = other._rectangle;
+  const double bFromA = computeEastwardDistance(a.getWest(), b.getWest());
+  const double aFromB = computeEastwardDistance(b.getWest(), a.getWest());
+  const double widthFromA =
+      glm::max(a.computeWidth(), bFromA + b.computeWidth());
+  const double widthFromB =
+      glm::max(b.computeWidth(), aFromB + a.computeWidth());
+
+  double west;
+  double east;
+  if (glm::min(widthFromA, widthFromB) >= Math::TwoPi) {
+    west = -Math::OnePi;
+    east = Math::OnePi;
+  } else if (widthFromA <= widthFromB) {
+    west = a.getWest();
+    east = widthFromA > a.computeWidth() ? b.getEast() : a.getEast();
+  } else {
+    west = b.getWest();
+    east = widthFromB > b.computeWidth() ? a.getEast() : b.getEast();
+  }
+
+  if (west != this->_rectangle.getWest() ||
+      east != this->_rectangle.getEast()) {
+    this->_rectangle.setWest(west);
+    this->_rectangle.setEast(east);
+    modified = true;
+  }
+
+  return modified;
+}
+
 } // namespace CesiumGeospatial
@@ -1,14 +1,28 @@
 #include "CesiumGeospatial/Ellipsoid.h"
 
+#include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
 
 #include <glm/geometric.hpp>
 #include <glm/trigonometric.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
 using namespace CesiumUtility;
 
 namespace CesiumGeospatial {
 
+namespace {
+// The number of positions that the batched cartesianToCartographic iterates
+// on together. Within a block, each position keeps iterating until it
+// converges, just as it would in scaleToGeodeticSurface.
+constexpr size_t cartesianToCartographicBlockSize = 8;
+} // namespace
+
 const Ellipsoid Ellipsoid::WGS84(6378137.0, 6378137.0, 6356752.3142451793);
 const Ellipsoid Ellipsoid::UNIT_SPHERE(1.0, 1.0, 1.0);
 
@@ -57,6 +71,259 @@ Ellipsoid::cartesianToCartographic(const glm::dvec3& cartesian) const noexcept {
   return Cartographic(longitude, latitude, height);
 }
 
+void Ellipsoid::geodeticSurfaceNormal(
+    const gsl::span<const double>& x,
+    const gsl::span<const double>& y,
+    const gsl::span<const double>& z,
+    const gsl::span<double>& normalX,
+    const gsl::span<double>& normalY,
+    const gsl::span<double>& normalZ) const noexcept {
+  const size_t count = x.size();
+  CESIUM_ASSERT(y.size() == count && z.size() == count);
+  CESIUM_ASSERT(
+      normalX.size() == count && normalY.size() == count &&
+      normalZ.size() == count);
+
+  const double oneOverRadiiSquaredX = this->_oneOverRadiiSquared.x;
+  const double oneOverRadiiSquaredY = this->_oneOverRadiiSquared.y;
+  const double oneOverRadiiSquaredZ = this->_oneOverRadiiSquared.z;
+
+  for (size_t i = 0; i < count; ++i) {
+    const double scaledX = x[i] * oneOverRadiiSquaredX;
+    const double scaledY = y[i] * oneOverRadiiSquaredY;
+    const double scaledZ = z[i] * oneOverRadiiSquaredZ;
+    const double inverseLength = 1.0 / std::sqrt(
+                                           scaledX * scaledX +
+                                           scaledY * scaledY +
+                                           scaledZ * scaledZ);
+    normalX[i] = scaledX * inverseLength;
+    normalY[i] = scaledY * inverseLength;
+    normalZ[i] = scaledZ * inverseLength;
+  }
+}
+
+void Ellipsoid::cartographicToCartesian(
+    const gsl::span<const double>& longitudes,
+    const gsl::span<const double>& latitudes,
+    const gsl::span<const double>& heights,
+    const gsl::span<double>& x,
+    const gsl::span<double>& y,
+    const gsl::span<double>& z) const noexcept {
+  const size_t count = longitudes.size();
+  CESIUM_ASSERT(latitudes.size() == count && heights.size() == count);
+  CESIUM_ASSERT(x.size() == count && y.size() == count && z.size() == count);
+
+  const double radiiSquaredX = this->_radiiSquared.x;
+  const double radiiSquaredY = this->_radiiSquared.y;
+  const double radiiSquaredZ = this->_radiiSquared.z;
+
+  for (size_t i = 0; i < count; ++i) {
+    const double longitude = longitudes[i];
+    const double latitude = latitudes[i];
+    const double cosLatitude = std::cos(latitude);
+
+    // The geodetic surface normal at the cartographic position.
+    double normalX = cosLatitude * std::cos(longitude);
+    double normalY = cosLatitude * std::sin(longitude);
+    double normalZ = std::sin(latitude);
+    const double inverseLength = 1.0 / std::sqrt(
+                                           normalX * normalX +
+                                           normalY * normalY +
+                                           normalZ * normalZ);
+    normalX *= inverseLength;
+    normalY *= inverseLength;
+    normalZ *= inverseLength;
+
+    const double kX = radiiSquaredX * normalX;
+    const double kY = radiiSquaredY * normalY;
+    const double kZ = radiiSquaredZ * normalZ;
+    const double gamma =
+        std::sqrt(normalX * kX + normalY * kY + normalZ * kZ);
+
+    const double height = heights[i];
+    x[i] = kX / gamma + normalX * height;
+    y[i] = kY / gamma + normalY * height;
+    z[i] = kZ / gamma + normalZ * height;
+  }
+}
+
+void Ellipsoid::cartesianToCartographic(
+    const gsl::span<const double>& x,
+    const gsl::span<const double>& y,
+    const gsl::span<const double>& z,
+    const gsl::span<double>& longitudes,
+    const gsl::span<double>& latitudes,
+    const gsl::span<double>& heights) const noexcept {
+  const size_t count = x.size();
+  CESIUM_ASSERT(y.size() == count && z.size() == count);
+  CESIUM_ASSERT(
+      longitudes.size() == count && latitudes.size() == count &&
+      heights.size() == count);
+
+  const double oneOverRadiiX = this->_oneOverRadii.x;
+  const double oneOverRadiiY = this->_oneOverRadii.y;
+  const double oneOverRadiiZ = this->_oneOverRadii.z;
+
+  const double oneOverRadiiSquaredX = this->_oneOverRadiiSquared.x;
+  const double oneOverRadiiSquaredY = this->_oneOverRadiiSquared.y;
+  const double oneOverRadiiSquaredZ = this->_oneOverRadiiSquared.z;
+
+  constexpr size_t blockSize = cartesianToCartographicBlockSize;
+  std::array<double, blockSize> x2{};
+  std::array<double, blockSize> y2{};
+  std::array<double, blockSize> z2{};
+  std::array<double, blockSize> lambda{};
+  std::array<double, blockSize> correction{};
+  std::array<double, blockSize> xMultiplier{};
+  std::array<double, blockSize> yMultiplier{};
+  std::array<double, blockSize> zMultiplier{};
+  std::array<bool, blockSize> iterating{};
+
+  for (size_t blockStart = 0; blockStart < count; blockStart += blockSize) {
+    const size_t blockCount = std::min(blockSize, count - blockStart);
+    const double* pX = x.data() + blockStart;
+    const double* pY = y.data() + blockStart;
+    const double* pZ = z.data() + blockStart;
+
+    // Scale each position to the geodetic surface, exactly as
+    // scaleToGeodeticSurface does, but for all positions in the block at once.
+    // The result is a multiplier for each component of each position.
+    bool anyIterating = false;
+    for (size_t i = 0; i < blockCount; ++i) {
+      const double positionX = pX[i];
+      const double positionY = pY[i];
+      const double positionZ = pZ[i];
+
+      x2[i] = positionX * positionX * oneOverRadiiX * oneOverRadiiX;
+      y2[i] = positionY * positionY * oneOverRadiiY * oneOverRadiiY;
+      z2[i] = positionZ * positionZ * oneOverRadiiZ * oneOverRadiiZ;
+
+      const double squaredNorm = x2[i] + y2[i] + z2[i];
+      const double ratio = sqrt(1.0 / squaredNorm);
+
+      // If the position is near the center, the iteration will not converge,
+      // so use the radial intersection.
+      if (squaredNorm < this->_centerToleranceSquared) {
+        const double multiplier =
+            std::isfinite(ratio) ? ratio
+                                 : std::numeric_limits<double>::quiet_NaN();
+        xMultiplier[i] = multiplier;
+        yMultiplier[i] = multiplier;
+        zMultiplier[i] = multiplier;
+        lambda[i] = 0.0;
+        correction[i] = 0.0;
+        iterating[i] = false;
+        continue;
+      }
+
+      const double gradientX = positionX * ratio * oneOverRadiiSquaredX * 2.0;
+      const double gradientY = positionY * ratio * oneOverRadiiSquaredY * 2.0;
+      const double gradientZ = positionZ * ratio * oneOverRadiiSquaredZ * 2.0;
+
+      const double positionLength = std::sqrt(
+          positionX * positionX + positionY * positionY +
+          positionZ * positionZ);
+      const double gradientLength = std::sqrt(
+          gradientX * gradientX + gradientY * gradientY +
+          gradientZ * gradientZ);
+
+      lambda[i] = ((1.0 - ratio) * positionLength) / (0.5 * gradientLength);
+      correction[i] = 0.0;
+      iterating[i] = true;
+      anyIterating = true;
+    }
+
+    // Newton's method. Every position in the block is updated together so
+    // that the loop body can be vectorized, but a position that has already
+    // converged keeps its previous values.
+    while (anyIterating) {
+      anyIterating = false;
+      for (size_t i = 0; i < blockCount; ++i) {
+        const double nextLambda = lambda[i] - correction[i];
+
+        const double nextXMultiplier =
+            1.0 / (1.0 + nextLambda * oneOverRadiiSquaredX);
+        const double nextYMultiplier =
+            1.0 / (1.0 + nextLambda * oneOverRadiiSquaredY);
+        const double nextZMultiplier =
+            1.0 / (1.0 + nextLambda * oneOverRadiiSquaredZ);
+
+        const double xMultiplier2 = nextXMultiplier * nextXMultiplier;
+        const double yMultiplier2 = nextYMultiplier * nextYMultiplier;
+        const double zMultiplier2 = nextZMultiplier * nextZMultiplier;
+
+        const double xMultiplier3 = xMultiplier2 * nextXMultiplier;
+        const double yMultiplier3 = yMultiplier2 * nextYMultiplier;
+        const double zMultiplier3 = zMultiplier2 * nextZMultiplier;
+
+        const double func = x2[i] * xMultiplier2 + y2[i] * yMultiplier2 +
+                            z2[i] * zMultiplier2 - 1.0;
+
+        const double denominator =
+            x2[i] * xMultiplier3 * oneOverRadiiSquaredX +
+            y2[i] * yMultiplier3 * oneOverRadiiSquaredY +
+            z2[i] * zMultiplier3 * oneOverRadiiSquaredZ;
+
+        const double derivative = -2.0 * denominator;
+
+        const bool active = iterating[i];
+        lambda[i] = active ? nextLambda : lambda[i];
+        correction[i] = active ? func / derivative : correction[i];
+        xMultiplier[i] = active ? nextXMultiplier : xMultiplier[i];
+        yMultiplier[i] = active ? nextYMultiplier : yMultiplier[i];
+        zMultiplier[i] = active ? nextZMultiplier : zMultiplier[i];
+
+        iterating[i] = active && glm::abs(func) > Math::Epsilon12;
+        anyIterating = anyIterating || iterating[i];
+      }
+    }
+
+    for (size_t i = 0; i < blockCount; ++i) {
+      const size_t index = blockStart + i;
+
+      // A position at the center of the ellipsoid has no cartographic
+      // representation.
+      if (std::isnan(xMultiplier[i])) {
+        longitudes[index] = std::numeric_limits<double>::quiet_NaN();
+        latitudes[index] = std::numeric_limits<double>::quiet_NaN();
+        heights[index] = std::numeric_limits<double>::quiet_NaN();
+        continue;
+      }
+
+      const double positionX = pX[i];
+      const double positionY = pY[i];
+      const double positionZ = pZ[i];
+
+      // The position on the surface.
+      const double surfaceX = positionX * xMultiplier[i];
+      const double surfaceY = positionY * yMultiplier[i];
+      const double surfaceZ = positionZ * zMultiplier[i];
+
+      // The geodetic surface normal at that position.
+      const double scaledX = surfaceX * oneOverRadiiSquaredX;
+      const double scaledY = surfaceY * oneOverRadiiSquaredY;
+      const double scaledZ = surfaceZ * oneOverRadiiSquaredZ;
+      const double inverseLength = 1.0 / std::sqrt(
+                                             scaledX * scaledX +
+                                             scaledY * scaledY +
+                                             scaledZ * scaledZ);
+      const double normalX = scaledX * inverseLength;
+      const double normalY = scaledY * inverseLength;
+      const double normalZ = scaledZ * inverseLength;
+
+      const double hX = positionX - surfaceX;
+      const double hY = positionY - surfaceY;
+      const double hZ = positionZ - surfaceZ;
+
+      longitudes[index] = std::atan2(normalY, normalX);
+      latitudes[index] = std::asin(normalZ);
+      heights[index] =
+          Math::sign(hX * positionX + hY * positionY + hZ * positionZ) *
+          std::sqrt(hX * hX + hY * hY + hZ * hZ);
+    }
+  }
+}
+
 std::optional<glm::dvec3>
 Ellipsoid::scaleToGeodeticSurface(const glm::dvec3& cartesian) const noexcept {
   const double positionX = cartesian.x;
@@ -72,3 +72,75 @@ TEST_CASE("BoundingRegionBuilder::expandToIncludePosition") {
   rectangle2 = wrappedBuilder.toGlobeRectangle();
   CHECK(GlobeRectangle::equals(wrapped, rectangle2));
 }
+
+TEST_CASE("BoundingRegionBuilder::expandToIncludeRegion") {
+  BoundingRegionBuilder west;
+  west.expandToIncludePosition(Cartographic(-1.0, -0.5, 10.0));
+  west.expandToIncludePosition(Cartographic(-0.5, 0.0, 20.0));
+
+  BoundingRegionBuilder east;
+  east.expandToIncludePosition(Cartographic(0.5, 0.0, 5.0));
+  east.expandToIncludePosition(Cartographic(1.0, 0.5, 15.0));
+
+  SECTION("includes an empty builder's region without modification") {
+    BoundingRegionBuilder builder = west;
+    CHECK(!builder.expandToIncludeRegion(BoundingRegionBuilder()));
+    CHECK(GlobeRectangle::equals(
+        builder.toGlobeRectangle(),
+        west.toGlobeRectangle()));
+  }
+
+  SECTION("copies the region into an empty builder") {
+    BoundingRegionBuilder builder;
+    CHECK(builder.expandToIncludeRegion(west));
+    CHECK(GlobeRectangle::equals(
+        builder.toGlobeRectangle(),
+        west.toGlobeRectangle()));
+  }
+
+  SECTION("matches a builder given all of the positions") {
+    BoundingRegionBuilder builder = west;
+    CHECK(builder.expandToIncludeRegion(east));
+
+    BoundingRegionBuilder expected = west;
+    expected.expandToIncludePosition(Cartographic(0.5, 0.0, 5.0));
+    expected.expandToIncludePosition(Cartographic(1.0, 0.5, 15.0));
+
+    CHECK(GlobeRectangle::equals(
+        builder.toGlobeRectangle(),
+        expected.toGlobeRectangle()));
+
+    const BoundingRegion region = builder.toRegion(Ellipsoid::WGS84);
+    CHECK(region.getMinimumHeight() == 5.0);
+    CHECK(region.getMaximumHeight() == 20.0);
+
+    CHECK(!builder.expandToIncludeRegion(east));
+  }
+
+  SECTION("takes the shorter way around the anti-meridian") {
+    BoundingRegionBuilder nearEast;
+    nearEast.expandToIncludePosition(Cartographic(3.0, 0.0, 0.0));
+    BoundingRegionBuilder nearWest;
+    nearWest.expandToIncludePosition(Cartographic(-3.0, 0.0, 0.0));
+
+    CHECK(nearEast.expandToIncludeRegion(nearWest));
+    const GlobeRectangle rectangle = nearEast.toGlobeRectangle();
+    CHECK(rectangle.getWest() == 3.0);
+    CHECK(rectangle.getEast() == -3.0);
+    CHECK(rectangle.contains(Cartographic(Math::OnePi, 0.0, 0.0)));
+    CHECK(!rectangle.contains(Cartographic(0.0, 0.0, 0.0)));
+  }
+
+  SECTION("includes the latitudes of positions near the poles") {
+    BoundingRegionBuilder nearPole;
+    nearPole.expandToIncludePosition(
+        Cartographic(2.0, Math::PiOverTwo - Math::Epsilon12, 0.0));
+
+    BoundingRegionBuilder builder = west;
+    CHECK(builder.expandToIncludeRegion(nearPole));
+    const GlobeRectangle rectangle = builder.toGlobeRectangle();
+    CHECK(rectangle.getNorth() == Math::PiOverTwo - Math::Epsilon12);
+    CHECK(rectangle.getWest() == -1.0);
+    CHECK(rectangle.getEast() == -0.5);
+  }
+}
@@ -0,0 +1,222 @@
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumUtility/Math.h>
+
+#include <catch2/catch.hpp>
+#include <glm/vec3.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+
+namespace {
+
+struct CartesianPositions {
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+};
+
+// Creates random positions from below the surface of the WGS84 ellipsoid to
+// well above it. Uses a constant seed so that failures are repeatable.
+CartesianPositions createRandomPositions(size_t count) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> longitudeDistribution(
+      -Math::OnePi,
+      Math::OnePi);
+  std::uniform_real_distribution<double> latitudeDistribution(
+      -Math::PiOverTwo,
+      Math::PiOverTwo);
+  std::uniform_real_distribution<double> heightDistribution(
+      -10000.0,
+      1000000.0);
+
+  CartesianPositions result;
+  for (size_t i = 0; i < count; ++i) {
+    const glm::dvec3 position = Ellipsoid::WGS84.cartographicToCartesian(
+        Cartographic(
+            longitudeDistribution(gen),
+            latitudeDistribution(gen),
+            heightDistribution(gen)));
+    result.x.emplace_back(position.x);
+    result.y.emplace_back(position.y);
+    result.z.emplace_back(position.z);
+  }
+
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("Ellipsoid batched conversions match the single position versions") {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+
+  // Not a multiple of the block size, so that a partial block is converted.
+  const size_t count = 1001;
+  CartesianPositions positions = createRandomPositions(count);
+
+  SECTION("cartesianToCartographic") {
+    std::vector<double> longitudes(count);
+    std::vector<double> latitudes(count);
+    std::vector<double> heights(count);
+    ellipsoid.cartesianToCartographic(
+        positions.x,
+        positions.y,
+        positions.z,
+        longitudes,
+        latitudes,
+        heights);
+
+    for (size_t i = 0; i < count; ++i) {
+      const std::optional<Cartographic> expected =
+          ellipsoid.cartesianToCartographic(
+              glm::dvec3(positions.x[i], positions.y[i], positions.z[i]));
+      REQUIRE(expected);
+      CHECK(Math::equalsEpsilon(
+          longitudes[i],
+          expected->longitude,
+          Math::Epsilon14));
+      CHECK(Math::equalsEpsilon(
+          latitudes[i],
+          expected->latitude,
+          Math::Epsilon14));
+      CHECK(Math::equalsEpsilon(
+          heights[i],
+          expected->height,
+          Math::Epsilon14,
+          Math::Epsilon6));
+    }
+  }
+
+  SECTION("cartographicToCartesian") {
+    std::vector<double> longitudes(count);
+    std::vector<double> latitudes(count);
+    std::vector<double> heights(count);
+    ellipsoid.cartesianToCartographic(
+        positions.x,
+        positions.y,
+        positions.z,
+        longitudes,
+        latitudes,
+        heights);
+
+    std::vector<double> x(count);
+    std::vector<double> y(count);
+    std::vector<double> z(count);
+    ellipsoid.cartographicToCartesian(longitudes, latitudes, heights, x, y, z);
+
+    for (size_t i = 0; i < count; ++i) {
+      const glm::dvec3 expected = ellipsoid.cartographicToCartesian(
+          Cartographic(longitudes[i], latitudes[i], heights[i]));
+      CHECK(Math::equalsEpsilon(x[i], expected.x, 0.0, Math::Epsilon6));
+      CHECK(Math::equalsEpsilon(y[i], expected.y, 0.0, Math::Epsilon6));
+      CHECK(Math::equalsEpsilon(z[i], expected.z, 0.0, Math::Epsilon6));
+
+      // And the round trip gets back to the original position.
+      CHECK(Math::equalsEpsilon(x[i], positions.x[i], 0.0, Math::Epsilon4));
+      CHECK(Math::equalsEpsilon(y[i], positions.y[i], 0.0, Math::Epsilon4));
+      CHECK(Math::equalsEpsilon(z[i], positions.z[i], 0.0, Math::Epsilon4));
+    }
+  }
+
+  SECTION("geodeticSurfaceNormal") {
+    std::vector<double> normalX(count);
+    std::vector<double> normalY(count);
+    std::vector<double> normalZ(count);
+    ellipsoid.geodeticSurfaceNormal(
+        positions.x,
+        positions.y,
+        positions.z,
+        normalX,
+        normalY,
+        normalZ);
+
+    for (size_t i = 0; i < count; ++i) {
+      const glm::dvec3 expected = ellipsoid.geodeticSurfaceNormal(
+          glm::dvec3(positions.x[i], positions.y[i], positions.z[i]));
+      CHECK(Math::equalsEpsilon(normalX[i], expected.x, Math::Epsilon14));
+      CHECK(Math::equalsEpsilon(normalY[i], expected.y, Math::Epsilon14));
+      CHECK(Math::equalsEpsilon(normalZ[i], expected.z, Math::Epsilon14));
+    }
+  }
+
+  SECTION("cartesianToCartographic returns NaN for the center") {
+    std::vector<double> x{0.0, ellipsoid.getRadii().x, 0.0};
+    std::vector<double> y{0.0, 0.0, 0.0};
+    std::vector<double> z{0.0, 0.0, 0.0};
+    std::vector<double> longitudes(3);
+    std::vector<double> latitudes(3);
+    std::vector<double> heights(3);
+    ellipsoid.cartesianToCartographic(x, y, z, longitudes, latitudes, heights);
+
+    for (size_t i : {size_t(0), size_t(2)}) {
+      CHECK(std::isnan(longitudes[i]));
+      CHECK(std::isnan(latitudes[i]));
+      CHECK(std::isnan(heights[i]));
+    }
+
+    CHECK(Math::equalsEpsilon(longitudes[1], 0.0, 0.0, Math::Epsilon14));
+    CHECK(Math::equalsEpsilon(latitudes[1], 0.0, 0.0, Math::Epsilon14));
+    CHECK(Math::equalsEpsilon(heights[1], 0.0, 0.0, Math::Epsilon6));
+  }
+}
+
+TEST_CASE("Benchmark Ellipsoid conversions", "[.][benchmark]") {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+  const size_t count = 100000;
+  CartesianPositions positions = createRandomPositions(count);
+
+  std::vector<double> longitudes(count);
+  std::vector<double> latitudes(count);
+  std::vector<double> heights(count);
+
+  const std::string suffix = " for " + std::to_string(count) + " positions";
+
+  BENCHMARK("Single cartesianToCartographic" + suffix) {
+    double sum = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+      std::optional<Cartographic> cartographic =
+          ellipsoid.cartesianToCartographic(
+              glm::dvec3(positions.x[i], positions.y[i], positions.z[i]));
+      sum += cartographic ? cartographic->height : 0.0;
+    }
+    return sum;
+  };
+
+  BENCHMARK("Batched cartesianToCartographic" + suffix) {
+    ellipsoid.cartesianToCartographic(
+        positions.x,
+        positions.y,
+        positions.z,
+        longitudes,
+        latitudes,
+        heights);
+    return heights[0];
+  };
+
+  std::vector<double> x(count);
+  std::vector<double> y(count);
+  std::vector<double> z(count);
+
+  BENCHMARK("Single cartographicToCartesian" + suffix) {
+    double sum = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+      sum += ellipsoid
+                 .cartographicToCartesian(
+                     Cartographic(longitudes[i], latitudes[i], heights[i]))
+                 .x;
+    }
+    return sum;
+  };
+
+  BENCHMARK("Batched cartographicToCartesian" + suffix) {
+    ellipsoid.cartographicToCartesian(longitudes, latitudes, heights, x, y, z);
+    return x[0];
+  };
+}
@@ -9,8 +9,11 @@
 
 #include <gsl/span>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <optional>
 #include <string_view>
 #include <type_traits>
 
@@ -373,6 +376,170 @@ public:
     }
   }
 
+  /**
+   * @brief Get the raw values of a range of elements of the
+   * {@link PropertyTable}, without offset or scale applied.
+   *
+   * This gives the same results as calling {@link getRaw} for each element in
+   * the range, but is faster for large ranges. Numeric values are copied
+   * directly from the buffer, and the offsets of strings and variable-length
+   * arrays are read in a single pass.
+   *
+   * @param start The index of the first element
+   * @param result The span to write the values to. Its size is the number of
+   * elements to get.
+   */
+  void
+  getRawValues(int64_t start, gsl::span<ElementType> result) const noexcept {
+    CESIUM_ASSERT(
+        this->_status == PropertyTablePropertyViewStatus::Valid &&
+        "Check the status() first to make sure view is valid");
+    CESIUM_ASSERT(start >= 0 && "start must be non-negative");
+    CESIUM_ASSERT(
+        start + static_cast<int64_t>(result.size()) <= size() &&
+        "range must not extend past the end of the view");
+
+    const size_t first = static_cast<size_t>(start);
+    const size_t count = result.size();
+    if (count == 0) {
+      return;
+    }
+
+    if constexpr (IsMetadataNumeric<ElementType>::value) {
+      // The values are tightly packed, so they can be copied all at once.
+      std::memcpy(
+          result.data(),
+          _values.data() + first * sizeof(ElementType),
+          count * sizeof(ElementType));
+    }
+
+    if constexpr (IsMetadataBoolean<ElementType>::value) {
+      for (size_t i = 0; i < count; ++i) {
+        result[i] = getBooleanValue(start + static_cast<int64_t>(i));
+      }
+    }
+
+    if constexpr (IsMetadataString<ElementType>::value) {
+      forEachRangeInOffsetsBuffer(
+          first,
+          count,
+          _stringOffsets,
+          _stringOffsetType,
+          [this, result](size_t i, size_t currentOffset, size_t nextOffset) {
+            result[i] = getStringValue(currentOffset, nextOffset);
+          });
+    }
+
+    if constexpr (IsMetadataArray<ElementType>::value) {
+      if (this->arrayCount() > 0) {
+        // Fixed-length arrays don't need any offsets.
+        for (size_t i = 0; i < count; ++i) {
+          result[i] = getRaw(start + static_cast<int64_t>(i));
+        }
+        return;
+      }
+
+      forEachRangeInOffsetsBuffer(
+          first,
+          count,
+          _arrayOffsets,
+          _arrayOffsetType,
+          [this, result](size_t i, size_t currentOffset, size_t nextOffset) {
+            if constexpr (IsMetadataNumericArray<ElementType>::value) {
+              result[i] = getNumericArrayValues<
+                  typename MetadataArrayType<ElementType>::type>(
+                  currentOffset,
+                  nextOffset);
+            } else if constexpr (IsMetadataBooleanArray<ElementType>::value) {
+              result[i] = getBooleanArrayValues(currentOffset, nextOffset);
+            } else {
+              result[i] = getStringArrayValues(currentOffset, nextOffset);
+            }
+          });
+    }
+  }
+
+  /**
+   * @brief Get the values of a range of elements of the {@link PropertyTable},
+   * with any value transforms applied.
+   *
+   * This gives the same results as calling {@link get} for each element in the
+   * range, but is faster for large ranges. The raw values are read with
+   * {@link getRawValues}, and then the scale and offset are applied to all of
+   * them in flat loops that the compiler can vectorize.
+   *
+   * If an element is equal to the "no data" value, the property's default
+   * value is written in its place. If the property does not have a default
+   * value, the element has no value: `false` is written to the corresponding
+   * element of `hasValue`, and the element of `values` should be ignored.
+   *
+   * Array properties are not supported; use {@link get} for those.
+   *
+   * @param start The index of the first element
+   * @param values The span to write the values to. Its size is the number of
+   * elements to get.
+   * @param hasValue An optional span to write whether each element has a
+   * value. If it is not empty, it must be the same size as `values`.
+   * @return Whether every element in the range has a value.
+   */
+  bool getValues(
+      int64_t start,
+      gsl::span<ElementType> values,
+      gsl::span<bool> hasValue = {}) const noexcept {
+    static_assert(
+        !IsMetadataArray<ElementType>::value,
+        "getValues does not support array properties");
+    CESIUM_ASSERT(start >= 0 && "start must be non-negative");
+    CESIUM_ASSERT(
+        start + static_cast<int64_t>(values.size()) <= size() &&
+        "range must not extend past the end of the view");
+    CESIUM_ASSERT(
+        (hasValue.empty() || hasValue.size() == values.size()) &&
+        "hasValue must be empty or the same size as values");
+
+    std::fill(hasValue.begin(), hasValue.end(), true);
+
+    if (this->_status ==
+        PropertyTablePropertyViewStatus::EmptyPropertyWithDefault) {
+      std::fill(values.begin(), values.end(), *this->defaultValue());
+      return true;
+    }
+
+    getRawValues(start, values);
+
+    const ElementType* pRaw = values.data();
+    if constexpr (IsMetadataNumeric<ElementType>::value) {
+      // Transforming the values overwrites them, but the raw values are still
+      // in the buffer to compare with the "no data" value.
+      pRaw = reinterpret_cast<const ElementType*>(_values.data()) + start;
+      transformValues<ElementType>(values, this->offset(), this->scale());
+    }
+
+    const std::optional<ElementType> noData = this->noData();
+    if (!noData) {
+      return true;
+    }
+
+    const std::optional<ElementType> defaultValue = this->defaultValue();
+    bool allHaveValues = true;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (pRaw[i] != *noData) {
+        continue;
+      }
+
+      if (defaultValue) {
+        values[i] = *defaultValue;
+      } else {
+        allHaveValues = false;
+        if (!hasValue.empty()) {
+          hasValue[i] = false;
+        }
+      }
+    }
+
+    return allHaveValues;
+  }
+
   /**
    * @brief Get the number of elements in this
    * PropertyTablePropertyView. If the view is valid, this returns
@@ -401,6 +568,11 @@ private:
         index + 1,
         _stringOffsets,
         _stringOffsetType);
+    return getStringValue(currentOffset, nextOffset);
+  }
+
+  std::string_view
+  getStringValue(size_t currentOffset, size_t nextOffset) const noexcept {
     return std::string_view(
         reinterpret_cast<const char*>(_values.data() + currentOffset),
         nextOffset - currentOffset);
@@ -418,17 +590,23 @@ private:
       return PropertyArrayView<T>{values};
     }
 
-    // Handle variable-length arrays. The offsets are interpreted as array
-    // indices, not byte offsets, so they must be multiplied by sizeof(T)
+    // Handle variable-length arrays
     const size_t currentOffset =
-        getOffsetFromOffsetsBuffer(index, _arrayOffsets, _arrayOffsetType) *
-        sizeof(T);
+        getOffsetFromOffsetsBuffer(index, _arrayOffsets, _arrayOffsetType);
     const size_t nextOffset =
-        getOffsetFromOffsetsBuffer(index + 1, _arrayOffsets, _arrayOffsetType) *
-        sizeof(T);
+        getOffsetFromOffsetsBuffer(index + 1, _arrayOffsets, _arrayOffsetType);
+    return getNumericArrayValues<T>(currentOffset, nextOffset);
+  }
+
+  template <typename T>
+  PropertyArrayView<T> getNumericArrayValues(
+      size_t currentOffset,
+      size_t nextOffset) const noexcept {
+    // The offsets are interpreted as array indices, not byte offsets, so they
+    // must be multiplied by sizeof(T)
     const gsl::span<const std::byte> values(
-        _values.data() + currentOffset,
-        nextOffset - currentOffset);
+        _values.data() + currentOffset * sizeof(T),
+        (nextOffset - currentOffset) * sizeof(T));
     return PropertyArrayView<T>{values};
   }
 
@@ -454,6 +632,12 @@ private:
         getOffsetFromOffsetsBuffer(index, _arrayOffsets, _arrayOffsetType);
     const size_t nextArrayOffset =
         getOffsetFromOffsetsBuffer(index + 1, _arrayOffsets, _arrayOffsetType);
+    return getStringArrayValues(currentArrayOffset, nextArrayOffset);
+  }
+
+  PropertyArrayView<std::string_view> getStringArrayValues(
+      size_t currentArrayOffset,
+      size_t nextArrayOffset) const noexcept {
     const size_t arraySize = nextArrayOffset - currentArrayOffset;
     const gsl::span<const std::byte> stringOffsetValues(
         _stringOffsets.data() + currentArrayOffset,
@@ -482,6 +666,12 @@ private:
         getOffsetFromOffsetsBuffer(index, _arrayOffsets, _arrayOffsetType);
     const size_t nextOffset =
         getOffsetFromOffsetsBuffer(index + 1, _arrayOffsets, _arrayOffsetType);
+    return getBooleanArrayValues(currentOffset, nextOffset);
+  }
+
+  PropertyArrayView<bool> getBooleanArrayValues(
+      size_t currentOffset,
+      size_t nextOffset) const noexcept {
     const size_t totalBits = nextOffset - currentOffset;
     const gsl::span<const std::byte> buffer(
         _values.data() + currentOffset / 8,
@@ -736,6 +926,155 @@ public:
     }
   }
 
+  /**
+   * @brief Get the raw values of a range of elements of the
+   * {@link PropertyTable}, without offset, scale, or normalization applied.
+   *
+   * This gives the same results as calling {@link getRaw} for each element in
+   * the range, but is faster for large ranges. Numeric values are copied
+   * directly from the buffer, and the offsets of variable-length arrays are
+   * read in a single pass.
+   *
+   * @param start The index of the first element
+   * @param result The span to write the values to. Its size is the number of
+   * elements to get.
+   */
+  void
+  getRawValues(int64_t start, gsl::span<ElementType> result) const noexcept {
+    CESIUM_ASSERT(
+        this->_status == PropertyTablePropertyViewStatus::Valid &&
+        "Check the status() first to make sure view is valid");
+    CESIUM_ASSERT(start >= 0 && "start must be non-negative");
+    CESIUM_ASSERT(
+        start + static_cast<int64_t>(result.size()) <= size() &&
+        "range must not extend past the end of the view");
+
+    const size_t first = static_cast<size_t>(start);
+    const size_t count = result.size();
+    if (count == 0) {
+      return;
+    }
+
+    if constexpr (IsMetadataNumeric<ElementType>::value) {
+      // The values are tightly packed, so they can be copied all at once.
+      std::memcpy(
+          result.data(),
+          _values.data() + first * sizeof(ElementType),
+          count * sizeof(ElementType));
+    }
+
+    if constexpr (IsMetadataNumericArray<ElementType>::value) {
+      if (this->arrayCount() > 0) {
+        // Fixed-length arrays don't need any offsets.
+        for (size_t i = 0; i < count; ++i) {
+          result[i] = getRaw(start + static_cast<int64_t>(i));
+        }
+        return;
+      }
+
+      forEachRangeInOffsetsBuffer(
+          first,
+          count,
+          _arrayOffsets,
+          _arrayOffsetType,
+          [this, result](size_t i, size_t currentOffset, size_t nextOffset) {
+            result[i] =
+                getArrayValues<typename MetadataArrayType<ElementType>::type>(
+                    currentOffset,
+                    nextOffset);
+          });
+    }
+  }
+
+  /**
+   * @brief Get the normalized values of a range of elements of the
+   * {@link PropertyTable}, with any value transforms applied.
+   *
+   * This gives the same results as calling {@link get} for each element in the
+   * range, but is faster for large ranges. The raw values are normalized, and
+   * then the scale and offset are applied to all of them, in flat loops that
+   * the compiler can vectorize.
+   *
+   * If an element is equal to the "no data" value, the property's default
+   * value is written in its place. If the property does not have a default
+   * value, the element has no value: `false` is written to the corresponding
+   * element of `hasValue`, and the element of `values` should be ignored.
+   *
+   * Array properties are not supported; use {@link get} for those.
+   *
+   * @param start The index of the first element
+   * @param values The span to write the values to. Its size is the number of
+   * elements to get.
+   * @param hasValue An optional span to write whether each element has a
+   * value. If it is not empty, it must be the same size as `values`.
+   * @return Whether every element in the range has a value.
+   */
+  bool getValues(
+      int64_t start,
+      gsl::span<NormalizedType> values,
+      gsl::span<bool> hasValue = {}) const noexcept {
+    static_assert(
+        IsMetadataNumeric<ElementType>::value,
+        "getValues does not support array properties");
+    CESIUM_ASSERT(start >= 0 && "start must be non-negative");
+    CESIUM_ASSERT(
+        start + static_cast<int64_t>(values.size()) <= size() &&
+        "range must not extend past the end of the view");
+    CESIUM_ASSERT(
+        (hasValue.empty() || hasValue.size() == values.size()) &&
+        "hasValue must be empty or the same size as values");
+
+    std::fill(hasValue.begin(), hasValue.end(), true);
+
+    if (this->_status ==
+        PropertyTablePropertyViewStatus::EmptyPropertyWithDefault) {
+      std::fill(values.begin(), values.end(), *this->defaultValue());
+      return true;
+    }
+
+    CESIUM_ASSERT(
+        this->_status == PropertyTablePropertyViewStatus::Valid &&
+        "Check the status() first to make sure view is valid");
+
+    const ElementType* pRaw =
+        reinterpret_cast<const ElementType*>(_values.data()) + start;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if constexpr (IsMetadataScalar<ElementType>::value) {
+        values[i] = normalize<ElementType>(pRaw[i]);
+      } else {
+        constexpr glm::length_t N = ElementType::length();
+        using T = typename ElementType::value_type;
+        values[i] = normalize<N, T>(pRaw[i]);
+      }
+    }
+
+    transformValues<NormalizedType>(values, this->offset(), this->scale());
+
+    const std::optional<ElementType> noData = this->noData();
+    if (!noData) {
+      return true;
+    }
+
+    const std::optional<NormalizedType> defaultValue = this->defaultValue();
+    bool allHaveValues = true;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (pRaw[i] != *noData) {
+        continue;
+      }
+
+      if (defaultValue) {
+        values[i] = *defaultValue;
+      } else {
+        allHaveValues = false;
+        if (!hasValue.empty()) {
+          hasValue[i] = false;
+        }
+      }
+    }
+
+    return allHaveValues;
+  }
+
   /**
    * @brief Get the number of elements in this
    * PropertyTablePropertyView. If the view is valid, this returns
@@ -764,17 +1103,22 @@ private:
       return PropertyArrayView<T>{values};
     }
 
-    // Handle variable-length arrays. The offsets are interpreted as array
-    // indices, not byte offsets, so they must be multiplied by sizeof(T)
+    // Handle variable-length arrays
     const size_t currentOffset =
-        getOffsetFromOffsetsBuffer(index, _arrayOffsets, _arrayOffsetType) *
-        sizeof(T);
+        getOffsetFromOffsetsBuffer(index, _arrayOffsets, _arrayOffsetType);
     const size_t nextOffset =
-        getOffsetFromOffsetsBuffer(index + 1, _arrayOffsets, _arrayOffsetType) *
-        sizeof(T);
+        getOffsetFromOffsetsBuffer(index + 1, _arrayOffsets, _arrayOffsetType);
+    return getArrayValues<T>(currentOffset, nextOffset);
+  }
+
+  template <typename T>
+  PropertyArrayView<T>
+  getArrayValues(size_t currentOffset, size_t nextOffset) const noexcept {
+    // The offsets are interpreted as array indices, not byte offsets, so they
+    // must be multiplied by sizeof(T)
     const gsl::span<const std::byte> values(
-        _values.data() + currentOffset,
-        nextOffset - currentOffset);
+        _values.data() + currentOffset * sizeof(T),
+        (nextOffset - currentOffset) * sizeof(T));
     return PropertyArrayView<T>{values};
   }
 
@@ -4,6 +4,7 @@
 #include "CesiumGltf/PropertyTypeTraits.h"
 
 #include <glm/common.hpp>
+#include <gsl/span>
 
 #include <algorithm>
 #include <cstdint>
@@ -78,6 +79,32 @@ T transformValue(
   return result;
 }
 
+// Applies a scale and then an offset to every value in place. Each case is a
+// separate flat loop so that the compiler can vectorize it.
+template <typename T>
+void transformValues(
+    gsl::span<T> values,
+    const std::optional<T>& offset,
+    const std::optional<T>& scale) {
+  if (scale && offset) {
+    const T s = *scale;
+    const T o = *offset;
+    for (T& value : values) {
+      value = applyScale<T>(value, s) + o;
+    }
+  } else if (scale) {
+    const T s = *scale;
+    for (T& value : values) {
+      value = applyScale<T>(value, s);
+    }
+  } else if (offset) {
+    const T o = *offset;
+    for (T& value : values) {
+      value += o;
+    }
+  }
+}
+
 template <typename T>
 PropertyArrayCopy<T> transformArray(
     const PropertyArrayView<T>& value,
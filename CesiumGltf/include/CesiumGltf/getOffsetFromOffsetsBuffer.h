@@ -8,6 +8,7 @@
 #include <gsl/span>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace CesiumGltf {
 static size_t getOffsetFromOffsetsBuffer(
@@ -44,4 +45,74 @@ static size_t getOffsetFromOffsetsBuffer(
     return 0;
   }
 }
+
+template <typename TOffset, typename Callback>
+static void forEachRangeInTypedOffsetsBuffer(
+    size_t start,
+    size_t count,
+    const gsl::span<const std::byte>& offsetBuffer,
+    Callback& callback) noexcept {
+  CESIUM_ASSERT(start + count < offsetBuffer.size() / sizeof(TOffset));
+  const TOffset* pOffsets =
+      reinterpret_cast<const TOffset*>(offsetBuffer.data()) + start;
+  size_t currentOffset = static_cast<size_t>(pOffsets[0]);
+  for (size_t i = 0; i < count; ++i) {
+    const size_t nextOffset = static_cast<size_t>(pOffsets[i + 1]);
+    callback(i, currentOffset, nextOffset);
+    currentOffset = nextOffset;
+  }
+}
+
+/**
+ * @brief Calls `callback(i, currentOffset, nextOffset)` for each of `count`
+ * consecutive elements of an offsets buffer, starting at `start`. The offset
+ * type is only checked once, and each offset is only read once, so this is
+ * faster than calling {@link getOffsetFromOffsetsBuffer} twice for every
+ * element.
+ */
+template <typename Callback>
+static void forEachRangeInOffsetsBuffer(
+    size_t start,
+    size_t count,
+    const gsl::span<const std::byte>& offsetBuffer,
+    PropertyComponentType offsetType,
+    Callback&& callback) noexcept {
+  if (count == 0) {
+    return;
+  }
+
+  switch (offsetType) {
+  case PropertyComponentType::Uint8:
+    forEachRangeInTypedOffsetsBuffer<uint8_t>(
+        start,
+        count,
+        offsetBuffer,
+        callback);
+    break;
+  case PropertyComponentType::Uint16:
+    forEachRangeInTypedOffsetsBuffer<uint16_t>(
+        start,
+        count,
+        offsetBuffer,
+        callback);
+    break;
+  case PropertyComponentType::Uint32:
+    forEachRangeInTypedOffsetsBuffer<uint32_t>(
+        start,
+        count,
+        offsetBuffer,
+        callback);
+    break;
+  case PropertyComponentType::Uint64:
+    forEachRangeInTypedOffsetsBuffer<uint64_t>(
+        start,
+        count,
+        offsetBuffer,
+        callback);
+    break;
+  default:
+    CESIUM_ASSERT(false && "Offset type is invalid");
+    break;
+  }
+}
 } // namespace CesiumGltf
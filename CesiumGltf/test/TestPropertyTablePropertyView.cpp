@@ -7,6 +7,10 @@
 #include <climits>
 #include <cstddef>
 #include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
 using namespace CesiumGltf;
@@ -23,6 +27,57 @@ checkArrayEqual(PropertyArrayView<T> arrayView, std::vector<T> expected) {
   }
 }
 
+template <typename T, bool Normalized, typename D>
+static void checkValuesInBulk(
+    const PropertyTablePropertyView<T, Normalized>& property,
+    const std::vector<T>& values,
+    const std::vector<std::optional<D>>& expected) {
+  std::vector<T> rawValues(values.size());
+  property.getRawValues(0, rawValues);
+  REQUIRE(rawValues == values);
+
+  std::vector<D> transformedValues(expected.size());
+  std::unique_ptr<bool[]> hasValue = std::make_unique<bool[]>(expected.size());
+  const bool allHaveValues = property.getValues(
+      0,
+      transformedValues,
+      gsl::span<bool>(hasValue.get(), expected.size()));
+
+  bool expectedAllHaveValues = true;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    REQUIRE(hasValue[i] == expected[i].has_value());
+    if (!expected[i]) {
+      expectedAllHaveValues = false;
+      continue;
+    }
+
+    if constexpr (IsMetadataFloating<D>::value) {
+      REQUIRE(transformedValues[i] == Approx(*expected[i]));
+    } else {
+      REQUIRE(transformedValues[i] == *expected[i]);
+    }
+  }
+
+  REQUIRE(allHaveValues == expectedAllHaveValues);
+}
+
+template <typename T, bool Normalized>
+static void checkRawArraysInBulk(
+    const PropertyTablePropertyView<PropertyArrayView<T>, Normalized>&
+        property) {
+  std::vector<PropertyArrayView<T>> values(
+      static_cast<size_t>(property.size()));
+  property.getRawValues(0, values);
+  for (int64_t i = 0; i < property.size(); ++i) {
+    const PropertyArrayView<T>& bulkValue = values[static_cast<size_t>(i)];
+    PropertyArrayView<T> value = property.getRaw(i);
+    REQUIRE(bulkValue.size() == value.size());
+    for (int64_t j = 0; j < value.size(); ++j) {
+      REQUIRE(bulkValue[j] == value[j]);
+    }
+  }
+}
+
 template <typename T> static void checkNumeric(const std::vector<T>& expected) {
   std::vector<std::byte> data;
   data.resize(expected.size() * sizeof(T));
@@ -51,6 +106,14 @@ template <typename T> static void checkNumeric(const std::vector<T>& expected) {
     REQUIRE(property.getRaw(i) == expected[static_cast<size_t>(i)]);
     REQUIRE(property.get(i) == property.getRaw(i));
   }
+
+  std::vector<T> rawValues(expected.size());
+  property.getRawValues(0, rawValues);
+  REQUIRE(rawValues == expected);
+
+  std::vector<T> values(expected.size());
+  REQUIRE(property.getValues(0, values));
+  REQUIRE(values == expected);
 }
 
 template <typename T>
@@ -96,6 +159,8 @@ static void checkNumeric(
       REQUIRE(property.get(i) == expected[static_cast<size_t>(i)]);
     }
   }
+
+  checkValuesInBulk(property, values, expected);
 }
 
 template <typename T, typename D = typename TypeToNormalizedType<T>::type>
@@ -139,6 +204,8 @@ static void checkNormalizedNumeric(
     REQUIRE(property.getRaw(i) == values[static_cast<size_t>(i)]);
     REQUIRE(property.get(i) == expected[static_cast<size_t>(i)]);
   }
+
+  checkValuesInBulk(property, values, expected);
 }
 
 template <typename DataType, typename OffsetType>
@@ -201,6 +268,7 @@ static void checkVariableLengthArray(
   }
 
   REQUIRE(expectedIdx == data.size());
+  checkRawArraysInBulk(property);
 }
 
 template <typename DataType, typename OffsetType>
@@ -263,6 +331,7 @@ static void checkVariableLengthArray(
   }
 
   REQUIRE(expectedIdx == data.size());
+  checkRawArraysInBulk(property);
 
   // Check values with properties applied
   for (int64_t i = 0; i < property.size(); ++i) {
@@ -341,6 +410,7 @@ static void checkNormalizedVariableLengthArray(
   }
 
   REQUIRE(expectedIdx == data.size());
+  checkRawArraysInBulk(property);
 
   // Check values with properties applied
   for (int64_t i = 0; i < property.size(); ++i) {
@@ -413,6 +483,7 @@ static void checkFixedLengthArray(
   }
 
   REQUIRE(expectedIdx == data.size());
+  checkRawArraysInBulk(property);
 }
 
 template <typename T>
@@ -1297,6 +1368,12 @@ TEST_CASE("Check boolean PropertyTablePropertyView") {
     REQUIRE(property.getRaw(i) == bits[static_cast<size_t>(i)]);
     REQUIRE(property.get(i) == property.getRaw(i));
   }
+
+  std::unique_ptr<bool[]> values = std::make_unique<bool[]>(instanceCount);
+  REQUIRE(property.getValues(0, gsl::span<bool>(values.get(), instanceCount)));
+  for (size_t i = 0; i < instanceCount; ++i) {
+    REQUIRE(values[i] == bits[i]);
+  }
 }
 
 TEST_CASE("Check string PropertyTablePropertyView") {
@@ -1355,6 +1432,16 @@ TEST_CASE("Check string PropertyTablePropertyView") {
       REQUIRE(property.getRaw(i) == strings[static_cast<size_t>(i)]);
       REQUIRE(property.get(i) == strings[static_cast<size_t>(i)]);
     }
+
+    std::vector<std::string_view> values(strings.size());
+    property.getRawValues(0, values);
+    for (size_t i = 0; i < strings.size(); ++i) {
+      REQUIRE(values[i] == strings[i]);
+    }
+
+    property.getRawValues(1, gsl::span<std::string_view>(values.data(), 2));
+    REQUIRE(values[0] == strings[1]);
+    REQUIRE(values[1] == strings[2]);
   }
 
   SECTION("Uses NoData value") {
@@ -1382,6 +1469,15 @@ TEST_CASE("Check string PropertyTablePropertyView") {
       REQUIRE(property.getRaw(i) == strings[static_cast<size_t>(i)]);
       REQUIRE(property.get(i) == expected[static_cast<size_t>(i)]);
     }
+
+    std::vector<std::string_view> values(strings.size());
+    bool hasValue[3];
+    REQUIRE(!property.getValues(0, values, hasValue));
+    REQUIRE(hasValue[0]);
+    REQUIRE(values[0] == strings[0]);
+    REQUIRE(!hasValue[1]);
+    REQUIRE(hasValue[2]);
+    REQUIRE(values[2] == strings[2]);
   }
 
   SECTION("Uses NoData and Default value") {
@@ -1410,6 +1506,12 @@ TEST_CASE("Check string PropertyTablePropertyView") {
       REQUIRE(property.getRaw(i) == strings[static_cast<size_t>(i)]);
       REQUIRE(property.get(i) == expected[static_cast<size_t>(i)]);
     }
+
+    std::vector<std::string_view> values(strings.size());
+    REQUIRE(property.getValues(0, values));
+    for (size_t i = 0; i < expected.size(); ++i) {
+      REQUIRE(values[i] == *expected[i]);
+    }
   }
 }
 
@@ -3243,6 +3345,7 @@ TEST_CASE("Check fixed-length array of string") {
     }
 
     REQUIRE(expectedIdx == stringCount);
+    checkRawArraysInBulk(property);
   }
 
   SECTION("Uses NoData value") {
@@ -3445,6 +3548,7 @@ TEST_CASE("Check variable-length string array PropertyTablePropertyView") {
     }
 
     REQUIRE(expectedIdx == stringCount);
+    checkRawArraysInBulk(property);
   }
 
   SECTION("Uses NoData Value") {
@@ -3632,6 +3736,8 @@ TEST_CASE("Check fixed-length boolean array PropertyTablePropertyView") {
       REQUIRE((*maybeValue)[j] == value[j]);
     }
   }
+
+  checkRawArraysInBulk(property);
 }
 
 TEST_CASE("Check variable-length boolean array PropertyTablePropertyView") {
@@ -3709,4 +3815,246 @@ TEST_CASE("Check variable-length boolean array PropertyTablePropertyView") {
       REQUIRE((*maybeValue)[j] == value[j]);
     }
   }
+
+  checkRawArraysInBulk(property);
+}
+
+TEST_CASE("Check PropertyTablePropertyView values over a range") {
+  SECTION("Float with Offset / Scale, NoData, and Default") {
+    std::vector<float> data{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+    std::vector<std::byte> buffer(data.size() * sizeof(float));
+    std::memcpy(buffer.data(), data.data(), buffer.size());
+
+    PropertyTableProperty propertyTableProperty;
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::SCALAR;
+    classProperty.componentType = ClassProperty::ComponentType::FLOAT32;
+    classProperty.offset = 1.0f;
+    classProperty.scale = 2.0f;
+    classProperty.noData = 3.0f;
+    classProperty.defaultProperty = 0.0f;
+
+    PropertyTablePropertyView<float> property(
+        propertyTableProperty,
+        classProperty,
+        static_cast<int64_t>(data.size()),
+        gsl::span<const std::byte>(buffer.data(), buffer.size()));
+
+    std::vector<float> values(3);
+    property.getRawValues(1, values);
+    REQUIRE(values == std::vector<float>{2.0f, 3.0f, 4.0f});
+
+    REQUIRE(property.getValues(1, values));
+    REQUIRE(values == std::vector<float>{5.0f, 0.0f, 9.0f});
+
+    REQUIRE(property.getValues(5, gsl::span<float>()));
+  }
+
+  SECTION("Normalized vec2 with NoData") {
+    std::vector<glm::u8vec2> data{
+        glm::u8vec2(0, 255),
+        glm::u8vec2(255, 0),
+        glm::u8vec2(0, 0),
+        glm::u8vec2(51, 102)};
+    std::vector<std::byte> buffer(data.size() * sizeof(glm::u8vec2));
+    std::memcpy(buffer.data(), data.data(), buffer.size());
+
+    PropertyTableProperty propertyTableProperty;
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::VEC2;
+    classProperty.componentType = ClassProperty::ComponentType::UINT8;
+    classProperty.normalized = true;
+    classProperty.noData = JsonValue::Array{0, 0};
+
+    PropertyTablePropertyView<glm::u8vec2, true> property(
+        propertyTableProperty,
+        classProperty,
+        static_cast<int64_t>(data.size()),
+        gsl::span<const std::byte>(buffer.data(), buffer.size()));
+
+    std::vector<glm::dvec2> values(3);
+    bool hasValue[3];
+    REQUIRE(!property.getValues(1, values, hasValue));
+    REQUIRE(hasValue[0]);
+    REQUIRE(values[0] == glm::dvec2(1.0, 0.0));
+    REQUIRE(!hasValue[1]);
+    REQUIRE(hasValue[2]);
+    REQUIRE(values[2] == glm::dvec2(0.2, 0.4));
+  }
+
+  SECTION("Variable-length arrays with Uint16 offsets") {
+    std::vector<int32_t> data{1, 2, 3, 4, 5, 6};
+    std::vector<std::byte> buffer(data.size() * sizeof(int32_t));
+    std::memcpy(buffer.data(), data.data(), buffer.size());
+
+    std::vector<uint16_t> offsets{0, 1, 1, 4, 6};
+    std::vector<std::byte> offsetBuffer(offsets.size() * sizeof(uint16_t));
+    std::memcpy(offsetBuffer.data(), offsets.data(), offsetBuffer.size());
+
+    PropertyTableProperty propertyTableProperty;
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::SCALAR;
+    classProperty.componentType = ClassProperty::ComponentType::INT32;
+    classProperty.array = true;
+
+    PropertyTablePropertyView<PropertyArrayView<int32_t>> property(
+        propertyTableProperty,
+        classProperty,
+        static_cast<int64_t>(offsets.size() - 1),
+        gsl::span<const std::byte>(buffer.data(), buffer.size()),
+        gsl::span<const std::byte>(offsetBuffer.data(), offsetBuffer.size()),
+        gsl::span<const std::byte>(),
+        PropertyComponentType::Uint16,
+        PropertyComponentType::None);
+
+    std::vector<PropertyArrayView<int32_t>> values(3);
+    property.getRawValues(1, values);
+    REQUIRE(values[0].size() == 0);
+    checkArrayEqual(values[1], {2, 3, 4});
+    checkArrayEqual(values[2], {5, 6});
+  }
+
+  SECTION("Empty property with default") {
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::SCALAR;
+    classProperty.componentType = ClassProperty::ComponentType::UINT32;
+
+    const uint32_t defaultValue = 10;
+    classProperty.defaultProperty = defaultValue;
+
+    PropertyTablePropertyView<uint32_t> property(classProperty, 4);
+    REQUIRE(
+        property.status() ==
+        PropertyTablePropertyViewStatus::EmptyPropertyWithDefault);
+
+    std::vector<uint32_t> values(3);
+    bool hasValue[3] = {false, false, false};
+    REQUIRE(property.getValues(1, values, hasValue));
+    REQUIRE(values == std::vector<uint32_t>(3, defaultValue));
+    REQUIRE(hasValue[0]);
+    REQUIRE(hasValue[1]);
+    REQUIRE(hasValue[2]);
+  }
+}
+
+TEST_CASE("Benchmark PropertyTablePropertyView bulk access", "[.][benchmark]") {
+  const size_t count = 1000000;
+
+  PropertyTableProperty propertyTableProperty;
+
+  std::vector<std::byte> floatBuffer(count * sizeof(float));
+  for (size_t i = 0; i < count; ++i) {
+    const float value = static_cast<float>(i % 1000);
+    std::memcpy(floatBuffer.data() + i * sizeof(float), &value, sizeof(float));
+  }
+
+  ClassProperty floatClassProperty;
+  floatClassProperty.type = ClassProperty::Type::SCALAR;
+  floatClassProperty.componentType = ClassProperty::ComponentType::FLOAT32;
+  floatClassProperty.offset = 10.0f;
+  floatClassProperty.scale = 0.5f;
+  floatClassProperty.noData = 999.0f;
+  floatClassProperty.defaultProperty = 0.0f;
+
+  PropertyTablePropertyView<float> floatProperty(
+      propertyTableProperty,
+      floatClassProperty,
+      static_cast<int64_t>(count),
+      gsl::span<const std::byte>(floatBuffer.data(), floatBuffer.size()));
+
+  std::vector<float> floatValues(count);
+
+  BENCHMARK("Per-element get of float with offset and scale") {
+    for (size_t i = 0; i < count; ++i) {
+      floatValues[i] =
+          floatProperty.get(static_cast<int64_t>(i)).value_or(0.0f);
+    }
+    return floatValues[count - 1];
+  };
+
+  BENCHMARK("getValues of float with offset and scale") {
+    floatProperty.getValues(0, floatValues);
+    return floatValues[count - 1];
+  };
+
+  std::vector<std::byte> int16Buffer(count * sizeof(int16_t));
+  for (size_t i = 0; i < count; ++i) {
+    const int16_t value = static_cast<int16_t>(i % 30000);
+    std::memcpy(
+        int16Buffer.data() + i * sizeof(int16_t),
+        &value,
+        sizeof(int16_t));
+  }
+
+  ClassProperty normalizedClassProperty;
+  normalizedClassProperty.type = ClassProperty::Type::SCALAR;
+  normalizedClassProperty.componentType = ClassProperty::ComponentType::INT16;
+  normalizedClassProperty.normalized = true;
+  normalizedClassProperty.scale = 100.0;
+
+  PropertyTablePropertyView<int16_t, true> normalizedProperty(
+      propertyTableProperty,
+      normalizedClassProperty,
+      static_cast<int64_t>(count),
+      gsl::span<const std::byte>(int16Buffer.data(), int16Buffer.size()));
+
+  std::vector<double> normalizedValues(count);
+
+  BENCHMARK("Per-element get of normalized int16 with scale") {
+    for (size_t i = 0; i < count; ++i) {
+      normalizedValues[i] =
+          normalizedProperty.get(static_cast<int64_t>(i)).value_or(0.0);
+    }
+    return normalizedValues[count - 1];
+  };
+
+  BENCHMARK("getValues of normalized int16 with scale") {
+    normalizedProperty.getValues(0, normalizedValues);
+    return normalizedValues[count - 1];
+  };
+
+  std::vector<std::byte> stringBuffer;
+  std::vector<std::byte> stringOffsetBuffer((count + 1) * sizeof(uint32_t));
+  for (size_t i = 0; i <= count; ++i) {
+    const uint32_t offset = static_cast<uint32_t>(stringBuffer.size());
+    std::memcpy(
+        stringOffsetBuffer.data() + i * sizeof(uint32_t),
+        &offset,
+        sizeof(uint32_t));
+    if (i < count) {
+      const std::string value = "feature " + std::to_string(i);
+      for (char c : value) {
+        stringBuffer.push_back(std::byte(c));
+      }
+    }
+  }
+
+  ClassProperty stringClassProperty;
+  stringClassProperty.type = ClassProperty::Type::STRING;
+
+  PropertyTablePropertyView<std::string_view> stringProperty(
+      propertyTableProperty,
+      stringClassProperty,
+      static_cast<int64_t>(count),
+      gsl::span<const std::byte>(stringBuffer.data(), stringBuffer.size()),
+      gsl::span<const std::byte>(),
+      gsl::span<const std::byte>(
+          stringOffsetBuffer.data(),
+          stringOffsetBuffer.size()),
+      PropertyComponentType::None,
+      PropertyComponentType::Uint32);
+
+  std::vector<std::string_view> stringValues(count);
+
+  BENCHMARK("Per-element getRaw of string") {
+    for (size_t i = 0; i < count; ++i) {
+      stringValues[i] = stringProperty.getRaw(static_cast<int64_t>(i));
+    }
+    return stringValues[count - 1].size();
+  };
+
+  BENCHMARK("getRawValues of string") {
+    stringProperty.getRawValues(0, stringValues);
+    return stringValues[count - 1].size();
+  };
 }
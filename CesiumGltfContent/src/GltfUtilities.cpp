@@ -24,6 +24,7 @@
 #include <glm/gtc/quaternion.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <unordered_set>
 #include <vector>
@@ -190,9 +191,26 @@ GltfUtilities::computeBoundingRegion(
   // at such extreme latitudes.
   CesiumGeospatial::BoundingRegionBuilder computedBounds;
 
+  // Scratch space for the batched cartographic conversion, reused for every
+  // primitive.
+  std::vector<double> ecefX;
+  std::vector<double> ecefY;
+  std::vector<double> ecefZ;
+  std::vector<double> longitudes;
+  std::vector<double> latitudes;
+  std::vector<double> heights;
+
   gltf.forEachPrimitiveInScene(
       -1,
-      [&rootTransform, &computedBounds, &ellipsoid](
+      [&rootTransform,
+       &computedBounds,
+       &ellipsoid,
+       &ecefX,
+       &ecefY,
+       &ecefZ,
+       &longitudes,
+       &latitudes,
+       &heights](
           const CesiumGltf::Model& gltf_,
           const CesiumGltf::Node& /*node*/,
           const CesiumGltf::Mesh& /*mesh*/,
@@ -230,20 +248,46 @@ GltfUtilities::computeBoundingRegion(
           vertexEnd = positionView.size();
         }
 
-        for (int64_t i = vertexBegin; i < vertexEnd; ++i) {
-          // Get the ECEF position
-          const glm::vec3 position = positionView[i];
+        if (vertexEnd <= vertexBegin) {
+          return;
+        }
+
+        // Get the ECEF positions and convert them all to cartographic at once.
+        const size_t vertexCount = size_t(vertexEnd - vertexBegin);
+        ecefX.resize(vertexCount);
+        ecefY.resize(vertexCount);
+        ecefZ.resize(vertexCount);
+        for (size_t i = 0; i < vertexCount; ++i) {
+          const glm::vec3 position = positionView[vertexBegin + int64_t(i)];
           const glm::dvec3 positionEcef =
               glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
+          ecefX[i] = positionEcef.x;
+          ecefY[i] = positionEcef.y;
+          ecefZ[i] = positionEcef.z;
+        }
 
-          // Convert it to cartographic
-          std::optional<CesiumGeospatial::Cartographic> cartographic =
-              ellipsoid.cartesianToCartographic(positionEcef);
-          if (!cartographic) {
+        longitudes.resize(vertexCount);
+        latitudes.resize(vertexCount);
+        heights.resize(vertexCount);
+        ellipsoid.cartesianToCartographic(
+            ecefX,
+            ecefY,
+            ecefZ,
+            longitudes,
+            latitudes,
+            heights);
+
+        for (size_t i = 0; i < vertexCount; ++i) {
+          // Positions at the center of the ellipsoid have no cartographic
+          // representation.
+          if (std::isnan(longitudes[i])) {
             continue;
           }
 
-          computedBounds.expandToIncludePosition(*cartographic);
+          computedBounds.expandToIncludePosition(CesiumGeospatial::Cartographic(
+              longitudes[i],
+              latitudes[i],
+              heights[i]));
         }
       });
 
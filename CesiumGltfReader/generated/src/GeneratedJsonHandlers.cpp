@@ -50,10 +50,16 @@ ExtensionCesiumRTCJsonHandler::readObjectKeyExtensionCesiumRTC(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionCesiumRTC& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("center"s == str)
-    return property("center", this->_center, o.center);
+  switch (str.size()) {
+  case 6:
+    if (str == "center"sv)
+      return property("center", this->_center, o.center);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -153,16 +159,28 @@ ExtensionCesiumTileEdgesJsonHandler::readObjectKeyExtensionCesiumTileEdges(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionCesiumTileEdges& o) {
-  using namespace std::string_literals;
-
-  if ("left"s == str)
-    return property("left", this->_left, o.left);
-  if ("bottom"s == str)
-    return property("bottom", this->_bottom, o.bottom);
-  if ("right"s == str)
-    return property("right", this->_right, o.right);
-  if ("top"s == str)
-    return property("top", this->_top, o.top);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    if (str == "top"sv)
+      return property("top", this->_top, o.top);
+    break;
+  case 4:
+    if (str == "left"sv)
+      return property("left", this->_left, o.left);
+    break;
+  case 5:
+    if (str == "right"sv)
+      return property("right", this->_right, o.right);
+    break;
+  case 6:
+    if (str == "bottom"sv)
+      return property("bottom", this->_bottom, o.bottom);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -263,10 +281,16 @@ CesiumJsonReader::IJsonHandler* ExtensionExtInstanceFeaturesJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionExtInstanceFeatures& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("featureIds"s == str)
-    return property("featureIds", this->_featureIds, o.featureIds);
+  switch (str.size()) {
+  case 10:
+    if (str == "featureIds"sv)
+      return property("featureIds", this->_featureIds, o.featureIds);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -366,10 +390,16 @@ ExtensionExtMeshFeaturesJsonHandler::readObjectKeyExtensionExtMeshFeatures(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionExtMeshFeatures& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("featureIds"s == str)
-    return property("featureIds", this->_featureIds, o.featureIds);
+  switch (str.size()) {
+  case 10:
+    if (str == "featureIds"sv)
+      return property("featureIds", this->_featureIds, o.featureIds);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -469,10 +499,16 @@ CesiumJsonReader::IJsonHandler* ExtensionExtMeshGpuInstancingJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionExtMeshGpuInstancing& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("attributes"s == str)
-    return property("attributes", this->_attributes, o.attributes);
+  switch (str.size()) {
+  case 10:
+    if (str == "attributes"sv)
+      return property("attributes", this->_attributes, o.attributes);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -574,10 +610,16 @@ ExtensionBufferExtMeshoptCompressionJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionBufferExtMeshoptCompression& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("fallback"s == str)
-    return property("fallback", this->_fallback, o.fallback);
+  switch (str.size()) {
+  case 8:
+    if (str == "fallback"sv)
+      return property("fallback", this->_fallback, o.fallback);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -691,22 +733,52 @@ ExtensionBufferViewExtMeshoptCompressionJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionBufferViewExtMeshoptCompression& o) {
-  using namespace std::string_literals;
-
-  if ("buffer"s == str)
-    return property("buffer", this->_buffer, o.buffer);
-  if ("byteOffset"s == str)
-    return property("byteOffset", this->_byteOffset, o.byteOffset);
-  if ("byteLength"s == str)
-    return property("byteLength", this->_byteLength, o.byteLength);
-  if ("byteStride"s == str)
-    return property("byteStride", this->_byteStride, o.byteStride);
-  if ("count"s == str)
-    return property("count", this->_count, o.count);
-  if ("mode"s == str)
-    return property("mode", this->_mode, o.mode);
-  if ("filter"s == str)
-    return property("filter", this->_filter, o.filter);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "mode"sv)
+      return property("mode", this->_mode, o.mode);
+    break;
+  case 5:
+    if (str == "count"sv)
+      return property("count", this->_count, o.count);
+    break;
+  case 6:
+    switch (str[0]) {
+    case 'b':
+      if (str == "buffer"sv)
+        return property("buffer", this->_buffer, o.buffer);
+      break;
+    case 'f':
+      if (str == "filter"sv)
+        return property("filter", this->_filter, o.filter);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 10:
+    switch (str[4]) {
+    case 'O':
+      if (str == "byteOffset"sv)
+        return property("byteOffset", this->_byteOffset, o.byteOffset);
+      break;
+    case 'L':
+      if (str == "byteLength"sv)
+        return property("byteLength", this->_byteLength, o.byteLength);
+      break;
+    case 'S':
+      if (str == "byteStride"sv)
+        return property("byteStride", this->_byteStride, o.byteStride);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -815,24 +887,41 @@ CesiumJsonReader::IJsonHandler* ExtensionModelExtStructuralMetadataJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelExtStructuralMetadata& o) {
-  using namespace std::string_literals;
-
-  if ("schema"s == str)
-    return property("schema", this->_schema, o.schema);
-  if ("schemaUri"s == str)
-    return property("schemaUri", this->_schemaUri, o.schemaUri);
-  if ("propertyTables"s == str)
-    return property("propertyTables", this->_propertyTables, o.propertyTables);
-  if ("propertyTextures"s == str)
-    return property(
-        "propertyTextures",
-        this->_propertyTextures,
-        o.propertyTextures);
-  if ("propertyAttributes"s == str)
-    return property(
-        "propertyAttributes",
-        this->_propertyAttributes,
-        o.propertyAttributes);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 6:
+    if (str == "schema"sv)
+      return property("schema", this->_schema, o.schema);
+    break;
+  case 9:
+    if (str == "schemaUri"sv)
+      return property("schemaUri", this->_schemaUri, o.schemaUri);
+    break;
+  case 14:
+    if (str == "propertyTables"sv)
+      return property(
+          "propertyTables",
+          this->_propertyTables,
+          o.propertyTables);
+    break;
+  case 16:
+    if (str == "propertyTextures"sv)
+      return property(
+          "propertyTextures",
+          this->_propertyTextures,
+          o.propertyTextures);
+    break;
+  case 18:
+    if (str == "propertyAttributes"sv)
+      return property(
+          "propertyAttributes",
+          this->_propertyAttributes,
+          o.propertyAttributes);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -941,18 +1030,26 @@ ExtensionMeshPrimitiveExtStructuralMetadataJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionMeshPrimitiveExtStructuralMetadata& o) {
-  using namespace std::string_literals;
-
-  if ("propertyTextures"s == str)
-    return property(
-        "propertyTextures",
-        this->_propertyTextures,
-        o.propertyTextures);
-  if ("propertyAttributes"s == str)
-    return property(
-        "propertyAttributes",
-        this->_propertyAttributes,
-        o.propertyAttributes);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 16:
+    if (str == "propertyTextures"sv)
+      return property(
+          "propertyTextures",
+          this->_propertyTextures,
+          o.propertyTextures);
+    break;
+  case 18:
+    if (str == "propertyAttributes"sv)
+      return property(
+          "propertyAttributes",
+          this->_propertyAttributes,
+          o.propertyAttributes);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1060,12 +1157,26 @@ CesiumJsonReader::IJsonHandler* ExtensionKhrDracoMeshCompressionJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionKhrDracoMeshCompression& o) {
-  using namespace std::string_literals;
-
-  if ("bufferView"s == str)
-    return property("bufferView", this->_bufferView, o.bufferView);
-  if ("attributes"s == str)
-    return property("attributes", this->_attributes, o.attributes);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 10:
+    switch (str[0]) {
+    case 'b':
+      if (str == "bufferView"sv)
+        return property("bufferView", this->_bufferView, o.bufferView);
+      break;
+    case 'a':
+      if (str == "attributes"sv)
+        return property("attributes", this->_attributes, o.attributes);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1165,8 +1276,6 @@ ExtensionKhrMaterialsUnlitJsonHandler::readObjectKeyExtensionKhrMaterialsUnlit(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionKhrMaterialsUnlit& o) {
-  using namespace std::string_literals;
-
   (void)o;
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
@@ -1269,10 +1378,16 @@ CesiumJsonReader::IJsonHandler* ExtensionModelKhrMaterialsVariantsJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelKhrMaterialsVariants& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("variants"s == str)
-    return property("variants", this->_variants, o.variants);
+  switch (str.size()) {
+  case 8:
+    if (str == "variants"sv)
+      return property("variants", this->_variants, o.variants);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1378,10 +1493,16 @@ ExtensionMeshPrimitiveKhrMaterialsVariantsJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionMeshPrimitiveKhrMaterialsVariants& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("mappings"s == str)
-    return property("mappings", this->_mappings, o.mappings);
+  switch (str.size()) {
+  case 8:
+    if (str == "mappings"sv)
+      return property("mappings", this->_mappings, o.mappings);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1483,10 +1604,16 @@ ExtensionKhrTextureBasisuJsonHandler::readObjectKeyExtensionKhrTextureBasisu(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionKhrTextureBasisu& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("source"s == str)
-    return property("source", this->_source, o.source);
+  switch (str.size()) {
+  case 6:
+    if (str == "source"sv)
+      return property("source", this->_source, o.source);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1588,12 +1715,20 @@ CesiumJsonReader::IJsonHandler* ExtensionModelMaxarMeshVariantsJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelMaxarMeshVariants& o) {
-  using namespace std::string_literals;
-
-  if ("default"s == str)
-    return property("default", this->_defaultProperty, o.defaultProperty);
-  if ("variants"s == str)
-    return property("variants", this->_variants, o.variants);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 7:
+    if (str == "default"sv)
+      return property("default", this->_defaultProperty, o.defaultProperty);
+    break;
+  case 8:
+    if (str == "variants"sv)
+      return property("variants", this->_variants, o.variants);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1694,10 +1829,16 @@ CesiumJsonReader::IJsonHandler* ExtensionNodeMaxarMeshVariantsJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionNodeMaxarMeshVariants& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("mappings"s == str)
-    return property("mappings", this->_mappings, o.mappings);
+  switch (str.size()) {
+  case 8:
+    if (str == "mappings"sv)
+      return property("mappings", this->_mappings, o.mappings);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1801,16 +1942,34 @@ CesiumJsonReader::IJsonHandler* ExtensionKhrTextureTransformJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionKhrTextureTransform& o) {
-  using namespace std::string_literals;
-
-  if ("offset"s == str)
-    return property("offset", this->_offset, o.offset);
-  if ("rotation"s == str)
-    return property("rotation", this->_rotation, o.rotation);
-  if ("scale"s == str)
-    return property("scale", this->_scale, o.scale);
-  if ("texCoord"s == str)
-    return property("texCoord", this->_texCoord, o.texCoord);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    if (str == "scale"sv)
+      return property("scale", this->_scale, o.scale);
+    break;
+  case 6:
+    if (str == "offset"sv)
+      return property("offset", this->_offset, o.offset);
+    break;
+  case 8:
+    switch (str[0]) {
+    case 'r':
+      if (str == "rotation"sv)
+        return property("rotation", this->_rotation, o.rotation);
+      break;
+    case 't':
+      if (str == "texCoord"sv)
+        return property("texCoord", this->_texCoord, o.texCoord);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -1907,10 +2066,16 @@ ExtensionTextureWebpJsonHandler::readObjectKeyExtensionTextureWebp(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::ExtensionTextureWebp& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("source"s == str)
-    return property("source", this->_source, o.source);
+  switch (str.size()) {
+  case 6:
+    if (str == "source"sv)
+      return property("source", this->_source, o.source);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2007,10 +2172,16 @@ CesiumJsonReader::IJsonHandler* ExtensionCesiumPrimitiveOutlineJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionCesiumPrimitiveOutline& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("indices"s == str)
-    return property("indices", this->_indices, o.indices);
+  switch (str.size()) {
+  case 7:
+    if (str == "indices"sv)
+      return property("indices", this->_indices, o.indices);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2101,14 +2272,30 @@ ExtensionNodeMaxarMeshVariantsMappingsValueJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionNodeMaxarMeshVariantsMappingsValue& o) {
-  using namespace std::string_literals;
-
-  if ("variants"s == str)
-    return property("variants", this->_variants, o.variants);
-  if ("mesh"s == str)
-    return property("mesh", this->_mesh, o.mesh);
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    switch (str[0]) {
+    case 'm':
+      if (str == "mesh"sv)
+        return property("mesh", this->_mesh, o.mesh);
+      break;
+    case 'n':
+      if (str == "name"sv)
+        return property("name", this->_name, o.name);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 8:
+    if (str == "variants"sv)
+      return property("variants", this->_variants, o.variants);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2201,10 +2388,16 @@ ExtensionModelMaxarMeshVariantsValueJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelMaxarMeshVariantsValue& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -2302,14 +2495,30 @@ ExtensionMeshPrimitiveKhrMaterialsVariantsMappingsValueJsonHandler::
         const std::string_view& str,
         CesiumGltf::ExtensionMeshPrimitiveKhrMaterialsVariantsMappingsValue&
             o) {
-  using namespace std::string_literals;
-
-  if ("variants"s == str)
-    return property("variants", this->_variants, o.variants);
-  if ("material"s == str)
-    return property("material", this->_material, o.material);
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 8:
+    switch (str[0]) {
+    case 'v':
+      if (str == "variants"sv)
+        return property("variants", this->_variants, o.variants);
+      break;
+    case 'm':
+      if (str == "material"sv)
+        return property("material", this->_material, o.material);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2403,10 +2612,16 @@ ExtensionModelKhrMaterialsVariantsValueJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionModelKhrMaterialsVariantsValue& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -2497,14 +2712,24 @@ PropertyAttributeJsonHandler::readObjectKeyPropertyAttribute(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyAttribute& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("class"s == str)
-    return property("class", this->_classProperty, o.classProperty);
-  if ("properties"s == str)
-    return property("properties", this->_properties, o.properties);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 5:
+    if (str == "class"sv)
+      return property("class", this->_classProperty, o.classProperty);
+    break;
+  case 10:
+    if (str == "properties"sv)
+      return property("properties", this->_properties, o.properties);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2592,18 +2817,38 @@ PropertyAttributePropertyJsonHandler::readObjectKeyPropertyAttributeProperty(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyAttributeProperty& o) {
-  using namespace std::string_literals;
-
-  if ("attribute"s == str)
-    return property("attribute", this->_attribute, o.attribute);
-  if ("offset"s == str)
-    return property("offset", this->_offset, o.offset);
-  if ("scale"s == str)
-    return property("scale", this->_scale, o.scale);
-  if ("max"s == str)
-    return property("max", this->_max, o.max);
-  if ("min"s == str)
-    return property("min", this->_min, o.min);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    switch (str[1]) {
+    case 'a':
+      if (str == "max"sv)
+        return property("max", this->_max, o.max);
+      break;
+    case 'i':
+      if (str == "min"sv)
+        return property("min", this->_min, o.min);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 5:
+    if (str == "scale"sv)
+      return property("scale", this->_scale, o.scale);
+    break;
+  case 6:
+    if (str == "offset"sv)
+      return property("offset", this->_offset, o.offset);
+    break;
+  case 9:
+    if (str == "attribute"sv)
+      return property("attribute", this->_attribute, o.attribute);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2691,14 +2936,24 @@ PropertyTextureJsonHandler::readObjectKeyPropertyTexture(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyTexture& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("class"s == str)
-    return property("class", this->_classProperty, o.classProperty);
-  if ("properties"s == str)
-    return property("properties", this->_properties, o.properties);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 5:
+    if (str == "class"sv)
+      return property("class", this->_classProperty, o.classProperty);
+    break;
+  case 10:
+    if (str == "properties"sv)
+      return property("properties", this->_properties, o.properties);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2783,18 +3038,38 @@ PropertyTexturePropertyJsonHandler::readObjectKeyPropertyTextureProperty(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyTextureProperty& o) {
-  using namespace std::string_literals;
-
-  if ("channels"s == str)
-    return property("channels", this->_channels, o.channels);
-  if ("offset"s == str)
-    return property("offset", this->_offset, o.offset);
-  if ("scale"s == str)
-    return property("scale", this->_scale, o.scale);
-  if ("max"s == str)
-    return property("max", this->_max, o.max);
-  if ("min"s == str)
-    return property("min", this->_min, o.min);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    switch (str[1]) {
+    case 'a':
+      if (str == "max"sv)
+        return property("max", this->_max, o.max);
+      break;
+    case 'i':
+      if (str == "min"sv)
+        return property("min", this->_min, o.min);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 5:
+    if (str == "scale"sv)
+      return property("scale", this->_scale, o.scale);
+    break;
+  case 6:
+    if (str == "offset"sv)
+      return property("offset", this->_offset, o.offset);
+    break;
+  case 8:
+    if (str == "channels"sv)
+      return property("channels", this->_channels, o.channels);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyTextureInfo(objectType, str, *this->_pObject);
 }
@@ -2881,12 +3156,20 @@ TextureInfoJsonHandler::readObjectKeyTextureInfo(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::TextureInfo& o) {
-  using namespace std::string_literals;
-
-  if ("index"s == str)
-    return property("index", this->_index, o.index);
-  if ("texCoord"s == str)
-    return property("texCoord", this->_texCoord, o.texCoord);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    if (str == "index"sv)
+      return property("index", this->_index, o.index);
+    break;
+  case 8:
+    if (str == "texCoord"sv)
+      return property("texCoord", this->_texCoord, o.texCoord);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -2969,16 +3252,34 @@ PropertyTableJsonHandler::readObjectKeyPropertyTable(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyTable& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("class"s == str)
-    return property("class", this->_classProperty, o.classProperty);
-  if ("count"s == str)
-    return property("count", this->_count, o.count);
-  if ("properties"s == str)
-    return property("properties", this->_properties, o.properties);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 5:
+    switch (str[1]) {
+    case 'l':
+      if (str == "class"sv)
+        return property("class", this->_classProperty, o.classProperty);
+      break;
+    case 'o':
+      if (str == "count"sv)
+        return property("count", this->_count, o.count);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 10:
+    if (str == "properties"sv)
+      return property("properties", this->_properties, o.properties);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -3067,32 +3368,66 @@ PropertyTablePropertyJsonHandler::readObjectKeyPropertyTableProperty(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::PropertyTableProperty& o) {
-  using namespace std::string_literals;
-
-  if ("values"s == str)
-    return property("values", this->_values, o.values);
-  if ("arrayOffsets"s == str)
-    return property("arrayOffsets", this->_arrayOffsets, o.arrayOffsets);
-  if ("stringOffsets"s == str)
-    return property("stringOffsets", this->_stringOffsets, o.stringOffsets);
-  if ("arrayOffsetType"s == str)
-    return property(
-        "arrayOffsetType",
-        this->_arrayOffsetType,
-        o.arrayOffsetType);
-  if ("stringOffsetType"s == str)
-    return property(
-        "stringOffsetType",
-        this->_stringOffsetType,
-        o.stringOffsetType);
-  if ("offset"s == str)
-    return property("offset", this->_offset, o.offset);
-  if ("scale"s == str)
-    return property("scale", this->_scale, o.scale);
-  if ("max"s == str)
-    return property("max", this->_max, o.max);
-  if ("min"s == str)
-    return property("min", this->_min, o.min);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    switch (str[1]) {
+    case 'a':
+      if (str == "max"sv)
+        return property("max", this->_max, o.max);
+      break;
+    case 'i':
+      if (str == "min"sv)
+        return property("min", this->_min, o.min);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 5:
+    if (str == "scale"sv)
+      return property("scale", this->_scale, o.scale);
+    break;
+  case 6:
+    switch (str[0]) {
+    case 'v':
+      if (str == "values"sv)
+        return property("values", this->_values, o.values);
+      break;
+    case 'o':
+      if (str == "offset"sv)
+        return property("offset", this->_offset, o.offset);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 12:
+    if (str == "arrayOffsets"sv)
+      return property("arrayOffsets", this->_arrayOffsets, o.arrayOffsets);
+    break;
+  case 13:
+    if (str == "stringOffsets"sv)
+      return property("stringOffsets", this->_stringOffsets, o.stringOffsets);
+    break;
+  case 15:
+    if (str == "arrayOffsetType"sv)
+      return property(
+          "arrayOffsetType",
+          this->_arrayOffsetType,
+          o.arrayOffsetType);
+    break;
+  case 16:
+    if (str == "stringOffsetType"sv)
+      return property(
+          "stringOffsetType",
+          this->_stringOffsetType,
+          o.stringOffsetType);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -3179,20 +3514,42 @@ CesiumJsonReader::IJsonHandler* SchemaJsonHandler::readObjectKeySchema(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Schema& o) {
-  using namespace std::string_literals;
-
-  if ("id"s == str)
-    return property("id", this->_id, o.id);
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("version"s == str)
-    return property("version", this->_version, o.version);
-  if ("classes"s == str)
-    return property("classes", this->_classes, o.classes);
-  if ("enums"s == str)
-    return property("enums", this->_enums, o.enums);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 2:
+    if (str == "id"sv)
+      return property("id", this->_id, o.id);
+    break;
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 5:
+    if (str == "enums"sv)
+      return property("enums", this->_enums, o.enums);
+    break;
+  case 7:
+    switch (str[0]) {
+    case 'v':
+      if (str == "version"sv)
+        return property("version", this->_version, o.version);
+      break;
+    case 'c':
+      if (str == "classes"sv)
+        return property("classes", this->_classes, o.classes);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -3270,16 +3627,28 @@ CesiumJsonReader::IJsonHandler* EnumJsonHandler::readObjectKeyEnum(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Enum& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("valueType"s == str)
-    return property("valueType", this->_valueType, o.valueType);
-  if ("values"s == str)
-    return property("values", this->_values, o.values);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 6:
+    if (str == "values"sv)
+      return property("values", this->_values, o.values);
+    break;
+  case 9:
+    if (str == "valueType"sv)
+      return property("valueType", this->_valueType, o.valueType);
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -3356,14 +3725,24 @@ CesiumJsonReader::IJsonHandler* EnumValueJsonHandler::readObjectKeyEnumValue(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::EnumValue& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("value"s == str)
-    return property("value", this->_value, o.value);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 5:
+    if (str == "value"sv)
+      return property("value", this->_value, o.value);
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -3441,14 +3820,24 @@ CesiumJsonReader::IJsonHandler* ClassJsonHandler::readObjectKeyClass(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Class& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("properties"s == str)
-    return property("properties", this->_properties, o.properties);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 10:
+    if (str == "properties"sv)
+      return property("properties", this->_properties, o.properties);
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -3539,40 +3928,106 @@ ClassPropertyJsonHandler::readObjectKeyClassProperty(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::ClassProperty& o) {
-  using namespace std::string_literals;
-
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("type"s == str)
-    return property("type", this->_type, o.type);
-  if ("componentType"s == str)
-    return property("componentType", this->_componentType, o.componentType);
-  if ("enumType"s == str)
-    return property("enumType", this->_enumType, o.enumType);
-  if ("array"s == str)
-    return property("array", this->_array, o.array);
-  if ("count"s == str)
-    return property("count", this->_count, o.count);
-  if ("normalized"s == str)
-    return property("normalized", this->_normalized, o.normalized);
-  if ("offset"s == str)
-    return property("offset", this->_offset, o.offset);
-  if ("scale"s == str)
-    return property("scale", this->_scale, o.scale);
-  if ("max"s == str)
-    return property("max", this->_max, o.max);
-  if ("min"s == str)
-    return property("min", this->_min, o.min);
-  if ("required"s == str)
-    return property("required", this->_required, o.required);
-  if ("noData"s == str)
-    return property("noData", this->_noData, o.noData);
-  if ("default"s == str)
-    return property("default", this->_defaultProperty, o.defaultProperty);
-  if ("semantic"s == str)
-    return property("semantic", this->_semantic, o.semantic);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    switch (str[1]) {
+    case 'a':
+      if (str == "max"sv)
+        return property("max", this->_max, o.max);
+      break;
+    case 'i':
+      if (str == "min"sv)
+        return property("min", this->_min, o.min);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 4:
+    switch (str[0]) {
+    case 'n':
+      if (str == "name"sv)
+        return property("name", this->_name, o.name);
+      break;
+    case 't':
+      if (str == "type"sv)
+        return property("type", this->_type, o.type);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 5:
+    switch (str[0]) {
+    case 'a':
+      if (str == "array"sv)
+        return property("array", this->_array, o.array);
+      break;
+    case 'c':
+      if (str == "count"sv)
+        return property("count", this->_count, o.count);
+      break;
+    case 's':
+      if (str == "scale"sv)
+        return property("scale", this->_scale, o.scale);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 6:
+    switch (str[0]) {
+    case 'o':
+      if (str == "offset"sv)
+        return property("offset", this->_offset, o.offset);
+      break;
+    case 'n':
+      if (str == "noData"sv)
+        return property("noData", this->_noData, o.noData);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 7:
+    if (str == "default"sv)
+      return property("default", this->_defaultProperty, o.defaultProperty);
+    break;
+  case 8:
+    switch (str[0]) {
+    case 'e':
+      if (str == "enumType"sv)
+        return property("enumType", this->_enumType, o.enumType);
+      break;
+    case 'r':
+      if (str == "required"sv)
+        return property("required", this->_required, o.required);
+      break;
+    case 's':
+      if (str == "semantic"sv)
+        return property("semantic", this->_semantic, o.semantic);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 10:
+    if (str == "normalized"sv)
+      return property("normalized", this->_normalized, o.normalized);
+    break;
+  case 11:
+    if (str == "description"sv)
+      return property("description", this->_description, o.description);
+    break;
+  case 13:
+    if (str == "componentType"sv)
+      return property("componentType", this->_componentType, o.componentType);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -3657,20 +4112,42 @@ CesiumJsonReader::IJsonHandler* FeatureIdJsonHandler::readObjectKeyFeatureId(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::FeatureId& o) {
-  using namespace std::string_literals;
-
-  if ("featureCount"s == str)
-    return property("featureCount", this->_featureCount, o.featureCount);
-  if ("nullFeatureId"s == str)
-    return property("nullFeatureId", this->_nullFeatureId, o.nullFeatureId);
-  if ("label"s == str)
-    return property("label", this->_label, o.label);
-  if ("attribute"s == str)
-    return property("attribute", this->_attribute, o.attribute);
-  if ("texture"s == str)
-    return property("texture", this->_texture, o.texture);
-  if ("propertyTable"s == str)
-    return property("propertyTable", this->_propertyTable, o.propertyTable);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    if (str == "label"sv)
+      return property("label", this->_label, o.label);
+    break;
+  case 7:
+    if (str == "texture"sv)
+      return property("texture", this->_texture, o.texture);
+    break;
+  case 9:
+    if (str == "attribute"sv)
+      return property("attribute", this->_attribute, o.attribute);
+    break;
+  case 12:
+    if (str == "featureCount"sv)
+      return property("featureCount", this->_featureCount, o.featureCount);
+    break;
+  case 13:
+    switch (str[0]) {
+    case 'n':
+      if (str == "nullFeatureId"sv)
+        return property("nullFeatureId", this->_nullFeatureId, o.nullFeatureId);
+      break;
+    case 'p':
+      if (str == "propertyTable"sv)
+        return property("propertyTable", this->_propertyTable, o.propertyTable);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -3746,10 +4223,16 @@ FeatureIdTextureJsonHandler::readObjectKeyFeatureIdTexture(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::FeatureIdTexture& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("channels"s == str)
-    return property("channels", this->_channels, o.channels);
+  switch (str.size()) {
+  case 8:
+    if (str == "channels"sv)
+      return property("channels", this->_channels, o.channels);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyTextureInfo(objectType, str, *this->_pObject);
 }
@@ -3838,18 +4321,38 @@ ExtensionExtInstanceFeaturesFeatureIdJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::ExtensionExtInstanceFeaturesFeatureId& o) {
-  using namespace std::string_literals;
-
-  if ("featureCount"s == str)
-    return property("featureCount", this->_featureCount, o.featureCount);
-  if ("nullFeatureId"s == str)
-    return property("nullFeatureId", this->_nullFeatureId, o.nullFeatureId);
-  if ("label"s == str)
-    return property("label", this->_label, o.label);
-  if ("attribute"s == str)
-    return property("attribute", this->_attribute, o.attribute);
-  if ("propertyTable"s == str)
-    return property("propertyTable", this->_propertyTable, o.propertyTable);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    if (str == "label"sv)
+      return property("label", this->_label, o.label);
+    break;
+  case 9:
+    if (str == "attribute"sv)
+      return property("attribute", this->_attribute, o.attribute);
+    break;
+  case 12:
+    if (str == "featureCount"sv)
+      return property("featureCount", this->_featureCount, o.featureCount);
+    break;
+  case 13:
+    switch (str[0]) {
+    case 'n':
+      if (str == "nullFeatureId"sv)
+        return property("nullFeatureId", this->_nullFeatureId, o.nullFeatureId);
+      break;
+    case 'p':
+      if (str == "propertyTable"sv)
+        return property("propertyTable", this->_propertyTable, o.propertyTable);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -3953,45 +4456,116 @@ CesiumJsonReader::IJsonHandler* ModelJsonHandler::readObjectKeyModel(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Model& o) {
-  using namespace std::string_literals;
-
-  if ("extensionsUsed"s == str)
-    return property("extensionsUsed", this->_extensionsUsed, o.extensionsUsed);
-  if ("extensionsRequired"s == str)
-    return property(
-        "extensionsRequired",
-        this->_extensionsRequired,
-        o.extensionsRequired);
-  if ("accessors"s == str)
-    return property("accessors", this->_accessors, o.accessors);
-  if ("animations"s == str)
-    return property("animations", this->_animations, o.animations);
-  if ("asset"s == str)
-    return property("asset", this->_asset, o.asset);
-  if ("buffers"s == str)
-    return property("buffers", this->_buffers, o.buffers);
-  if ("bufferViews"s == str)
-    return property("bufferViews", this->_bufferViews, o.bufferViews);
-  if ("cameras"s == str)
-    return property("cameras", this->_cameras, o.cameras);
-  if ("images"s == str)
-    return property("images", this->_images, o.images);
-  if ("materials"s == str)
-    return property("materials", this->_materials, o.materials);
-  if ("meshes"s == str)
-    return property("meshes", this->_meshes, o.meshes);
-  if ("nodes"s == str)
-    return property("nodes", this->_nodes, o.nodes);
-  if ("samplers"s == str)
-    return property("samplers", this->_samplers, o.samplers);
-  if ("scene"s == str)
-    return property("scene", this->_scene, o.scene);
-  if ("scenes"s == str)
-    return property("scenes", this->_scenes, o.scenes);
-  if ("skins"s == str)
-    return property("skins", this->_skins, o.skins);
-  if ("textures"s == str)
-    return property("textures", this->_textures, o.textures);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    switch (str[1]) {
+    case 's':
+      if (str == "asset"sv)
+        return property("asset", this->_asset, o.asset);
+      break;
+    case 'o':
+      if (str == "nodes"sv)
+        return property("nodes", this->_nodes, o.nodes);
+      break;
+    case 'c':
+      if (str == "scene"sv)
+        return property("scene", this->_scene, o.scene);
+      break;
+    case 'k':
+      if (str == "skins"sv)
+        return property("skins", this->_skins, o.skins);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 6:
+    switch (str[0]) {
+    case 'i':
+      if (str == "images"sv)
+        return property("images", this->_images, o.images);
+      break;
+    case 'm':
+      if (str == "meshes"sv)
+        return property("meshes", this->_meshes, o.meshes);
+      break;
+    case 's':
+      if (str == "scenes"sv)
+        return property("scenes", this->_scenes, o.scenes);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 7:
+    switch (str[0]) {
+    case 'b':
+      if (str == "buffers"sv)
+        return property("buffers", this->_buffers, o.buffers);
+      break;
+    case 'c':
+      if (str == "cameras"sv)
+        return property("cameras", this->_cameras, o.cameras);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 8:
+    switch (str[0]) {
+    case 's':
+      if (str == "samplers"sv)
+        return property("samplers", this->_samplers, o.samplers);
+      break;
+    case 't':
+      if (str == "textures"sv)
+        return property("textures", this->_textures, o.textures);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 9:
+    switch (str[0]) {
+    case 'a':
+      if (str == "accessors"sv)
+        return property("accessors", this->_accessors, o.accessors);
+      break;
+    case 'm':
+      if (str == "materials"sv)
+        return property("materials", this->_materials, o.materials);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 10:
+    if (str == "animations"sv)
+      return property("animations", this->_animations, o.animations);
+    break;
+  case 11:
+    if (str == "bufferViews"sv)
+      return property("bufferViews", this->_bufferViews, o.bufferViews);
+    break;
+  case 14:
+    if (str == "extensionsUsed"sv)
+      return property(
+          "extensionsUsed",
+          this->_extensionsUsed,
+          o.extensionsUsed);
+    break;
+  case 18:
+    if (str == "extensionsRequired"sv)
+      return property(
+          "extensionsRequired",
+          this->_extensionsRequired,
+          o.extensionsRequired);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -4067,12 +4641,20 @@ CesiumJsonReader::IJsonHandler* TextureJsonHandler::readObjectKeyTexture(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Texture& o) {
-  using namespace std::string_literals;
-
-  if ("sampler"s == str)
-    return property("sampler", this->_sampler, o.sampler);
-  if ("source"s == str)
-    return property("source", this->_source, o.source);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 6:
+    if (str == "source"sv)
+      return property("source", this->_source, o.source);
+    break;
+  case 7:
+    if (str == "sampler"sv)
+      return property("sampler", this->_sampler, o.sampler);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -4149,17 +4731,27 @@ CesiumJsonReader::IJsonHandler* SkinJsonHandler::readObjectKeySkin(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Skin& o) {
-  using namespace std::string_literals;
-
-  if ("inverseBindMatrices"s == str)
-    return property(
-        "inverseBindMatrices",
-        this->_inverseBindMatrices,
-        o.inverseBindMatrices);
-  if ("skeleton"s == str)
-    return property("skeleton", this->_skeleton, o.skeleton);
-  if ("joints"s == str)
-    return property("joints", this->_joints, o.joints);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 6:
+    if (str == "joints"sv)
+      return property("joints", this->_joints, o.joints);
+    break;
+  case 8:
+    if (str == "skeleton"sv)
+      return property("skeleton", this->_skeleton, o.skeleton);
+    break;
+  case 19:
+    if (str == "inverseBindMatrices"sv)
+      return property(
+          "inverseBindMatrices",
+          this->_inverseBindMatrices,
+          o.inverseBindMatrices);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -4233,10 +4825,16 @@ CesiumJsonReader::IJsonHandler* SceneJsonHandler::readObjectKeyScene(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Scene& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("nodes"s == str)
-    return property("nodes", this->_nodes, o.nodes);
+  switch (str.size()) {
+  case 5:
+    if (str == "nodes"sv)
+      return property("nodes", this->_nodes, o.nodes);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -4314,16 +4912,40 @@ CesiumJsonReader::IJsonHandler* SamplerJsonHandler::readObjectKeySampler(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Sampler& o) {
-  using namespace std::string_literals;
-
-  if ("magFilter"s == str)
-    return property("magFilter", this->_magFilter, o.magFilter);
-  if ("minFilter"s == str)
-    return property("minFilter", this->_minFilter, o.minFilter);
-  if ("wrapS"s == str)
-    return property("wrapS", this->_wrapS, o.wrapS);
-  if ("wrapT"s == str)
-    return property("wrapT", this->_wrapT, o.wrapT);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    switch (str[4]) {
+    case 'S':
+      if (str == "wrapS"sv)
+        return property("wrapS", this->_wrapS, o.wrapS);
+      break;
+    case 'T':
+      if (str == "wrapT"sv)
+        return property("wrapT", this->_wrapT, o.wrapT);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 9:
+    switch (str[1]) {
+    case 'a':
+      if (str == "magFilter"sv)
+        return property("magFilter", this->_magFilter, o.magFilter);
+      break;
+    case 'i':
+      if (str == "minFilter"sv)
+        return property("minFilter", this->_minFilter, o.minFilter);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -4406,26 +5028,66 @@ CesiumJsonReader::IJsonHandler* NodeJsonHandler::readObjectKeyNode(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Node& o) {
-  using namespace std::string_literals;
-
-  if ("camera"s == str)
-    return property("camera", this->_camera, o.camera);
-  if ("children"s == str)
-    return property("children", this->_children, o.children);
-  if ("skin"s == str)
-    return property("skin", this->_skin, o.skin);
-  if ("matrix"s == str)
-    return property("matrix", this->_matrix, o.matrix);
-  if ("mesh"s == str)
-    return property("mesh", this->_mesh, o.mesh);
-  if ("rotation"s == str)
-    return property("rotation", this->_rotation, o.rotation);
-  if ("scale"s == str)
-    return property("scale", this->_scale, o.scale);
-  if ("translation"s == str)
-    return property("translation", this->_translation, o.translation);
-  if ("weights"s == str)
-    return property("weights", this->_weights, o.weights);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    switch (str[0]) {
+    case 's':
+      if (str == "skin"sv)
+        return property("skin", this->_skin, o.skin);
+      break;
+    case 'm':
+      if (str == "mesh"sv)
+        return property("mesh", this->_mesh, o.mesh);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 5:
+    if (str == "scale"sv)
+      return property("scale", this->_scale, o.scale);
+    break;
+  case 6:
+    switch (str[0]) {
+    case 'c':
+      if (str == "camera"sv)
+        return property("camera", this->_camera, o.camera);
+      break;
+    case 'm':
+      if (str == "matrix"sv)
+        return property("matrix", this->_matrix, o.matrix);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 7:
+    if (str == "weights"sv)
+      return property("weights", this->_weights, o.weights);
+    break;
+  case 8:
+    switch (str[0]) {
+    case 'c':
+      if (str == "children"sv)
+        return property("children", this->_children, o.children);
+      break;
+    case 'r':
+      if (str == "rotation"sv)
+        return property("rotation", this->_rotation, o.rotation);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 11:
+    if (str == "translation"sv)
+      return property("translation", this->_translation, o.translation);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -4501,12 +5163,20 @@ CesiumJsonReader::IJsonHandler* MeshJsonHandler::readObjectKeyMesh(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Mesh& o) {
-  using namespace std::string_literals;
-
-  if ("primitives"s == str)
-    return property("primitives", this->_primitives, o.primitives);
-  if ("weights"s == str)
-    return property("weights", this->_weights, o.weights);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 7:
+    if (str == "weights"sv)
+      return property("weights", this->_weights, o.weights);
+    break;
+  case 10:
+    if (str == "primitives"sv)
+      return property("primitives", this->_primitives, o.primitives);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -4586,18 +5256,38 @@ MeshPrimitiveJsonHandler::readObjectKeyMeshPrimitive(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::MeshPrimitive& o) {
-  using namespace std::string_literals;
-
-  if ("attributes"s == str)
-    return property("attributes", this->_attributes, o.attributes);
-  if ("indices"s == str)
-    return property("indices", this->_indices, o.indices);
-  if ("material"s == str)
-    return property("material", this->_material, o.material);
-  if ("mode"s == str)
-    return property("mode", this->_mode, o.mode);
-  if ("targets"s == str)
-    return property("targets", this->_targets, o.targets);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "mode"sv)
+      return property("mode", this->_mode, o.mode);
+    break;
+  case 7:
+    switch (str[0]) {
+    case 'i':
+      if (str == "indices"sv)
+        return property("indices", this->_indices, o.indices);
+      break;
+    case 't':
+      if (str == "targets"sv)
+        return property("targets", this->_targets, o.targets);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 8:
+    if (str == "material"sv)
+      return property("material", this->_material, o.material);
+    break;
+  case 10:
+    if (str == "attributes"sv)
+      return property("attributes", this->_attributes, o.attributes);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -4684,33 +5374,62 @@ CesiumJsonReader::IJsonHandler* MaterialJsonHandler::readObjectKeyMaterial(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Material& o) {
-  using namespace std::string_literals;
-
-  if ("pbrMetallicRoughness"s == str)
-    return property(
-        "pbrMetallicRoughness",
-        this->_pbrMetallicRoughness,
-        o.pbrMetallicRoughness);
-  if ("normalTexture"s == str)
-    return property("normalTexture", this->_normalTexture, o.normalTexture);
-  if ("occlusionTexture"s == str)
-    return property(
-        "occlusionTexture",
-        this->_occlusionTexture,
-        o.occlusionTexture);
-  if ("emissiveTexture"s == str)
-    return property(
-        "emissiveTexture",
-        this->_emissiveTexture,
-        o.emissiveTexture);
-  if ("emissiveFactor"s == str)
-    return property("emissiveFactor", this->_emissiveFactor, o.emissiveFactor);
-  if ("alphaMode"s == str)
-    return property("alphaMode", this->_alphaMode, o.alphaMode);
-  if ("alphaCutoff"s == str)
-    return property("alphaCutoff", this->_alphaCutoff, o.alphaCutoff);
-  if ("doubleSided"s == str)
-    return property("doubleSided", this->_doubleSided, o.doubleSided);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 9:
+    if (str == "alphaMode"sv)
+      return property("alphaMode", this->_alphaMode, o.alphaMode);
+    break;
+  case 11:
+    switch (str[0]) {
+    case 'a':
+      if (str == "alphaCutoff"sv)
+        return property("alphaCutoff", this->_alphaCutoff, o.alphaCutoff);
+      break;
+    case 'd':
+      if (str == "doubleSided"sv)
+        return property("doubleSided", this->_doubleSided, o.doubleSided);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 13:
+    if (str == "normalTexture"sv)
+      return property("normalTexture", this->_normalTexture, o.normalTexture);
+    break;
+  case 14:
+    if (str == "emissiveFactor"sv)
+      return property(
+          "emissiveFactor",
+          this->_emissiveFactor,
+          o.emissiveFactor);
+    break;
+  case 15:
+    if (str == "emissiveTexture"sv)
+      return property(
+          "emissiveTexture",
+          this->_emissiveTexture,
+          o.emissiveTexture);
+    break;
+  case 16:
+    if (str == "occlusionTexture"sv)
+      return property(
+          "occlusionTexture",
+          this->_occlusionTexture,
+          o.occlusionTexture);
+    break;
+  case 20:
+    if (str == "pbrMetallicRoughness"sv)
+      return property(
+          "pbrMetallicRoughness",
+          this->_pbrMetallicRoughness,
+          o.pbrMetallicRoughness);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -4787,10 +5506,16 @@ CesiumJsonReader::IJsonHandler* MaterialOcclusionTextureInfoJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::MaterialOcclusionTextureInfo& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("strength"s == str)
-    return property("strength", this->_strength, o.strength);
+  switch (str.size()) {
+  case 8:
+    if (str == "strength"sv)
+      return property("strength", this->_strength, o.strength);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyTextureInfo(objectType, str, *this->_pObject);
 }
@@ -4876,10 +5601,16 @@ MaterialNormalTextureInfoJsonHandler::readObjectKeyMaterialNormalTextureInfo(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::MaterialNormalTextureInfo& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("scale"s == str)
-    return property("scale", this->_scale, o.scale);
+  switch (str.size()) {
+  case 5:
+    if (str == "scale"sv)
+      return property("scale", this->_scale, o.scale);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyTextureInfo(objectType, str, *this->_pObject);
 }
@@ -4971,30 +5702,53 @@ CesiumJsonReader::IJsonHandler* MaterialPBRMetallicRoughnessJsonHandler::
         const std::string& objectType,
         const std::string_view& str,
         CesiumGltf::MaterialPBRMetallicRoughness& o) {
-  using namespace std::string_literals;
-
-  if ("baseColorFactor"s == str)
-    return property(
-        "baseColorFactor",
-        this->_baseColorFactor,
-        o.baseColorFactor);
-  if ("baseColorTexture"s == str)
-    return property(
-        "baseColorTexture",
-        this->_baseColorTexture,
-        o.baseColorTexture);
-  if ("metallicFactor"s == str)
-    return property("metallicFactor", this->_metallicFactor, o.metallicFactor);
-  if ("roughnessFactor"s == str)
-    return property(
-        "roughnessFactor",
-        this->_roughnessFactor,
-        o.roughnessFactor);
-  if ("metallicRoughnessTexture"s == str)
-    return property(
-        "metallicRoughnessTexture",
-        this->_metallicRoughnessTexture,
-        o.metallicRoughnessTexture);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 14:
+    if (str == "metallicFactor"sv)
+      return property(
+          "metallicFactor",
+          this->_metallicFactor,
+          o.metallicFactor);
+    break;
+  case 15:
+    switch (str[0]) {
+    case 'b':
+      if (str == "baseColorFactor"sv)
+        return property(
+            "baseColorFactor",
+            this->_baseColorFactor,
+            o.baseColorFactor);
+      break;
+    case 'r':
+      if (str == "roughnessFactor"sv)
+        return property(
+            "roughnessFactor",
+            this->_roughnessFactor,
+            o.roughnessFactor);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 16:
+    if (str == "baseColorTexture"sv)
+      return property(
+          "baseColorTexture",
+          this->_baseColorTexture,
+          o.baseColorTexture);
+    break;
+  case 24:
+    if (str == "metallicRoughnessTexture"sv)
+      return property(
+          "metallicRoughnessTexture",
+          this->_metallicRoughnessTexture,
+          o.metallicRoughnessTexture);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -5081,14 +5835,24 @@ CesiumJsonReader::IJsonHandler* ImageJsonHandler::readObjectKeyImage(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Image& o) {
-  using namespace std::string_literals;
-
-  if ("uri"s == str)
-    return property("uri", this->_uri, o.uri);
-  if ("mimeType"s == str)
-    return property("mimeType", this->_mimeType, o.mimeType);
-  if ("bufferView"s == str)
-    return property("bufferView", this->_bufferView, o.bufferView);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    if (str == "uri"sv)
+      return property("uri", this->_uri, o.uri);
+    break;
+  case 8:
+    if (str == "mimeType"sv)
+      return property("mimeType", this->_mimeType, o.mimeType);
+    break;
+  case 10:
+    if (str == "bufferView"sv)
+      return property("bufferView", this->_bufferView, o.bufferView);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -5165,14 +5929,24 @@ CesiumJsonReader::IJsonHandler* CameraJsonHandler::readObjectKeyCamera(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Camera& o) {
-  using namespace std::string_literals;
-
-  if ("orthographic"s == str)
-    return property("orthographic", this->_orthographic, o.orthographic);
-  if ("perspective"s == str)
-    return property("perspective", this->_perspective, o.perspective);
-  if ("type"s == str)
-    return property("type", this->_type, o.type);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "type"sv)
+      return property("type", this->_type, o.type);
+    break;
+  case 11:
+    if (str == "perspective"sv)
+      return property("perspective", this->_perspective, o.perspective);
+    break;
+  case 12:
+    if (str == "orthographic"sv)
+      return property("orthographic", this->_orthographic, o.orthographic);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -5251,16 +6025,34 @@ CameraPerspectiveJsonHandler::readObjectKeyCameraPerspective(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::CameraPerspective& o) {
-  using namespace std::string_literals;
-
-  if ("aspectRatio"s == str)
-    return property("aspectRatio", this->_aspectRatio, o.aspectRatio);
-  if ("yfov"s == str)
-    return property("yfov", this->_yfov, o.yfov);
-  if ("zfar"s == str)
-    return property("zfar", this->_zfar, o.zfar);
-  if ("znear"s == str)
-    return property("znear", this->_znear, o.znear);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    switch (str[0]) {
+    case 'y':
+      if (str == "yfov"sv)
+        return property("yfov", this->_yfov, o.yfov);
+      break;
+    case 'z':
+      if (str == "zfar"sv)
+        return property("zfar", this->_zfar, o.zfar);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 5:
+    if (str == "znear"sv)
+      return property("znear", this->_znear, o.znear);
+    break;
+  case 11:
+    if (str == "aspectRatio"sv)
+      return property("aspectRatio", this->_aspectRatio, o.aspectRatio);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -5346,16 +6138,34 @@ CameraOrthographicJsonHandler::readObjectKeyCameraOrthographic(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::CameraOrthographic& o) {
-  using namespace std::string_literals;
-
-  if ("xmag"s == str)
-    return property("xmag", this->_xmag, o.xmag);
-  if ("ymag"s == str)
-    return property("ymag", this->_ymag, o.ymag);
-  if ("zfar"s == str)
-    return property("zfar", this->_zfar, o.zfar);
-  if ("znear"s == str)
-    return property("znear", this->_znear, o.znear);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    switch (str[0]) {
+    case 'x':
+      if (str == "xmag"sv)
+        return property("xmag", this->_xmag, o.xmag);
+      break;
+    case 'y':
+      if (str == "ymag"sv)
+        return property("ymag", this->_ymag, o.ymag);
+      break;
+    case 'z':
+      if (str == "zfar"sv)
+        return property("zfar", this->_zfar, o.zfar);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 5:
+    if (str == "znear"sv)
+      return property("znear", this->_znear, o.znear);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -5441,18 +6251,44 @@ CesiumJsonReader::IJsonHandler* BufferViewJsonHandler::readObjectKeyBufferView(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::BufferView& o) {
-  using namespace std::string_literals;
-
-  if ("buffer"s == str)
-    return property("buffer", this->_buffer, o.buffer);
-  if ("byteOffset"s == str)
-    return property("byteOffset", this->_byteOffset, o.byteOffset);
-  if ("byteLength"s == str)
-    return property("byteLength", this->_byteLength, o.byteLength);
-  if ("byteStride"s == str)
-    return property("byteStride", this->_byteStride, o.byteStride);
-  if ("target"s == str)
-    return property("target", this->_target, o.target);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 6:
+    switch (str[0]) {
+    case 'b':
+      if (str == "buffer"sv)
+        return property("buffer", this->_buffer, o.buffer);
+      break;
+    case 't':
+      if (str == "target"sv)
+        return property("target", this->_target, o.target);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 10:
+    switch (str[4]) {
+    case 'O':
+      if (str == "byteOffset"sv)
+        return property("byteOffset", this->_byteOffset, o.byteOffset);
+      break;
+    case 'L':
+      if (str == "byteLength"sv)
+        return property("byteLength", this->_byteLength, o.byteLength);
+      break;
+    case 'S':
+      if (str == "byteStride"sv)
+        return property("byteStride", this->_byteStride, o.byteStride);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -5532,12 +6368,20 @@ CesiumJsonReader::IJsonHandler* BufferJsonHandler::readObjectKeyBuffer(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Buffer& o) {
-  using namespace std::string_literals;
-
-  if ("uri"s == str)
-    return property("uri", this->_uri, o.uri);
-  if ("byteLength"s == str)
-    return property("byteLength", this->_byteLength, o.byteLength);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    if (str == "uri"sv)
+      return property("uri", this->_uri, o.uri);
+    break;
+  case 10:
+    if (str == "byteLength"sv)
+      return property("byteLength", this->_byteLength, o.byteLength);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -5615,16 +6459,34 @@ CesiumJsonReader::IJsonHandler* AssetJsonHandler::readObjectKeyAsset(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Asset& o) {
-  using namespace std::string_literals;
-
-  if ("copyright"s == str)
-    return property("copyright", this->_copyright, o.copyright);
-  if ("generator"s == str)
-    return property("generator", this->_generator, o.generator);
-  if ("version"s == str)
-    return property("version", this->_version, o.version);
-  if ("minVersion"s == str)
-    return property("minVersion", this->_minVersion, o.minVersion);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 7:
+    if (str == "version"sv)
+      return property("version", this->_version, o.version);
+    break;
+  case 9:
+    switch (str[0]) {
+    case 'c':
+      if (str == "copyright"sv)
+        return property("copyright", this->_copyright, o.copyright);
+      break;
+    case 'g':
+      if (str == "generator"sv)
+        return property("generator", this->_generator, o.generator);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 10:
+    if (str == "minVersion"sv)
+      return property("minVersion", this->_minVersion, o.minVersion);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -5700,12 +6562,26 @@ CesiumJsonReader::IJsonHandler* AnimationJsonHandler::readObjectKeyAnimation(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Animation& o) {
-  using namespace std::string_literals;
-
-  if ("channels"s == str)
-    return property("channels", this->_channels, o.channels);
-  if ("samplers"s == str)
-    return property("samplers", this->_samplers, o.samplers);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 8:
+    switch (str[0]) {
+    case 'c':
+      if (str == "channels"sv)
+        return property("channels", this->_channels, o.channels);
+      break;
+    case 's':
+      if (str == "samplers"sv)
+        return property("samplers", this->_samplers, o.samplers);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -5784,14 +6660,24 @@ AnimationSamplerJsonHandler::readObjectKeyAnimationSampler(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::AnimationSampler& o) {
-  using namespace std::string_literals;
-
-  if ("input"s == str)
-    return property("input", this->_input, o.input);
-  if ("interpolation"s == str)
-    return property("interpolation", this->_interpolation, o.interpolation);
-  if ("output"s == str)
-    return property("output", this->_output, o.output);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    if (str == "input"sv)
+      return property("input", this->_input, o.input);
+    break;
+  case 6:
+    if (str == "output"sv)
+      return property("output", this->_output, o.output);
+    break;
+  case 13:
+    if (str == "interpolation"sv)
+      return property("interpolation", this->_interpolation, o.interpolation);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -5874,12 +6760,20 @@ AnimationChannelJsonHandler::readObjectKeyAnimationChannel(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::AnimationChannel& o) {
-  using namespace std::string_literals;
-
-  if ("sampler"s == str)
-    return property("sampler", this->_sampler, o.sampler);
-  if ("target"s == str)
-    return property("target", this->_target, o.target);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 6:
+    if (str == "target"sv)
+      return property("target", this->_target, o.target);
+    break;
+  case 7:
+    if (str == "sampler"sv)
+      return property("sampler", this->_sampler, o.sampler);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -5962,12 +6856,26 @@ AnimationChannelTargetJsonHandler::readObjectKeyAnimationChannelTarget(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::AnimationChannelTarget& o) {
-  using namespace std::string_literals;
-
-  if ("node"s == str)
-    return property("node", this->_node, o.node);
-  if ("path"s == str)
-    return property("path", this->_path, o.path);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    switch (str[0]) {
+    case 'n':
+      if (str == "node"sv)
+        return property("node", this->_node, o.node);
+      break;
+    case 'p':
+      if (str == "path"sv)
+        return property("path", this->_path, o.path);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -6060,26 +6968,60 @@ CesiumJsonReader::IJsonHandler* AccessorJsonHandler::readObjectKeyAccessor(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::Accessor& o) {
-  using namespace std::string_literals;
-
-  if ("bufferView"s == str)
-    return property("bufferView", this->_bufferView, o.bufferView);
-  if ("byteOffset"s == str)
-    return property("byteOffset", this->_byteOffset, o.byteOffset);
-  if ("componentType"s == str)
-    return property("componentType", this->_componentType, o.componentType);
-  if ("normalized"s == str)
-    return property("normalized", this->_normalized, o.normalized);
-  if ("count"s == str)
-    return property("count", this->_count, o.count);
-  if ("type"s == str)
-    return property("type", this->_type, o.type);
-  if ("max"s == str)
-    return property("max", this->_max, o.max);
-  if ("min"s == str)
-    return property("min", this->_min, o.min);
-  if ("sparse"s == str)
-    return property("sparse", this->_sparse, o.sparse);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 3:
+    switch (str[1]) {
+    case 'a':
+      if (str == "max"sv)
+        return property("max", this->_max, o.max);
+      break;
+    case 'i':
+      if (str == "min"sv)
+        return property("min", this->_min, o.min);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 4:
+    if (str == "type"sv)
+      return property("type", this->_type, o.type);
+    break;
+  case 5:
+    if (str == "count"sv)
+      return property("count", this->_count, o.count);
+    break;
+  case 6:
+    if (str == "sparse"sv)
+      return property("sparse", this->_sparse, o.sparse);
+    break;
+  case 10:
+    switch (str[1]) {
+    case 'u':
+      if (str == "bufferView"sv)
+        return property("bufferView", this->_bufferView, o.bufferView);
+      break;
+    case 'y':
+      if (str == "byteOffset"sv)
+        return property("byteOffset", this->_byteOffset, o.byteOffset);
+      break;
+    case 'o':
+      if (str == "normalized"sv)
+        return property("normalized", this->_normalized, o.normalized);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 13:
+    if (str == "componentType"sv)
+      return property("componentType", this->_componentType, o.componentType);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyNamedObject(objectType, str, *this->_pObject);
 }
@@ -6157,14 +7099,24 @@ AccessorSparseJsonHandler::readObjectKeyAccessorSparse(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::AccessorSparse& o) {
-  using namespace std::string_literals;
-
-  if ("count"s == str)
-    return property("count", this->_count, o.count);
-  if ("indices"s == str)
-    return property("indices", this->_indices, o.indices);
-  if ("values"s == str)
-    return property("values", this->_values, o.values);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 5:
+    if (str == "count"sv)
+      return property("count", this->_count, o.count);
+    break;
+  case 6:
+    if (str == "values"sv)
+      return property("values", this->_values, o.values);
+    break;
+  case 7:
+    if (str == "indices"sv)
+      return property("indices", this->_indices, o.indices);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -6246,12 +7198,26 @@ AccessorSparseValuesJsonHandler::readObjectKeyAccessorSparseValues(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::AccessorSparseValues& o) {
-  using namespace std::string_literals;
-
-  if ("bufferView"s == str)
-    return property("bufferView", this->_bufferView, o.bufferView);
-  if ("byteOffset"s == str)
-    return property("byteOffset", this->_byteOffset, o.byteOffset);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 10:
+    switch (str[1]) {
+    case 'u':
+      if (str == "bufferView"sv)
+        return property("bufferView", this->_bufferView, o.bufferView);
+      break;
+    case 'y':
+      if (str == "byteOffset"sv)
+        return property("byteOffset", this->_byteOffset, o.byteOffset);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -6336,14 +7302,30 @@ AccessorSparseIndicesJsonHandler::readObjectKeyAccessorSparseIndices(
     const std::string& objectType,
     const std::string_view& str,
     CesiumGltf::AccessorSparseIndices& o) {
-  using namespace std::string_literals;
-
-  if ("bufferView"s == str)
-    return property("bufferView", this->_bufferView, o.bufferView);
-  if ("byteOffset"s == str)
-    return property("byteOffset", this->_byteOffset, o.byteOffset);
-  if ("componentType"s == str)
-    return property("componentType", this->_componentType, o.componentType);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 10:
+    switch (str[1]) {
+    case 'u':
+      if (str == "bufferView"sv)
+        return property("bufferView", this->_bufferView, o.bufferView);
+      break;
+    case 'y':
+      if (str == "byteOffset"sv)
+        return property("byteOffset", this->_byteOffset, o.byteOffset);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 13:
+    if (str == "componentType"sv)
+      return property("componentType", this->_componentType, o.componentType);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
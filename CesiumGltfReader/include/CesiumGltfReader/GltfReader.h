@@ -16,6 +16,7 @@
 
 #include <gsl/span>
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -104,6 +105,27 @@ struct CESIUMGLTFREADER_API GltfReaderOptions {
    */
   bool applyTextureTransform = true;
 
+  /**
+   * @brief The async system whose worker threads help to decode the
+   * `KHR_draco_mesh_compression` primitives and `EXT_meshopt_compression`
+   * buffer views of a single glTF in parallel.
+   *
+   * If this is not set, they are decoded one after another in the thread that
+   * reads the glTF. The decoded model is the same either way.
+   */
+  std::optional<CesiumAsync::AsyncSystem> decodeAsyncSystem;
+
+  /**
+   * @brief The maximum number of threads, including the thread that reads the
+   * glTF, that decode a single glTF at once when
+   * {@link decodeAsyncSystem} is set. This is further limited by
+   * {@link CesiumAsync::AsyncSystem::getMaximumWorkerConcurrency}.
+   *
+   * Many glTFs are usually read at the same time, so this is kept small by
+   * default to leave worker threads for the others.
+   */
+  size_t maximumDecodeConcurrency = 4;
+
   /**
    * @brief For each possible input transmission format, this struct names
    * the ideal target gpu-compressed pixel format to transcode to.
@@ -149,6 +171,50 @@ public:
       const gsl::span<const std::byte>& data,
       const GltfReaderOptions& options = GltfReaderOptions()) const;
 
+  /**
+   * @brief Reads a glTF or binary glTF (GLB) from a buffer that the reader may
+   * take ownership of.
+   *
+   * For a GLB whose binary chunk is at least half of its size, the storage of
+   * `data` is reused for the first buffer in the model, so the binary chunk is
+   * not copied into a newly-allocated buffer. This avoids holding two copies of
+   * large models in memory at once. The binary chunk is still moved to the
+   * start of the storage, and the buffer retains the capacity that the GLB
+   * header and JSON chunk used. Other GLBs, and JSON glTFs, are read exactly
+   * like the overload taking a span.
+   *
+   * @param data The buffer from which to read the glTF. After this method
+   * returns, it is in a valid but unspecified state.
+   * @param options Options for how to read the glTF.
+   * @return The result of reading the glTF.
+   */
+  GltfReaderResult readGltf(
+      std::vector<std::byte>&& data,
+      const GltfReaderOptions& options = GltfReaderOptions()) const;
+
+  /**
+   * @brief Reads a glTF or binary glTF (GLB) that is stored in part of a buffer
+   * that the reader may take ownership of.
+   *
+   * This is like the overload that takes the whole buffer, but reads the glTF
+   * from the `byteLength` bytes starting at `byteOffset`. It allows a glTF
+   * that is embedded in another format, such as a B3DM, to be read without
+   * first copying it out of that format. The rest of the buffer may be
+   * overwritten.
+   *
+   * @param data The buffer containing the glTF. After this method returns, it
+   * is in a valid but unspecified state.
+   * @param byteOffset The offset of the glTF within the buffer.
+   * @param byteLength The length of the glTF in bytes.
+   * @param options Options for how to read the glTF.
+   * @return The result of reading the glTF.
+   */
+  GltfReaderResult readGltf(
+      std::vector<std::byte>&& data,
+      size_t byteOffset,
+      size_t byteLength,
+      const GltfReaderOptions& options = GltfReaderOptions()) const;
+
   /**
    * @brief Reads a glTF or binary glTF file from a URL and resolves external
    * buffers and images.
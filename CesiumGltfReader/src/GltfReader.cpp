@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -93,9 +94,17 @@ std::string toMagicString(uint32_t i) {
   return stream.str();
 }
 
+/**
+ * @brief Reads a GLB.
+ *
+ * If `pOwnedData` is not nullptr, it must be the vector that contains `data`.
+ * When the binary chunk is most of that vector, its storage is then reused for
+ * the first buffer instead of copying the binary chunk into a new allocation.
+ */
 GltfReaderResult readBinaryGltf(
     const CesiumJsonReader::JsonReaderOptions& context,
-    const gsl::span<const std::byte>& data) {
+    const gsl::span<const std::byte>& data,
+    std::vector<std::byte>* pOwnedData = nullptr) {
   CESIUM_TRACE("CesiumGltfReader::GltfReader::readBinaryGltf");
 
   if (data.size() < sizeof(GlbHeader) + sizeof(ChunkHeader)) {
@@ -222,9 +231,29 @@ GltfReaderResult readBinaryGltf(
           std::to_string(binaryChunkSize) + ")");
     }
 
-    buffer.cesium.data = std::vector<std::byte>(
-        binaryChunk.begin(),
-        binaryChunk.begin() + buffer.byteLength);
+    // BufferCesium::data must start at the beginning of its allocation, so
+    // adopting the owned storage means moving the binary chunk down over
+    // everything before it, such as the GLB header and JSON chunk, which have
+    // already been parsed. The bytes are still moved, but within the same
+    // allocation, so the GLB and the buffer are never both in memory at once.
+    // The buffer keeps the capacity of the whole vector, which is only
+    // worthwhile when the binary chunk is most of it. Otherwise a new
+    // allocation of the right size wastes less memory.
+    const size_t bufferSize = size_t(buffer.byteLength);
+    if (pOwnedData && bufferSize >= pOwnedData->size() / 2) {
+      std::vector<std::byte>& ownedData = *pOwnedData;
+      const size_t binaryOffset = size_t(binaryChunk.data() - ownedData.data());
+      std::memmove(
+          ownedData.data(),
+          ownedData.data() + binaryOffset,
+          bufferSize);
+      ownedData.resize(bufferSize);
+      buffer.cesium.data = std::move(ownedData);
+    } else {
+      buffer.cesium.data = std::vector<std::byte>(
+          binaryChunk.begin(),
+          binaryChunk.begin() + buffer.byteLength);
+    }
   }
 
   return result;
@@ -322,8 +351,14 @@ void postprocess(GltfReaderResult& readGltf, const GltfReaderOptions& options) {
     }
   }
 
+  const CesiumAsync::AsyncSystem* pDecodeAsyncSystem =
+      options.decodeAsyncSystem ? &*options.decodeAsyncSystem : nullptr;
+
   if (options.decodeDraco) {
-    decodeDraco(readGltf);
+    decodeDraco(
+        readGltf,
+        pDecodeAsyncSystem,
+        options.maximumDecodeConcurrency);
   }
 
   if (options.decodeMeshOptData &&
@@ -331,7 +366,11 @@ void postprocess(GltfReaderResult& readGltf, const GltfReaderOptions& options) {
           model.extensionsUsed.begin(),
           model.extensionsUsed.end(),
           "EXT_meshopt_compression") != model.extensionsUsed.end()) {
-    decodeMeshOpt(model, readGltf);
+    decodeMeshOpt(
+        model,
+        readGltf,
+        pDecodeAsyncSystem,
+        options.maximumDecodeConcurrency);
   }
 
   if (options.dequantizeMeshData &&
@@ -380,6 +419,41 @@ GltfReaderResult GltfReader::readGltf(
   return result;
 }
 
+GltfReaderResult GltfReader::readGltf(
+    std::vector<std::byte>&& data,
+    const GltfReaderOptions& options) const {
+  const size_t byteLength = data.size();
+  return this->readGltf(std::move(data), 0, byteLength, options);
+}
+
+GltfReaderResult GltfReader::readGltf(
+    std::vector<std::byte>&& data,
+    size_t byteOffset,
+    size_t byteLength,
+    const GltfReaderOptions& options) const {
+  if (byteOffset > data.size() || byteLength > data.size() - byteOffset) {
+    return {
+        std::nullopt,
+        {"glTF extends past the end of the buffer, glTF end at " +
+         std::to_string(byteOffset + byteLength) + ", data size " +
+         std::to_string(data.size())},
+        {}};
+  }
+
+  const CesiumJsonReader::JsonReaderOptions& context = this->getExtensions();
+  const gsl::span<const std::byte> dataSpan =
+      gsl::span<const std::byte>(data).subspan(byteOffset, byteLength);
+  GltfReaderResult result = isBinaryGltf(dataSpan)
+                                ? readBinaryGltf(context, dataSpan, &data)
+                                : readJsonGltf(context, dataSpan);
+
+  if (result.model) {
+    postprocess(result, options);
+  }
+
+  return result;
+}
+
 CesiumAsync::Future<GltfReaderResult> GltfReader::loadGltf(
     const CesiumAsync::AsyncSystem& asyncSystem,
     const std::string& uri,
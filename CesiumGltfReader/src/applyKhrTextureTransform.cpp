@@ -18,13 +18,34 @@ bool transformBufferView(
     return false;
   }
 
-  glm::vec2* transformedUvs = reinterpret_cast<glm::vec2*>(data.data());
-
-  for (int i = 0; i < accessorView.size(); i++) {
-    const glm::vec2& uv = accessorView[i];
-    glm::dvec2 transformedUv = textureTransform.applyTransform(uv.x, uv.y);
-    *transformedUvs = glm::vec2(transformedUv.x, transformedUv.y);
-    transformedUvs++;
+  // This does the same arithmetic as KhrTextureTransform::applyTransform, but
+  // with the coefficients hoisted out of the loop so that it can be
+  // vectorized.
+  const glm::dvec2 scale = textureTransform.scale();
+  const double sin = textureTransform.rotationSineCosine().x;
+  const double cos = textureTransform.rotationSineCosine().y;
+  const glm::dvec2 offset = textureTransform.offset();
+  auto transform = [&](const float* pUv, float* pTransformedUv) {
+    const double u = pUv[0] * scale.x;
+    const double v = pUv[1] * scale.y;
+    pTransformedUv[0] = static_cast<float>(u * cos + v * sin + offset.x);
+    pTransformedUv[1] = static_cast<float>(v * cos - u * sin + offset.y);
+  };
+
+  float* pTransformedUvs = reinterpret_cast<float*>(data.data());
+  const size_t count = static_cast<size_t>(accessorView.size());
+  const int64_t stride = accessorView.stride();
+
+  if (stride == static_cast<int64_t>(sizeof(glm::vec2))) {
+    const float* pUvs = reinterpret_cast<const float*>(accessorView.data());
+    for (size_t i = 0; i < count; ++i) {
+      transform(pUvs + 2 * i, pTransformedUvs + 2 * i);
+    }
+  } else {
+    const std::byte* pUv = accessorView.data();
+    for (size_t i = 0; i < count; ++i, pUv += stride) {
+      transform(reinterpret_cast<const float*>(pUv), pTransformedUvs + 2 * i);
+    }
   }
 
   return true;
@@ -70,7 +91,10 @@ void processTextureInfo(
     return;
   }
 
-  std::vector<std::byte> data(static_cast<size_t>(pBufferView->byteLength));
+  // The transformed coordinates are tightly packed, whatever the stride of the
+  // original ones.
+  std::vector<std::byte> data(
+      static_cast<size_t>(accessorView.size()) * sizeof(glm::vec2));
   bool success = transformBufferView(accessorView, data, *pTextureTransform);
   if (!success) {
     return;
@@ -84,6 +108,7 @@ void processTextureInfo(
   bufferView.buffer = static_cast<int32_t>(model.buffers.size() - 1);
   bufferView.byteLength = buffer.byteLength;
   bufferView.byteOffset = 0;
+  bufferView.byteStride.reset();
 
   Accessor& accessor = model.accessors.emplace_back(*pAccessor);
   accessor.bufferView = static_cast<int32_t>(model.bufferViews.size() - 1);
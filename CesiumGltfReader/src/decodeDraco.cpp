@@ -2,12 +2,16 @@
 
 #include "CesiumGltfReader/GltfReader.h"
 
+#include <CesiumAsync/forEachInParallel.h>
 #include <CesiumGltf/ExtensionKhrDracoMeshCompression.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumUtility/Tracing.h>
 
 #include <cstddef>
+#include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -24,37 +28,35 @@
 namespace CesiumGltfReader {
 
 namespace {
+// Only reads the model, so that several primitives can be decoded at once.
 std::unique_ptr<draco::Mesh> decodeBufferViewToDracoMesh(
-    GltfReaderResult& readGltf,
-    CesiumGltf::MeshPrimitive& /* primitive */,
-    const CesiumGltf::ExtensionKhrDracoMeshCompression& draco) {
+    const CesiumGltf::Model& model,
+    const CesiumGltf::ExtensionKhrDracoMeshCompression& draco,
+    std::optional<std::string>& warning) {
   CESIUM_TRACE("CesiumGltfReader::decodeBufferViewToDracoMesh");
-  CesiumGltf::Model& model = readGltf.model.value();
 
-  CesiumGltf::BufferView* pBufferView =
+  const CesiumGltf::BufferView* pBufferView =
       CesiumGltf::Model::getSafe(&model.bufferViews, draco.bufferView);
   if (!pBufferView) {
-    readGltf.warnings.emplace_back("Draco bufferView index is invalid.");
+    warning = "Draco bufferView index is invalid.";
     return nullptr;
   }
 
   const CesiumGltf::BufferView& bufferView = *pBufferView;
 
-  CesiumGltf::Buffer* pBuffer =
+  const CesiumGltf::Buffer* pBuffer =
       CesiumGltf::Model::getSafe(&model.buffers, bufferView.buffer);
   if (!pBuffer) {
-    readGltf.warnings.emplace_back(
-        "Draco bufferView has an invalid buffer index.");
+    warning = "Draco bufferView has an invalid buffer index.";
     return nullptr;
   }
 
-  CesiumGltf::Buffer& buffer = *pBuffer;
+  const CesiumGltf::Buffer& buffer = *pBuffer;
 
   if (bufferView.byteOffset < 0 || bufferView.byteLength < 0 ||
       bufferView.byteOffset + bufferView.byteLength >
           static_cast<int64_t>(buffer.cesium.data.size())) {
-    readGltf.warnings.emplace_back(
-        "Draco bufferView extends beyond its buffer.");
+    warning = "Draco bufferView extends beyond its buffer.";
     return nullptr;
   }
 
@@ -66,13 +68,11 @@ std::unique_ptr<draco::Mesh> decodeBufferViewToDracoMesh(
   decodeBuffer.Init(reinterpret_cast<const char*>(data.data()), data.size());
 
   draco::Decoder decoder;
-  draco::Mesh mesh;
   draco::StatusOr<std::unique_ptr<draco::Mesh>> result =
       decoder.DecodeMeshFromBuffer(&decodeBuffer);
   if (!result.ok()) {
-    readGltf.warnings.emplace_back(
-        std::string("Draco decoding failed: ") +
-        result.status().error_msg_string());
+    warning = std::string("Draco decoding failed: ") +
+              result.status().error_msg_string();
     return nullptr;
   }
 
@@ -269,19 +269,14 @@ void copyDecodedAttribute(
   }
 }
 
-void decodePrimitive(
+void copyDecodedPrimitive(
     GltfReaderResult& readGltf,
     CesiumGltf::MeshPrimitive& primitive,
-    CesiumGltf::ExtensionKhrDracoMeshCompression& draco) {
-  CESIUM_TRACE("CesiumGltfReader::decodePrimitive");
+    const CesiumGltf::ExtensionKhrDracoMeshCompression& draco,
+    const std::unique_ptr<draco::Mesh>& pMesh) {
+  CESIUM_TRACE("CesiumGltfReader::copyDecodedPrimitive");
   CesiumGltf::Model& model = readGltf.model.value();
 
-  std::unique_ptr<draco::Mesh> pMesh =
-      decodeBufferViewToDracoMesh(readGltf, primitive, draco);
-  if (!pMesh) {
-    return;
-  }
-
   copyDecodedIndices(readGltf, primitive, pMesh.get());
 
   for (const std::pair<const std::string, int32_t>& attribute :
@@ -323,9 +318,19 @@ void decodePrimitive(
         pAttribute);
   }
 }
+
+struct DracoPrimitive {
+  CesiumGltf::MeshPrimitive* pPrimitive;
+  const CesiumGltf::ExtensionKhrDracoMeshCompression* pDraco;
+  std::unique_ptr<draco::Mesh> pMesh;
+  std::optional<std::string> warning;
+};
 } // namespace
 
-void decodeDraco(CesiumGltfReader::GltfReaderResult& readGltf) {
+void decodeDraco(
+    CesiumGltfReader::GltfReaderResult& readGltf,
+    const CesiumAsync::AsyncSystem* pAsyncSystem,
+    size_t maximumConcurrency) {
   CESIUM_TRACE("CesiumGltfReader::decodeDraco");
   if (!readGltf.model) {
     return;
@@ -333,21 +338,50 @@ void decodeDraco(CesiumGltfReader::GltfReaderResult& readGltf) {
 
   CesiumGltf::Model& model = readGltf.model.value();
 
+  std::vector<DracoPrimitive> dracoPrimitives;
   for (CesiumGltf::Mesh& mesh : model.meshes) {
     for (CesiumGltf::MeshPrimitive& primitive : mesh.primitives) {
-      CesiumGltf::ExtensionKhrDracoMeshCompression* pDraco =
+      const CesiumGltf::ExtensionKhrDracoMeshCompression* pDraco =
           primitive
               .getExtension<CesiumGltf::ExtensionKhrDracoMeshCompression>();
-      if (!pDraco) {
-        continue;
+      if (pDraco) {
+        dracoPrimitives.emplace_back(
+            DracoPrimitive{&primitive, pDraco, nullptr, std::nullopt});
       }
+    }
+  }
 
-      decodePrimitive(readGltf, primitive, *pDraco);
+  CesiumAsync::forEachInParallel(
+      pAsyncSystem,
+      dracoPrimitives.size(),
+      [&](size_t i) {
+        DracoPrimitive& dracoPrimitive = dracoPrimitives[i];
+        dracoPrimitive.pMesh = decodeBufferViewToDracoMesh(
+            model,
+            *dracoPrimitive.pDraco,
+            dracoPrimitive.warning);
+      },
+      maximumConcurrency);
+
+  // Copy the decoded meshes to the model in the order of the primitives, so
+  // that the new buffers and warnings are the same no matter how many threads
+  // decoded them.
+  for (DracoPrimitive& dracoPrimitive : dracoPrimitives) {
+    if (dracoPrimitive.warning) {
+      readGltf.warnings.emplace_back(std::move(*dracoPrimitive.warning));
+    }
 
-      // Remove the Draco extension as it no longer applies.
-      primitive.extensions.erase(
-          CesiumGltf::ExtensionKhrDracoMeshCompression::ExtensionName);
+    if (dracoPrimitive.pMesh) {
+      copyDecodedPrimitive(
+          readGltf,
+          *dracoPrimitive.pPrimitive,
+          *dracoPrimitive.pDraco,
+          dracoPrimitive.pMesh);
     }
+
+    // Remove the Draco extension as it no longer applies.
+    dracoPrimitive.pPrimitive->extensions.erase(
+        CesiumGltf::ExtensionKhrDracoMeshCompression::ExtensionName);
   }
 
   model.removeExtensionRequired(
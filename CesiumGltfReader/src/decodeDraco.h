@@ -1,7 +1,24 @@
 #pragma once
 
+#include <cstddef>
+
+namespace CesiumAsync {
+class AsyncSystem;
+}
+
 namespace CesiumGltfReader {
 struct GltfReaderResult;
 
-void decodeDraco(GltfReaderResult& readGltf);
+/**
+ * @brief Decodes the primitives in the model that are compressed according to
+ * the KHR_draco_mesh_compression extension.
+ *
+ * If an async system is given, up to `maximumConcurrency` primitives are
+ * decoded at once. The buffers and warnings are added to the model in the same
+ * order either way.
+ */
+void decodeDraco(
+    GltfReaderResult& readGltf,
+    const CesiumAsync::AsyncSystem* pAsyncSystem = nullptr,
+    size_t maximumConcurrency = 1);
 } // namespace CesiumGltfReader
@@ -1,5 +1,6 @@
 #include "decodeMeshOpt.h"
 
+#include <CesiumAsync/forEachInParallel.h>
 #include <CesiumGltf/ExtensionBufferViewExtMeshoptCompression.h>
 #include <CesiumGltfReader/GltfReader.h>
 
@@ -12,6 +13,10 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include <optional>
+#include <string>
+#include <vector>
+
 using namespace CesiumGltf;
 
 namespace CesiumGltfReader {
@@ -99,62 +104,104 @@ int decodeBufferView(
     }
   }
 }
+
+struct DecompressedBufferView {
+  std::vector<std::byte> data;
+  std::optional<std::string> warning;
+};
+
+// Only reads the model, so that several buffer views can be decompressed at
+// once.
+DecompressedBufferView decompressBufferView(
+    const Model& model,
+    const ExtensionBufferViewExtMeshoptCompression& meshOpt) {
+  DecompressedBufferView result;
+
+  const Buffer* pBuffer = model.getSafe(&model.buffers, meshOpt.buffer);
+  if (!pBuffer) {
+    result.warning = "The EXT_meshopt_compression extension has an invalid "
+                     "buffer index.";
+    return result;
+  }
+
+  if (meshOpt.byteOffset < 0 || meshOpt.byteLength < 0 ||
+      static_cast<size_t>(meshOpt.byteOffset + meshOpt.byteLength) >
+          pBuffer->cesium.data.size()) {
+    result.warning = "The EXT_meshopt_compression extension has a bufferView "
+                     "that extends beyond its buffer.";
+    return result;
+  }
+  int64_t byteLength = meshOpt.byteStride * meshOpt.count;
+  if (byteLength < 0) {
+    result.warning = "The EXT_meshopt_compression extension has a negative "
+                     "byte length.";
+    return result;
+  }
+
+  result.data.resize(static_cast<size_t>(byteLength));
+  if (decodeBufferView(
+          result.data.data(),
+          gsl::span<const std::byte>(
+              pBuffer->cesium.data.data() + meshOpt.byteOffset,
+              static_cast<size_t>(meshOpt.byteLength)),
+          meshOpt) != 0) {
+    result.data.clear();
+    result.warning = "The EXT_meshopt_compression extension has a corrupted "
+                     "or incompatible meshopt compression buffer.";
+    return result;
+  }
+  decodeFilter(result.data.data(), meshOpt);
+  return result;
+}
 } // namespace
 
-void decodeMeshOpt(Model& model, CesiumGltfReader::GltfReaderResult& readGltf) {
+void decodeMeshOpt(
+    Model& model,
+    CesiumGltfReader::GltfReaderResult& readGltf,
+    const CesiumAsync::AsyncSystem* pAsyncSystem,
+    size_t maximumConcurrency) {
+  std::vector<BufferView*> compressedBufferViews;
   for (BufferView& bufferView : model.bufferViews) {
-    const ExtensionBufferViewExtMeshoptCompression* pMeshOpt =
-        bufferView.getExtension<ExtensionBufferViewExtMeshoptCompression>();
-    if (pMeshOpt) {
-      const Buffer* pBuffer = model.getSafe(&model.buffers, pMeshOpt->buffer);
-      if (!pBuffer) {
-        readGltf.warnings.emplace_back(
-            "The EXT_meshopt_compression extension has an invalid buffer "
-            "index.");
-        continue;
-      }
-
-      if (pMeshOpt->byteOffset < 0 || pMeshOpt->byteLength < 0 ||
-          static_cast<size_t>(pMeshOpt->byteOffset + pMeshOpt->byteLength) >
-              pBuffer->cesium.data.size()) {
-        readGltf.warnings.emplace_back(
-            "The EXT_meshopt_compression extension has a bufferView that "
-            "extends beyond its buffer.");
-        continue;
-      }
-      int64_t byteLength = pMeshOpt->byteStride * pMeshOpt->count;
-      if (byteLength < 0) {
-        readGltf.warnings.emplace_back("The EXT_meshopt_compression extension "
-                                       "has a negative byte length.");
-        continue;
-      }
-
-      std::vector<std::byte> data;
-      data.resize(static_cast<size_t>(byteLength));
-      if (decodeBufferView(
-              data.data(),
-              gsl::span<const std::byte>(
-                  pBuffer->cesium.data.data() + pMeshOpt->byteOffset,
-                  static_cast<size_t>(pMeshOpt->byteLength)),
-              *pMeshOpt) != 0) {
-        readGltf.warnings.emplace_back(
-            "The EXT_meshopt_compression extension has a corrupted or "
-            "incompatible meshopt compression buffer.");
-        continue;
-      }
-      decodeFilter(data.data(), *pMeshOpt);
-      Buffer& buffer = model.buffers.emplace_back();
-      buffer.byteLength = byteLength;
-      buffer.cesium.data = std::move(data);
-
-      bufferView.buffer = static_cast<int32_t>(model.buffers.size() - 1);
-      bufferView.byteOffset = 0;
-      bufferView.byteLength = byteLength;
-      bufferView.extensions.erase(
-          ExtensionBufferViewExtMeshoptCompression::ExtensionName);
+    if (bufferView.hasExtension<ExtensionBufferViewExtMeshoptCompression>()) {
+      compressedBufferViews.emplace_back(&bufferView);
     }
   }
 
+  std::vector<DecompressedBufferView> decompressed(
+      compressedBufferViews.size());
+  CesiumAsync::forEachInParallel(
+      pAsyncSystem,
+      compressedBufferViews.size(),
+      [&](size_t i) {
+        decompressed[i] = decompressBufferView(
+            model,
+            *compressedBufferViews[i]
+                 ->getExtension<ExtensionBufferViewExtMeshoptCompression>());
+      },
+      maximumConcurrency);
+
+  // Add the new buffers and warnings in the order of the buffer views, so
+  // that the model is the same no matter how many threads decompressed it.
+  for (size_t i = 0; i < compressedBufferViews.size(); ++i) {
+    if (decompressed[i].warning) {
+      readGltf.warnings.emplace_back(std::move(*decompressed[i].warning));
+      continue;
+    }
+
+    const int64_t byteLength =
+        static_cast<int64_t>(decompressed[i].data.size());
+    Buffer& buffer = model.buffers.emplace_back();
+    buffer.byteLength = byteLength;
+    buffer.cesium.data = std::move(decompressed[i].data);
+
+    BufferView& bufferView = *compressedBufferViews[i];
+    bufferView.buffer = static_cast<int32_t>(model.buffers.size() - 1);
+    bufferView.byteOffset = 0;
+    bufferView.byteLength = byteLength;
+    bufferView.extensions.erase(
+        ExtensionBufferViewExtMeshoptCompression::ExtensionName);
+  }
+
   model.removeExtensionRequired(
       CesiumGltf::ExtensionBufferViewExtMeshoptCompression::ExtensionName);
 }
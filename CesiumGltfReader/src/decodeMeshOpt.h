@@ -1,5 +1,11 @@
 #pragma once
 
+#include <cstddef>
+
+namespace CesiumAsync {
+class AsyncSystem;
+}
+
 namespace CesiumGltf {
 struct Model;
 }
@@ -17,8 +23,14 @@ namespace CesiumGltfReader {
  * The decompressed buffer may be in a quantized format as specified by the
  * KHR_mesh_quantization extension, in which case the data will have to be
  * dequantized to get the original values.
+ *
+ * If an async system is given, up to `maximumConcurrency` buffer views are
+ * decompressed at once. The buffers and warnings are added to the model in the
+ * same order either way.
  **/
 void decodeMeshOpt(
     CesiumGltf::Model& model,
-    CesiumGltfReader::GltfReaderResult& readGltf);
+    CesiumGltfReader::GltfReaderResult& readGltf,
+    const CesiumAsync::AsyncSystem* pAsyncSystem = nullptr,
+    size_t maximumConcurrency = 1);
 } // namespace CesiumGltfReader
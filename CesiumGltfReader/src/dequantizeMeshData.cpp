@@ -2,6 +2,12 @@
 
 #include <CesiumGltfReader/GltfReader.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
 using namespace CesiumGltf;
 
 namespace CesiumGltfReader {
@@ -22,17 +28,43 @@ template <> float intToFloat(std::int16_t c) {
 
 template <> float intToFloat(std::uint16_t c) { return c / 65535.0f; }
 
+template <typename T, size_t N, typename Convert>
+void convertQuantized(
+    float* fPtr,
+    int64_t count,
+    const std::byte* bPtr,
+    int64_t stride,
+    Convert convert) {
+  const size_t elementCount = static_cast<size_t>(count);
+
+  if (stride == static_cast<int64_t>(N * sizeof(T))) {
+    // The elements are tightly packed, so convert all of their components in a
+    // single flat loop that the compiler can vectorize.
+    const T* pValues = reinterpret_cast<const T*>(bPtr);
+    const size_t valueCount = elementCount * N;
+    for (size_t i = 0; i < valueCount; ++i) {
+      fPtr[i] = convert(pValues[i]);
+    }
+    return;
+  }
+
+  for (size_t i = 0; i < elementCount; ++i, bPtr += stride) {
+    const T* pElement = reinterpret_cast<const T*>(bPtr);
+    for (size_t j = 0; j < N; ++j) {
+      *fPtr++ = convert(pElement[j]);
+    }
+  }
+}
+
 template <typename T, size_t N>
 void normalizeQuantized(
     float* fPtr,
     int64_t count,
     const std::byte* bPtr,
     int64_t stride) {
-  for (int i = 0; i < count; i++, bPtr += stride) {
-    for (unsigned int j = 0; j < N; j++) {
-      *fPtr++ = intToFloat<T>(reinterpret_cast<const T*>(bPtr)[j]);
-    }
-  }
+  convertQuantized<T, N>(fPtr, count, bPtr, stride, [](T t) {
+    return intToFloat<T>(t);
+  });
 }
 
 template <typename T, size_t N>
@@ -41,26 +73,42 @@ void castQuantizedToFloat(
     int64_t count,
     const std::byte* bPtr,
     int64_t stride) {
-  for (int i = 0; i < count; i++, bPtr += stride) {
-    for (unsigned int j = 0; j < N; j++) {
-      *fPtr++ = static_cast<float>(reinterpret_cast<const T*>(bPtr)[j]);
-    }
-  }
+  convertQuantized<T, N>(fPtr, count, bPtr, stride, [](T t) {
+    return static_cast<float>(t);
+  });
 }
 
-template <typename T, size_t N>
-void dequantizeAccessor(Model& model, Accessor& accessor) {
+/**
+ * @brief Gets the number of bytes needed for the floating-point version of a
+ * quantized accessor, or -1 if the accessor can't be dequantized.
+ */
+int64_t
+computeDequantizedByteLength(const Model& model, const Accessor& accessor) {
+  switch (accessor.componentType) {
+  case Accessor::ComponentType::BYTE:
+  case Accessor::ComponentType::UNSIGNED_BYTE:
+  case Accessor::ComponentType::SHORT:
+  case Accessor::ComponentType::UNSIGNED_SHORT:
+    break;
+  default:
+    return -1;
+  }
 
-  BufferView* pBufferView =
-      Model::getSafe(&model.bufferViews, accessor.bufferView);
+  const int64_t componentByteSize = accessor.computeByteSizeOfComponent();
+  const int64_t numberOfComponents = accessor.computeNumberOfComponents();
+  if (numberOfComponents < 2 || numberOfComponents > 4) {
+    return -1;
+  }
 
+  const BufferView* pBufferView =
+      Model::getSafe(&model.bufferViews, accessor.bufferView);
   if (!pBufferView) {
-    return;
+    return -1;
   }
 
-  Buffer* pBuffer = Model::getSafe(&model.buffers, pBufferView->buffer);
+  const Buffer* pBuffer = Model::getSafe(&model.buffers, pBufferView->buffer);
   if (!pBuffer) {
-    return;
+    return -1;
   }
 
   int64_t byteStride;
@@ -73,27 +121,51 @@ void dequantizeAccessor(Model& model, Accessor& accessor) {
   if (static_cast<size_t>(
           pBufferView->byteOffset + accessor.byteOffset +
           accessor.count * byteStride) > pBuffer->cesium.data.size() ||
-      static_cast<int64_t>(sizeof(T) * N) > byteStride) {
-    return;
+      componentByteSize * numberOfComponents > byteStride) {
+    return -1;
   }
 
-  int64_t byteLength = accessor.count * static_cast<int64_t>(N * sizeof(float));
-  if (byteLength < 0) {
-    return;
+  const int64_t byteLength = accessor.count * numberOfComponents *
+                             static_cast<int64_t>(sizeof(float));
+  return byteLength < 0 ? -1 : byteLength;
+}
+
+/**
+ * @brief Writes the floating-point version of a quantized accessor to the
+ * given part of a buffer, and points the accessor to it.
+ *
+ * The accessor must already have been checked with
+ * {@link computeDequantizedByteLength}.
+ */
+template <typename T, size_t N>
+void dequantizeAccessor(
+    Model& model,
+    Accessor& accessor,
+    int32_t bufferIndex,
+    int64_t byteOffset) {
+  const BufferView& sourceBufferView =
+      model.bufferViews[static_cast<size_t>(accessor.bufferView)];
+  const Buffer& sourceBuffer =
+      model.buffers[static_cast<size_t>(sourceBufferView.buffer)];
+
+  int64_t byteStride;
+  if (sourceBufferView.byteStride) {
+    byteStride = *sourceBufferView.byteStride;
+  } else {
+    byteStride = accessor.computeByteStride(model);
   }
 
-  std::vector<std::byte> data;
-  data.resize(static_cast<size_t>(byteLength));
+  const int64_t byteLength =
+      accessor.count * static_cast<int64_t>(N * sizeof(float));
 
-  const std::byte* bPtr = pBuffer->cesium.data.data() +
-                          pBufferView->byteOffset + accessor.byteOffset;
+  const std::byte* bPtr = sourceBuffer.cesium.data.data() +
+                          sourceBufferView.byteOffset + accessor.byteOffset;
+  float* fPtr = reinterpret_cast<float*>(
+      model.buffers[static_cast<size_t>(bufferIndex)].cesium.data.data() +
+      byteOffset);
 
   if (accessor.normalized) {
-    normalizeQuantized<T, N>(
-        reinterpret_cast<float*>(data.data()),
-        accessor.count,
-        bPtr,
-        byteStride);
+    normalizeQuantized<T, N>(fPtr, accessor.count, bPtr, byteStride);
     for (double& d : accessor.min) {
       d = intToFloat<T>(static_cast<T>(d));
     }
@@ -101,83 +173,136 @@ void dequantizeAccessor(Model& model, Accessor& accessor) {
       d = intToFloat<T>(static_cast<T>(d));
     }
   } else {
-    castQuantizedToFloat<T, N>(
-        reinterpret_cast<float*>(data.data()),
-        accessor.count,
-        bPtr,
-        byteStride);
+    castQuantizedToFloat<T, N>(fPtr, accessor.count, bPtr, byteStride);
   }
+
+  BufferView bufferView = sourceBufferView;
+  bufferView.byteOffset = byteOffset;
+  bufferView.byteStride = N * sizeof(float);
+  bufferView.byteLength = byteLength;
+  bufferView.buffer = bufferIndex;
+
   accessor.componentType = AccessorSpec::ComponentType::FLOAT;
   accessor.byteOffset = 0;
   accessor.bufferView = static_cast<int32_t>(model.bufferViews.size());
   accessor.normalized = false;
 
-  BufferView& bufferView = model.bufferViews.emplace_back(*pBufferView);
-  bufferView.byteOffset = 0;
-  bufferView.byteStride = N * sizeof(float);
-  bufferView.byteLength = byteLength;
-  bufferView.buffer = static_cast<int32_t>(model.buffers.size());
-
-  Buffer& buffer = model.buffers.emplace_back();
-  buffer.cesium.data = std::move(data);
-  buffer.byteLength = byteLength;
+  model.bufferViews.emplace_back(std::move(bufferView));
 }
 
-template <size_t N> void dequantizeAccessor(Model& model, Accessor& accessor) {
+template <size_t N>
+void dequantizeAccessor(
+    Model& model,
+    Accessor& accessor,
+    int32_t bufferIndex,
+    int64_t byteOffset) {
   switch (accessor.componentType) {
   case Accessor::ComponentType::BYTE:
-    dequantizeAccessor<std::int8_t, N>(model, accessor);
+    dequantizeAccessor<std::int8_t, N>(
+        model,
+        accessor,
+        bufferIndex,
+        byteOffset);
     break;
   case Accessor::ComponentType::UNSIGNED_BYTE:
-    dequantizeAccessor<std::uint8_t, N>(model, accessor);
+    dequantizeAccessor<std::uint8_t, N>(
+        model,
+        accessor,
+        bufferIndex,
+        byteOffset);
     break;
   case Accessor::ComponentType::SHORT:
-    dequantizeAccessor<std::int16_t, N>(model, accessor);
+    dequantizeAccessor<std::int16_t, N>(
+        model,
+        accessor,
+        bufferIndex,
+        byteOffset);
     break;
   case Accessor::ComponentType::UNSIGNED_SHORT:
-    dequantizeAccessor<std::uint16_t, N>(model, accessor);
+    dequantizeAccessor<std::uint16_t, N>(
+        model,
+        accessor,
+        bufferIndex,
+        byteOffset);
     break;
   }
 }
 
-void dequantizeAccessor(Model& model, Accessor& accessor) {
+void dequantizeAccessor(
+    Model& model,
+    Accessor& accessor,
+    int32_t bufferIndex,
+    int64_t byteOffset) {
   int8_t numberOfComponents = accessor.computeNumberOfComponents();
   switch (numberOfComponents) {
   case 2:
-    dequantizeAccessor<2>(model, accessor);
+    dequantizeAccessor<2>(model, accessor, bufferIndex, byteOffset);
     break;
   case 3:
-    dequantizeAccessor<3>(model, accessor);
+    dequantizeAccessor<3>(model, accessor, bufferIndex, byteOffset);
     break;
   case 4:
-    dequantizeAccessor<4>(model, accessor);
+    dequantizeAccessor<4>(model, accessor, bufferIndex, byteOffset);
     break;
   }
 }
+
+struct QuantizedAccessor {
+  int32_t accessor;
+  int64_t byteOffset;
+};
 } // namespace
 
 void dequantizeMeshData(Model& model) {
-  for (Mesh& mesh : model.meshes) {
-    for (MeshPrimitive& primitive : mesh.primitives) {
-      for (std::pair<const std::string, int32_t> attribute :
-           primitive.attributes) {
-        Accessor* pAccessor =
-            Model::getSafe(&model.accessors, attribute.second);
-        if (!pAccessor) {
+  // Find all of the accessors to dequantize first, so that their
+  // floating-point data can be written to a single new buffer.
+  std::vector<QuantizedAccessor> quantizedAccessors;
+  std::unordered_set<int32_t> visitedAccessors;
+  int64_t totalByteLength = 0;
+
+  for (const Mesh& mesh : model.meshes) {
+    for (const MeshPrimitive& primitive : mesh.primitives) {
+      for (const auto& [attributeName, accessorIndex] : primitive.attributes) {
+        if (attributeName != "POSITION" && attributeName != "NORMAL" &&
+            attributeName != "TANGENT" &&
+            attributeName.find("TEXCOORD") != 0) {
           continue;
         }
-        if (pAccessor->componentType == Accessor::ComponentType::FLOAT) {
+
+        const Accessor* pAccessor =
+            Model::getSafe(&model.accessors, accessorIndex);
+        if (!pAccessor || !visitedAccessors.insert(accessorIndex).second) {
           continue;
         }
-        const std::string& attributeName = attribute.first;
-        if (attributeName == "POSITION" || attributeName == "NORMAL" ||
-            attributeName == "TANGENT" || attributeName.find("TEXCOORD") == 0) {
-          dequantizeAccessor(model, *pAccessor);
+
+        const int64_t byteLength =
+            computeDequantizedByteLength(model, *pAccessor);
+        if (byteLength < 0) {
+          continue;
         }
+
+        quantizedAccessors.emplace_back(
+            QuantizedAccessor{accessorIndex, totalByteLength});
+        totalByteLength += byteLength;
       }
     }
   }
 
+  if (!quantizedAccessors.empty()) {
+    const int32_t bufferIndex = static_cast<int32_t>(model.buffers.size());
+    Buffer& buffer = model.buffers.emplace_back();
+    buffer.cesium.data.resize(static_cast<size_t>(totalByteLength));
+    buffer.byteLength = totalByteLength;
+
+    for (const QuantizedAccessor& quantizedAccessor : quantizedAccessors) {
+      dequantizeAccessor(
+          model,
+          model.accessors[static_cast<size_t>(quantizedAccessor.accessor)],
+          bufferIndex,
+          quantizedAccessor.byteOffset);
+    }
+  }
+
   model.removeExtensionRequired("KHR_mesh_quantization");
 }
 } // namespace CesiumGltfReader
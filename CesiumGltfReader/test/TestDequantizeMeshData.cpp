@@ -0,0 +1,276 @@
+#include "applyKhrTextureTransform.h"
+#include "dequantizeMeshData.h"
+
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/ExtensionKhrTextureTransform.h>
+#include <CesiumGltf/KhrTextureTransform.h>
+#include <CesiumGltf/Model.h>
+
+#include <catch2/catch.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace CesiumGltf;
+using namespace CesiumGltfReader;
+
+namespace {
+
+// Adds an accessor whose elements are `stride` bytes apart in a new buffer.
+template <typename T>
+int32_t addAccessor(
+    Model& model,
+    const std::vector<T>& values,
+    size_t numberOfComponents,
+    size_t stride,
+    const std::string& type,
+    int32_t componentType,
+    bool normalized) {
+  const size_t count = values.size() / numberOfComponents;
+
+  Buffer& buffer = model.buffers.emplace_back();
+  buffer.cesium.data.resize(count * stride);
+  buffer.byteLength = int64_t(buffer.cesium.data.size());
+  for (size_t i = 0; i < count; ++i) {
+    std::memcpy(
+        buffer.cesium.data.data() + i * stride,
+        values.data() + i * numberOfComponents,
+        numberOfComponents * sizeof(T));
+  }
+
+  BufferView& bufferView = model.bufferViews.emplace_back();
+  bufferView.buffer = int32_t(model.buffers.size() - 1);
+  bufferView.byteLength = buffer.byteLength;
+  if (stride != numberOfComponents * sizeof(T)) {
+    bufferView.byteStride = int64_t(stride);
+  }
+
+  Accessor& accessor = model.accessors.emplace_back();
+  accessor.bufferView = int32_t(model.bufferViews.size() - 1);
+  accessor.count = int64_t(count);
+  accessor.type = type;
+  accessor.componentType = componentType;
+  accessor.normalized = normalized;
+
+  return int32_t(model.accessors.size() - 1);
+}
+
+// Creates a model with the vertex attributes of a typical quantized
+// photogrammetry tile: unnormalized 16-bit positions, normalized 8-bit
+// normals, and normalized 16-bit texture coordinates with a texture transform.
+// When `packed` is false, every attribute is padded to four components.
+Model createQuantizedModel(size_t vertexCount, bool packed) {
+  std::vector<uint16_t> positions(vertexCount * 3);
+  std::vector<int8_t> normals(vertexCount * 3);
+  std::vector<uint16_t> texCoords(vertexCount * 2);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      positions[i * 3 + j] = uint16_t((i * 7919 + j * 104729) % 65536);
+      normals[i * 3 + j] = int8_t(int((i * 31 + j * 17) % 256) - 128);
+    }
+    texCoords[i * 2] = uint16_t((i * 6151) % 65536);
+    texCoords[i * 2 + 1] = uint16_t((i * 3079) % 65536);
+  }
+
+  Model model;
+  MeshPrimitive& primitive =
+      model.meshes.emplace_back().primitives.emplace_back();
+  primitive.attributes["POSITION"] = addAccessor(
+      model,
+      positions,
+      3,
+      packed ? 6U : 8U,
+      Accessor::Type::VEC3,
+      Accessor::ComponentType::UNSIGNED_SHORT,
+      false);
+  primitive.attributes["NORMAL"] = addAccessor(
+      model,
+      normals,
+      3,
+      packed ? 3U : 4U,
+      Accessor::Type::VEC3,
+      Accessor::ComponentType::BYTE,
+      true);
+  primitive.attributes["TEXCOORD_0"] = addAccessor(
+      model,
+      texCoords,
+      2,
+      packed ? 4U : 8U,
+      Accessor::Type::VEC2,
+      Accessor::ComponentType::UNSIGNED_SHORT,
+      true);
+
+  primitive.material = 0;
+  Material& material = model.materials.emplace_back();
+  TextureInfo& textureInfo =
+      material.pbrMetallicRoughness.emplace().baseColorTexture.emplace();
+  ExtensionKhrTextureTransform& textureTransform =
+      textureInfo.addExtension<ExtensionKhrTextureTransform>();
+  textureTransform.offset = {0.25, 0.5};
+  textureTransform.rotation = 0.3;
+  textureTransform.scale = {0.5, 2.0};
+
+  model.addExtensionRequired("KHR_mesh_quantization");
+  model.addExtensionRequired(ExtensionKhrTextureTransform::ExtensionName);
+  return model;
+}
+
+template <typename T>
+std::vector<T> readAttribute(const Model& model, const std::string& name) {
+  const MeshPrimitive& primitive = model.meshes[0].primitives[0];
+  AccessorView<T> view(model, primitive.attributes.at(name));
+  REQUIRE(view.status() == AccessorViewStatus::Valid);
+
+  std::vector<T> result(size_t(view.size()));
+  for (int64_t i = 0; i < view.size(); ++i) {
+    result[size_t(i)] = view[i];
+  }
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("dequantizeMeshData") {
+  const size_t vertexCount = 1000;
+  Model packed = createQuantizedModel(vertexCount, true);
+  Model padded = createQuantizedModel(vertexCount, false);
+  const size_t buffersBefore = packed.buffers.size();
+
+  dequantizeMeshData(packed);
+  dequantizeMeshData(padded);
+
+  SECTION("converts the attributes to floats") {
+    const std::vector<glm::vec3> positions =
+        readAttribute<glm::vec3>(packed, "POSITION");
+    CHECK(positions[1] == glm::vec3(7919.0f, 47112.0f, 20769.0f));
+
+    const std::vector<glm::vec3> normals =
+        readAttribute<glm::vec3>(packed, "NORMAL");
+    CHECK(normals[0].x == -1.0f);
+    CHECK(normals[0].y == -111.0f / 127.0f);
+
+    const std::vector<glm::vec2> texCoords =
+        readAttribute<glm::vec2>(packed, "TEXCOORD_0");
+    CHECK(texCoords[0] == glm::vec2(0.0f));
+    CHECK(texCoords[1].x == 6151.0f / 65535.0f);
+
+    CHECK(!packed.isExtensionRequired("KHR_mesh_quantization"));
+  }
+
+  SECTION("packed and padded attributes give the same result") {
+    CHECK(
+        readAttribute<glm::vec3>(packed, "POSITION") ==
+        readAttribute<glm::vec3>(padded, "POSITION"));
+    CHECK(
+        readAttribute<glm::vec3>(packed, "NORMAL") ==
+        readAttribute<glm::vec3>(padded, "NORMAL"));
+    CHECK(
+        readAttribute<glm::vec2>(packed, "TEXCOORD_0") ==
+        readAttribute<glm::vec2>(padded, "TEXCOORD_0"));
+  }
+
+  SECTION("all of the attributes share a single new buffer") {
+    REQUIRE(packed.buffers.size() == buffersBefore + 1);
+    for (const auto& [name, accessorIndex] :
+         packed.meshes[0].primitives[0].attributes) {
+      const Accessor& accessor = packed.accessors[size_t(accessorIndex)];
+      CHECK(accessor.componentType == Accessor::ComponentType::FLOAT);
+      CHECK(!accessor.normalized);
+      const BufferView& bufferView =
+          packed.bufferViews[size_t(accessor.bufferView)];
+      CHECK(bufferView.buffer == int32_t(buffersBefore));
+      CHECK(bufferView.byteOffset % 4 == 0);
+    }
+  }
+
+  SECTION("an accessor used by several primitives is dequantized once") {
+    Model model = createQuantizedModel(10, true);
+    model.meshes[0].primitives.emplace_back(model.meshes[0].primitives[0]);
+    const size_t bufferViewsBefore = model.bufferViews.size();
+    dequantizeMeshData(model);
+    CHECK(model.bufferViews.size() == bufferViewsBefore + 3);
+  }
+}
+
+TEST_CASE("applyKhrTextureTransform") {
+  const size_t vertexCount = 1000;
+  Model packed = createQuantizedModel(vertexCount, true);
+  Model padded = createQuantizedModel(vertexCount, false);
+  dequantizeMeshData(packed);
+  dequantizeMeshData(padded);
+
+  // Pad the dequantized texture coordinates, too.
+  {
+    const std::vector<glm::vec2> texCoords =
+        readAttribute<glm::vec2>(padded, "TEXCOORD_0");
+    std::vector<float> values(texCoords.size() * 2);
+    std::memcpy(
+        values.data(),
+        texCoords.data(),
+        values.size() * sizeof(float));
+    padded.meshes[0].primitives[0].attributes["TEXCOORD_0"] = addAccessor(
+        padded,
+        values,
+        2,
+        12,
+        Accessor::Type::VEC2,
+        Accessor::ComponentType::FLOAT,
+        false);
+  }
+
+  const std::vector<glm::vec2> original =
+      readAttribute<glm::vec2>(packed, "TEXCOORD_0");
+  applyKhrTextureTransform(packed);
+  applyKhrTextureTransform(padded);
+
+  const std::vector<glm::vec2> transformed =
+      readAttribute<glm::vec2>(packed, "TEXCOORD_0");
+  CHECK(readAttribute<glm::vec2>(padded, "TEXCOORD_0") == transformed);
+
+  KhrTextureTransform textureTransform(
+      *packed.materials[0]
+           .pbrMetallicRoughness->baseColorTexture
+           ->getExtension<ExtensionKhrTextureTransform>());
+  REQUIRE(textureTransform.status() == KhrTextureTransformStatus::Valid);
+
+  REQUIRE(transformed.size() == original.size());
+  for (size_t i = 0; i < original.size(); ++i) {
+    const glm::dvec2 expected =
+        textureTransform.applyTransform(original[i].x, original[i].y);
+    CHECK(transformed[i].x == Approx(expected.x).margin(1e-6));
+    CHECK(transformed[i].y == Approx(expected.y).margin(1e-6));
+  }
+}
+
+TEST_CASE(
+    "Benchmark dequantizing a quantized photogrammetry tile",
+    "[.][benchmark]") {
+  const size_t vertexCount = 65536;
+  const std::string suffix =
+      " with " + std::to_string(vertexCount) + " vertices";
+
+  for (const bool packed : {true, false}) {
+    const Model model = createQuantizedModel(vertexCount, packed);
+    const std::string layout = packed ? " packed" : " padded";
+
+    BENCHMARK("Dequantize" + layout + " attributes" + suffix) {
+      Model copy = model;
+      dequantizeMeshData(copy);
+      return copy.buffers.size();
+    };
+
+    BENCHMARK(
+        "Dequantize and transform" + layout + " attributes" + suffix) {
+      Model copy = model;
+      dequantizeMeshData(copy);
+      applyKhrTextureTransform(copy);
+      return copy.buffers.size();
+    };
+  }
+}
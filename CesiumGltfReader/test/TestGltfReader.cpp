@@ -4,9 +4,11 @@
 #include <CesiumGltf/AccessorView.h>
 #include <CesiumGltf/ExtensionBufferViewExtMeshoptCompression.h>
 #include <CesiumGltf/ExtensionCesiumRTC.h>
+#include <CesiumGltf/ExtensionExtMeshGpuInstancing.h>
 #include <CesiumGltf/ExtensionKhrDracoMeshCompression.h>
 #include <CesiumNativeTests/SimpleAssetAccessor.h>
 #include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumNativeTests/ThreadTaskProcessor.h>
 #include <CesiumNativeTests/readFile.h>
 #include <CesiumNativeTests/waitForFuture.h>
 #include <CesiumUtility/Math.h>
@@ -19,7 +21,9 @@
 #include <filesystem>
 #include <fstream>
 #include <limits>
+#include <optional>
 #include <string>
+#include <vector>
 
 using namespace CesiumAsync;
 using namespace CesiumGltf;
@@ -167,6 +171,50 @@ bool epsilonCompare(const T& v1, const T& v2, double epsilon) {
   }
   return true;
 }
+
+void checkSameDecodedModel(
+    const GltfReaderResult& expected,
+    const GltfReaderResult& actual) {
+  REQUIRE(expected.model);
+  REQUIRE(actual.model);
+  CHECK(actual.errors == expected.errors);
+  CHECK(actual.warnings == expected.warnings);
+
+  const Model& expectedModel = *expected.model;
+  const Model& actualModel = *actual.model;
+
+  REQUIRE(actualModel.buffers.size() == expectedModel.buffers.size());
+  for (size_t i = 0; i < expectedModel.buffers.size(); ++i) {
+    CHECK(
+        actualModel.buffers[i].byteLength ==
+        expectedModel.buffers[i].byteLength);
+    CHECK(
+        actualModel.buffers[i].cesium.data ==
+        expectedModel.buffers[i].cesium.data);
+  }
+
+  REQUIRE(actualModel.bufferViews.size() == expectedModel.bufferViews.size());
+  for (size_t i = 0; i < expectedModel.bufferViews.size(); ++i) {
+    const BufferView& expectedBufferView = expectedModel.bufferViews[i];
+    const BufferView& actualBufferView = actualModel.bufferViews[i];
+    CHECK(actualBufferView.buffer == expectedBufferView.buffer);
+    CHECK(actualBufferView.byteOffset == expectedBufferView.byteOffset);
+    CHECK(actualBufferView.byteLength == expectedBufferView.byteLength);
+    CHECK(actualBufferView.byteStride == expectedBufferView.byteStride);
+    CHECK(
+        actualBufferView.extensions.size() ==
+        expectedBufferView.extensions.size());
+  }
+
+  REQUIRE(actualModel.accessors.size() == expectedModel.accessors.size());
+  for (size_t i = 0; i < expectedModel.accessors.size(); ++i) {
+    const Accessor& expectedAccessor = expectedModel.accessors[i];
+    const Accessor& actualAccessor = actualModel.accessors[i];
+    CHECK(actualAccessor.bufferView == expectedAccessor.bufferView);
+    CHECK(actualAccessor.count == expectedAccessor.count);
+    CHECK(actualAccessor.componentType == expectedAccessor.componentType);
+  }
+}
 } // namespace
 
 TEST_CASE("Can decompress meshes using EXT_meshopt_compression") {
@@ -252,6 +300,167 @@ TEST_CASE("Read TriangleWithPaddingInGlbBin") {
   REQUIRE(result.warnings.size() == 1);
 }
 
+namespace {
+
+// Creates a GLB with an empty scene and a single buffer of the given size in
+// its binary chunk.
+std::vector<std::byte> createGlbWithBuffer(uint32_t bufferSize) {
+  std::string json = R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":)" +
+                     std::to_string(bufferSize) + "}]}";
+  json.resize((json.size() + 3) & ~size_t(3), ' ');
+
+  const uint32_t jsonSize = static_cast<uint32_t>(json.size());
+  const uint32_t binarySize = (bufferSize + 3U) & ~3U;
+  const uint32_t header[] = {
+      0x46546C67,
+      2,
+      12 + 8 + jsonSize + 8 + binarySize,
+      jsonSize,
+      0x4E4F534A};
+  const uint32_t binaryHeader[] = {binarySize, 0x004E4942};
+
+  std::vector<std::byte> glb;
+  glb.reserve(sizeof(header) + json.size() + sizeof(binaryHeader) + binarySize);
+
+  const std::byte* pHeader = reinterpret_cast<const std::byte*>(header);
+  glb.insert(glb.end(), pHeader, pHeader + sizeof(header));
+
+  const std::byte* pJson = reinterpret_cast<const std::byte*>(json.data());
+  glb.insert(glb.end(), pJson, pJson + json.size());
+
+  const std::byte* pBinaryHeader =
+      reinterpret_cast<const std::byte*>(binaryHeader);
+  glb.insert(glb.end(), pBinaryHeader, pBinaryHeader + sizeof(binaryHeader));
+
+  for (uint32_t i = 0; i < binarySize; ++i) {
+    glb.emplace_back(std::byte(i & 0xFF));
+  }
+
+  return glb;
+}
+
+} // namespace
+
+TEST_CASE("GltfReader::readGltf adopts the binary chunk of a GLB it owns") {
+  GltfReader reader;
+
+  SECTION("with a generated GLB") {
+    std::vector<std::byte> data = createGlbWithBuffer(1001);
+    const GltfReaderResult copied = reader.readGltf(data);
+    REQUIRE(copied.model);
+
+    const std::byte* pOriginal = data.data();
+    const GltfReaderResult adopted = reader.readGltf(std::move(data));
+    REQUIRE(adopted.model);
+    CHECK(adopted.errors.empty());
+    CHECK(adopted.warnings.empty());
+
+    REQUIRE(adopted.model->buffers.size() == 1);
+    const std::vector<std::byte>& bufferData =
+        adopted.model->buffers[0].cesium.data;
+    CHECK(bufferData.data() == pOriginal);
+    CHECK(bufferData.size() == 1001);
+    CHECK(bufferData == copied.model->buffers[0].cesium.data);
+  }
+
+  SECTION("with a GLB that is mostly JSON") {
+    std::vector<std::byte> data = createGlbWithBuffer(4);
+    const std::byte* pOriginal = data.data();
+    const GltfReaderResult adopted = reader.readGltf(std::move(data));
+    REQUIRE(adopted.model);
+    CHECK(adopted.errors.empty());
+
+    // Keeping the capacity of the whole GLB for a tiny buffer would waste more
+    // memory than a new allocation of the right size.
+    const std::vector<std::byte>& bufferData =
+        adopted.model->buffers[0].cesium.data;
+    CHECK(bufferData.data() != pOriginal);
+    CHECK(bufferData.size() == 4);
+    CHECK(bufferData.capacity() == 4);
+  }
+
+  SECTION("with a GLB that has padding in its binary chunk") {
+    std::filesystem::path glbFile = CesiumGltfReader_TEST_DATA_DIR;
+    glbFile /= "TriangleWithPaddingInGlbBin/TriangleWithPaddingInGlbBin.glb";
+    std::vector<std::byte> data = readFile(glbFile);
+    const GltfReaderResult copied = reader.readGltf(data);
+    const GltfReaderResult adopted = reader.readGltf(std::move(data));
+    REQUIRE(copied.model);
+    REQUIRE(adopted.model);
+    CHECK(adopted.warnings.size() == 1);
+
+    const Buffer& buffer = adopted.model->buffers[0];
+    CHECK(int64_t(buffer.cesium.data.size()) == buffer.byteLength);
+    CHECK(buffer.cesium.data == copied.model->buffers[0].cesium.data);
+
+    AccessorView<glm::vec3> copiedPosition(*copied.model, 0);
+    AccessorView<glm::vec3> adoptedPosition(*adopted.model, 0);
+    REQUIRE(adoptedPosition.status() == AccessorViewStatus::Valid);
+    REQUIRE(adoptedPosition.size() == copiedPosition.size());
+    for (int64_t i = 0; i < adoptedPosition.size(); ++i) {
+      CHECK(adoptedPosition[i] == copiedPosition[i]);
+    }
+  }
+
+  SECTION("with a JSON glTF") {
+    std::filesystem::path gltfFile = CesiumGltfReader_TEST_DATA_DIR;
+    gltfFile /=
+        "TriangleWithoutIndices/glTF-Embedded/TriangleWithoutIndices.gltf";
+    GltfReaderResult result = reader.readGltf(readFile(gltfFile));
+    REQUIRE(result.model);
+    CHECK(result.errors.empty());
+    CHECK(result.model->buffers.size() == 1);
+  }
+}
+
+TEST_CASE("Benchmark reading a large GLB", "[.][benchmark]") {
+  const uint32_t bufferSize = 32 * 1024 * 1024;
+  const std::vector<std::byte> glb = createGlbWithBuffer(bufferSize);
+  GltfReader reader;
+
+  // Both ways of reading copy every byte of the binary chunk. Reading from a
+  // span copies them into a new allocation, so the GLB and the buffer are both
+  // in memory at once. Reading from an owned vector moves them within the
+  // GLB's allocation, and the buffer retains the GLB's capacity.
+  auto report = [](const char* name,
+                   const GltfReaderResult& result,
+                   const std::byte* pOriginal) {
+    REQUIRE(result.model);
+    const std::vector<std::byte>& bufferData =
+        result.model->buffers[0].cesium.data;
+    const bool adopted = bufferData.data() == pOriginal;
+    WARN(
+        "Reading from " << name << ": "
+                        << (adopted ? size_t(0) : bufferData.capacity())
+                        << " bytes allocated, " << bufferData.size()
+                        << " bytes copied or moved, "
+                        << bufferData.capacity() - bufferData.size()
+                        << " bytes of unused capacity retained per tile");
+  };
+
+  {
+    std::vector<std::byte> copy = glb;
+    const std::byte* pCopy = copy.data();
+    report("a span", reader.readGltf(copy), pCopy);
+    report("an owned vector", reader.readGltf(std::move(copy)), pCopy);
+  }
+
+  BENCHMARK_ADVANCED("readGltf from a span")
+  (Catch::Benchmark::Chronometer meter) {
+    meter.measure([&reader, &glb]() { return reader.readGltf(glb); });
+  };
+
+  BENCHMARK_ADVANCED("readGltf from an owned vector")
+  (Catch::Benchmark::Chronometer meter) {
+    std::vector<std::vector<std::byte>> copies(
+        static_cast<size_t>(meter.runs()),
+        glb);
+    meter.measure([&reader, &copies](int i) {
+      return reader.readGltf(std::move(copies[static_cast<size_t>(i)]));
+    });
+  };
+}
+
 TEST_CASE("Nested extras deserializes properly") {
   const std::string s = R"(
     {
@@ -293,6 +502,60 @@ TEST_CASE("Nested extras deserializes properly") {
   CHECK(array[4].getSafeNumber<std::int32_t>() == 5);
 }
 
+TEST_CASE("Nested arrays in extras deserialize properly") {
+  const std::string s = R"(
+    {
+        "asset" : {
+            "version" : "1.1"
+        },
+        "extras": {
+            "empty": [],
+            "nested": [[1, 2], [], [[3]], {"a": [4, {"b": [5, 6]}]}, "seven"],
+            "after": 8
+        }
+    }
+  )";
+
+  GltfReader reader;
+  GltfReaderResult result = reader.readGltf(
+      gsl::span(reinterpret_cast<const std::byte*>(s.c_str()), s.size()));
+
+  REQUIRE(result.errors.empty());
+  REQUIRE(result.model.has_value());
+
+  const JsonValue::Object& extras = result.model->extras;
+  REQUIRE(extras.size() == 3);
+  CHECK(extras.at("empty").getArray().empty());
+  CHECK(extras.at("after").getSafeNumber<int64_t>() == 8);
+
+  const JsonValue::Array& nested = extras.at("nested").getArray();
+  REQUIRE(nested.size() == 5);
+  // Arrays are allocated at their final size.
+  CHECK(nested.capacity() == nested.size());
+
+  const JsonValue::Array& first = nested[0].getArray();
+  REQUIRE(first.size() == 2);
+  CHECK(first[0].getSafeNumber<int64_t>() == 1);
+  CHECK(first[1].getSafeNumber<int64_t>() == 2);
+
+  CHECK(nested[1].getArray().empty());
+
+  const JsonValue::Array& third = nested[2].getArray();
+  REQUIRE(third.size() == 1);
+  REQUIRE(third[0].getArray().size() == 1);
+  CHECK(third[0].getArray()[0].getSafeNumber<int64_t>() == 3);
+
+  const JsonValue::Array& a = nested[3].getObject().at("a").getArray();
+  REQUIRE(a.size() == 2);
+  CHECK(a[0].getSafeNumber<int64_t>() == 4);
+  const JsonValue::Array& b = a[1].getObject().at("b").getArray();
+  REQUIRE(b.size() == 2);
+  CHECK(b[0].getSafeNumber<int64_t>() == 5);
+  CHECK(b[1].getSafeNumber<int64_t>() == 6);
+
+  CHECK(nested[4].getString() == "seven");
+}
+
 TEST_CASE("Can deserialize KHR_draco_mesh_compression") {
   const std::string s = R"(
     {
@@ -753,6 +1016,53 @@ TEST_CASE("GltfReader::loadGltf") {
   }
 }
 
+TEST_CASE("Decoding a glTF in parallel gives the same model as serially") {
+  AsyncSystem decodeAsyncSystem{std::make_shared<ThreadTaskProcessor>()};
+  GltfReaderOptions parallelOptions;
+  parallelOptions.decodeAsyncSystem = decodeAsyncSystem;
+
+  SECTION("with EXT_meshopt_compression") {
+    const std::vector<std::byte> data = readFile(
+        CesiumGltfReader_TEST_DATA_DIR +
+        std::string("/DucksMeshopt/Duck-vp-12-vt-12-vn-12.glb"));
+
+    GltfReader reader;
+    GltfReaderResult serial = reader.readGltf(data);
+    for (size_t concurrency : {size_t(2), size_t(16)}) {
+      parallelOptions.maximumDecodeConcurrency = concurrency;
+      GltfReaderResult parallel = reader.readGltf(data, parallelOptions);
+      checkSameDecodedModel(serial, parallel);
+    }
+  }
+
+  SECTION("with KHR_draco_mesh_compression") {
+    std::filesystem::path dataDir(CesiumGltfReader_TEST_DATA_DIR);
+    dataDir /= "DracoCompressed";
+
+    // Read the glTF without decoding it, and then add its external buffer.
+    GltfReaderOptions serialOptions;
+    serialOptions.decodeDraco = false;
+    GltfReader reader;
+    GltfReaderResult compressed = reader.readGltf(
+        readFile(dataDir / "CesiumMilkTruck.gltf"),
+        serialOptions);
+    REQUIRE(compressed.model);
+    REQUIRE(compressed.model->buffers.size() == 1);
+    compressed.model->buffers[0].cesium.data = readFile(dataDir / "0.bin");
+
+    serialOptions.decodeDraco = true;
+    GltfReaderResult serial = compressed;
+    reader.postprocessGltf(serial, serialOptions);
+    CHECK(
+        serial.model->bufferViews.size() >
+        compressed.model->bufferViews.size());
+
+    GltfReaderResult parallel = compressed;
+    reader.postprocessGltf(parallel, parallelOptions);
+    checkSameDecodedModel(serial, parallel);
+  }
+}
+
 TEST_CASE("GltfReader::postprocessGltf") {
   GltfReaderOptions options;
   GltfReader reader;
@@ -789,3 +1099,252 @@ TEST_CASE("GltfReader::postprocessGltf") {
     CHECK(s == "test");
   }
 }
+
+namespace {
+
+// Creates the JSON of a glTF with the given number of nodes, each with its own
+// mesh, material, accessor, and buffer view.
+std::string createLargeGltfJson(size_t count) {
+  std::string accessors;
+  std::string bufferViews;
+  std::string meshes;
+  std::string materials;
+  std::string nodes;
+  for (size_t i = 0; i < count; ++i) {
+    const std::string separator = i == 0 ? "" : ",";
+    const std::string index = std::to_string(i);
+    accessors += separator + R"({"bufferView":)" + index +
+                 R"(,"byteOffset":0,"componentType":5126,"count":24,)" +
+                 R"("type":"VEC3","normalized":false,"max":[1,1,1],)" +
+                 R"("min":[-1,-1,-1],"name":"accessor)" + index + R"("})";
+    bufferViews += separator + R"({"buffer":0,"byteOffset":)" +
+                   std::to_string(i * 288) +
+                   R"(,"byteLength":288,"byteStride":12,"target":34962})";
+    meshes += separator + R"({"primitives":[{"attributes":{"POSITION":)" +
+              index + R"(,"NORMAL":)" + index + R"(},"material":)" + index +
+              R"(,"mode":4}],"name":"mesh)" + index + R"("})";
+    materials +=
+        separator +
+        R"({"pbrMetallicRoughness":{"baseColorFactor":[1,1,1,1],)" +
+        R"("metallicFactor":0,"roughnessFactor":1},"doubleSided":true,)" +
+        R"("alphaMode":"OPAQUE","name":"material)" + index + R"("})";
+    nodes += separator + R"({"mesh":)" + index +
+             R"(,"translation":[1,2,3],"rotation":[0,0,0,1],)" +
+             R"("scale":[1,1,1],"name":"node)" + index +
+             R"(","extras":{"id":)" + index + "}}";
+  }
+
+  return R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":)" +
+         std::to_string(count * 288) + R"(}],"accessors":[)" + accessors +
+         R"(],"bufferViews":[)" + bufferViews + R"(],"meshes":[)" + meshes +
+         R"(],"materials":[)" + materials + R"(],"nodes":[)" + nodes +
+         R"(],"scenes":[{"nodes":[0]}],"scene":0})";
+}
+
+gsl::span<const std::byte> asBytes(const std::string& s) {
+  return gsl::span(reinterpret_cast<const std::byte*>(s.data()), s.size());
+}
+
+} // namespace
+
+TEST_CASE("GltfReader matches keys that share a length") {
+  // byteOffset, byteLength, and byteStride share a length and a prefix, and
+  // bufferView, byteOffset, and normalized share a length. Unknown keys that
+  // have the length of a known key must still be treated as unknown.
+  const std::string s = R"(
+    {
+      "asset": { "version": "2.0" },
+      "bufferViews": [
+        {
+          "buffer": 0,
+          "byteOffset": 4,
+          "byteLength": 8,
+          "byteStride": 12,
+          "byteStridf": 16,
+          "targe": 1
+        }
+      ],
+      "accessors": [
+        {
+          "bufferView": 0,
+          "byteOffset": 2,
+          "normalized": true,
+          "componentType": 5121,
+          "count": 1,
+          "type": "SCALAR",
+          "normalizeD": false
+        }
+      ]
+    }
+  )";
+
+  GltfReaderOptions options;
+  GltfReader reader;
+  reader.getOptions().setCaptureUnknownProperties(true);
+  GltfReaderResult result = reader.readGltf(asBytes(s), options);
+  REQUIRE(result.model);
+
+  REQUIRE(result.model->bufferViews.size() == 1);
+  const BufferView& bufferView = result.model->bufferViews[0];
+  CHECK(bufferView.buffer == 0);
+  CHECK(bufferView.byteOffset == 4);
+  CHECK(bufferView.byteLength == 8);
+  CHECK(bufferView.byteStride == 12);
+  CHECK(!bufferView.target);
+  CHECK(bufferView.unknownProperties.size() == 2);
+  CHECK(bufferView.unknownProperties.count("byteStridf") == 1);
+  CHECK(bufferView.unknownProperties.count("targe") == 1);
+
+  REQUIRE(result.model->accessors.size() == 1);
+  const Accessor& accessor = result.model->accessors[0];
+  CHECK(accessor.bufferView == 0);
+  CHECK(accessor.byteOffset == 2);
+  CHECK(accessor.normalized);
+  CHECK(accessor.componentType == Accessor::ComponentType::UNSIGNED_BYTE);
+  CHECK(accessor.count == 1);
+  CHECK(accessor.type == Accessor::Type::SCALAR);
+  CHECK(accessor.unknownProperties.size() == 1);
+  CHECK(accessor.unknownProperties.count("normalizeD") == 1);
+}
+
+TEST_CASE("Benchmark parsing glTF JSON", "[.][benchmark]") {
+  std::filesystem::path boxTexturedFile = CesiumGltfReader_TEST_DATA_DIR;
+  boxTexturedFile /= "BoxTextured.gltf";
+  const std::vector<std::byte> boxTextured = readFile(boxTexturedFile);
+
+  const std::string small = createLargeGltfJson(100);
+  const std::string medium = createLargeGltfJson(10000);
+  const std::string large = createLargeGltfJson(100000);
+
+  GltfReader reader;
+  for (const std::string* pJson : {&small, &medium, &large}) {
+    GltfReaderResult result = reader.readGltf(asBytes(*pJson));
+    REQUIRE(result.model);
+    REQUIRE(result.errors.empty());
+  }
+
+  BENCHMARK("BoxTextured.gltf") { return reader.readGltf(boxTextured); };
+
+  BENCHMARK("100 nodes (" + std::to_string(small.size()) + " bytes)") {
+    return reader.readGltf(asBytes(small));
+  };
+
+  BENCHMARK("10,000 nodes (" + std::to_string(medium.size()) + " bytes)") {
+    return reader.readGltf(asBytes(medium));
+  };
+
+  BENCHMARK("100,000 nodes (" + std::to_string(large.size()) + " bytes)") {
+    return reader.readGltf(asBytes(large));
+  };
+}
+
+namespace {
+
+// Creates the JSON of a glTF with the given number of nodes, each with large
+// extras and a known and an unknown extension.
+std::string createGltfJsonWithLargeExtras(size_t count) {
+  std::string nodes;
+  for (size_t i = 0; i < count; ++i) {
+    const std::string index = std::to_string(i);
+    nodes += (i == 0 ? "" : ",") + std::string(R"({"name":"node)") + index +
+             R"(","extras":{"id":)" + index +
+             R"(,"tags":["building","residential","lod2"],)" +
+             R"("bounds":[[0.5,1.5,2.5],[3.5,4.5,5.5]],)" +
+             R"("attributes":{"height":12.5,"floors":4,"year":1987,)" +
+             R"("owner":{"name":"owner name that is long","id":)" + index +
+             R"(},"history":[{"year":1990,"event":"renovated"},)" +
+             R"({"year":2005,"event":"extended"}]}},)" +
+             R"("extensions":{"EXT_mesh_gpu_instancing":)" +
+             R"({"attributes":{"TRANSLATION":0}},)" +
+             R"("EXT_unregistered_metadata":{"values":[1,2,3,4,5,6,7,8]}}})";
+  }
+
+  return R"({"asset":{"version":"2.0"},"nodes":[)" + nodes + "]}";
+}
+
+} // namespace
+
+TEST_CASE(
+    "Benchmark reading and freeing glTF with large extras",
+    "[.][benchmark]") {
+  const std::string json = createGltfJsonWithLargeExtras(10000);
+
+  GltfReader reader;
+  {
+    GltfReaderResult result = reader.readGltf(asBytes(json));
+    REQUIRE(result.model);
+    REQUIRE(result.errors.empty());
+    REQUIRE(result.model->nodes.size() == 10000);
+  }
+
+  BENCHMARK("readGltf") { return reader.readGltf(asBytes(json)); };
+
+  BENCHMARK_ADVANCED("free the model")
+  (Catch::Benchmark::Chronometer meter) {
+    std::vector<std::optional<Model>> models(
+        static_cast<size_t>(meter.runs()));
+    for (std::optional<Model>& model : models) {
+      model = reader.readGltf(asBytes(json)).model;
+    }
+    meter.measure(
+        [&models](int i) { models[static_cast<size_t>(i)].reset(); });
+  };
+}
+
+TEST_CASE("Reads the same extension on many objects") {
+  const std::string s = R"(
+    {
+      "asset": { "version": "2.0" },
+      "nodes": [
+        {
+          "extensions": {
+            "EXT_mesh_gpu_instancing": { "attributes": { "TRANSLATION": 1 } },
+            "EXT_disabled": { "value": 1 },
+            "EXT_unregistered": { "value": 1 }
+          }
+        },
+        {
+          "extensions": {
+            "EXT_unregistered": { "value": 2 },
+            "EXT_disabled": { "value": 2 },
+            "EXT_mesh_gpu_instancing": { "attributes": { "SCALE": 2 } }
+          }
+        }
+      ]
+    }
+  )";
+
+  GltfReader reader;
+  reader.getOptions().setExtensionState(
+      "EXT_disabled",
+      CesiumJsonReader::ExtensionState::Disabled);
+  GltfReaderResult result = reader.readGltf(asBytes(s));
+  REQUIRE(result.model);
+  REQUIRE(result.errors.empty());
+  REQUIRE(result.model->nodes.size() == 2);
+
+  for (size_t i = 0; i < 2; ++i) {
+    const Node& node = result.model->nodes[i];
+    CHECK(node.extensions.size() == 2);
+    CHECK(node.getGenericExtension("EXT_disabled") == nullptr);
+
+    const JsonValue* pUnregistered =
+        node.getGenericExtension("EXT_unregistered");
+    REQUIRE(pUnregistered);
+    CHECK(
+        pUnregistered->getSafeNumericalValueForKey<int64_t>("value") ==
+        static_cast<int64_t>(i + 1));
+  }
+
+  const ExtensionExtMeshGpuInstancing* pFirst =
+      result.model->nodes[0].getExtension<ExtensionExtMeshGpuInstancing>();
+  REQUIRE(pFirst);
+  CHECK(pFirst->attributes.size() == 1);
+  CHECK(pFirst->attributes.at("TRANSLATION") == 1);
+
+  const ExtensionExtMeshGpuInstancing* pSecond =
+      result.model->nodes[1].getExtension<ExtensionExtMeshGpuInstancing>();
+  REQUIRE(pSecond);
+  CHECK(pSecond->attributes.size() == 1);
+  CHECK(pSecond->attributes.at("SCALE") == 2);
+}
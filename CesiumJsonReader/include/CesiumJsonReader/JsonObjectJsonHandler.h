@@ -5,6 +5,10 @@
 
 #include <CesiumUtility/JsonValue.h>
 
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
 namespace CesiumJsonReader {
 
 class CESIUMJSONREADER_API JsonObjectJsonHandler : public JsonHandler {
@@ -28,10 +32,25 @@ public:
   virtual IJsonHandler* readArrayEnd() override;
 
 private:
+  struct StackEntry {
+    CesiumUtility::JsonValue* pValue;
+    // True if an array is being read into pValue. Its elements are collected
+    // in _arrays until the end of the array.
+    bool isArray;
+  };
+
+  CesiumUtility::JsonValue& setValue(CesiumUtility::JsonValue&& value);
   IJsonHandler* doneElement();
 
-  std::vector<CesiumUtility::JsonValue*> _stack;
+  std::vector<StackEntry> _stack;
   std::string_view _currentKey;
+
+  // The elements of the arrays that are being read, from outermost to
+  // innermost. These are reused for every array read by this handler, so that
+  // each array is allocated once, at its final size, rather than growing one
+  // element at a time.
+  std::vector<std::vector<CesiumUtility::JsonValue>> _arrays;
+  size_t _openArrays;
 };
 
 } // namespace CesiumJsonReader
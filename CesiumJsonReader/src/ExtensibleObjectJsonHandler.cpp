@@ -23,12 +23,12 @@ IJsonHandler* ExtensibleObjectJsonHandler::readObjectKeyExtensibleObject(
     const std::string& objectType,
     const std::string_view& str,
     CesiumUtility::ExtensibleObject& o) {
-  using namespace std::string_literals;
+  using namespace std::string_view_literals;
 
-  if ("extras"s == str)
+  if (str == "extras"sv)
     return property("extras", this->_extras, o.extras);
 
-  if ("extensions"s == str) {
+  if (str == "extensions"sv) {
     this->_extensions.reset(this, &o, objectType);
     return &this->_extensions;
   }
@@ -1,89 +1,75 @@
 #include "CesiumJsonReader/JsonObjectJsonHandler.h"
 
 #include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
 
 namespace CesiumJsonReader {
-namespace {
-template <typename T>
-void addOrReplace(CesiumUtility::JsonValue& json, T value) {
-  CesiumUtility::JsonValue::Array* pArray =
-      std::get_if<CesiumUtility::JsonValue::Array>(&json.value);
-  if (pArray) {
-    pArray->emplace_back(value);
-  } else {
-    json = value;
-  }
-}
-} // namespace
 
-JsonObjectJsonHandler::JsonObjectJsonHandler() noexcept : JsonHandler() {}
+JsonObjectJsonHandler::JsonObjectJsonHandler() noexcept
+    : JsonHandler(), _stack(), _currentKey(), _arrays(), _openArrays(0) {}
 
 void JsonObjectJsonHandler::reset(
     IJsonHandler* pParent,
     CesiumUtility::JsonValue* pValue) {
   JsonHandler::reset(pParent);
   this->_stack.clear();
-  this->_stack.push_back(pValue);
+  this->_stack.push_back(StackEntry{pValue, false});
+
+  // A previous read may have stopped partway through an array.
+  for (size_t i = 0; i < this->_openArrays; ++i) {
+    this->_arrays[i].clear();
+  }
+  this->_openArrays = 0;
 }
 
 IJsonHandler* JsonObjectJsonHandler::readNull() {
-  addOrReplace(*this->_stack.back(), CesiumUtility::JsonValue::Null());
+  this->setValue(CesiumUtility::JsonValue::Null());
   return this->doneElement();
 }
 
 IJsonHandler* JsonObjectJsonHandler::readBool(bool b) {
-  addOrReplace(*this->_stack.back(), b);
+  this->setValue(b);
   return this->doneElement();
 }
 
 IJsonHandler* JsonObjectJsonHandler::readInt32(int32_t i) {
-  addOrReplace(*this->_stack.back(), std::int64_t(i));
+  this->setValue(std::int64_t(i));
   return this->doneElement();
 }
 
 IJsonHandler* JsonObjectJsonHandler::readUint32(uint32_t i) {
-  addOrReplace(*this->_stack.back(), std::uint64_t(i));
+  this->setValue(std::uint64_t(i));
   return this->doneElement();
 }
 
 IJsonHandler* JsonObjectJsonHandler::readInt64(int64_t i) {
-  addOrReplace(*this->_stack.back(), i);
+  this->setValue(i);
   return this->doneElement();
 }
 
 IJsonHandler* JsonObjectJsonHandler::readUint64(uint64_t i) {
-  addOrReplace(*this->_stack.back(), i);
+  this->setValue(i);
   return this->doneElement();
 }
 
 IJsonHandler* JsonObjectJsonHandler::readDouble(double d) {
-  addOrReplace(*this->_stack.back(), d);
+  this->setValue(d);
   return this->doneElement();
 }
 
 IJsonHandler* JsonObjectJsonHandler::readString(const std::string_view& str) {
-  CesiumUtility::JsonValue& current = *this->_stack.back();
-  CesiumUtility::JsonValue::Array* pArray =
-      std::get_if<CesiumUtility::JsonValue::Array>(&current.value);
-  if (pArray) {
-    pArray->emplace_back(std::string(str));
-  } else {
-    current = std::string(str);
-  }
-
+  this->setValue(std::string(str));
   return this->doneElement();
 }
 
 IJsonHandler* JsonObjectJsonHandler::readObjectStart() {
-  CesiumUtility::JsonValue& current = *this->_stack.back();
-  CesiumUtility::JsonValue::Array* pArray =
-      std::get_if<CesiumUtility::JsonValue::Array>(&current.value);
-  if (pArray) {
-    CesiumUtility::JsonValue& newObject =
-        pArray->emplace_back(CesiumUtility::JsonValue::Object());
-    this->_stack.emplace_back(&newObject);
-  } else {
-    current = CesiumUtility::JsonValue::Object();
+  const bool inArray = this->_stack.back().isArray;
+  CesiumUtility::JsonValue& newObject =
+      this->setValue(CesiumUtility::JsonValue::Object());
+  if (inArray) {
+    this->_stack.push_back(StackEntry{&newObject, false});
   }
 
   return this;
@@ -91,12 +77,12 @@ IJsonHandler* JsonObjectJsonHandler::readObjectStart() {
 
 IJsonHandler*
 JsonObjectJsonHandler::readObjectKey(const std::string_view& str) {
-  CesiumUtility::JsonValue& json = *this->_stack.back();
+  CesiumUtility::JsonValue& json = *this->_stack.back().pValue;
   CesiumUtility::JsonValue::Object* pObject =
       std::get_if<CesiumUtility::JsonValue::Object>(&json.value);
 
   auto it = pObject->emplace(str, CesiumUtility::JsonValue()).first;
-  this->_stack.push_back(&it->second);
+  this->_stack.push_back(StackEntry{&it->second, false});
   this->_currentKey = str;
   return this;
 }
@@ -106,30 +92,51 @@ IJsonHandler* JsonObjectJsonHandler::readObjectEnd() {
 }
 
 IJsonHandler* JsonObjectJsonHandler::readArrayStart() {
-  CesiumUtility::JsonValue& current = *this->_stack.back();
-  CesiumUtility::JsonValue::Array* pArray =
-      std::get_if<CesiumUtility::JsonValue::Array>(&current.value);
-  if (pArray) {
+  if (this->_stack.back().isArray) {
+    // The new array is an element of the current one. Add a placeholder for
+    // it now, so that it keeps its place among the elements.
     CesiumUtility::JsonValue& newArray =
-        pArray->emplace_back(CesiumUtility::JsonValue::Array());
-    this->_stack.emplace_back(&newArray);
+        this->setValue(CesiumUtility::JsonValue());
+    this->_stack.push_back(StackEntry{&newArray, true});
   } else {
-    current = CesiumUtility::JsonValue::Array();
+    this->_stack.back().isArray = true;
+  }
+
+  // Moving the vectors of elements when this one grows doesn't move the
+  // elements, so pointers to the placeholders stay valid.
+  if (this->_openArrays == this->_arrays.size()) {
+    this->_arrays.emplace_back();
   }
+  ++this->_openArrays;
 
   return this;
 }
 
 IJsonHandler* JsonObjectJsonHandler::readArrayEnd() {
+  std::vector<CesiumUtility::JsonValue>& elements =
+      this->_arrays[--this->_openArrays];
+  *this->_stack.back().pValue = CesiumUtility::JsonValue::Array(
+      std::make_move_iterator(elements.begin()),
+      std::make_move_iterator(elements.end()));
+  elements.clear();
+
   this->_stack.pop_back();
   return this->_stack.empty() ? this->parent() : this;
 }
 
+CesiumUtility::JsonValue&
+JsonObjectJsonHandler::setValue(CesiumUtility::JsonValue&& value) {
+  StackEntry& current = this->_stack.back();
+  if (current.isArray) {
+    return this->_arrays[this->_openArrays - 1].emplace_back(std::move(value));
+  }
+
+  *current.pValue = std::move(value);
+  return *current.pValue;
+}
+
 IJsonHandler* JsonObjectJsonHandler::doneElement() {
-  CesiumUtility::JsonValue& current = *this->_stack.back();
-  CesiumUtility::JsonValue::Array* pArray =
-      std::get_if<CesiumUtility::JsonValue::Array>(&current.value);
-  if (!pArray) {
+  if (!this->_stack.back().isArray) {
     this->_stack.pop_back();
     return this->_stack.empty() ? this->parent() : this;
   }
@@ -6,5 +6,9 @@ namespace CesiumNativeTests {
 class SimpleTaskProcessor : public CesiumAsync::ITaskProcessor {
 public:
   virtual void startTask(std::function<void()> f) override { f(); }
+
+  virtual size_t getMaximumConcurrency() const noexcept override {
+    return 1;
+  }
 };
 } // namespace CesiumNativeTests
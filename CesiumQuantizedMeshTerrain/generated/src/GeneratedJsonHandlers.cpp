@@ -52,44 +52,108 @@ CesiumJsonReader::IJsonHandler* LayerJsonHandler::readObjectKeyLayer(
     const std::string& objectType,
     const std::string_view& str,
     CesiumQuantizedMeshTerrain::Layer& o) {
-  using namespace std::string_literals;
-
-  if ("attribution"s == str)
-    return property("attribution", this->_attribution, o.attribution);
-  if ("available"s == str)
-    return property("available", this->_available, o.available);
-  if ("bounds"s == str)
-    return property("bounds", this->_bounds, o.bounds);
-  if ("description"s == str)
-    return property("description", this->_description, o.description);
-  if ("extensions"s == str)
-    return property(
-        "extensions",
-        this->_extensionsProperty,
-        o.extensionsProperty);
-  if ("format"s == str)
-    return property("format", this->_format, o.format);
-  if ("maxzoom"s == str)
-    return property("maxzoom", this->_maxzoom, o.maxzoom);
-  if ("minzoom"s == str)
-    return property("minzoom", this->_minzoom, o.minzoom);
-  if ("metadataAvailability"s == str)
-    return property(
-        "metadataAvailability",
-        this->_metadataAvailability,
-        o.metadataAvailability);
-  if ("name"s == str)
-    return property("name", this->_name, o.name);
-  if ("parentUrl"s == str)
-    return property("parentUrl", this->_parentUrl, o.parentUrl);
-  if ("projection"s == str)
-    return property("projection", this->_projection, o.projection);
-  if ("scheme"s == str)
-    return property("scheme", this->_scheme, o.scheme);
-  if ("tiles"s == str)
-    return property("tiles", this->_tiles, o.tiles);
-  if ("version"s == str)
-    return property("version", this->_version, o.version);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    if (str == "name"sv)
+      return property("name", this->_name, o.name);
+    break;
+  case 5:
+    if (str == "tiles"sv)
+      return property("tiles", this->_tiles, o.tiles);
+    break;
+  case 6:
+    switch (str[0]) {
+    case 'b':
+      if (str == "bounds"sv)
+        return property("bounds", this->_bounds, o.bounds);
+      break;
+    case 'f':
+      if (str == "format"sv)
+        return property("format", this->_format, o.format);
+      break;
+    case 's':
+      if (str == "scheme"sv)
+        return property("scheme", this->_scheme, o.scheme);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 7:
+    switch (str[1]) {
+    case 'a':
+      if (str == "maxzoom"sv)
+        return property("maxzoom", this->_maxzoom, o.maxzoom);
+      break;
+    case 'i':
+      if (str == "minzoom"sv)
+        return property("minzoom", this->_minzoom, o.minzoom);
+      break;
+    case 'e':
+      if (str == "version"sv)
+        return property("version", this->_version, o.version);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 9:
+    switch (str[0]) {
+    case 'a':
+      if (str == "available"sv)
+        return property("available", this->_available, o.available);
+      break;
+    case 'p':
+      if (str == "parentUrl"sv)
+        return property("parentUrl", this->_parentUrl, o.parentUrl);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 10:
+    switch (str[0]) {
+    case 'e':
+      if (str == "extensions"sv)
+        return property(
+            "extensions",
+            this->_extensionsProperty,
+            o.extensionsProperty);
+      break;
+    case 'p':
+      if (str == "projection"sv)
+        return property("projection", this->_projection, o.projection);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 11:
+    switch (str[0]) {
+    case 'a':
+      if (str == "attribution"sv)
+        return property("attribution", this->_attribution, o.attribution);
+      break;
+    case 'd':
+      if (str == "description"sv)
+        return property("description", this->_description, o.description);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 20:
+    if (str == "metadataAvailability"sv)
+      return property(
+          "metadataAvailability",
+          this->_metadataAvailability,
+          o.metadataAvailability);
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -169,16 +233,40 @@ AvailabilityRectangleJsonHandler::readObjectKeyAvailabilityRectangle(
     const std::string& objectType,
     const std::string_view& str,
     CesiumQuantizedMeshTerrain::AvailabilityRectangle& o) {
-  using namespace std::string_literals;
-
-  if ("startX"s == str)
-    return property("startX", this->_startX, o.startX);
-  if ("startY"s == str)
-    return property("startY", this->_startY, o.startY);
-  if ("endX"s == str)
-    return property("endX", this->_endX, o.endX);
-  if ("endY"s == str)
-    return property("endY", this->_endY, o.endY);
+  using namespace std::string_view_literals;
+
+  switch (str.size()) {
+  case 4:
+    switch (str[3]) {
+    case 'X':
+      if (str == "endX"sv)
+        return property("endX", this->_endX, o.endX);
+      break;
+    case 'Y':
+      if (str == "endY"sv)
+        return property("endY", this->_endY, o.endY);
+      break;
+    default:
+      break;
+    }
+    break;
+  case 6:
+    switch (str[5]) {
+    case 'X':
+      if (str == "startX"sv)
+        return property("startX", this->_startX, o.startX);
+      break;
+    case 'Y':
+      if (str == "startY"sv)
+        return property("startY", this->_startY, o.startY);
+      break;
+    default:
+      break;
+    }
+    break;
+  default:
+    break;
+  }
 
   return this->readObjectKeyExtensibleObject(objectType, str, *this->_pObject);
 }
@@ -16,6 +16,7 @@
 #include <glm/vec3.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <stdexcept>
 
@@ -115,6 +116,35 @@ int32_t zigZagDecode(int32_t value) noexcept {
   return (value >> 1) ^ (-(value & 1));
 }
 
+// Decodes the zig-zag encoded deltas of a vertex component, such as the u
+// coordinates of every vertex. The deltas are decoded in a loop without any
+// dependency between iterations, which the compiler can vectorize, and are
+// then summed in a single pass.
+void decodeZigZagDeltas(
+    const gsl::span<const uint16_t>& encoded,
+    const gsl::span<int32_t>& decoded) noexcept {
+  for (size_t i = 0; i < encoded.size(); ++i) {
+    decoded[i] = zigZagDecode(static_cast<int32_t>(encoded[i]));
+  }
+
+  int32_t value = 0;
+  for (size_t i = 0; i < encoded.size(); ++i) {
+    value += decoded[i];
+    decoded[i] = value;
+  }
+}
+
+// The decoded u, v, and height of every vertex, from 0 to 32767.
+struct QuantizedVertices {
+  gsl::span<const int32_t> u;
+  gsl::span<const int32_t> v;
+  gsl::span<const int32_t> height;
+};
+
+double dequantize(int32_t value) noexcept {
+  return static_cast<double>(value) / 32767.0;
+}
+
 template <class E, class D>
 void decodeIndices(
     const gsl::span<const E>& encoded,
@@ -371,7 +401,7 @@ static void addSkirt(
     double skirtHeight,
     double longitudeOffset,
     double latitudeOffset,
-    const std::vector<glm::dvec3>& uvsAndHeights,
+    const QuantizedVertices& vertices,
     const gsl::span<const E>& edgeIndices,
     const gsl::span<float>& positions,
     const gsl::span<float>& normals,
@@ -389,9 +419,9 @@ static void addSkirt(
   for (size_t i = 0; i < edgeIndices.size(); ++i) {
     E edgeIdx = edgeIndices[i];
 
-    const double uRatio = uvsAndHeights[edgeIdx].x;
-    const double vRatio = uvsAndHeights[edgeIdx].y;
-    const double heightRatio = uvsAndHeights[edgeIdx].z;
+    const double uRatio = dequantize(vertices.u[edgeIdx]);
+    const double vRatio = dequantize(vertices.v[edgeIdx]);
+    const double heightRatio = dequantize(vertices.height[edgeIdx]);
     const double longitude = Math::lerp(west, east, uRatio) + longitudeOffset;
     const double latitude = Math::lerp(south, north, vRatio) + latitudeOffset;
     const double heightMeters =
@@ -442,7 +472,7 @@ static void addSkirts(
     double skirtHeight,
     double longitudeOffset,
     double latitudeOffset,
-    const std::vector<glm::dvec3>& uvsAndHeights,
+    const QuantizedVertices& vertices,
     const gsl::span<const std::byte>& westEdgeIndicesBuffer,
     const gsl::span<const std::byte>& southEdgeIndicesBuffer,
     const gsl::span<const std::byte>& eastEdgeIndicesBuffer,
@@ -477,8 +507,8 @@ static void addSkirts(
       westEdgeIndices.end(),
       sortEdgeIndices.begin(),
       sortEdgeIndices.begin() + westVertexCount,
-      [&uvsAndHeights](auto lhs, auto rhs) noexcept {
-        return uvsAndHeights[lhs].y < uvsAndHeights[rhs].y;
+      [&vertices](auto lhs, auto rhs) noexcept {
+        return vertices.v[lhs] < vertices.v[rhs];
       });
   westEdgeIndices = gsl::span(sortEdgeIndices.data(), westVertexCount);
   addSkirt(
@@ -492,7 +522,7 @@ static void addSkirts(
       skirtHeight,
       -longitudeOffset,
       0.0,
-      uvsAndHeights,
+      vertices,
       westEdgeIndices,
       outputPositions,
       outputNormals,
@@ -510,8 +540,8 @@ static void addSkirts(
       southEdgeIndices.end(),
       sortEdgeIndices.begin(),
       sortEdgeIndices.begin() + southVertexCount,
-      [&uvsAndHeights](auto lhs, auto rhs) noexcept {
-        return uvsAndHeights[lhs].x > uvsAndHeights[rhs].x;
+      [&vertices](auto lhs, auto rhs) noexcept {
+        return vertices.u[lhs] > vertices.u[rhs];
       });
   southEdgeIndices = gsl::span(sortEdgeIndices.data(), southVertexCount);
   addSkirt(
@@ -525,7 +555,7 @@ static void addSkirts(
       skirtHeight,
       0.0,
       -latitudeOffset,
-      uvsAndHeights,
+      vertices,
       southEdgeIndices,
       outputPositions,
       outputNormals,
@@ -543,8 +573,8 @@ static void addSkirts(
       eastEdgeIndices.end(),
       sortEdgeIndices.begin(),
       sortEdgeIndices.begin() + eastVertexCount,
-      [&uvsAndHeights](auto lhs, auto rhs) noexcept {
-        return uvsAndHeights[lhs].y > uvsAndHeights[rhs].y;
+      [&vertices](auto lhs, auto rhs) noexcept {
+        return vertices.v[lhs] > vertices.v[rhs];
       });
   eastEdgeIndices = gsl::span(sortEdgeIndices.data(), eastVertexCount);
   addSkirt(
@@ -558,7 +588,7 @@ static void addSkirts(
       skirtHeight,
       longitudeOffset,
       0.0,
-      uvsAndHeights,
+      vertices,
       eastEdgeIndices,
       outputPositions,
       outputNormals,
@@ -576,8 +606,8 @@ static void addSkirts(
       northEdgeIndices.end(),
       sortEdgeIndices.begin(),
       sortEdgeIndices.begin() + northVertexCount,
-      [&uvsAndHeights](auto lhs, auto rhs) noexcept {
-        return uvsAndHeights[lhs].x < uvsAndHeights[rhs].x;
+      [&vertices](auto lhs, auto rhs) noexcept {
+        return vertices.u[lhs] < vertices.u[rhs];
       });
   northEdgeIndices = gsl::span(sortEdgeIndices.data(), northVertexCount);
   addSkirt(
@@ -591,7 +621,7 @@ static void addSkirts(
       skirtHeight,
       0.0,
       latitudeOffset,
-      uvsAndHeights,
+      vertices,
       northEdgeIndices,
       outputPositions,
       outputNormals,
@@ -618,15 +648,13 @@ static void decodeNormals(
   }
 }
 
+// The normals must be zero initially.
 template <class T>
-static std::vector<std::byte> generateNormals(
+static void generateNormals(
     const gsl::span<const float>& positions,
     const gsl::span<T>& indices,
-    size_t currentNumOfIndex) {
-  std::vector<std::byte> normalsBuffer(positions.size() * sizeof(float));
-  const gsl::span<float> normals(
-      reinterpret_cast<float*>(normalsBuffer.data()),
-      positions.size());
+    size_t currentNumOfIndex,
+    const gsl::span<float>& normals) {
   for (size_t i = 0; i < currentNumOfIndex; i += 3) {
     T id0 = indices[i];
     T id1 = indices[i + 1];
@@ -665,8 +693,67 @@ static std::vector<std::byte> generateNormals(
       normals[i + 2] = normal.z;
     }
   }
+}
 
-  return normalsBuffer;
+// Computes the positions of the vertices relative to the center of the tile,
+// along with their bounds. The vertices are converted to cartesian in small
+// batches, so that the conversion can be vectorized while its inputs and
+// outputs stay in the cache.
+static void computePositions(
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    const glm::dvec3& center,
+    const CesiumGeospatial::GlobeRectangle& rectangle,
+    double minimumHeight,
+    double maximumHeight,
+    const QuantizedVertices& vertices,
+    const gsl::span<float>& positions,
+    glm::dvec3& positionMinimums,
+    glm::dvec3& positionMaximums) {
+  const double west = rectangle.getWest();
+  const double south = rectangle.getSouth();
+  const double east = rectangle.getEast();
+  const double north = rectangle.getNorth();
+
+  constexpr size_t batchSize = 128;
+  std::array<double, batchSize> longitudes;
+  std::array<double, batchSize> latitudes;
+  std::array<double, batchSize> heights;
+  std::array<double, batchSize> x;
+  std::array<double, batchSize> y;
+  std::array<double, batchSize> z;
+
+  const size_t vertexCount = vertices.u.size();
+  for (size_t begin = 0; begin < vertexCount; begin += batchSize) {
+    const size_t count = std::min(batchSize, vertexCount - begin);
+    for (size_t i = 0; i < count; ++i) {
+      const size_t vertex = begin + i;
+      longitudes[i] = Math::lerp(west, east, dequantize(vertices.u[vertex]));
+      latitudes[i] = Math::lerp(south, north, dequantize(vertices.v[vertex]));
+      heights[i] = Math::lerp(
+          minimumHeight,
+          maximumHeight,
+          dequantize(vertices.height[vertex]));
+    }
+
+    ellipsoid.cartographicToCartesian(
+        gsl::span<const double>(longitudes.data(), count),
+        gsl::span<const double>(latitudes.data(), count),
+        gsl::span<const double>(heights.data(), count),
+        gsl::span<double>(x.data(), count),
+        gsl::span<double>(y.data(), count),
+        gsl::span<double>(z.data(), count));
+
+    float* pPosition = positions.data() + begin * 3;
+    for (size_t i = 0; i < count; ++i) {
+      const glm::dvec3 position = glm::dvec3(x[i], y[i], z[i]) - center;
+      *pPosition++ = static_cast<float>(position.x);
+      *pPosition++ = static_cast<float>(position.y);
+      *pPosition++ = static_cast<float>(position.z);
+
+      positionMinimums = glm::min(positionMinimums, position);
+      positionMaximums = glm::max(positionMaximums, position);
+    }
+  }
 }
 
 /*static*/ QuantizedMeshLoadResult QuantizedMeshLoader::load(
@@ -696,15 +783,32 @@ static std::vector<std::byte> generateNormals(
       meshView->westEdgeIndicesCount + meshView->southEdgeIndicesCount +
       meshView->eastEdgeIndicesCount + meshView->northEdgeIndicesCount;
   const uint32_t skirtIndicesCount = (skirtVertexCount - 4) * 6;
-
-  // decode position without skirt, but preallocate position buffer to include
-  // skirt as well
-  std::vector<std::byte> outputPositionsBuffer(
-      (vertexCount + skirtVertexCount) * 3 * sizeof(float));
-  gsl::span<float> outputPositions(
-      reinterpret_cast<float*>(outputPositionsBuffer.data()),
-      (vertexCount + skirtVertexCount) * 3);
-  size_t positionOutputIndex = 0;
+  const size_t outputVertexCount = size_t(vertexCount) + skirtVertexCount;
+  const size_t outputIndicesCount = size_t(indicesCount) + skirtIndicesCount;
+
+  // Caution of indices type since adding skirt means the number of vertices is
+  // potentially over maximum of uint16_t
+  const uint32_t indexSizeBytes =
+      meshView->indexType == QuantizedMeshIndexType::UnsignedShort &&
+              outputVertexCount < std::numeric_limits<uint16_t>::max()
+          ? sizeof(uint16_t)
+          : sizeof(uint32_t);
+
+  // The positions, normals, and indices of the tile and its skirt share a
+  // single buffer, which is allocated once at its final size.
+  const size_t positionsByteLength = outputVertexCount * 3 * sizeof(float);
+  const size_t normalsByteOffset = positionsByteLength;
+  const size_t normalsByteLength = outputVertexCount * 3 * sizeof(float);
+  const size_t indicesByteOffset = normalsByteOffset + normalsByteLength;
+  const size_t indicesByteLength = outputIndicesCount * indexSizeBytes;
+  std::vector<std::byte> outputBuffer(indicesByteOffset + indicesByteLength);
+
+  const gsl::span<float> outputPositions(
+      reinterpret_cast<float*>(outputBuffer.data()),
+      outputVertexCount * 3);
+  const gsl::span<float> outputNormals(
+      reinterpret_cast<float*>(outputBuffer.data() + normalsByteOffset),
+      outputVertexCount * 3);
 
   const glm::dvec3 center(
       pHeader->BoundingSphereCenterX,
@@ -727,52 +831,36 @@ static std::vector<std::byte> generateNormals(
   const double east = rectangle.getEast();
   const double north = rectangle.getNorth();
 
-  int32_t u = 0;
-  int32_t v = 0;
-  int32_t height = 0;
-  std::vector<glm::dvec3> uvsAndHeights;
-  uvsAndHeights.reserve(vertexCount);
-  for (size_t i = 0; i < vertexCount; ++i) {
-    u += zigZagDecode(meshView->uBuffer[i]);
-    v += zigZagDecode(meshView->vBuffer[i]);
-    height += zigZagDecode(meshView->heightBuffer[i]);
-
-    double uRatio = static_cast<double>(u) / 32767.0;
-    double vRatio = static_cast<double>(v) / 32767.0;
-    double heightRatio = static_cast<double>(height) / 32767.0;
-
-    const double longitude = Math::lerp(west, east, uRatio);
-    const double latitude = Math::lerp(south, north, vRatio);
-    const double heightMeters =
-        Math::lerp(minimumHeight, maximumHeight, heightRatio);
-
-    glm::dvec3 position = ellipsoid.cartographicToCartesian(
-        Cartographic(longitude, latitude, heightMeters));
-    position -= center;
-    outputPositions[positionOutputIndex++] = static_cast<float>(position.x);
-    outputPositions[positionOutputIndex++] = static_cast<float>(position.y);
-    outputPositions[positionOutputIndex++] = static_cast<float>(position.z);
-
-    positionMinimums = glm::min(positionMinimums, position);
-    positionMaximums = glm::max(positionMaximums, position);
+  // decode u, v, and height of the vertices without skirt. They are kept for
+  // the skirt, which is created from the vertices on the edges of the tile.
+  std::vector<int32_t> quantizedVertexBuffer(size_t(vertexCount) * 3);
+  const gsl::span<int32_t> decodedU(quantizedVertexBuffer.data(), vertexCount);
+  const gsl::span<int32_t> decodedV(
+      quantizedVertexBuffer.data() + vertexCount,
+      vertexCount);
+  const gsl::span<int32_t> decodedHeight(
+      quantizedVertexBuffer.data() + size_t(vertexCount) * 2,
+      vertexCount);
+  decodeZigZagDeltas(meshView->uBuffer, decodedU);
+  decodeZigZagDeltas(meshView->vBuffer, decodedV);
+  decodeZigZagDeltas(meshView->heightBuffer, decodedHeight);
+  const QuantizedVertices vertices{decodedU, decodedV, decodedHeight};
 
-    uvsAndHeights.emplace_back(uRatio, vRatio, heightRatio);
-  }
+  computePositions(
+      ellipsoid,
+      center,
+      rectangle,
+      minimumHeight,
+      maximumHeight,
+      vertices,
+      outputPositions,
+      positionMinimums,
+      positionMaximums);
 
   // decode normal vertices of the tile as well as its metadata without skirt
-  std::vector<std::byte> outputNormalsBuffer;
-  gsl::span<float> outputNormals;
-  if (!meshView->octEncodedNormalBuffer.empty()) {
-    const uint32_t totalNormalFloats = (vertexCount + skirtVertexCount) * 3;
-    outputNormalsBuffer.resize(totalNormalFloats * sizeof(float));
-    outputNormals = gsl::span<float>(
-        reinterpret_cast<float*>(outputNormalsBuffer.data()),
-        totalNormalFloats);
+  const bool hasNormals = !meshView->octEncodedNormalBuffer.empty();
+  if (hasNormals) {
     decodeNormals(meshView->octEncodedNormalBuffer, outputNormals);
-
-    outputNormals = gsl::span<float>(
-        reinterpret_cast<float*>(outputNormalsBuffer.data()),
-        outputNormalsBuffer.size() / sizeof(float));
   }
 
   // decode metadata
@@ -783,36 +871,27 @@ static std::vector<std::byte> generateNormals(
     result.errors.merge(std::move(metadata.errors));
   }
 
-  // indices buffer for gltf to include tile and skirt indices. Caution of
-  // indices type since adding skirt means the number of vertices is potentially
-  // over maximum of uint16_t
-  std::vector<std::byte> outputIndicesBuffer;
-  uint32_t indexSizeBytes =
-      meshView->indexType == QuantizedMeshIndexType::UnsignedInt
-          ? sizeof(uint32_t)
-          : sizeof(uint16_t);
+  // indices buffer for gltf to include tile and skirt indices.
   const double skirtHeight = calculateSkirtHeight(ellipsoid, rectangle);
   const double longitudeOffset = (east - west) * 0.0001;
   const double latitudeOffset = (north - south) * 0.0001;
   if (meshView->indexType == QuantizedMeshIndexType::UnsignedInt) {
     // decode the tile indices without skirt.
-    const size_t outputIndicesCount = indicesCount + skirtIndicesCount;
-    outputIndicesBuffer.resize(outputIndicesCount * sizeof(uint32_t));
     const gsl::span<const uint32_t> indices(
         reinterpret_cast<const uint32_t*>(meshView->indicesBuffer.data()),
         indicesCount);
     gsl::span<uint32_t> outputIndices(
-        reinterpret_cast<uint32_t*>(outputIndicesBuffer.data()),
+        reinterpret_cast<uint32_t*>(outputBuffer.data() + indicesByteOffset),
         outputIndicesCount);
     decodeIndices(indices, outputIndices);
 
     // generate normals if no provided
-    if (outputNormalsBuffer.empty()) {
-      outputNormalsBuffer =
-          generateNormals(outputPositions, outputIndices, indicesCount);
-      outputNormals = gsl::span<float>(
-          reinterpret_cast<float*>(outputNormalsBuffer.data()),
-          outputNormalsBuffer.size() / sizeof(float));
+    if (!hasNormals) {
+      generateNormals(
+          outputPositions,
+          outputIndices,
+          indicesCount,
+          outputNormals);
     }
 
     // add skirt
@@ -827,7 +906,7 @@ static std::vector<std::byte> generateNormals(
         skirtHeight,
         longitudeOffset,
         latitudeOffset,
-        uvsAndHeights,
+        vertices,
         meshView->westEdgeIndicesBuffer,
         meshView->southEdgeIndicesBuffer,
         meshView->eastEdgeIndicesBuffer,
@@ -837,28 +916,24 @@ static std::vector<std::byte> generateNormals(
         outputIndices,
         positionMinimums,
         positionMaximums);
-
-    indexSizeBytes = sizeof(uint32_t);
   } else {
-    const size_t outputIndicesCount = indicesCount + skirtIndicesCount;
     const gsl::span<const uint16_t> indices(
         reinterpret_cast<const uint16_t*>(meshView->indicesBuffer.data()),
         indicesCount);
-    if (vertexCount + skirtVertexCount < std::numeric_limits<uint16_t>::max()) {
+    if (indexSizeBytes == sizeof(uint16_t)) {
       // decode the tile indices without skirt.
-      outputIndicesBuffer.resize(outputIndicesCount * sizeof(uint16_t));
       gsl::span<uint16_t> outputIndices(
-          reinterpret_cast<uint16_t*>(outputIndicesBuffer.data()),
+          reinterpret_cast<uint16_t*>(outputBuffer.data() + indicesByteOffset),
           outputIndicesCount);
       decodeIndices(indices, outputIndices);
 
       // generate normals if no provided
-      if (outputNormalsBuffer.empty()) {
-        outputNormalsBuffer =
-            generateNormals(outputPositions, outputIndices, indicesCount);
-        outputNormals = gsl::span<float>(
-            reinterpret_cast<float*>(outputNormalsBuffer.data()),
-            outputNormalsBuffer.size() / sizeof(float));
+      if (!hasNormals) {
+        generateNormals(
+            outputPositions,
+            outputIndices,
+            indicesCount,
+            outputNormals);
       }
 
       addSkirts<uint16_t, uint16_t>(
@@ -872,7 +947,7 @@ static std::vector<std::byte> generateNormals(
           skirtHeight,
           longitudeOffset,
           latitudeOffset,
-          uvsAndHeights,
+          vertices,
           meshView->westEdgeIndicesBuffer,
           meshView->southEdgeIndicesBuffer,
           meshView->eastEdgeIndicesBuffer,
@@ -882,22 +957,19 @@ static std::vector<std::byte> generateNormals(
           outputIndices,
           positionMinimums,
           positionMaximums);
-
-      indexSizeBytes = sizeof(uint16_t);
     } else {
-      outputIndicesBuffer.resize(outputIndicesCount * sizeof(uint32_t));
       gsl::span<uint32_t> outputIndices(
-          reinterpret_cast<uint32_t*>(outputIndicesBuffer.data()),
+          reinterpret_cast<uint32_t*>(outputBuffer.data() + indicesByteOffset),
           outputIndicesCount);
       decodeIndices(indices, outputIndices);
 
       // generate normals if no provided
-      if (outputNormalsBuffer.empty()) {
-        outputNormalsBuffer =
-            generateNormals(outputPositions, outputIndices, indicesCount);
-        outputNormals = gsl::span<float>(
-            reinterpret_cast<float*>(outputNormalsBuffer.data()),
-            outputNormalsBuffer.size() / sizeof(float));
+      if (!hasNormals) {
+        generateNormals(
+            outputPositions,
+            outputIndices,
+            indicesCount,
+            outputNormals);
       }
 
       addSkirts<uint16_t, uint32_t>(
@@ -911,7 +983,7 @@ static std::vector<std::byte> generateNormals(
           skirtHeight,
           longitudeOffset,
           latitudeOffset,
-          uvsAndHeights,
+          vertices,
           meshView->westEdgeIndicesBuffer,
           meshView->southEdgeIndicesBuffer,
           meshView->eastEdgeIndicesBuffer,
@@ -921,8 +993,6 @@ static std::vector<std::byte> generateNormals(
           outputIndices,
           positionMinimums,
           positionMaximums);
-
-      indexSizeBytes = sizeof(uint32_t);
     }
   }
 
@@ -946,21 +1016,20 @@ static std::vector<std::byte> generateNormals(
   primitive.mode = CesiumGltf::MeshPrimitive::Mode::TRIANGLES;
   primitive.material = 0;
 
-  // add position buffer to gltf
-  const size_t positionBufferId = model.buffers.size();
-  model.buffers.emplace_back();
-  CesiumGltf::Buffer& positionBuffer = model.buffers[positionBufferId];
-  positionBuffer.byteLength = int64_t(outputPositionsBuffer.size());
-  positionBuffer.cesium.data = std::move(outputPositionsBuffer);
+  // add the buffer of positions, normals, and indices to gltf
+  const size_t bufferId = model.buffers.size();
+  CesiumGltf::Buffer& buffer = model.buffers.emplace_back();
+  buffer.byteLength = int64_t(outputBuffer.size());
+  buffer.cesium.data = std::move(outputBuffer);
 
   const size_t positionBufferViewId = model.bufferViews.size();
   model.bufferViews.emplace_back();
   CesiumGltf::BufferView& positionBufferView =
       model.bufferViews[positionBufferViewId];
-  positionBufferView.buffer = int32_t(positionBufferId);
+  positionBufferView.buffer = int32_t(bufferId);
   positionBufferView.byteOffset = 0;
   positionBufferView.byteStride = 3 * sizeof(float);
-  positionBufferView.byteLength = int64_t(positionBuffer.cesium.data.size());
+  positionBufferView.byteLength = int64_t(positionsByteLength);
   positionBufferView.target = CesiumGltf::BufferView::Target::ARRAY_BUFFER;
 
   const size_t positionAccessorId = model.accessors.size();
@@ -969,7 +1038,7 @@ static std::vector<std::byte> generateNormals(
   positionAccessor.bufferView = static_cast<int>(positionBufferViewId);
   positionAccessor.byteOffset = 0;
   positionAccessor.componentType = CesiumGltf::Accessor::ComponentType::FLOAT;
-  positionAccessor.count = vertexCount + skirtVertexCount;
+  positionAccessor.count = int64_t(outputVertexCount);
   positionAccessor.type = CesiumGltf::Accessor::Type::VEC3;
   positionAccessor.min = {
       positionMinimums.x,
@@ -982,50 +1051,36 @@ static std::vector<std::byte> generateNormals(
 
   primitive.attributes.emplace("POSITION", int32_t(positionAccessorId));
 
-  // add normal buffer to gltf if there are any
-  if (!outputNormalsBuffer.empty()) {
-    const size_t normalBufferId = model.buffers.size();
-    model.buffers.emplace_back();
-    CesiumGltf::Buffer& normalBuffer = model.buffers[normalBufferId];
-    normalBuffer.byteLength = int64_t(outputNormalsBuffer.size());
-    normalBuffer.cesium.data = std::move(outputNormalsBuffer);
-
-    const size_t normalBufferViewId = model.bufferViews.size();
-    model.bufferViews.emplace_back();
-    CesiumGltf::BufferView& normalBufferView =
-        model.bufferViews[normalBufferViewId];
-    normalBufferView.buffer = int32_t(normalBufferId);
-    normalBufferView.byteOffset = 0;
-    normalBufferView.byteStride = 3 * sizeof(float);
-    normalBufferView.byteLength = int64_t(normalBuffer.cesium.data.size());
-    normalBufferView.target = CesiumGltf::BufferView::Target::ARRAY_BUFFER;
-
-    const size_t normalAccessorId = model.accessors.size();
-    model.accessors.emplace_back();
-    CesiumGltf::Accessor& normalAccessor = model.accessors[normalAccessorId];
-    normalAccessor.bufferView = int32_t(normalBufferViewId);
-    normalAccessor.byteOffset = 0;
-    normalAccessor.componentType = CesiumGltf::Accessor::ComponentType::FLOAT;
-    normalAccessor.count = vertexCount + skirtVertexCount;
-    normalAccessor.type = CesiumGltf::Accessor::Type::VEC3;
-
-    primitive.attributes.emplace("NORMAL", static_cast<int>(normalAccessorId));
-  }
+  // add normals to gltf
+  const size_t normalBufferViewId = model.bufferViews.size();
+  model.bufferViews.emplace_back();
+  CesiumGltf::BufferView& normalBufferView =
+      model.bufferViews[normalBufferViewId];
+  normalBufferView.buffer = int32_t(bufferId);
+  normalBufferView.byteOffset = int64_t(normalsByteOffset);
+  normalBufferView.byteStride = 3 * sizeof(float);
+  normalBufferView.byteLength = int64_t(normalsByteLength);
+  normalBufferView.target = CesiumGltf::BufferView::Target::ARRAY_BUFFER;
+
+  const size_t normalAccessorId = model.accessors.size();
+  model.accessors.emplace_back();
+  CesiumGltf::Accessor& normalAccessor = model.accessors[normalAccessorId];
+  normalAccessor.bufferView = int32_t(normalBufferViewId);
+  normalAccessor.byteOffset = 0;
+  normalAccessor.componentType = CesiumGltf::Accessor::ComponentType::FLOAT;
+  normalAccessor.count = int64_t(outputVertexCount);
+  normalAccessor.type = CesiumGltf::Accessor::Type::VEC3;
 
-  // add indices buffer to gltf
-  const size_t indicesBufferId = model.buffers.size();
-  model.buffers.emplace_back();
-  CesiumGltf::Buffer& indicesBuffer = model.buffers[indicesBufferId];
-  indicesBuffer.byteLength = int64_t(outputIndicesBuffer.size());
-  indicesBuffer.cesium.data = std::move(outputIndicesBuffer);
+  primitive.attributes.emplace("NORMAL", static_cast<int>(normalAccessorId));
 
+  // add indices to gltf
   const size_t indicesBufferViewId = model.bufferViews.size();
   model.bufferViews.emplace_back();
   CesiumGltf::BufferView& indicesBufferView =
       model.bufferViews[indicesBufferViewId];
-  indicesBufferView.buffer = int32_t(indicesBufferId);
-  indicesBufferView.byteOffset = 0;
-  indicesBufferView.byteLength = int64_t(indicesBuffer.cesium.data.size());
+  indicesBufferView.buffer = int32_t(bufferId);
+  indicesBufferView.byteOffset = int64_t(indicesByteOffset);
+  indicesBufferView.byteLength = int64_t(indicesByteLength);
   indicesBufferView.target =
       CesiumGltf::BufferView::Target::ELEMENT_ARRAY_BUFFER;
 
@@ -1035,13 +1090,13 @@ static std::vector<std::byte> generateNormals(
   indicesAccessor.bufferView = int32_t(indicesBufferViewId);
   indicesAccessor.byteOffset = 0;
   indicesAccessor.type = CesiumGltf::Accessor::Type::SCALAR;
-  indicesAccessor.count = indicesCount + skirtIndicesCount;
+  indicesAccessor.count = int64_t(outputIndicesCount);
   indicesAccessor.componentType =
       indexSizeBytes == sizeof(uint32_t)
           ? CesiumGltf::Accessor::ComponentType::UNSIGNED_INT
           : CesiumGltf::Accessor::ComponentType::UNSIGNED_SHORT;
 
-  primitive.indices = int32_t(indicesBufferId);
+  primitive.indices = int32_t(indicesAccessorId);
 
   // add skirts info to primitive extra in case we need to upsample from it
   SkirtMeshMetadata skirtMeshMetadata;
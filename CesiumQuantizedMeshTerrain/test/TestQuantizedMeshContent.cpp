@@ -10,6 +10,7 @@
 #include <catch2/catch.hpp>
 #include <glm/glm.hpp>
 
+#include <string>
 #include <vector>
 
 using namespace Cesium3DTilesContent;
@@ -794,6 +795,10 @@ TEST_CASE("Test converting quantized mesh to gltf with skirt") {
     const CesiumGltf::Mesh& mesh = model.meshes.front();
     const CesiumGltf::MeshPrimitive& primitive = mesh.primitives.front();
 
+    // the positions, normals, and indices share a single buffer
+    CHECK(model.buffers.size() == 1);
+    CHECK(model.bufferViews.size() == 3);
+
     // make sure mesh contains grid mesh and skirts at the end
     AccessorView<uint16_t> indices(model, primitive.indices);
     CHECK(indices.status() == AccessorViewStatus::Valid);
@@ -1627,3 +1632,58 @@ TEST_CASE("Test converting ill-formed quantized mesh") {
     REQUIRE(loadResult.model == std::nullopt);
   }
 }
+
+TEST_CASE("Benchmark loading quantized mesh", "[.][benchmark]") {
+  QuadtreeTilingScheme tilingScheme(
+      CesiumGeometry::Rectangle(
+          glm::radians(-180.0),
+          glm::radians(-90.0),
+          glm::radians(180.0),
+          glm::radians(90.0)),
+      2,
+      1);
+  QuadtreeTileID tileID(10, 0, 0);
+  CesiumGeometry::Rectangle tileRectangle =
+      tilingScheme.tileToRectangle(tileID);
+  BoundingRegion boundingVolume = BoundingRegion(
+      GlobeRectangle(
+          tileRectangle.minimumX,
+          tileRectangle.minimumY,
+          tileRectangle.maximumX,
+          tileRectangle.maximumY),
+      0.0,
+      0.0,
+      Ellipsoid::WGS84);
+
+  // A typical terrain tile, and one large enough to need 32-bit indices.
+  for (uint32_t verticesWidth : {65U, 300U}) {
+    std::vector<std::byte> quantizedMeshBin;
+    if (verticesWidth * verticesWidth > 65536) {
+      quantizedMeshBin =
+          convertQuantizedMeshToBinary(createGridQuantizedMesh<uint32_t>(
+              boundingVolume,
+              verticesWidth,
+              verticesWidth));
+    } else {
+      quantizedMeshBin =
+          convertQuantizedMeshToBinary(createGridQuantizedMesh<uint16_t>(
+              boundingVolume,
+              verticesWidth,
+              verticesWidth));
+    }
+    gsl::span<const std::byte> data(
+        quantizedMeshBin.data(),
+        quantizedMeshBin.size());
+
+    BENCHMARK(
+        "Load a quantized mesh with " +
+        std::to_string(verticesWidth * verticesWidth) + " vertices") {
+      return QuantizedMeshLoader::load(
+          tileID,
+          boundingVolume,
+          "url",
+          data,
+          false);
+    };
+  }
+}
@@ -9,10 +9,15 @@
 
 #include <glm/fwd.hpp>
 
+#include <array>
 #include <optional>
 #include <string_view>
 #include <vector>
 
+namespace CesiumAsync {
+class AsyncSystem;
+}
+
 namespace CesiumGltf {
 struct Model;
 }
@@ -84,6 +89,49 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayUtilities {
           DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
       int32_t firstTextureCoordinateID = 0);
 
+  /**
+   * @brief Creates texture coordinates for mapping {@link RasterOverlay} tiles
+   * to a glTF model, using worker threads to help with large primitives.
+   *
+   * This is the same as the overload without an `asyncSystem`, except that the
+   * vertices of primitives with many vertices are divided into chunks, and
+   * worker threads from the `asyncSystem` help the calling thread to generate
+   * the texture coordinates for them. The calling thread never waits for a
+   * chunk that a worker thread has not yet started, so it is safe to call this
+   * from a worker thread. The generated texture coordinates are identical to
+   * those generated without an `asyncSystem`.
+   *
+   * @param asyncSystem The async system whose worker threads help to generate
+   * the texture coordinates.
+   * @param gltf The glTF model.
+   * @param modelToEcefTransform The transformation of this glTF to ECEF
+   * coordinates.
+   * @param globeRectangle The rectangle that all the vertices in the glTF are
+   * expected to lie within. If this parameter is std::nullopt, it is computed
+   * from the vertices.
+   * @param projections The projections for which to generate texture
+   * coordinates.
+   * @param invertVCoordinate True if the V texture coordinate should be
+   * inverted so that it is 1.0 at the Southern end of the rectangle and 0.0 at
+   * the Northern end.
+   * @param textureCoordinateAttributeBaseName The base name to use for the
+   * texture coordinate attributes, without a number on the end.
+   * @param firstTextureCoordinateID The texture coordinate ID of the first
+   * projection.
+   * @return The details of the generated texture coordinates.
+   */
+  static std::optional<RasterOverlayDetails>
+  createRasterOverlayTextureCoordinates(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      CesiumGltf::Model& gltf,
+      const glm::dmat4& modelToEcefTransform,
+      const std::optional<CesiumGeospatial::GlobeRectangle>& globeRectangle,
+      std::vector<CesiumGeospatial::Projection>&& projections,
+      bool invertVCoordinate = false,
+      const std::string_view& textureCoordinateAttributeBaseName =
+          DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
+      int32_t firstTextureCoordinateID = 0);
+
   /**
    * @brief Creates a new glTF model from one of the quadtree children of the
    * given parent model.
@@ -120,6 +168,46 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayUtilities {
       const CesiumGeospatial::Ellipsoid& ellipsoid =
           CesiumGeospatial::Ellipsoid::WGS84);
 
+  /**
+   * @brief Creates new glTF models for all four quadtree children of the given
+   * parent model.
+   *
+   * The models are the same as those created by calling
+   * {@link upsampleGltfForRasterOverlays} once for each child, but the parent
+   * model is only read once. Each triangle is clipped against the East-West
+   * boundary once for each side of it, and the scratch buffers used while
+   * clipping are shared by all of the children and primitives. When more than
+   * one child of a tile is needed, this is considerably faster than upsampling
+   * the children one at a time.
+   *
+   * @param parentModel The parent model to upsample.
+   * @param parentTileID The quadtree tile ID of the parent model. The tile IDs
+   * of the children are derived from it.
+   * @param hasInvertedVCoordinate True if the V texture coordinate has 0.0 as
+   * the Northern-most coordinate; False if the V texture coordinate has 0.0 as
+   * the Southern-most coordiante.
+   * @param textureCoordinateAttributeBaseName The base name of the attribute
+   * that holds the projected texture coordinates. The `textureCoordinateIndex`
+   * is appended to this name. Defaults to
+   * {@link DEFAULT_TEXTURE_COORDINATE_BASE_NAME}.
+   * @param textureCoordinateIndex The index of the texture coordinate set to
+   * use.
+   * @param ellipsoid The ellipsoid used to create the skirts of the children.
+   * @return The upsampled models of the southwest, southeast, northwest, and
+   * northeast children, in that order. A child that contains no part of the
+   * parent model is `std::nullopt`.
+   */
+  static std::array<std::optional<CesiumGltf::Model>, 4>
+  upsampleGltfForRasterOverlayChildren(
+      const CesiumGltf::Model& parentModel,
+      const CesiumGeometry::QuadtreeTileID& parentTileID,
+      bool hasInvertedVCoordinate = false,
+      const std::string_view& textureCoordinateAttributeBaseName =
+          DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
+      int32_t textureCoordinateIndex = 0,
+      const CesiumGeospatial::Ellipsoid& ellipsoid =
+          CesiumGeospatial::Ellipsoid::WGS84);
+
   /**
    * @brief Computes the desired screen pixels for a raster overlay texture.
    *
@@ -27,7 +27,8 @@ public:
       bool invertSelection,
       const CesiumGeospatial::Ellipsoid& ellipsoid,
       const CesiumGeospatial::Projection& projection,
-      const RasterOverlayOptions& overlayOptions = {});
+      const RasterOverlayOptions& overlayOptions = {},
+      bool antialias = false);
   virtual ~RasterizedPolygonsOverlay() override;
 
   virtual CesiumAsync::Future<CreateTileProviderResult> createTileProvider(
@@ -47,6 +48,8 @@ public:
 
   bool getInvertSelection() const noexcept { return this->_invertSelection; }
 
+  bool getAntialias() const noexcept { return this->_antialias; }
+
   const CesiumGeospatial::Ellipsoid& getEllipsoid() const noexcept {
     return this->_ellipsoid;
   }
@@ -54,6 +57,7 @@ public:
 private:
   std::vector<CesiumGeospatial::CartographicPolygon> _polygons;
   bool _invertSelection;
+  bool _antialias;
   CesiumGeospatial::Ellipsoid _ellipsoid;
   CesiumGeospatial::Projection _projection;
 };
@@ -1,3 +1,5 @@
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/forEachInParallel.h>
 #include <CesiumGeometry/clipTriangleAtAxisAlignedThreshold.h>
 #include <CesiumGeospatial/BoundingRegionBuilder.h>
 #include <CesiumGeospatial/Ellipsoid.h>
@@ -10,9 +12,16 @@
 #include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Tracing.h>
 
+#include <glm/common.hpp>
+#include <gsl/span>
+
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstring>
+#include <vector>
 
+using CesiumAsync::forEachInParallel;
 using namespace CesiumGltf;
 using namespace CesiumGltfContent;
 using namespace CesiumGeometry;
@@ -20,8 +29,14 @@ using namespace CesiumGeospatial;
 
 namespace CesiumRasterOverlays {
 
-/*static*/ std::optional<RasterOverlayDetails>
-RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+namespace {
+
+// The number of vertices in each chunk of a primitive when generating texture
+// coordinates. Worker threads help with primitives that have more than one.
+constexpr size_t textureCoordinateChunkSize = 16384;
+
+std::optional<RasterOverlayDetails> generateRasterOverlayTextureCoordinates(
+    const CesiumAsync::AsyncSystem* pAsyncSystem,
     CesiumGltf::Model& model,
     const glm::dmat4& modelToEcefTransform,
     const std::optional<CesiumGeospatial::GlobeRectangle>& globeRectangle,
@@ -63,6 +78,25 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
     rectangles[i] = projectRectangleSimple(projections[i], bounds);
   }
 
+  // Overlays often share a projection, and equal projections produce equal
+  // texture coordinates. So each position is projected only once for each
+  // distinct projection, and the result is written for every overlay that
+  // uses it.
+  std::vector<size_t> distinctProjections;
+  std::vector<size_t> projectionToDistinct(projections.size());
+  for (size_t i = 0; i < projections.size(); ++i) {
+    auto it = std::find_if(
+        distinctProjections.begin(),
+        distinctProjections.end(),
+        [&projections, i](size_t j) {
+          return projections[j] == projections[i];
+        });
+    projectionToDistinct[i] = size_t(it - distinctProjections.begin());
+    if (it == distinctProjections.end()) {
+      distinctProjections.emplace_back(i);
+    }
+  }
+
   glm::dmat4 rootTransform = modelToEcefTransform;
   rootTransform = GltfUtilities::applyRtcCenter(model, rootTransform);
   rootTransform = GltfUtilities::applyGltfUpAxisTransform(model, rootTransform);
@@ -201,107 +235,201 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
           maxs.emplace_back(&uvAccessor.max);
         }
 
-        // Generate texture coordinates for each position.
-        for (int64_t positionIndex = 0; positionIndex < positionView.size();
-             ++positionIndex) {
-          // Get the ECEF position
-          const glm::vec3 position = positionView[positionIndex];
-          const glm::dvec3 positionEcef =
-              glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
-
-          // Convert it to cartographic
-          const std::optional<CesiumGeospatial::Cartographic> cartographic =
-              ellipsoid.cartesianToCartographic(positionEcef);
-          if (!cartographic) {
-            for (CesiumGltf::AccessorWriter<glm::vec2>& uvWriter : uvWriters) {
-              uvWriter[positionIndex] = glm::dvec2(0.0, 0.0);
-            }
-            continue;
+        // The minimum and maximum texture coordinates of each chunk, for each
+        // distinct projection, and the bounds of each chunk's vertices. These
+        // are merged in chunk order once all of the chunks are done.
+        const size_t positionCount = size_t(positionView.size());
+        const size_t distinctCount = distinctProjections.size();
+        const size_t chunkCount =
+            (positionCount + textureCoordinateChunkSize - 1) /
+            textureCoordinateChunkSize;
+        std::vector<glm::dvec2> chunkMinimums(
+            chunkCount * distinctCount,
+            glm::dvec2(1.0, 1.0));
+        std::vector<glm::dvec2> chunkMaximums(
+            chunkCount * distinctCount,
+            glm::dvec2(0.0, 0.0));
+        CesiumGeospatial::BoundingRegionBuilder emptyBounds;
+        emptyBounds.setPoleTolerance(computedBounds.getPoleTolerance());
+        std::vector<CesiumGeospatial::BoundingRegionBuilder> chunkBounds(
+            chunkCount,
+            emptyBounds);
+
+        // Skirt vertices are excluded from the bounds.
+        const size_t boundsBegin = size_t(std::max(vertexBegin, int64_t(0)));
+        const size_t boundsEnd =
+            std::min(size_t(std::max(vertexEnd, int64_t(0))), positionCount);
+
+        forEachInParallel(pAsyncSystem, chunkCount, [&](size_t chunkIndex) {
+          const size_t chunkBegin = chunkIndex * textureCoordinateChunkSize;
+          const size_t chunkEnd =
+              std::min(chunkBegin + textureCoordinateChunkSize, positionCount);
+          const size_t chunkLength = chunkEnd - chunkBegin;
+
+          // Get the ECEF positions and convert them all to cartographic at
+          // once, in scratch buffers that only hold this chunk.
+          std::vector<double> scratch(6 * chunkLength);
+          const gsl::span<double> scratchSpan(scratch);
+          const gsl::span<double> ecefX = scratchSpan.subspan(0, chunkLength);
+          const gsl::span<double> ecefY =
+              scratchSpan.subspan(chunkLength, chunkLength);
+          const gsl::span<double> ecefZ =
+              scratchSpan.subspan(2 * chunkLength, chunkLength);
+          const gsl::span<double> longitudes =
+              scratchSpan.subspan(3 * chunkLength, chunkLength);
+          const gsl::span<double> latitudes =
+              scratchSpan.subspan(4 * chunkLength, chunkLength);
+          const gsl::span<double> heights =
+              scratchSpan.subspan(5 * chunkLength, chunkLength);
+          for (size_t i = 0; i < chunkLength; ++i) {
+            const glm::vec3 position = positionView[int64_t(chunkBegin + i)];
+            const glm::dvec3 positionEcef =
+                glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
+            ecefX[i] = positionEcef.x;
+            ecefY[i] = positionEcef.y;
+            ecefZ[i] = positionEcef.z;
           }
 
-          // exclude skirt vertices from bounds
-          if (positionIndex >= vertexBegin && positionIndex < vertexEnd) {
-            computedBounds.expandToIncludePosition(*cartographic);
-          }
+          ellipsoid.cartesianToCartographic(
+              ecefX,
+              ecefY,
+              ecefZ,
+              longitudes,
+              latitudes,
+              heights);
+
+          glm::dvec2* pMinimums =
+              chunkMinimums.data() + chunkIndex * distinctCount;
+          glm::dvec2* pMaximums =
+              chunkMaximums.data() + chunkIndex * distinctCount;
+          CesiumGeospatial::BoundingRegionBuilder& vertexBounds =
+              chunkBounds[chunkIndex];
+          std::vector<glm::vec2> distinctUvs(distinctCount);
+
+          // Generate texture coordinates for each position.
+          for (size_t i = 0; i < chunkLength; ++i) {
+            const int64_t positionIndex = int64_t(chunkBegin + i);
+            if (std::isnan(longitudes[i])) {
+              for (CesiumGltf::AccessorWriter<glm::vec2>& uvWriter :
+                   uvWriters) {
+                uvWriter[positionIndex] = glm::dvec2(0.0, 0.0);
+              }
+              continue;
+            }
+
+            const CesiumGeospatial::Cartographic cartographic(
+                longitudes[i],
+                latitudes[i],
+                heights[i]);
+
+            if (chunkBegin + i >= boundsBegin && chunkBegin + i < boundsEnd) {
+              vertexBounds.expandToIncludePosition(cartographic);
+            }
+
+            // Generate texture coordinates at this position for each distinct
+            // projection
+            for (size_t distinctIndex = 0; distinctIndex < distinctCount;
+                 ++distinctIndex) {
+              const size_t projectionIndex =
+                  distinctProjections[distinctIndex];
+              const CesiumGeospatial::Projection& projection =
+                  projections[projectionIndex];
+              const CesiumGeometry::Rectangle& rectangle =
+                  rectangles[projectionIndex];
+
+              // Project it with the raster overlay's projection
+              glm::dvec3 projectedPosition =
+                  projectPosition(projection, cartographic);
+
+              double longitude = cartographic.longitude;
+              const double latitude = cartographic.latitude;
+              const double ellipsoidHeight = cartographic.height;
+
+              // If the position is near the anti-meridian and the projected
+              // position is outside the expected range, try using the
+              // equivalent longitude on the other side of the anti-meridian to
+              // see if that gets us closer.
+              if (glm::abs(
+                      glm::abs(cartographic.longitude) -
+                      CesiumUtility::Math::OnePi) <
+                      CesiumUtility::Math::Epsilon5 &&
+                  (projectedPosition.x < rectangle.minimumX ||
+                   projectedPosition.x > rectangle.maximumX ||
+                   projectedPosition.y < rectangle.minimumY ||
+                   projectedPosition.y > rectangle.maximumY)) {
+                const double testLongitude = longitude + longitude < 0.0
+                                                 ? CesiumUtility::Math::TwoPi
+                                                 : -CesiumUtility::Math::TwoPi;
+                const glm::dvec3 projectedPosition2 = projectPosition(
+                    projection,
+                    CesiumGeospatial::Cartographic(
+                        testLongitude,
+                        latitude,
+                        ellipsoidHeight));
+
+                const double distance1 = rectangle.computeSignedDistance(
+                    glm::dvec2(projectedPosition));
+                const double distance2 = rectangle.computeSignedDistance(
+                    glm::dvec2(projectedPosition2));
+
+                if (distance2 < distance1) {
+                  projectedPosition = projectedPosition2;
+                  longitude = testLongitude;
+                }
+              }
 
-          // Generate texture coordinates at this position for each projection
-          for (size_t projectionIndex = 0; projectionIndex < projections.size();
-               ++projectionIndex) {
-            const CesiumGeospatial::Projection& projection =
-                projections[projectionIndex];
-            const CesiumGeometry::Rectangle& rectangle =
-                rectangles[projectionIndex];
-
-            // Project it with the raster overlay's projection
-            glm::dvec3 projectedPosition =
-                projectPosition(projection, cartographic.value());
-
-            double longitude = cartographic.value().longitude;
-            const double latitude = cartographic.value().latitude;
-            const double ellipsoidHeight = cartographic.value().height;
-
-            // If the position is near the anti-meridian and the projected
-            // position is outside the expected range, try using the equivalent
-            // longitude on the other side of the anti-meridian to see if that
-            // gets us closer.
-            if (glm::abs(
-                    glm::abs(cartographic.value().longitude) -
-                    CesiumUtility::Math::OnePi) <
-                    CesiumUtility::Math::Epsilon5 &&
-                (projectedPosition.x < rectangle.minimumX ||
-                 projectedPosition.x > rectangle.maximumX ||
-                 projectedPosition.y < rectangle.minimumY ||
-                 projectedPosition.y > rectangle.maximumY)) {
-              const double testLongitude = longitude + longitude < 0.0
-                                               ? CesiumUtility::Math::TwoPi
-                                               : -CesiumUtility::Math::TwoPi;
-              const glm::dvec3 projectedPosition2 = projectPosition(
-                  projection,
-                  CesiumGeospatial::Cartographic(
-                      testLongitude,
-                      latitude,
-                      ellipsoidHeight));
-
-              const double distance1 = rectangle.computeSignedDistance(
-                  glm::dvec2(projectedPosition));
-              const double distance2 = rectangle.computeSignedDistance(
-                  glm::dvec2(projectedPosition2));
-
-              if (distance2 < distance1) {
-                projectedPosition = projectedPosition2;
-                longitude = testLongitude;
+              // Scale to (0.0, 0.0) at the (minimumX, minimumY) corner, and
+              // (1.0, 1.0) at the (maximumX, maximumY) corner. The coordinates
+              // should stay inside these bounds if the input rectangle actually
+              // bounds the vertices, but we'll clamp to be safe.
+              glm::vec2 uv(
+                  CesiumUtility::Math::clamp(
+                      (projectedPosition.x - rectangle.minimumX) /
+                          rectangle.computeWidth(),
+                      0.0,
+                      1.0),
+                  CesiumUtility::Math::clamp(
+                      (projectedPosition.y - rectangle.minimumY) /
+                          rectangle.computeHeight(),
+                      0.0,
+                      1.0));
+
+              if (invertVCoordinate) {
+                uv.y = 1.0f - uv.y;
               }
+
+              pMinimums[distinctIndex] =
+                  glm::min(pMinimums[distinctIndex], glm::dvec2(uv));
+              pMaximums[distinctIndex] =
+                  glm::max(pMaximums[distinctIndex], glm::dvec2(uv));
+              distinctUvs[distinctIndex] = uv;
             }
 
-            // Scale to (0.0, 0.0) at the (minimumX, minimumY) corner, and
-            // (1.0, 1.0) at the (maximumX, maximumY) corner. The coordinates
-            // should stay inside these bounds if the input rectangle actually
-            // bounds the vertices, but we'll clamp to be safe.
-            glm::vec2 uv(
-                CesiumUtility::Math::clamp(
-                    (projectedPosition.x - rectangle.minimumX) /
-                        rectangle.computeWidth(),
-                    0.0,
-                    1.0),
-                CesiumUtility::Math::clamp(
-                    (projectedPosition.y - rectangle.minimumY) /
-                        rectangle.computeHeight(),
-                    0.0,
-                    1.0));
-
-            if (invertVCoordinate) {
-              uv.y = 1.0f - uv.y;
+            for (size_t projectionIndex = 0;
+                 projectionIndex < projections.size();
+                 ++projectionIndex) {
+              uvWriters[projectionIndex][positionIndex] =
+                  distinctUvs[projectionToDistinct[projectionIndex]];
             }
+          }
+        });
 
-            mins[projectionIndex]->at(0) =
-                glm::min(mins[projectionIndex]->at(0), double(uv.x));
-            mins[projectionIndex]->at(1) =
-                glm::min(mins[projectionIndex]->at(1), double(uv.y));
-            maxs[projectionIndex]->at(0) =
-                glm::max(maxs[projectionIndex]->at(0), double(uv.x));
-            maxs[projectionIndex]->at(1) =
-                glm::max(maxs[projectionIndex]->at(1), double(uv.y));
-            uvWriters[projectionIndex][positionIndex] = uv;
+        for (const CesiumGeospatial::BoundingRegionBuilder& vertexBounds :
+             chunkBounds) {
+          computedBounds.expandToIncludeRegion(vertexBounds);
+        }
+
+        for (size_t projectionIndex = 0; projectionIndex < projections.size();
+             ++projectionIndex) {
+          const size_t distinctIndex = projectionToDistinct[projectionIndex];
+          std::vector<double>& minimum = *mins[projectionIndex];
+          std::vector<double>& maximum = *maxs[projectionIndex];
+          for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex) {
+            const size_t index = chunkIndex * distinctCount + distinctIndex;
+            minimum[0] = glm::min(minimum[0], chunkMinimums[index].x);
+            minimum[1] = glm::min(minimum[1], chunkMinimums[index].y);
+            maximum[0] = glm::max(maximum[0], chunkMaximums[index].x);
+            maximum[1] = glm::max(maximum[1], chunkMaximums[index].y);
           }
         }
       };
@@ -314,6 +442,49 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
       computedBounds.toRegion(ellipsoid)};
 }
 
+} // namespace
+
+/*static*/ std::optional<RasterOverlayDetails>
+RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+    CesiumGltf::Model& model,
+    const glm::dmat4& modelToEcefTransform,
+    const std::optional<CesiumGeospatial::GlobeRectangle>& globeRectangle,
+    std::vector<CesiumGeospatial::Projection>&& projections,
+    bool invertVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t firstTextureCoordinateID) {
+  return generateRasterOverlayTextureCoordinates(
+      nullptr,
+      model,
+      modelToEcefTransform,
+      globeRectangle,
+      std::move(projections),
+      invertVCoordinate,
+      textureCoordinateAttributeBaseName,
+      firstTextureCoordinateID);
+}
+
+/*static*/ std::optional<RasterOverlayDetails>
+RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    CesiumGltf::Model& model,
+    const glm::dmat4& modelToEcefTransform,
+    const std::optional<CesiumGeospatial::GlobeRectangle>& globeRectangle,
+    std::vector<CesiumGeospatial::Projection>&& projections,
+    bool invertVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t firstTextureCoordinateID) {
+  return generateRasterOverlayTextureCoordinates(
+      &asyncSystem,
+      model,
+      modelToEcefTransform,
+      globeRectangle,
+      std::move(projections),
+      invertVCoordinate,
+      textureCoordinateAttributeBaseName,
+      firstTextureCoordinateID);
+}
+
 namespace {
 struct EdgeVertex {
   uint32_t index;
@@ -325,18 +496,14 @@ struct EdgeIndices {
   std::vector<EdgeVertex> south;
   std::vector<EdgeVertex> east;
   std::vector<EdgeVertex> north;
-};
 
-bool upsamplePrimitiveForRasterOverlays(
-    const Model& parentModel,
-    Model& model,
-    Mesh& mesh,
-    MeshPrimitive& primitive,
-    CesiumGeometry::UpsampledQuadtreeNode childID,
-    bool hasInvertedVCoordinate,
-    const std::string_view& textureCoordinateAttributeBaseName,
-    int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid);
+  void clear() noexcept {
+    west.clear();
+    south.clear();
+    east.clear();
+    north.clear();
+  }
+};
 
 struct FloatVertexAttribute {
   const std::vector<std::byte>& buffer;
@@ -348,6 +515,69 @@ struct FloatVertexAttribute {
   std::vector<double> maximums;
 };
 
+// The scratch buffers used to upsample a primitive for one child. They're
+// cleared rather than freed between primitives, so they're only allocated
+// once for all of the primitives of a model.
+struct UpsampledChildScratch {
+  // Maps old (parentModel) vertex indices to new (model) vertex indices.
+  std::vector<uint32_t> vertexMap;
+  std::vector<float> vertexFloats;
+  std::vector<uint32_t> indices;
+  EdgeIndices edgeIndices;
+};
+
+// The scratch buffers used while upsampling the children of a model.
+struct UpsampleScratch {
+  std::vector<uint32_t> clipVertexToIndices;
+  std::vector<CesiumGeometry::TriangleClipVertex> clippedA;
+  std::vector<CesiumGeometry::TriangleClipVertex> clippedB;
+  std::vector<UpsampledChildScratch> children;
+};
+
+// A primitive of a child model that is being upsampled from the corresponding
+// primitive of the parent model.
+struct UpsampledPrimitive {
+  UpsampledPrimitive(
+      Model& model_,
+      MeshPrimitive& primitive_,
+      CesiumGeometry::UpsampledQuadtreeNode childID_,
+      UpsampledChildScratch& scratch_) noexcept
+      : model(model_),
+        primitive(primitive_),
+        childID(childID_),
+        scratch(scratch_) {}
+
+  Model& model;
+  MeshPrimitive& primitive;
+  CesiumGeometry::UpsampledQuadtreeNode childID;
+  UpsampledChildScratch& scratch;
+
+  bool keepAboveU = false;
+  bool keepAboveV = false;
+  std::vector<FloatVertexAttribute> attributes;
+  int64_t vertexSizeFloats = 0;
+  int32_t positionAttributeIndex = -1;
+  size_t vertexBufferIndex = 0;
+  size_t indexBufferIndex = 0;
+  size_t vertexBufferViewIndex = 0;
+  size_t indexBufferViewIndex = 0;
+
+  // Whether any part of the parent primitive is inside this child.
+  bool keep = false;
+};
+
+// Upsamples a primitive of the parent model for each of the given children in
+// a single pass over its triangles.
+void upsamplePrimitiveForRasterOverlays(
+    const Model& parentModel,
+    const MeshPrimitive& parentPrimitive,
+    gsl::span<UpsampledPrimitive> children,
+    UpsampleScratch& scratch,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid);
+
 void addClippedPolygon(
     std::vector<float>& output,
     std::vector<uint32_t>& indices,
@@ -405,15 +635,13 @@ void copyImages(const Model& parentModel, Model& result);
 void copyMetadataTables(const Model& parentModel, Model& result);
 } // namespace
 
-/*static*/ std::optional<Model>
-RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+namespace {
+// Creates a child model with everything in the parent model except for the
+// buffers, bufferViews, and accessors of its primitives, which are rewritten
+// when the primitives are upsampled.
+Model createUpsampledModel(
     const Model& parentModel,
-    UpsampledQuadtreeNode childID,
-    bool hasInvertedVCoordinate,
-    const std::string_view& textureCoordinateAttributeBaseName,
-    int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
-  CESIUM_TRACE("upsampleGltfForRasterOverlays");
+    UpsampledQuadtreeNode childID) {
   Model result;
 
   // Copy the entire parent model except for the buffers, bufferViews, and
@@ -459,35 +687,152 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
     nameIt->second = name;
   }
 
-  bool containsPrimitives = false;
+  return result;
+}
+
+// Upsamples the given children of a model. Each primitive of the parent is
+// read once for all of the children, and the scratch buffers are shared by all
+// of the primitives.
+std::vector<std::optional<Model>> upsampleModelsForRasterOverlays(
+    const Model& parentModel,
+    gsl::span<const UpsampledQuadtreeNode> childIDs,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  const size_t childCount = childIDs.size();
 
-  for (Mesh& mesh : result.meshes) {
-    for (size_t i = 0; i < mesh.primitives.size(); ++i) {
-      MeshPrimitive& primitive = mesh.primitives[i];
+  std::vector<Model> results;
+  results.reserve(childCount);
+  for (const UpsampledQuadtreeNode& childID : childIDs) {
+    results.emplace_back(createUpsampledModel(parentModel, childID));
+  }
+
+  UpsampleScratch scratch;
+  scratch.children.resize(childCount);
+
+  std::vector<UpsampledPrimitive> children;
+  children.reserve(childCount);
+  std::vector<bool> keep;
+  std::vector<bool> containsPrimitives(childCount, false);
+
+  for (size_t meshIndex = 0; meshIndex < parentModel.meshes.size();
+       ++meshIndex) {
+    const Mesh& parentMesh = parentModel.meshes[meshIndex];
+    const size_t primitiveCount = parentMesh.primitives.size();
+    keep.assign(primitiveCount * childCount, false);
+
+    for (size_t i = 0; i < primitiveCount; ++i) {
+      children.clear();
+      for (size_t j = 0; j < childCount; ++j) {
+        children.emplace_back(
+            results[j],
+            results[j].meshes[meshIndex].primitives[i],
+            childIDs[j],
+            scratch.children[j]);
+      }
 
-      bool keep = upsamplePrimitiveForRasterOverlays(
+      upsamplePrimitiveForRasterOverlays(
           parentModel,
-          result,
-          mesh,
-          primitive,
-          childID,
+          parentMesh.primitives[i],
+          children,
+          scratch,
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
           ellipsoid);
 
-      // We're assuming here that nothing references primitives by index, so we
-      // can remove them without any drama.
-      if (!keep) {
-        mesh.primitives.erase(mesh.primitives.begin() + int64_t(i));
-        --i;
+      for (size_t j = 0; j < childCount; ++j) {
+        keep[i * childCount + j] = children[j].keep;
+      }
+    }
+
+    // We're assuming here that nothing references primitives by index, so we
+    // can remove them without any drama.
+    for (size_t j = 0; j < childCount; ++j) {
+      std::vector<MeshPrimitive>& primitives =
+          results[j].meshes[meshIndex].primitives;
+      size_t keptCount = 0;
+      for (size_t i = 0; i < primitiveCount; ++i) {
+        if (keep[i * childCount + j]) {
+          if (keptCount != i) {
+            primitives[keptCount] = std::move(primitives[i]);
+          }
+          ++keptCount;
+        }
       }
-      containsPrimitives |= !mesh.primitives.empty();
+      primitives.erase(
+          primitives.begin() + int64_t(keptCount),
+          primitives.end());
+      containsPrimitives[j] = containsPrimitives[j] || !primitives.empty();
     }
   }
 
-  return containsPrimitives ? std::make_optional<Model>(std::move(result))
-                            : std::nullopt;
+  std::vector<std::optional<Model>> upsampledModels(childCount);
+  for (size_t j = 0; j < childCount; ++j) {
+    if (containsPrimitives[j]) {
+      upsampledModels[j] = std::move(results[j]);
+    }
+  }
+
+  return upsampledModels;
+}
+} // namespace
+
+/*static*/ std::optional<Model>
+RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+    const Model& parentModel,
+    UpsampledQuadtreeNode childID,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  CESIUM_TRACE("upsampleGltfForRasterOverlays");
+  std::vector<std::optional<Model>> upsampledModels =
+      upsampleModelsForRasterOverlays(
+          parentModel,
+          gsl::span<const UpsampledQuadtreeNode>(&childID, 1),
+          hasInvertedVCoordinate,
+          textureCoordinateAttributeBaseName,
+          textureCoordinateIndex,
+          ellipsoid);
+  return std::move(upsampledModels[0]);
+}
+
+/*static*/ std::array<std::optional<Model>, 4>
+RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+    const Model& parentModel,
+    const QuadtreeTileID& parentTileID,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  CESIUM_TRACE("upsampleGltfForRasterOverlayChildren");
+
+  auto getChildID = [&parentTileID](uint32_t x, uint32_t y) {
+    return UpsampledQuadtreeNode{QuadtreeTileID(
+        parentTileID.level + 1,
+        parentTileID.x * 2 + x,
+        parentTileID.y * 2 + y)};
+  };
+  const std::array<UpsampledQuadtreeNode, 4> childIDs{
+      getChildID(0, 0),
+      getChildID(1, 0),
+      getChildID(0, 1),
+      getChildID(1, 1)};
+
+  std::vector<std::optional<Model>> upsampledModels =
+      upsampleModelsForRasterOverlays(
+          parentModel,
+          childIDs,
+          hasInvertedVCoordinate,
+          textureCoordinateAttributeBaseName,
+          textureCoordinateIndex,
+          ellipsoid);
+
+  std::array<std::optional<Model>, 4> result;
+  std::move(upsampledModels.begin(), upsampledModels.end(), result.begin());
+  return result;
 }
 
 /*static*/ glm::dvec2 RasterOverlayUtilities::computeDesiredScreenPixels(
@@ -763,47 +1108,46 @@ T getVertexValue(
   return std::visit(Operation{accessor, complements}, vertex);
 }
 
-template <class TIndex>
-bool upsamplePrimitiveForRasterOverlays(
+// Adds the buffers, bufferViews, and accessors of an upsampled primitive to a
+// child model, and removes the attributes that can't be upsampled. Returns the
+// index of the parent accessor with the texture coordinates that guide the
+// upsampling, or -1 if the primitive has none.
+int32_t prepareUpsampledPrimitive(
     const Model& parentModel,
-    Model& model,
-    Mesh& /*mesh*/,
-    MeshPrimitive& primitive,
-    CesiumGeometry::UpsampledQuadtreeNode childID,
-    bool hasInvertedVCoordinate,
+    UpsampledPrimitive& child,
     const std::string_view& textureCoordinateAttributeBaseName,
-    int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
-  CESIUM_TRACE("upsamplePrimitiveForRasterOverlays");
+    int32_t textureCoordinateIndex) {
+  Model& model = child.model;
+  MeshPrimitive& primitive = child.primitive;
+
+  child.keepAboveU = !isWestChild(child.childID);
+  child.keepAboveV = !isSouthChild(child.childID);
 
   // Add up the per-vertex size of all attributes and create buffers,
   // bufferViews, and accessors
-  std::vector<FloatVertexAttribute> attributes;
-  attributes.reserve(primitive.attributes.size());
+  child.attributes.reserve(primitive.attributes.size());
 
-  const size_t vertexBufferIndex = model.buffers.size();
+  child.vertexBufferIndex = model.buffers.size();
   model.buffers.emplace_back();
 
-  const size_t indexBufferIndex = model.buffers.size();
+  child.indexBufferIndex = model.buffers.size();
   model.buffers.emplace_back();
 
-  const size_t vertexBufferViewIndex = model.bufferViews.size();
+  child.vertexBufferViewIndex = model.bufferViews.size();
   model.bufferViews.emplace_back();
 
-  const size_t indexBufferViewIndex = model.bufferViews.size();
+  child.indexBufferViewIndex = model.bufferViews.size();
   model.bufferViews.emplace_back();
 
-  BufferView& vertexBufferView = model.bufferViews[vertexBufferViewIndex];
-  vertexBufferView.buffer = static_cast<int>(vertexBufferIndex);
+  BufferView& vertexBufferView = model.bufferViews[child.vertexBufferViewIndex];
+  vertexBufferView.buffer = static_cast<int>(child.vertexBufferIndex);
   vertexBufferView.target = BufferView::Target::ARRAY_BUFFER;
 
-  BufferView& indexBufferView = model.bufferViews[indexBufferViewIndex];
-  indexBufferView.buffer = static_cast<int>(indexBufferIndex);
+  BufferView& indexBufferView = model.bufferViews[child.indexBufferViewIndex];
+  indexBufferView.buffer = static_cast<int>(child.indexBufferIndex);
   indexBufferView.target = BufferView::Target::ELEMENT_ARRAY_BUFFER;
 
-  int64_t vertexSizeFloats = 0;
   int32_t uvAccessorIndex = -1;
-  int32_t positionAttributeIndex = -1;
 
   std::vector<std::string> toRemove;
 
@@ -862,14 +1206,14 @@ bool upsamplePrimitiveForRasterOverlays(
     attribute.second = static_cast<int>(model.accessors.size());
     model.accessors.emplace_back();
     Accessor& newAccessor = model.accessors.back();
-    newAccessor.bufferView = static_cast<int>(vertexBufferViewIndex);
-    newAccessor.byteOffset = vertexSizeFloats * int64_t(sizeof(float));
+    newAccessor.bufferView = static_cast<int>(child.vertexBufferViewIndex);
+    newAccessor.byteOffset = child.vertexSizeFloats * int64_t(sizeof(float));
     newAccessor.componentType = Accessor::ComponentType::FLOAT;
     newAccessor.type = accessor.type;
 
-    vertexSizeFloats += accessorComponentElements;
+    child.vertexSizeFloats += accessorComponentElements;
 
-    attributes.push_back(FloatVertexAttribute{
+    child.attributes.push_back(FloatVertexAttribute{
         buffer.cesium.data,
         bufferView.byteOffset + accessor.byteOffset,
         accessorByteStride,
@@ -885,167 +1229,84 @@ bool upsamplePrimitiveForRasterOverlays(
 
     // get position to be used to create skirts later
     if (attribute.first == "POSITION") {
-      positionAttributeIndex = int32_t(attributes.size() - 1);
+      child.positionAttributeIndex = int32_t(child.attributes.size() - 1);
     }
   }
 
-  if (uvAccessorIndex == -1) {
-    // We don't know how to divide this primitive, so just remove it.
-    return false;
-  }
-
   for (const std::string& attribute : toRemove) {
     primitive.attributes.erase(attribute);
   }
 
-  const bool keepAboveU = !isWestChild(childID);
-  const bool keepAboveV = !isSouthChild(childID);
-
-  const AccessorView<glm::vec2> uvView(parentModel, uvAccessorIndex);
-  const AccessorView<TIndex> indicesView(parentModel, primitive.indices);
-
-  if (uvView.status() != AccessorViewStatus::Valid ||
-      indicesView.status() != AccessorViewStatus::Valid) {
-    return false;
-  }
+  return uvAccessorIndex;
+}
 
-  // check if the primitive has skirts
-  int64_t indicesBegin = 0;
-  int64_t indicesCount = indicesView.size();
-  std::optional<SkirtMeshMetadata> parentSkirtMeshMetadata =
-      SkirtMeshMetadata::parseFromGltfExtras(primitive.extras);
-  const bool hasSkirt = (parentSkirtMeshMetadata != std::nullopt) &&
-                        (positionAttributeIndex != -1);
+// Clips a triangle of the East-West clip result in the shared scratch buffers
+// against the North-South boundary of a child, and adds the clipped triangle
+// or quad, if any, to the child.
+void addClippedTriangle(
+    UpsampledPrimitive& child,
+    UpsampleScratch& scratch,
+    const AccessorView<glm::vec2>& uvView,
+    bool hasInvertedVCoordinate,
+    bool hasSkirt,
+    const std::array<int, 3>& clipIndices,
+    const std::array<double, 3>& clipValues) {
+  UpsampledChildScratch& childScratch = child.scratch;
+
+  scratch.clipVertexToIndices.clear();
+  scratch.clippedB.clear();
+  clipTriangleAtAxisAlignedThreshold(
+      0.5,
+      hasInvertedVCoordinate ? !child.keepAboveV : child.keepAboveV,
+      clipIndices[0],
+      clipIndices[1],
+      clipIndices[2],
+      clipValues[0],
+      clipValues[1],
+      clipValues[2],
+      scratch.clippedB);
+
+  addClippedPolygon(
+      childScratch.vertexFloats,
+      childScratch.indices,
+      child.attributes,
+      childScratch.vertexMap,
+      scratch.clipVertexToIndices,
+      scratch.clippedA,
+      scratch.clippedB);
   if (hasSkirt) {
-    indicesBegin = parentSkirtMeshMetadata->noSkirtIndicesBegin;
-    indicesCount = parentSkirtMeshMetadata->noSkirtIndicesCount;
-  }
-
-  std::vector<uint32_t> clipVertexToIndices;
-  std::vector<CesiumGeometry::TriangleClipVertex> clippedA;
-  std::vector<CesiumGeometry::TriangleClipVertex> clippedB;
-
-  // Maps old (parentModel) vertex indices to new (model) vertex indices.
-  std::vector<uint32_t> vertexMap(
-      size_t(uvView.size()),
-      std::numeric_limits<uint32_t>::max());
-
-  // std::vector<unsigned char> newVertexBuffer(vertexSizeFloats *
-  // sizeof(float)); gsl::span<float>
-  // newVertexFloats(reinterpret_cast<float*>(newVertexBuffer.data()),
-  // newVertexBuffer.size() / sizeof(float));
-  std::vector<float> newVertexFloats;
-  std::vector<uint32_t> indices;
-  EdgeIndices edgeIndices;
-
-  for (int64_t i = indicesBegin; i < indicesBegin + indicesCount; i += 3) {
-    TIndex i0 = indicesView[i];
-    TIndex i1 = indicesView[i + 1];
-    TIndex i2 = indicesView[i + 2];
-
-    const glm::vec2 uv0 = uvView[i0];
-    const glm::vec2 uv1 = uvView[i1];
-    const glm::vec2 uv2 = uvView[i2];
-
-    // Clip this triangle against the East-West boundary
-    clippedA.clear();
-    clipTriangleAtAxisAlignedThreshold(
+    addEdge(
+        childScratch.edgeIndices,
         0.5,
-        keepAboveU,
-        static_cast<int>(i0),
-        static_cast<int>(i1),
-        static_cast<int>(i2),
-        uv0.x,
-        uv1.x,
-        uv2.x,
-        clippedA);
-
-    if (clippedA.size() < 3) {
-      // No part of this triangle is inside the target tile.
-      continue;
-    }
-
-    // Clip the first clipped triange against the North-South boundary
-    clipVertexToIndices.clear();
-    clippedB.clear();
-    clipTriangleAtAxisAlignedThreshold(
         0.5,
-        hasInvertedVCoordinate ? !keepAboveV : keepAboveV,
-        ~0,
-        ~1,
-        ~2,
-        getVertexValue(uvView, clippedA[0]).y,
-        getVertexValue(uvView, clippedA[1]).y,
-        getVertexValue(uvView, clippedA[2]).y,
-        clippedB);
-
-    // Add the clipped triangle or quad, if any
-    addClippedPolygon(
-        newVertexFloats,
-        indices,
-        attributes,
-        vertexMap,
-        clipVertexToIndices,
-        clippedA,
-        clippedB);
-    if (hasSkirt) {
-      addEdge(
-          edgeIndices,
-          0.5,
-          0.5,
-          keepAboveU,
-          keepAboveV,
-          hasInvertedVCoordinate,
-          uvView,
-          clipVertexToIndices,
-          clippedA,
-          clippedB);
-    }
-
-    // If the East-West clip yielded a quad (rather than a triangle), clip the
-    // second triangle of the quad, too.
-    if (clippedA.size() > 3) {
-      clipVertexToIndices.clear();
-      clippedB.clear();
-      clipTriangleAtAxisAlignedThreshold(
-          0.5,
-          hasInvertedVCoordinate ? !keepAboveV : keepAboveV,
-          ~0,
-          ~2,
-          ~3,
-          getVertexValue(uvView, clippedA[0]).y,
-          getVertexValue(uvView, clippedA[2]).y,
-          getVertexValue(uvView, clippedA[3]).y,
-          clippedB);
-
-      // Add the clipped triangle or quad, if any
-      addClippedPolygon(
-          newVertexFloats,
-          indices,
-          attributes,
-          vertexMap,
-          clipVertexToIndices,
-          clippedA,
-          clippedB);
-      if (hasSkirt) {
-        addEdge(
-            edgeIndices,
-            0.5,
-            0.5,
-            keepAboveU,
-            keepAboveV,
-            hasInvertedVCoordinate,
-            uvView,
-            clipVertexToIndices,
-            clippedA,
-            clippedB);
-      }
-    }
+        child.keepAboveU,
+        child.keepAboveV,
+        hasInvertedVCoordinate,
+        uvView,
+        scratch.clipVertexToIndices,
+        scratch.clippedA,
+        scratch.clippedB);
   }
+}
+
+// Adds the skirts and writes the vertices and indices of an upsampled
+// primitive to the buffers of its child model. Returns false if no part of the
+// primitive is inside the child.
+bool finishUpsampledPrimitive(
+    UpsampledPrimitive& child,
+    const std::optional<SkirtMeshMetadata>& parentSkirtMeshMetadata,
+    bool hasInvertedVCoordinate,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  Model& model = child.model;
+  MeshPrimitive& primitive = child.primitive;
+  const CesiumGeometry::UpsampledQuadtreeNode childID = child.childID;
+  std::vector<float>& newVertexFloats = child.scratch.vertexFloats;
+  std::vector<uint32_t>& indices = child.scratch.indices;
+  const int64_t vertexSizeFloats = child.vertexSizeFloats;
 
   // create mesh with skirt
   std::optional<SkirtMeshMetadata> skirtMeshMetadata;
-  if (hasSkirt) {
+  if (parentSkirtMeshMetadata) {
     skirtMeshMetadata = std::make_optional<SkirtMeshMetadata>();
     skirtMeshMetadata->noSkirtIndicesBegin = 0;
     skirtMeshMetadata->noSkirtIndicesCount =
@@ -1057,13 +1318,13 @@ bool upsamplePrimitiveForRasterOverlays(
     addSkirts(
         newVertexFloats,
         indices,
-        attributes,
+        child.attributes,
         childID,
         *skirtMeshMetadata,
         *parentSkirtMeshMetadata,
-        edgeIndices,
+        child.scratch.edgeIndices,
         vertexSizeFloats,
-        positionAttributeIndex,
+        child.positionAttributeIndex,
         hasInvertedVCoordinate,
         ellipsoid);
   }
@@ -1075,7 +1336,7 @@ bool upsamplePrimitiveForRasterOverlays(
   // Update the accessor vertex counts and min/max values
   const int64_t numberOfVertices =
       int64_t(newVertexFloats.size()) / vertexSizeFloats;
-  for (const FloatVertexAttribute& attribute : attributes) {
+  for (FloatVertexAttribute& attribute : child.attributes) {
     Accessor& accessor =
         model.accessors[static_cast<size_t>(attribute.accessorIndex)];
     accessor.count = numberOfVertices;
@@ -1087,14 +1348,16 @@ bool upsamplePrimitiveForRasterOverlays(
   const size_t indexAccessorIndex = model.accessors.size();
   model.accessors.emplace_back();
   Accessor& newIndicesAccessor = model.accessors.back();
-  newIndicesAccessor.bufferView = static_cast<int>(indexBufferViewIndex);
+  newIndicesAccessor.bufferView =
+      static_cast<int>(child.indexBufferViewIndex);
   newIndicesAccessor.byteOffset = 0;
   newIndicesAccessor.count = int64_t(indices.size());
   newIndicesAccessor.componentType = Accessor::ComponentType::UNSIGNED_INT;
   newIndicesAccessor.type = Accessor::Type::SCALAR;
 
   // Populate the buffers
-  Buffer& vertexBuffer = model.buffers[vertexBufferIndex];
+  BufferView& vertexBufferView = model.bufferViews[child.vertexBufferViewIndex];
+  Buffer& vertexBuffer = model.buffers[child.vertexBufferIndex];
   vertexBuffer.cesium.data.resize(newVertexFloats.size() * sizeof(float));
   float* pAsFloats = reinterpret_cast<float*>(vertexBuffer.cesium.data.data());
   std::copy(newVertexFloats.begin(), newVertexFloats.end(), pAsFloats);
@@ -1102,7 +1365,8 @@ bool upsamplePrimitiveForRasterOverlays(
       int64_t(vertexBuffer.cesium.data.size());
   vertexBufferView.byteStride = vertexSizeFloats * int64_t(sizeof(float));
 
-  Buffer& indexBuffer = model.buffers[indexBufferIndex];
+  BufferView& indexBufferView = model.bufferViews[child.indexBufferViewIndex];
+  Buffer& indexBuffer = model.buffers[child.indexBufferIndex];
   indexBuffer.cesium.data.resize(indices.size() * sizeof(uint32_t));
   uint32_t* pAsUint32s =
       reinterpret_cast<uint32_t*>(indexBuffer.cesium.data.data());
@@ -1157,7 +1421,7 @@ bool upsamplePrimitiveForRasterOverlays(
   }
 
   // add skirts to extras to be upsampled later if needed
-  if (hasSkirt) {
+  if (skirtMeshMetadata) {
     primitive.extras = SkirtMeshMetadata::createGltfExtras(*skirtMeshMetadata);
   }
 
@@ -1175,6 +1439,151 @@ bool upsamplePrimitiveForRasterOverlays(
   return true;
 }
 
+template <class TIndex>
+void upsamplePrimitiveForRasterOverlays(
+    const Model& parentModel,
+    const MeshPrimitive& parentPrimitive,
+    gsl::span<UpsampledPrimitive> children,
+    UpsampleScratch& scratch,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  CESIUM_TRACE("upsamplePrimitiveForRasterOverlays");
+
+  if (children.empty()) {
+    return;
+  }
+
+  // Every child has the same attributes, because they all come from the
+  // parent primitive.
+  int32_t uvAccessorIndex = -1;
+  for (UpsampledPrimitive& child : children) {
+    uvAccessorIndex = prepareUpsampledPrimitive(
+        parentModel,
+        child,
+        textureCoordinateAttributeBaseName,
+        textureCoordinateIndex);
+  }
+
+  if (uvAccessorIndex == -1) {
+    // We don't know how to divide this primitive, so just remove it.
+    return;
+  }
+
+  const AccessorView<glm::vec2> uvView(parentModel, uvAccessorIndex);
+  const AccessorView<TIndex> indicesView(parentModel, parentPrimitive.indices);
+
+  if (uvView.status() != AccessorViewStatus::Valid ||
+      indicesView.status() != AccessorViewStatus::Valid) {
+    return;
+  }
+
+  // check if the primitive has skirts
+  int64_t indicesBegin = 0;
+  int64_t indicesCount = indicesView.size();
+  std::optional<SkirtMeshMetadata> parentSkirtMeshMetadata =
+      SkirtMeshMetadata::parseFromGltfExtras(parentPrimitive.extras);
+  if (children[0].positionAttributeIndex == -1) {
+    parentSkirtMeshMetadata.reset();
+  }
+  const bool hasSkirt = parentSkirtMeshMetadata != std::nullopt;
+  if (hasSkirt) {
+    indicesBegin = parentSkirtMeshMetadata->noSkirtIndicesBegin;
+    indicesCount = parentSkirtMeshMetadata->noSkirtIndicesCount;
+  }
+
+  for (UpsampledPrimitive& child : children) {
+    UpsampledChildScratch& childScratch = child.scratch;
+    childScratch.vertexMap.assign(
+        size_t(uvView.size()),
+        std::numeric_limits<uint32_t>::max());
+    childScratch.vertexFloats.clear();
+    childScratch.indices.clear();
+    childScratch.edgeIndices.clear();
+  }
+
+  std::vector<CesiumGeometry::TriangleClipVertex>& clippedA = scratch.clippedA;
+
+  for (int64_t i = indicesBegin; i < indicesBegin + indicesCount; i += 3) {
+    TIndex i0 = indicesView[i];
+    TIndex i1 = indicesView[i + 1];
+    TIndex i2 = indicesView[i + 2];
+
+    const glm::vec2 uv0 = uvView[i0];
+    const glm::vec2 uv1 = uvView[i1];
+    const glm::vec2 uv2 = uvView[i2];
+
+    // Clip this triangle against the East-West boundary once for each side of
+    // it, and share the result among the children on that side.
+    for (const bool keepAboveU : {false, true}) {
+      bool isClipped = false;
+      std::array<double, 4> clippedV{};
+
+      for (UpsampledPrimitive& child : children) {
+        if (child.keepAboveU != keepAboveU) {
+          continue;
+        }
+
+        if (!isClipped) {
+          isClipped = true;
+          clippedA.clear();
+          clipTriangleAtAxisAlignedThreshold(
+              0.5,
+              keepAboveU,
+              static_cast<int>(i0),
+              static_cast<int>(i1),
+              static_cast<int>(i2),
+              uv0.x,
+              uv1.x,
+              uv2.x,
+              clippedA);
+
+          for (size_t j = 0; j < clippedA.size() && j < clippedV.size(); ++j) {
+            clippedV[j] = getVertexValue(uvView, clippedA[j]).y;
+          }
+        }
+
+        if (clippedA.size() < 3) {
+          // No part of this triangle is inside the children on this side.
+          break;
+        }
+
+        // Clip the first clipped triange against the North-South boundary
+        addClippedTriangle(
+            child,
+            scratch,
+            uvView,
+            hasInvertedVCoordinate,
+            hasSkirt,
+            {~0, ~1, ~2},
+            {clippedV[0], clippedV[1], clippedV[2]});
+
+        // If the East-West clip yielded a quad (rather than a triangle), clip
+        // the second triangle of the quad, too.
+        if (clippedA.size() > 3) {
+          addClippedTriangle(
+              child,
+              scratch,
+              uvView,
+              hasInvertedVCoordinate,
+              hasSkirt,
+              {~0, ~2, ~3},
+              {clippedV[0], clippedV[2], clippedV[3]});
+        }
+      }
+    }
+  }
+
+  for (UpsampledPrimitive& child : children) {
+    child.keep = finishUpsampledPrimitive(
+        child,
+        parentSkirtMeshMetadata,
+        hasInvertedVCoordinate,
+        ellipsoid);
+  }
+}
+
 uint32_t getOrCreateVertex(
     std::vector<float>& output,
     std::vector<FloatVertexAttribute>& attributes,
@@ -1557,34 +1966,33 @@ void addSkirts(
       ellipsoid);
 }
 
-bool upsamplePrimitiveForRasterOverlays(
+void upsamplePrimitiveForRasterOverlays(
     const Model& parentModel,
-    Model& model,
-    Mesh& mesh,
-    MeshPrimitive& primitive,
-    CesiumGeometry::UpsampledQuadtreeNode childID,
+    const MeshPrimitive& parentPrimitive,
+    gsl::span<UpsampledPrimitive> children,
+    UpsampleScratch& scratch,
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
-  if (primitive.mode != MeshPrimitive::Mode::TRIANGLES ||
-      primitive.indices < 0 ||
-      primitive.indices >= static_cast<int>(parentModel.accessors.size())) {
+  if (parentPrimitive.mode != MeshPrimitive::Mode::TRIANGLES ||
+      parentPrimitive.indices < 0 ||
+      parentPrimitive.indices >=
+          static_cast<int>(parentModel.accessors.size())) {
     // Not indexed triangles, so we don't know how to divide this primitive
     // (yet). So remove it.
-    return false;
+    return;
   }
 
   const Accessor& indicesAccessorGltf =
-      parentModel.accessors[static_cast<size_t>(primitive.indices)];
+      parentModel.accessors[static_cast<size_t>(parentPrimitive.indices)];
   if (indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_BYTE) {
-    return upsamplePrimitiveForRasterOverlays<uint8_t>(
+    upsamplePrimitiveForRasterOverlays<uint8_t>(
         parentModel,
-        model,
-        mesh,
-        primitive,
-        childID,
+        parentPrimitive,
+        children,
+        scratch,
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
@@ -1592,12 +2000,11 @@ bool upsamplePrimitiveForRasterOverlays(
   } else if (
       indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_SHORT) {
-    return upsamplePrimitiveForRasterOverlays<uint16_t>(
+    upsamplePrimitiveForRasterOverlays<uint16_t>(
         parentModel,
-        model,
-        mesh,
-        primitive,
-        childID,
+        parentPrimitive,
+        children,
+        scratch,
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
@@ -1605,19 +2012,16 @@ bool upsamplePrimitiveForRasterOverlays(
   } else if (
       indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_INT) {
-    return upsamplePrimitiveForRasterOverlays<uint32_t>(
+    upsamplePrimitiveForRasterOverlays<uint32_t>(
         parentModel,
-        model,
-        mesh,
-        primitive,
-        childID,
+        parentPrimitive,
+        children,
+        scratch,
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
         ellipsoid);
   }
-
-  return false;
 }
 
 // Copy a buffer view from a parent to a child. Create a new buffer on the
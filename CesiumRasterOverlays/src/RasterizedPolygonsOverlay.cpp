@@ -5,11 +5,15 @@
 #include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
 #include <CesiumRasterOverlays/RasterizedPolygonsOverlay.h>
 #include <CesiumUtility/IntrusivePointer.h>
+#include <CesiumUtility/Math.h>
 
 #include <spdlog/fwd.h>
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
@@ -17,12 +21,314 @@ using namespace CesiumUtility;
 
 namespace CesiumRasterOverlays {
 namespace {
+// The number of scanlines sampled in each row of pixels when antialiasing.
+constexpr int32_t antialiasingScanlinesPerRow = 4;
+
+// An edge of a polygon's outline that is crossed by horizontal scanlines.
+struct PolygonEdge {
+  double minY;
+  double maxY;
+  // The X coordinate at minY, and the change in X per unit of Y.
+  double xAtMinY;
+  double slope;
+};
+
+// The outline of a polygon, prepared for scanline rasterization.
+struct RasterizablePolygon {
+  // The non-horizontal edges, sorted by minY. Longitudes are normalized
+  // relative to the first vertex, so a polygon that crosses the antimeridian
+  // is continuous, and may extend past -PI or PI.
+  std::vector<PolygonEdge> edges;
+  double minX;
+  double maxX;
+  double minY;
+  double maxY;
+};
+
+RasterizablePolygon
+createRasterizablePolygon(const CartographicPolygon& polygon) {
+  const std::vector<glm::dvec2>& vertices = polygon.getVertices();
+
+  RasterizablePolygon result{{}, 0.0, 0.0, 0.0, 0.0};
+  if (vertices.size() < 3) {
+    return result;
+  }
+
+  // normalize the longitude relative to the first vertex, just like the
+  // triangulation in CartographicPolygon
+  std::vector<glm::dvec2> local(vertices);
+  for (size_t i = 1; i < local.size(); ++i) {
+    const double difference = local[i].x - local[0].x;
+    if (difference > Math::OnePi) {
+      local[i].x -= Math::TwoPi;
+    } else if (difference < -Math::OnePi) {
+      local[i].x += Math::TwoPi;
+    }
+  }
+
+  result.minX = result.maxX = local[0].x;
+  result.minY = result.maxY = local[0].y;
+
+  result.edges.reserve(local.size());
+  for (size_t i = 0; i < local.size(); ++i) {
+    const glm::dvec2& a = local[i];
+    const glm::dvec2& b = local[(i + 1) % local.size()];
+
+    result.minX = glm::min(result.minX, a.x);
+    result.maxX = glm::max(result.maxX, a.x);
+    result.minY = glm::min(result.minY, a.y);
+    result.maxY = glm::max(result.maxY, a.y);
+
+    if (a.y == b.y) {
+      continue;
+    }
+
+    const glm::dvec2& lower = a.y < b.y ? a : b;
+    const glm::dvec2& upper = a.y < b.y ? b : a;
+    result.edges.push_back(PolygonEdge{
+        lower.y,
+        upper.y,
+        lower.x,
+        (upper.x - lower.x) / (upper.y - lower.y)});
+  }
+
+  std::sort(
+      result.edges.begin(),
+      result.edges.end(),
+      [](const PolygonEdge& a, const PolygonEdge& b) {
+        return a.minY < b.minY;
+      });
+
+  return result;
+}
+
+std::vector<RasterizablePolygon>
+createRasterizablePolygons(const std::vector<CartographicPolygon>& polygons) {
+  std::vector<RasterizablePolygon> result;
+  result.reserve(polygons.size());
+  for (const CartographicPolygon& polygon : polygons) {
+    result.emplace_back(createRasterizablePolygon(polygon));
+  }
+  return result;
+}
+
+// Rasterizes polygons into a single-channel coverage mask, one scanline at a
+// time. Each scanline is intersected with the edges that cross it, and the
+// pixels between pairs of intersections are filled.
+class ScanlineRasterizer {
+public:
+  ScanlineRasterizer(
+      const GlobeRectangle& rectangle,
+      int32_t width,
+      int32_t height,
+      bool antialias,
+      std::vector<std::byte>& coverage)
+      : _west(rectangle.getWest()),
+        _south(rectangle.getSouth()),
+        _rectangleWidth(rectangle.computeWidth()),
+        _pixelWidth(rectangle.computeWidth() / double(width)),
+        _pixelHeight(rectangle.computeHeight() / double(height)),
+        _width(width),
+        _height(height),
+        _scanlinesPerRow(antialias ? antialiasingScanlinesPerRow : 1),
+        _coverage(coverage),
+        _activeEdges(),
+        _crossings(),
+        _rowCoverage(antialias ? size_t(width) : 0, 0.0f) {}
+
+  void rasterize(const RasterizablePolygon& polygon) {
+    if (polygon.edges.empty()) {
+      return;
+    }
+
+    // A polygon that crosses the antimeridian may need to be drawn on both
+    // sides of a tile, or shifted a whole turn to reach a tile that is on the
+    // other side of it.
+    std::array<double, 3> offsets{};
+    size_t offsetCount = 0;
+    for (const double offset : {0.0, -Math::TwoPi, Math::TwoPi}) {
+      if (polygon.maxX + offset >= this->_west &&
+          polygon.minX + offset <= this->_west + this->_rectangleWidth) {
+        offsets[offsetCount++] = offset;
+      }
+    }
+
+    if (offsetCount == 0) {
+      return;
+    }
+
+    // Only visit the rows that the polygon overlaps. Rows are counted up from
+    // the south, the opposite of the order of rows in the image.
+    const int32_t firstRow = this->clampToPixels(
+        glm::floor((polygon.minY - this->_south) / this->_pixelHeight),
+        this->_height - 1);
+    const int32_t lastRow = this->clampToPixels(
+        glm::floor((polygon.maxY - this->_south) / this->_pixelHeight),
+        this->_height - 1);
+    const double scanlineSpacing = 1.0 / double(this->_scanlinesPerRow);
+
+    this->_activeEdges.clear();
+    size_t nextEdge = 0;
+
+    for (int32_t row = firstRow; row <= lastRow; ++row) {
+      int32_t firstTouched = this->_width;
+      int32_t lastTouched = -1;
+
+      for (int32_t scanline = 0; scanline < this->_scanlinesPerRow;
+           ++scanline) {
+        const double y =
+            this->_south +
+            this->_pixelHeight *
+                (double(row) + (double(scanline) + 0.5) * scanlineSpacing);
+
+        // Update the edges crossing this scanline. An edge crosses it if
+        // minY <= y < maxY, so a vertex shared by two edges is only counted
+        // once.
+        while (nextEdge < polygon.edges.size() &&
+               polygon.edges[nextEdge].minY <= y) {
+          this->_activeEdges.push_back(&polygon.edges[nextEdge]);
+          ++nextEdge;
+        }
+
+        this->_activeEdges.erase(
+            std::remove_if(
+                this->_activeEdges.begin(),
+                this->_activeEdges.end(),
+                [y](const PolygonEdge* pEdge) { return pEdge->maxY <= y; }),
+            this->_activeEdges.end());
+
+        if (this->_activeEdges.empty()) {
+          continue;
+        }
+
+        this->_crossings.clear();
+        for (const PolygonEdge* pEdge : this->_activeEdges) {
+          this->_crossings.push_back(
+              pEdge->xAtMinY + (y - pEdge->minY) * pEdge->slope);
+        }
+        std::sort(this->_crossings.begin(), this->_crossings.end());
+
+        // Fill between pairs of crossings (the even-odd rule).
+        for (size_t i = 0; i + 1 < this->_crossings.size(); i += 2) {
+          for (size_t j = 0; j < offsetCount; ++j) {
+            const double start =
+                (this->_crossings[i] + offsets[j] - this->_west) /
+                this->_pixelWidth;
+            const double end =
+                (this->_crossings[i + 1] + offsets[j] - this->_west) /
+                this->_pixelWidth;
+            if (this->_scanlinesPerRow == 1) {
+              this->fillSpan(row, start, end);
+            } else {
+              this->accumulateSpan(start, end, firstTouched, lastTouched);
+            }
+          }
+        }
+      }
+
+      if (lastTouched >= firstTouched) {
+        this->resolveRowCoverage(row, firstTouched, lastTouched);
+      }
+    }
+  }
+
+private:
+  // Converts a pixel coordinate to an integer in [0, maximum], without
+  // overflowing for polygons that extend far beyond a small tile.
+  static int32_t clampToPixels(double value, int32_t maximum) {
+    return int32_t(glm::clamp(value, 0.0, double(maximum)));
+  }
+
+  std::byte* getRowPixels(int32_t row) {
+    return this->_coverage.data() +
+           size_t(this->_height - 1 - row) * size_t(this->_width);
+  }
+
+  // Marks the pixels whose centers are within [start, end), in units of
+  // pixels from the west edge of the rectangle, as covered.
+  void fillSpan(int32_t row, double start, double end) {
+    const int32_t first =
+        this->clampToPixels(glm::ceil(start - 0.5), this->_width);
+    const int32_t last =
+        this->clampToPixels(glm::ceil(end - 0.5), this->_width) - 1;
+    if (last < first) {
+      return;
+    }
+
+    std::byte* pRow = this->getRowPixels(row);
+    std::fill(pRow + first, pRow + last + 1, std::byte(0xff));
+  }
+
+  // Adds the fraction of each pixel in the current row that is covered by
+  // [start, end) along one scanline.
+  void accumulateSpan(
+      double start,
+      double end,
+      int32_t& firstTouched,
+      int32_t& lastTouched) {
+    start = glm::clamp(start, 0.0, double(this->_width));
+    end = glm::clamp(end, 0.0, double(this->_width));
+    if (end <= start) {
+      return;
+    }
+
+    const float weight = 1.0f / float(this->_scanlinesPerRow);
+    const int32_t first = int32_t(start);
+    const int32_t last = glm::min(int32_t(end), this->_width - 1);
+
+    firstTouched = glm::min(firstTouched, first);
+    lastTouched = glm::max(lastTouched, last);
+
+    if (first == last) {
+      this->_rowCoverage[size_t(first)] += float(end - start) * weight;
+      return;
+    }
+
+    this->_rowCoverage[size_t(first)] +=
+        float(double(first + 1) - start) * weight;
+    for (int32_t i = first + 1; i < last; ++i) {
+      this->_rowCoverage[size_t(i)] += weight;
+    }
+    this->_rowCoverage[size_t(last)] += float(end - double(last)) * weight;
+  }
+
+  // Adds the coverage accumulated for one polygon in a row to the mask, and
+  // clears it for the next row.
+  void resolveRowCoverage(int32_t row, int32_t first, int32_t last) {
+    std::byte* pRow = this->getRowPixels(row);
+    for (int32_t i = first; i <= last; ++i) {
+      float& coverage = this->_rowCoverage[size_t(i)];
+      const int32_t sum =
+          int32_t(pRow[i]) + int32_t(glm::round(coverage * 255.0f));
+      pRow[i] = std::byte(glm::min(sum, 255));
+      coverage = 0.0f;
+    }
+  }
+
+  double _west;
+  double _south;
+  double _rectangleWidth;
+  double _pixelWidth;
+  double _pixelHeight;
+  int32_t _width;
+  int32_t _height;
+  int32_t _scanlinesPerRow;
+  std::vector<std::byte>& _coverage;
+
+  // Scratch space reused for every scanline.
+  std::vector<const PolygonEdge*> _activeEdges;
+  std::vector<double> _crossings;
+  std::vector<float> _rowCoverage;
+};
+
 void rasterizePolygons(
     LoadedRasterOverlayImage& loaded,
     const CesiumGeospatial::GlobeRectangle& rectangle,
     const glm::dvec2& textureSize,
     const std::vector<CartographicPolygon>& cartographicPolygons,
-    bool invertSelection) {
+    const std::vector<RasterizablePolygon>& rasterizablePolygons,
+    bool invertSelection,
+    bool antialias) {
 
   CesiumGltf::ImageAsset& image = loaded.pImage.emplace();
 
@@ -73,82 +379,33 @@ void rasterizePolygons(
     return;
   }
 
-  const double rectangleWidth = rectangle.computeWidth();
-  const double rectangleHeight = rectangle.computeHeight();
-
   // create source image
   loaded.moreDetailAvailable = true;
   image.width = int32_t(glm::round(textureSize.x));
   image.height = int32_t(glm::round(textureSize.y));
   image.channels = 1;
   image.bytesPerChannel = 1;
-  image.pixelData.resize(size_t(image.width * image.height), outsideColor);
-
-  // TODO: this is naive approach, use line-triangle
-  // intersections to rasterize one row at a time
-  // NOTE: also completely ignores antimeridian (really these
-  // calculations should be normalized to the first vertex)
-  for (const CartographicPolygon& polygon : cartographicPolygons) {
-    const std::vector<glm::dvec2>& vertices = polygon.getVertices();
-    const std::vector<uint32_t>& indices = polygon.getIndices();
-    for (size_t triangle = 0; triangle < indices.size() / 3; ++triangle) {
-      const glm::dvec2& a = vertices[indices[3 * triangle]];
-      const glm::dvec2& b = vertices[indices[3 * triangle + 1]];
-      const glm::dvec2& c = vertices[indices[3 * triangle + 2]];
-
-      // TODO: deal with the corner cases here
-      const double minX = glm::min(a.x, glm::min(b.x, c.x));
-      const double minY = glm::min(a.y, glm::min(b.y, c.y));
-      const double maxX = glm::max(a.x, glm::max(b.x, c.x));
-      const double maxY = glm::max(a.y, glm::max(b.y, c.y));
-
-      const CesiumGeospatial::GlobeRectangle triangleBounds(
-          minX,
-          minY,
-          maxX,
-          maxY);
-
-      // skip this triangle if it is entirely outside the tile bounds
-      if (!rectangle.computeIntersection(triangleBounds)) {
-        continue;
-      }
 
-      const glm::dvec2 ab = b - a;
-      const glm::dvec2 ab_perp(-ab.y, ab.x);
-      const glm::dvec2 bc = c - b;
-      const glm::dvec2 bc_perp(-bc.y, bc.x);
-      const glm::dvec2 ca = a - c;
-      const glm::dvec2 ca_perp(-ca.y, ca.x);
-
-      size_t width = size_t(image.width);
-      size_t height = size_t(image.height);
-
-      for (size_t j = 0; j < height; ++j) {
-        const double pixelY =
-            rectangle.getSouth() +
-            rectangleHeight * (1.0 - (double(j) + 0.5) / double(height));
-        for (size_t i = 0; i < width; ++i) {
-          const double pixelX = rectangle.getWest() + rectangleWidth *
-                                                          (double(i) + 0.5) /
-                                                          double(width);
-          const glm::dvec2 v(pixelX, pixelY);
-
-          const glm::dvec2 av = v - a;
-          const glm::dvec2 cv = v - c;
-
-          const double v_proj_ab_perp = glm::dot(av, ab_perp);
-          const double v_proj_bc_perp = glm::dot(cv, bc_perp);
-          const double v_proj_ca_perp = glm::dot(cv, ca_perp);
-
-          // will determine in or out, irrespective of winding
-          if ((v_proj_ab_perp >= 0.0 && v_proj_ca_perp >= 0.0 &&
-               v_proj_bc_perp >= 0.0) ||
-              (v_proj_ab_perp <= 0.0 && v_proj_ca_perp <= 0.0 &&
-               v_proj_bc_perp <= 0.0)) {
-            image.pixelData[width * j + i] = insideColor;
-          }
-        }
-      }
+  // Rasterize the coverage of the polygons, and then map it to the inside and
+  // outside colors.
+  image.pixelData.resize(size_t(image.width * image.height), std::byte(0));
+  if (image.width <= 0 || image.height <= 0) {
+    return;
+  }
+
+  ScanlineRasterizer rasterizer(
+      rectangle,
+      image.width,
+      image.height,
+      antialias,
+      image.pixelData);
+  for (const RasterizablePolygon& polygon : rasterizablePolygons) {
+    rasterizer.rasterize(polygon);
+  }
+
+  if (invertSelection) {
+    for (std::byte& pixel : image.pixelData) {
+      pixel = ~pixel;
     }
   }
 }
@@ -159,7 +416,9 @@ class CESIUMRASTEROVERLAYS_API RasterizedPolygonsTileProvider final
 
 private:
   std::vector<CartographicPolygon> _polygons;
+  std::vector<RasterizablePolygon> _rasterizablePolygons;
   bool _invertSelection;
+  bool _antialias;
 
 public:
   RasterizedPolygonsTileProvider(
@@ -171,7 +430,8 @@ public:
       const std::shared_ptr<spdlog::logger>& pLogger,
       const CesiumGeospatial::Projection& projection,
       const std::vector<CartographicPolygon>& polygons,
-      bool invertSelection)
+      bool invertSelection,
+      bool antialias)
       : RasterOverlayTileProvider(
             pOwner,
             asyncSystem,
@@ -185,7 +445,9 @@ public:
                 projection,
                 CesiumGeospatial::GlobeRectangle::MAXIMUM)),
         _polygons(polygons),
-        _invertSelection(invertSelection) {}
+        _rasterizablePolygons(createRasterizablePolygons(polygons)),
+        _invertSelection(invertSelection),
+        _antialias(antialias) {}
 
   virtual CesiumAsync::Future<LoadedRasterOverlayImage>
   loadTileImage(RasterOverlayTile& overlayTile) override {
@@ -198,7 +460,9 @@ public:
 
     return this->getAsyncSystem().runInWorkerThread(
         [&polygons = this->_polygons,
+         &rasterizablePolygons = this->_rasterizablePolygons,
          invertSelection = this->_invertSelection,
+         antialias = this->_antialias,
          projection = this->getProjection(),
          rectangle = overlayTile.getRectangle(),
          textureSize]() -> LoadedRasterOverlayImage {
@@ -213,7 +477,9 @@ public:
               tileRectangle,
               textureSize,
               polygons,
-              invertSelection);
+              rasterizablePolygons,
+              invertSelection,
+              antialias);
 
           return result;
         });
@@ -226,10 +492,12 @@ RasterizedPolygonsOverlay::RasterizedPolygonsOverlay(
     bool invertSelection,
     const CesiumGeospatial::Ellipsoid& ellipsoid,
     const CesiumGeospatial::Projection& projection,
-    const RasterOverlayOptions& overlayOptions)
+    const RasterOverlayOptions& overlayOptions,
+    bool antialias)
     : RasterOverlay(name, overlayOptions),
       _polygons(polygons),
       _invertSelection(invertSelection),
+      _antialias(antialias),
       _ellipsoid(ellipsoid),
       _projection(projection) {}
 
@@ -257,7 +525,8 @@ RasterizedPolygonsOverlay::createTileProvider(
               pLogger,
               this->_projection,
               this->_polygons,
-              this->_invertSelection)));
+              this->_invertSelection,
+              this->_antialias)));
 }
 
 } // namespace CesiumRasterOverlays
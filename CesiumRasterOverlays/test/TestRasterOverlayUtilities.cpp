@@ -0,0 +1,255 @@
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumGeometry/Axis.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GeographicProjection.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/WebMercatorProjection.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumNativeTests/ThreadTaskProcessor.h>
+#include <CesiumRasterOverlays/RasterOverlayUtilities.h>
+#include <CesiumUtility/JsonValue.h>
+
+#include <catch2/catch.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace CesiumAsync;
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
+using namespace CesiumUtility;
+
+namespace {
+
+const GlobeRectangle gridRectangle =
+    GlobeRectangle::fromDegrees(10.0, 20.0, 11.0, 21.0);
+
+// Creates a model with a single primitive whose vertices are a grid covering
+// gridRectangle. The positions are relative to the center of the rectangle.
+Model createGridModel(size_t verticesPerSide) {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+  const glm::dvec3 center =
+      ellipsoid.cartographicToCartesian(gridRectangle.computeCenter());
+
+  std::vector<glm::vec3> positions;
+  positions.reserve(verticesPerSide * verticesPerSide);
+  for (size_t j = 0; j < verticesPerSide; ++j) {
+    const double v = double(j) / double(verticesPerSide - 1);
+    for (size_t i = 0; i < verticesPerSide; ++i) {
+      const double u = double(i) / double(verticesPerSide - 1);
+      const Cartographic cartographic(
+          gridRectangle.getWest() + u * gridRectangle.computeWidth(),
+          gridRectangle.getSouth() + v * gridRectangle.computeHeight(),
+          100.0 * u * v);
+      positions.emplace_back(
+          glm::vec3(ellipsoid.cartographicToCartesian(cartographic) - center));
+    }
+  }
+
+  Model model;
+  model.extras["gltfUpAxis"] = JsonValue(std::underlying_type_t<Axis>(Axis::Z));
+
+  Buffer& buffer = model.buffers.emplace_back();
+  buffer.cesium.data.resize(positions.size() * sizeof(glm::vec3));
+  std::memcpy(
+      buffer.cesium.data.data(),
+      positions.data(),
+      buffer.cesium.data.size());
+  buffer.byteLength = int64_t(buffer.cesium.data.size());
+
+  BufferView& bufferView = model.bufferViews.emplace_back();
+  bufferView.buffer = 0;
+  bufferView.byteLength = buffer.byteLength;
+
+  Accessor& accessor = model.accessors.emplace_back();
+  accessor.bufferView = 0;
+  accessor.count = int64_t(positions.size());
+  accessor.componentType = Accessor::ComponentType::FLOAT;
+  accessor.type = Accessor::Type::VEC3;
+
+  MeshPrimitive& primitive =
+      model.meshes.emplace_back().primitives.emplace_back();
+  primitive.attributes["POSITION"] = 0;
+
+  return model;
+}
+
+glm::dmat4 createGridTransform() {
+  return glm::translate(
+      glm::dmat4(1.0),
+      Ellipsoid::WGS84.cartographicToCartesian(gridRectangle.computeCenter()));
+}
+
+std::vector<glm::vec2>
+getTextureCoordinates(const Model& model, int32_t textureCoordinateID) {
+  const MeshPrimitive& primitive = model.meshes[0].primitives[0];
+  auto it = primitive.attributes.find(
+      "_CESIUMOVERLAY_" + std::to_string(textureCoordinateID));
+  REQUIRE(it != primitive.attributes.end());
+
+  AccessorView<glm::vec2> view(model, it->second);
+  REQUIRE(view.status() == AccessorViewStatus::Valid);
+
+  std::vector<glm::vec2> result(size_t(view.size()));
+  for (int64_t i = 0; i < view.size(); ++i) {
+    result[size_t(i)] = view[i];
+  }
+  return result;
+}
+
+std::vector<Projection> createProjections() {
+  return {
+      GeographicProjection(Ellipsoid::WGS84),
+      WebMercatorProjection(Ellipsoid::WGS84),
+      GeographicProjection(Ellipsoid::WGS84)};
+}
+
+} // namespace
+
+TEST_CASE("RasterOverlayUtilities::createRasterOverlayTextureCoordinates") {
+  // Large enough to be divided into several chunks.
+  const size_t verticesPerSide = 300;
+
+  Model serialModel = createGridModel(verticesPerSide);
+  std::optional<RasterOverlayDetails> serialDetails =
+      RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+          serialModel,
+          createGridTransform(),
+          std::nullopt,
+          createProjections());
+  REQUIRE(serialDetails);
+  REQUIRE(serialDetails->rasterOverlayProjections.size() == 3);
+
+  SECTION("maps the grid to the whole texture") {
+    const std::vector<glm::vec2> uvs = getTextureCoordinates(serialModel, 0);
+    CHECK(Math::equalsEpsilon(uvs.front().x, 0.0, 0.0, 1e-5));
+    CHECK(Math::equalsEpsilon(uvs.front().y, 0.0, 0.0, 1e-5));
+    CHECK(Math::equalsEpsilon(uvs.back().x, 1.0, 0.0, 1e-5));
+    CHECK(Math::equalsEpsilon(uvs.back().y, 1.0, 0.0, 1e-5));
+
+    const GlobeRectangle& bounds =
+        serialDetails->boundingRegion.getRectangle();
+    CHECK(Math::equalsEpsilon(
+        bounds.getWest(),
+        gridRectangle.getWest(),
+        0.0,
+        Math::Epsilon7));
+    CHECK(Math::equalsEpsilon(
+        bounds.getNorth(),
+        gridRectangle.getNorth(),
+        0.0,
+        Math::Epsilon7));
+    CHECK(Math::equalsEpsilon(
+        bounds.getSouth(),
+        gridRectangle.getSouth(),
+        0.0,
+        Math::Epsilon7));
+    CHECK(Math::equalsEpsilon(
+        bounds.getEast(),
+        gridRectangle.getEast(),
+        0.0,
+        Math::Epsilon7));
+    CHECK(Math::equalsEpsilon(
+        serialDetails->boundingRegion.getMaximumHeight(),
+        100.0,
+        0.0,
+        0.01));
+  }
+
+  SECTION("overlays with the same projection get the same coordinates") {
+    const std::vector<glm::vec2> first = getTextureCoordinates(serialModel, 0);
+    const std::vector<glm::vec2> webMercator =
+        getTextureCoordinates(serialModel, 1);
+    const std::vector<glm::vec2> third = getTextureCoordinates(serialModel, 2);
+    CHECK(first == third);
+    CHECK(first != webMercator);
+
+    const MeshPrimitive& primitive = serialModel.meshes[0].primitives[0];
+    const Accessor& firstAccessor = serialModel.accessors[size_t(
+        primitive.attributes.at("_CESIUMOVERLAY_0"))];
+    const Accessor& thirdAccessor = serialModel.accessors[size_t(
+        primitive.attributes.at("_CESIUMOVERLAY_2"))];
+    CHECK(firstAccessor.min == thirdAccessor.min);
+    CHECK(firstAccessor.max == thirdAccessor.max);
+  }
+
+  SECTION("worker threads produce the same result") {
+    AsyncSystem asyncSystem(std::make_shared<ThreadTaskProcessor>());
+
+    Model threadedModel = createGridModel(verticesPerSide);
+    std::optional<RasterOverlayDetails> threadedDetails =
+        RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+            asyncSystem,
+            threadedModel,
+            createGridTransform(),
+            std::nullopt,
+            createProjections());
+    REQUIRE(threadedDetails);
+
+    CHECK(
+        threadedDetails->boundingRegion.getRectangle().getWest() ==
+        serialDetails->boundingRegion.getRectangle().getWest());
+    CHECK(
+        threadedDetails->boundingRegion.getRectangle().getEast() ==
+        serialDetails->boundingRegion.getRectangle().getEast());
+    CHECK(
+        threadedDetails->boundingRegion.getMinimumHeight() ==
+        serialDetails->boundingRegion.getMinimumHeight());
+    CHECK(
+        threadedDetails->boundingRegion.getMaximumHeight() ==
+        serialDetails->boundingRegion.getMaximumHeight());
+
+    for (int32_t i = 0; i < 3; ++i) {
+      CHECK(
+          getTextureCoordinates(threadedModel, i) ==
+          getTextureCoordinates(serialModel, i));
+    }
+
+    REQUIRE(threadedModel.accessors.size() == serialModel.accessors.size());
+    for (size_t i = 0; i < serialModel.accessors.size(); ++i) {
+      CHECK(threadedModel.accessors[i].min == serialModel.accessors[i].min);
+      CHECK(threadedModel.accessors[i].max == serialModel.accessors[i].max);
+    }
+  }
+}
+
+TEST_CASE(
+    "Benchmark RasterOverlayUtilities::createRasterOverlayTextureCoordinates",
+    "[.][benchmark]") {
+  AsyncSystem asyncSystem(std::make_shared<ThreadTaskProcessor>());
+  const size_t verticesPerSide = 512;
+  const Model model = createGridModel(verticesPerSide);
+  const std::string suffix =
+      " for " + std::to_string(verticesPerSide * verticesPerSide) +
+      " vertices and 3 overlays";
+
+  BENCHMARK("Create texture coordinates" + suffix) {
+    Model copy = model;
+    return RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+        copy,
+        createGridTransform(),
+        std::nullopt,
+        createProjections());
+  };
+
+  BENCHMARK("Create texture coordinates with worker threads" + suffix) {
+    Model copy = model;
+    return RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+        asyncSystem,
+        copy,
+        createGridTransform(),
+        std::nullopt,
+        createProjections());
+  };
+}
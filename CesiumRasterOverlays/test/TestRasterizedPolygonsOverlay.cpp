@@ -0,0 +1,295 @@
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/GeographicProjection.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumNativeTests/SimpleAssetAccessor.h>
+#include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumRasterOverlays/RasterOverlayTile.h>
+#include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
+#include <CesiumRasterOverlays/RasterizedPolygonsOverlay.h>
+#include <CesiumUtility/Math.h>
+
+#include <catch2/catch.hpp>
+#include <spdlog/spdlog.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace CesiumAsync;
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
+using namespace CesiumUtility;
+
+namespace {
+
+CartographicPolygon createRectanglePolygon(
+    double westDegrees,
+    double southDegrees,
+    double eastDegrees,
+    double northDegrees) {
+  return CartographicPolygon(std::vector<glm::dvec2>{
+      glm::dvec2(
+          Math::degreesToRadians(westDegrees),
+          Math::degreesToRadians(southDegrees)),
+      glm::dvec2(
+          Math::degreesToRadians(eastDegrees),
+          Math::degreesToRadians(southDegrees)),
+      glm::dvec2(
+          Math::degreesToRadians(eastDegrees),
+          Math::degreesToRadians(northDegrees)),
+      glm::dvec2(
+          Math::degreesToRadians(westDegrees),
+          Math::degreesToRadians(northDegrees))});
+}
+
+IntrusivePointer<RasterOverlayTileProvider> createTileProvider(
+    const AsyncSystem& asyncSystem,
+    const std::vector<CartographicPolygon>& polygons,
+    bool invertSelection,
+    bool antialias) {
+  IntrusivePointer<RasterizedPolygonsOverlay> pOverlay =
+      new RasterizedPolygonsOverlay(
+          "Test",
+          polygons,
+          invertSelection,
+          Ellipsoid::WGS84,
+          GeographicProjection(Ellipsoid::WGS84),
+          RasterOverlayOptions(),
+          antialias);
+
+  IntrusivePointer<RasterOverlayTileProvider> pProvider = nullptr;
+  pOverlay
+      ->createTileProvider(
+          asyncSystem,
+          std::make_shared<SimpleAssetAccessor>(
+              std::map<std::string, std::shared_ptr<SimpleAssetRequest>>()),
+          nullptr,
+          nullptr,
+          spdlog::default_logger(),
+          nullptr)
+      .thenInMainThread(
+          [&pProvider](RasterOverlay::CreateTileProviderResult&& created) {
+            CHECK(created);
+            pProvider = *created;
+          });
+  asyncSystem.dispatchMainThreadTasks();
+
+  return pProvider;
+}
+
+// Rasterizes the polygons for a tile covering the given rectangle, into an
+// image that is imageSize pixels square unless the tile is entirely inside or
+// outside of the polygons.
+IntrusivePointer<ImageAsset> rasterizeTile(
+    const AsyncSystem& asyncSystem,
+    RasterOverlayTileProvider& provider,
+    const GlobeRectangle& tileRectangle,
+    int32_t imageSize) {
+  // The image is sized by the target screen pixels divided by the maximum
+  // screen-space error, which is 2 by default.
+  IntrusivePointer<RasterOverlayTile> pTile = provider.getTile(
+      projectRectangleSimple(provider.getProjection(), tileRectangle),
+      glm::dvec2(2.0 * double(imageSize)));
+  REQUIRE(pTile);
+  provider.loadTile(*pTile);
+
+  while (pTile->getState() != RasterOverlayTile::LoadState::Loaded) {
+    asyncSystem.dispatchMainThreadTasks();
+  }
+
+  return pTile->getImage();
+}
+
+uint8_t getPixel(const ImageAsset& image, int32_t column, int32_t row) {
+  return uint8_t(image.pixelData[size_t(row * image.width + column)]);
+}
+
+} // namespace
+
+TEST_CASE("RasterizedPolygonsOverlay") {
+  AsyncSystem asyncSystem(std::make_shared<SimpleTaskProcessor>());
+  const int32_t imageSize = 64;
+
+  SECTION("fills the pixels inside of a polygon") {
+    // The polygon covers the west half of the tile.
+    IntrusivePointer<RasterOverlayTileProvider> pProvider = createTileProvider(
+        asyncSystem,
+        {createRectanglePolygon(5.0, 5.0, 15.0, 25.0)},
+        false,
+        false);
+    REQUIRE(pProvider);
+
+    IntrusivePointer<ImageAsset> pImage = rasterizeTile(
+        asyncSystem,
+        *pProvider,
+        GlobeRectangle::fromDegrees(10.0, 10.0, 20.0, 20.0),
+        imageSize);
+    REQUIRE(pImage);
+    REQUIRE(pImage->width == imageSize);
+    REQUIRE(pImage->height == imageSize);
+
+    for (int32_t row = 0; row < imageSize; ++row) {
+      for (int32_t column = 0; column < imageSize; ++column) {
+        const int expected = column < imageSize / 2 ? 0xff : 0;
+        REQUIRE(getPixel(*pImage, column, row) == expected);
+      }
+    }
+  }
+
+  SECTION("fills the pixels outside of a polygon when inverted") {
+    // The polygon covers the south half of the tile, which is the bottom half
+    // of the image.
+    IntrusivePointer<RasterOverlayTileProvider> pProvider = createTileProvider(
+        asyncSystem,
+        {createRectanglePolygon(5.0, 5.0, 25.0, 15.0)},
+        true,
+        false);
+    REQUIRE(pProvider);
+
+    IntrusivePointer<ImageAsset> pImage = rasterizeTile(
+        asyncSystem,
+        *pProvider,
+        GlobeRectangle::fromDegrees(10.0, 10.0, 20.0, 20.0),
+        imageSize);
+    REQUIRE(pImage);
+    REQUIRE(pImage->width == imageSize);
+
+    for (int32_t row = 0; row < imageSize; ++row) {
+      for (int32_t column = 0; column < imageSize; ++column) {
+        const int expected = row < imageSize / 2 ? 0xff : 0;
+        REQUIRE(getPixel(*pImage, column, row) == expected);
+      }
+    }
+  }
+
+  SECTION("fills polygons that cross the antimeridian") {
+    // The polygon covers longitudes 175 to 185 (-175) degrees.
+    IntrusivePointer<RasterOverlayTileProvider> pProvider = createTileProvider(
+        asyncSystem,
+        {createRectanglePolygon(175.0, -5.0, -175.0, 15.0)},
+        false,
+        false);
+    REQUIRE(pProvider);
+
+    // The tile west of the antimeridian is covered on its east half.
+    IntrusivePointer<ImageAsset> pWestImage = rasterizeTile(
+        asyncSystem,
+        *pProvider,
+        GlobeRectangle::fromDegrees(170.0, 0.0, 180.0, 10.0),
+        imageSize);
+    REQUIRE(pWestImage);
+    REQUIRE(pWestImage->width == imageSize);
+
+    // The tile east of the antimeridian is covered on its west half.
+    IntrusivePointer<ImageAsset> pEastImage = rasterizeTile(
+        asyncSystem,
+        *pProvider,
+        GlobeRectangle::fromDegrees(-180.0, 0.0, -170.0, 10.0),
+        imageSize);
+    REQUIRE(pEastImage);
+    REQUIRE(pEastImage->width == imageSize);
+
+    for (int32_t row = 0; row < imageSize; ++row) {
+      for (int32_t column = 0; column < imageSize; ++column) {
+        const bool isWestHalf = column < imageSize / 2;
+        REQUIRE(getPixel(*pWestImage, column, row) == (isWestHalf ? 0 : 0xff));
+        REQUIRE(getPixel(*pEastImage, column, row) == (isWestHalf ? 0xff : 0));
+      }
+    }
+  }
+
+  SECTION("antialiases the edges of polygons") {
+    // The east edge of the polygon is in the middle of column 10.
+    const double pixelSizeDegrees = 10.0 / double(imageSize);
+    const double eastDegrees = 10.0 + 10.5 * pixelSizeDegrees;
+
+    IntrusivePointer<RasterOverlayTileProvider> pProvider = createTileProvider(
+        asyncSystem,
+        {createRectanglePolygon(5.0, 5.0, eastDegrees, 25.0)},
+        false,
+        true);
+    REQUIRE(pProvider);
+
+    IntrusivePointer<ImageAsset> pImage = rasterizeTile(
+        asyncSystem,
+        *pProvider,
+        GlobeRectangle::fromDegrees(10.0, 10.0, 20.0, 20.0),
+        imageSize);
+    REQUIRE(pImage);
+    REQUIRE(pImage->width == imageSize);
+
+    const int32_t row = imageSize / 2;
+    CHECK(getPixel(*pImage, 9, row) == 0xff);
+    CHECK(getPixel(*pImage, 10, row) > 0x60);
+    CHECK(getPixel(*pImage, 10, row) < 0xa0);
+    CHECK(getPixel(*pImage, 11, row) == 0);
+  }
+
+  SECTION("creates a single pixel for a tile inside of a polygon") {
+    IntrusivePointer<RasterOverlayTileProvider> pProvider = createTileProvider(
+        asyncSystem,
+        {createRectanglePolygon(5.0, 5.0, 25.0, 25.0)},
+        false,
+        false);
+    REQUIRE(pProvider);
+
+    IntrusivePointer<ImageAsset> pImage = rasterizeTile(
+        asyncSystem,
+        *pProvider,
+        GlobeRectangle::fromDegrees(10.0, 10.0, 20.0, 20.0),
+        imageSize);
+    REQUIRE(pImage);
+    CHECK(pImage->width == 1);
+    CHECK(pImage->height == 1);
+    CHECK(getPixel(*pImage, 0, 0) == 0xff);
+  }
+}
+
+TEST_CASE("Benchmark RasterizedPolygonsOverlay", "[.][benchmark]") {
+  AsyncSystem asyncSystem(std::make_shared<SimpleTaskProcessor>());
+
+  // A grid of small 32-sided polygons over a 10 degree square tile.
+  std::vector<CartographicPolygon> polygons;
+  const size_t polygonsPerSide = 20;
+  const size_t verticesPerPolygon = 32;
+  const double spacingDegrees = 10.0 / double(polygonsPerSide);
+  for (size_t i = 0; i < polygonsPerSide; ++i) {
+    for (size_t j = 0; j < polygonsPerSide; ++j) {
+      const double centerX = 10.0 + (double(i) + 0.5) * spacingDegrees;
+      const double centerY = 10.0 + (double(j) + 0.5) * spacingDegrees;
+      std::vector<glm::dvec2> vertices(verticesPerPolygon);
+      for (size_t k = 0; k < verticesPerPolygon; ++k) {
+        const double angle =
+            Math::TwoPi * double(k) / double(verticesPerPolygon);
+        vertices[k] = glm::dvec2(
+            Math::degreesToRadians(
+                centerX + 0.4 * spacingDegrees * std::cos(angle)),
+            Math::degreesToRadians(
+                centerY + 0.4 * spacingDegrees * std::sin(angle)));
+      }
+      polygons.emplace_back(vertices);
+    }
+  }
+
+  const GlobeRectangle tileRectangle =
+      GlobeRectangle::fromDegrees(10.0, 10.0, 20.0, 20.0);
+
+  for (bool antialias : {false, true}) {
+    IntrusivePointer<RasterOverlayTileProvider> pProvider =
+        createTileProvider(asyncSystem, polygons, false, antialias);
+    REQUIRE(pProvider);
+
+    BENCHMARK(
+        std::string("Rasterize ") + std::to_string(polygons.size()) +
+        " polygons into a 1024x1024 tile" +
+        (antialias ? " with antialiasing" : "")) {
+      return rasterizeTile(asyncSystem, *pProvider, tileRectangle, 1024);
+    };
+  }
+}
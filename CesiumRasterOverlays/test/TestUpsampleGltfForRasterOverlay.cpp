@@ -9,7 +9,11 @@
 #include <catch2/catch.hpp>
 #include <glm/trigonometric.hpp>
 
+#include <array>
+#include <cstdint>
 #include <cstring>
+#include <optional>
+#include <string>
 #include <vector>
 
 using namespace CesiumUtility;
@@ -1273,3 +1277,247 @@ TEST_CASE("upsampleGltfForRasterOverlay with UNSIGNED_BYTE indices") {
           (upsampledPosition[4] + positions[1]) * 0.5f,
           glm::vec3(static_cast<float>(Math::Epsilon7))) == glm::bvec3(true));
 }
+
+// Adds an accessor for a part of the first buffer of a model.
+static int32_t addGridAccessor(
+    Model& model,
+    size_t byteOffset,
+    size_t byteLength,
+    int64_t count,
+    const std::string& type,
+    int32_t componentType) {
+  BufferView& bufferView = model.bufferViews.emplace_back();
+  bufferView.buffer = 0;
+  bufferView.byteOffset = int64_t(byteOffset);
+  bufferView.byteLength = int64_t(byteLength);
+
+  Accessor& accessor = model.accessors.emplace_back();
+  accessor.bufferView = int32_t(model.bufferViews.size() - 1);
+  accessor.count = count;
+  accessor.type = type;
+  accessor.componentType = componentType;
+  return int32_t(model.accessors.size() - 1);
+}
+
+// Creates a model with a single primitive that is a grid of `gridSize` by
+// `gridSize` squares, with raster overlay texture coordinates that span the
+// grid.
+static Model createGridModel(uint32_t gridSize, bool withSkirts) {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+  const double west = glm::radians(110.0);
+  const double south = glm::radians(32.0);
+  const double size = glm::radians(1.0);
+  const glm::dvec3 center = ellipsoid.cartographicToCartesian(
+      Cartographic(west + size * 0.5, south + size * 0.5, 0.0));
+
+  const uint32_t verticesPerSide = gridSize + 1;
+  std::vector<glm::vec3> positions;
+  std::vector<glm::vec2> uvs;
+  for (uint32_t y = 0; y < verticesPerSide; ++y) {
+    for (uint32_t x = 0; x < verticesPerSide; ++x) {
+      const double u = double(x) / double(gridSize);
+      const double v = double(y) / double(gridSize);
+      const double height = 100.0 * double((x * 7 + y * 13) % 11);
+      positions.emplace_back(static_cast<glm::vec3>(
+          ellipsoid.cartographicToCartesian(
+              Cartographic(west + u * size, south + v * size, height)) -
+          center));
+      uvs.emplace_back(static_cast<float>(u), static_cast<float>(v));
+    }
+  }
+
+  std::vector<uint32_t> indices;
+  for (uint32_t y = 0; y < gridSize; ++y) {
+    for (uint32_t x = 0; x < gridSize; ++x) {
+      const uint32_t i = y * verticesPerSide + x;
+      indices.push_back(i);
+      indices.push_back(i + 1);
+      indices.push_back(i + verticesPerSide);
+      indices.push_back(i + 1);
+      indices.push_back(i + verticesPerSide + 1);
+      indices.push_back(i + verticesPerSide);
+    }
+  }
+
+  const size_t positionsSize = positions.size() * sizeof(glm::vec3);
+  const size_t uvsSize = uvs.size() * sizeof(glm::vec2);
+  const size_t indicesSize = indices.size() * sizeof(uint32_t);
+
+  Model model;
+  Buffer& buffer = model.buffers.emplace_back();
+  buffer.cesium.data.resize(positionsSize + uvsSize + indicesSize);
+  buffer.byteLength = int64_t(buffer.cesium.data.size());
+  std::memcpy(buffer.cesium.data.data(), positions.data(), positionsSize);
+  std::memcpy(buffer.cesium.data.data() + positionsSize, uvs.data(), uvsSize);
+  std::memcpy(
+      buffer.cesium.data.data() + positionsSize + uvsSize,
+      indices.data(),
+      indicesSize);
+
+  MeshPrimitive& primitive =
+      model.meshes.emplace_back().primitives.emplace_back();
+  primitive.mode = MeshPrimitive::Mode::TRIANGLES;
+  primitive.attributes["POSITION"] = addGridAccessor(
+      model,
+      0,
+      positionsSize,
+      int64_t(positions.size()),
+      Accessor::Type::VEC3,
+      Accessor::ComponentType::FLOAT);
+  primitive.attributes["_CESIUMOVERLAY_0"] = addGridAccessor(
+      model,
+      positionsSize,
+      uvsSize,
+      int64_t(uvs.size()),
+      Accessor::Type::VEC2,
+      Accessor::ComponentType::FLOAT);
+  primitive.indices = addGridAccessor(
+      model,
+      positionsSize + uvsSize,
+      indicesSize,
+      int64_t(indices.size()),
+      Accessor::Type::SCALAR,
+      Accessor::ComponentType::UNSIGNED_INT);
+
+  if (withSkirts) {
+    SkirtMeshMetadata skirtMeshMetadata;
+    skirtMeshMetadata.noSkirtIndicesBegin = 0;
+    skirtMeshMetadata.noSkirtIndicesCount = uint32_t(indices.size());
+    skirtMeshMetadata.noSkirtVerticesBegin = 0;
+    skirtMeshMetadata.noSkirtVerticesCount = uint32_t(positions.size());
+    skirtMeshMetadata.meshCenter = center;
+    skirtMeshMetadata.skirtWestHeight = 10.0;
+    skirtMeshMetadata.skirtSouthHeight = 20.0;
+    skirtMeshMetadata.skirtEastHeight = 30.0;
+    skirtMeshMetadata.skirtNorthHeight = 40.0;
+    primitive.extras = SkirtMeshMetadata::createGltfExtras(skirtMeshMetadata);
+  }
+
+  model.nodes.emplace_back().mesh = 0;
+  return model;
+}
+
+static void
+checkSameUpsampledModel(const Model& expected, const Model& actual) {
+  REQUIRE(actual.buffers.size() == expected.buffers.size());
+  for (size_t i = 0; i < expected.buffers.size(); ++i) {
+    CHECK(actual.buffers[i].cesium.data == expected.buffers[i].cesium.data);
+  }
+
+  REQUIRE(actual.accessors.size() == expected.accessors.size());
+  for (size_t i = 0; i < expected.accessors.size(); ++i) {
+    CHECK(actual.accessors[i].bufferView == expected.accessors[i].bufferView);
+    CHECK(actual.accessors[i].byteOffset == expected.accessors[i].byteOffset);
+    CHECK(actual.accessors[i].count == expected.accessors[i].count);
+    CHECK(actual.accessors[i].min == expected.accessors[i].min);
+    CHECK(actual.accessors[i].max == expected.accessors[i].max);
+  }
+
+  REQUIRE(actual.meshes.size() == expected.meshes.size());
+  for (size_t i = 0; i < expected.meshes.size(); ++i) {
+    const std::vector<MeshPrimitive>& expectedPrimitives =
+        expected.meshes[i].primitives;
+    const std::vector<MeshPrimitive>& actualPrimitives =
+        actual.meshes[i].primitives;
+    REQUIRE(actualPrimitives.size() == expectedPrimitives.size());
+    for (size_t j = 0; j < expectedPrimitives.size(); ++j) {
+      CHECK(actualPrimitives[j].attributes == expectedPrimitives[j].attributes);
+      CHECK(actualPrimitives[j].indices == expectedPrimitives[j].indices);
+
+      std::optional<SkirtMeshMetadata> expectedSkirt =
+          SkirtMeshMetadata::parseFromGltfExtras(expectedPrimitives[j].extras);
+      std::optional<SkirtMeshMetadata> actualSkirt =
+          SkirtMeshMetadata::parseFromGltfExtras(actualPrimitives[j].extras);
+      REQUIRE(actualSkirt.has_value() == expectedSkirt.has_value());
+      if (expectedSkirt) {
+        CHECK(
+            actualSkirt->noSkirtIndicesCount ==
+            expectedSkirt->noSkirtIndicesCount);
+        CHECK(
+            actualSkirt->noSkirtVerticesCount ==
+            expectedSkirt->noSkirtVerticesCount);
+        CHECK(actualSkirt->skirtWestHeight == expectedSkirt->skirtWestHeight);
+        CHECK(
+            actualSkirt->skirtSouthHeight == expectedSkirt->skirtSouthHeight);
+        CHECK(actualSkirt->skirtEastHeight == expectedSkirt->skirtEastHeight);
+        CHECK(
+            actualSkirt->skirtNorthHeight == expectedSkirt->skirtNorthHeight);
+      }
+    }
+  }
+}
+
+TEST_CASE(
+    "upsampleGltfForRasterOverlayChildren matches upsampling each child") {
+  const CesiumGeometry::QuadtreeTileID parentID(3, 5, 2);
+
+  for (const bool withSkirts : {false, true}) {
+    for (const bool hasInvertedVCoordinate : {false, true}) {
+      // An odd grid size makes some of the triangles straddle the boundaries
+      // between the children.
+      const Model parentModel = createGridModel(7, withSkirts);
+
+      std::array<std::optional<Model>, 4> children =
+          RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+              parentModel,
+              parentID,
+              hasInvertedVCoordinate);
+
+      for (uint32_t i = 0; i < 4; ++i) {
+        const CesiumGeometry::UpsampledQuadtreeNode childID{
+            CesiumGeometry::QuadtreeTileID(
+                parentID.level + 1,
+                parentID.x * 2 + (i & 1),
+                parentID.y * 2 + (i >> 1))};
+        std::optional<Model> expected =
+            RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+                parentModel,
+                childID,
+                hasInvertedVCoordinate);
+
+        REQUIRE(expected.has_value());
+        REQUIRE(children[i].has_value());
+        checkSameUpsampledModel(*expected, *children[i]);
+      }
+    }
+  }
+}
+
+TEST_CASE(
+    "Benchmark upsampling all four children of a terrain tile",
+    "[.][benchmark]") {
+  const CesiumGeometry::QuadtreeTileID parentID(10, 0, 0);
+
+  for (const uint32_t gridSize : {64U, 256U}) {
+    const Model parentModel = createGridModel(gridSize, true);
+    const std::string suffix = " of a " + std::to_string(gridSize) + "x" +
+                               std::to_string(gridSize) + " grid";
+
+    BENCHMARK("Upsample each child separately" + suffix) {
+      size_t count = 0;
+      for (uint32_t i = 0; i < 4; ++i) {
+        const CesiumGeometry::UpsampledQuadtreeNode childID{
+            CesiumGeometry::QuadtreeTileID(
+                parentID.level + 1,
+                parentID.x * 2 + (i & 1),
+                parentID.y * 2 + (i >> 1))};
+        count += RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+                     parentModel,
+                     childID)
+                     ->buffers.size();
+      }
+      return count;
+    };
+
+    BENCHMARK("Upsample all children at once" + suffix) {
+      size_t count = 0;
+      for (const std::optional<Model>& child :
+           RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+               parentModel,
+               parentID)) {
+        count += child->buffers.size();
+      }
+      return count;
+    };
+  }
+}
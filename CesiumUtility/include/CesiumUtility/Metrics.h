@@ -0,0 +1,267 @@
+#pragma once
+
+#include "Library.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace CesiumUtility {
+
+/**
+ * @brief A value that only ever increases, such as the number of requests
+ * made.
+ *
+ * All operations use relaxed atomics, so a counter may be updated from any
+ * thread for about the cost of an uncontended increment.
+ */
+class CESIUMUTILITY_API MetricCounter final {
+public:
+  MetricCounter() noexcept = default;
+  MetricCounter(const MetricCounter& rhs) = delete;
+  MetricCounter& operator=(const MetricCounter& rhs) = delete;
+
+  /**
+   * @brief Adds to the counter.
+   *
+   * @param value The amount to add.
+   */
+  void add(int64_t value = 1) noexcept {
+    this->_value.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Gets the current value of the counter.
+   */
+  int64_t get() const noexcept {
+    return this->_value.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<int64_t> _value{0};
+};
+
+/**
+ * @brief A value that may go up or down, such as the length of a queue.
+ *
+ * All operations use relaxed atomics.
+ */
+class CESIUMUTILITY_API MetricGauge final {
+public:
+  MetricGauge() noexcept = default;
+  MetricGauge(const MetricGauge& rhs) = delete;
+  MetricGauge& operator=(const MetricGauge& rhs) = delete;
+
+  /**
+   * @brief Sets the value of the gauge.
+   */
+  void set(int64_t value) noexcept {
+    this->_value.store(value, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Adds to the value of the gauge, which may be negative.
+   */
+  void add(int64_t value) noexcept {
+    this->_value.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Gets the current value of the gauge.
+   */
+  int64_t get() const noexcept {
+    return this->_value.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<int64_t> _value{0};
+};
+
+/**
+ * @brief The distribution of a value, such as the duration of a request.
+ *
+ * Values are counted in buckets whose upper bounds are powers of two, so
+ * recording a value is a few relaxed atomic operations, and the memory used
+ * doesn't depend on the number of values recorded. Bucket 0 counts values less
+ * than 1, and bucket `i` counts values in `[2^(i-1), 2^i)`.
+ *
+ * Durations are recorded in microseconds by convention.
+ */
+class CESIUMUTILITY_API MetricHistogram final {
+public:
+  /**
+   * @brief The number of buckets, which is enough for any `int64_t`.
+   */
+  static constexpr size_t bucketCount = 64;
+
+  MetricHistogram() noexcept = default;
+  MetricHistogram(const MetricHistogram& rhs) = delete;
+  MetricHistogram& operator=(const MetricHistogram& rhs) = delete;
+
+  /**
+   * @brief Records a value.
+   */
+  void record(int64_t value) noexcept;
+
+  /**
+   * @brief Records the time elapsed since the given time, in microseconds.
+   */
+  void
+  recordElapsedSince(std::chrono::steady_clock::time_point start) noexcept {
+    this->record(std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count());
+  }
+
+  /**
+   * @brief Gets the number of values recorded.
+   */
+  int64_t getCount() const noexcept {
+    return this->_count.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Gets the sum of the values recorded.
+   */
+  int64_t getSum() const noexcept {
+    return this->_sum.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Gets the largest value recorded, or 0 if none have been.
+   */
+  int64_t getMaximum() const noexcept {
+    return this->_maximum.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Gets the number of values recorded in a bucket.
+   *
+   * @param bucket The index of the bucket, which must be less than
+   * {@link bucketCount}.
+   */
+  int64_t getBucketCount(size_t bucket) const noexcept {
+    return this->_buckets[bucket].load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Gets the exclusive upper bound of the values counted in a bucket.
+   */
+  static int64_t getBucketUpperBound(size_t bucket) noexcept;
+
+  /**
+   * @brief Estimates a percentile of the values recorded, as the upper bound
+   * of the bucket that contains it. Returns 0 if no values have been recorded.
+   *
+   * @param percentile The percentile, from 0.0 to 100.0.
+   */
+  int64_t estimatePercentile(double percentile) const noexcept;
+
+private:
+  std::array<std::atomic<int64_t>, bucketCount> _buckets{};
+  std::atomic<int64_t> _count{0};
+  std::atomic<int64_t> _sum{0};
+  std::atomic<int64_t> _maximum{0};
+};
+
+/**
+ * @brief A destination for runtime metrics.
+ *
+ * Instrumented classes get their metrics from a sink by name when they are
+ * constructed, and then update them directly with relaxed atomics, so
+ * collecting metrics is cheap enough to leave on all the time. Classes that
+ * share a sink share the metrics with the same name.
+ *
+ * Implementations must return the same object every time they are asked for
+ * the same name, and that object must live as long as the sink.
+ */
+class CESIUMUTILITY_API IMetricsSink {
+public:
+  virtual ~IMetricsSink() = default;
+
+  /**
+   * @brief Gets the counter with the given name, creating it if necessary.
+   */
+  virtual MetricCounter& getCounter(const std::string& name) = 0;
+
+  /**
+   * @brief Gets the gauge with the given name, creating it if necessary.
+   */
+  virtual MetricGauge& getGauge(const std::string& name) = 0;
+
+  /**
+   * @brief Gets the histogram with the given name, creating it if necessary.
+   */
+  virtual MetricHistogram& getHistogram(const std::string& name) = 0;
+};
+
+/**
+ * @brief An {@link IMetricsSink} that keeps its metrics in memory, where they
+ * can be read at any time, for example to show them in an overlay or to
+ * export them periodically.
+ */
+class CESIUMUTILITY_API InMemoryMetricsSink : public IMetricsSink {
+public:
+  /** @copydoc IMetricsSink::getCounter */
+  MetricCounter& getCounter(const std::string& name) override;
+
+  /** @copydoc IMetricsSink::getGauge */
+  MetricGauge& getGauge(const std::string& name) override;
+
+  /** @copydoc IMetricsSink::getHistogram */
+  MetricHistogram& getHistogram(const std::string& name) override;
+
+  /**
+   * @brief Finds the counter with the given name, or returns nullptr if no one
+   * has asked for it yet.
+   */
+  const MetricCounter* findCounter(const std::string& name) const;
+
+  /**
+   * @brief Finds the gauge with the given name, or returns nullptr if no one
+   * has asked for it yet.
+   */
+  const MetricGauge* findGauge(const std::string& name) const;
+
+  /**
+   * @brief Finds the histogram with the given name, or returns nullptr if no
+   * one has asked for it yet.
+   */
+  const MetricHistogram* findHistogram(const std::string& name) const;
+
+  /**
+   * @brief Calls a function for each counter, in order of name.
+   */
+  void forEachCounter(
+      const std::function<void(const std::string&, const MetricCounter&)>&
+          callback) const;
+
+  /**
+   * @brief Calls a function for each gauge, in order of name.
+   */
+  void forEachGauge(
+      const std::function<void(const std::string&, const MetricGauge&)>&
+          callback) const;
+
+  /**
+   * @brief Calls a function for each histogram, in order of name.
+   */
+  void forEachHistogram(
+      const std::function<void(const std::string&, const MetricHistogram&)>&
+          callback) const;
+
+private:
+  mutable std::mutex _mutex;
+  std::map<std::string, std::unique_ptr<MetricCounter>> _counters;
+  std::map<std::string, std::unique_ptr<MetricGauge>> _gauges;
+  std::map<std::string, std::unique_ptr<MetricHistogram>> _histograms;
+};
+
+} // namespace CesiumUtility
@@ -6,6 +6,7 @@
 #include <CesiumUtility/Library.h>
 
 #include <atomic>
+#include <cstddef>
 
 namespace CesiumAsync {
 template <typename TAssetType, typename TAssetKey> class SharedAssetDepot;
@@ -142,6 +143,10 @@ private:
   mutable std::atomic<std::int32_t> _referenceCount{0};
   IDepotOwningAsset<T>* _pDepot{nullptr};
 
+  // The index of the stripe within _pDepot that holds this asset's entry. Only
+  // meaningful if _pDepot is not nullptr.
+  size_t _depotStripe{0};
+
   // To allow the depot to modify _pDepot.
   template <typename TAssetType, typename TAssetKey>
   friend class CesiumAsync::SharedAssetDepot;
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "Library.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace CesiumUtility {
+
+/**
+ * @brief Options for a {@link TraceRecorder}.
+ */
+struct CESIUMUTILITY_API TraceRecorderOptions {
+  /**
+   * @brief The number of events that each thread can record before the
+   * background thread writes them.
+   *
+   * This is rounded up to a power of two. Events that are recorded while a
+   * thread's buffer is full are dropped rather than waiting for space.
+   */
+  size_t eventsPerThread = 16384;
+
+  /**
+   * @brief Records only one of every `sampleInterval` complete and counter
+   * events on each thread.
+   *
+   * A value of 1 records every event. Begin and end events are always
+   * recorded, because each must be paired with the other.
+   */
+  uint32_t sampleInterval = 1;
+
+  /**
+   * @brief The maximum number of complete and counter events that each thread
+   * records per second, or 0 for no limit.
+   *
+   * Events beyond the limit are dropped until the next second begins.
+   */
+  uint32_t maximumEventsPerSecondPerThread = 0;
+
+  /**
+   * @brief How often the background thread writes the recorded events.
+   */
+  std::chrono::milliseconds drainInterval{10};
+};
+
+/**
+ * @brief Records trace events with very little overhead, and writes them in
+ * the Chrome tracing JSON format, which can also be viewed in Perfetto.
+ *
+ * Each thread that records an event gets its own fixed-size ring buffer of
+ * binary events, which only that thread writes to. A background thread
+ * periodically drains every buffer and formats the events as JSON, so
+ * recording an event never takes a lock, allocates, or formats text. Event
+ * names are interned, so an event only stores the ID of its name.
+ *
+ * This is the backend of the `CESIUM_TRACE` macros, but it is always compiled,
+ * so it can also be used directly.
+ */
+class CESIUMUTILITY_API TraceRecorder final {
+public:
+  /**
+   * @brief Creates a recorder and starts the background thread.
+   *
+   * @param pOutput The stream to write the JSON to.
+   * @param options The options for the recorder.
+   */
+  TraceRecorder(
+      std::unique_ptr<std::ostream>&& pOutput,
+      const TraceRecorderOptions& options = TraceRecorderOptions());
+
+  /**
+   * @brief Stops the recorder, if it hasn't been stopped already.
+   */
+  ~TraceRecorder() noexcept;
+
+  TraceRecorder(const TraceRecorder& rhs) = delete;
+  TraceRecorder& operator=(const TraceRecorder& rhs) = delete;
+
+  /**
+   * @brief Gets the ID of an event name.
+   *
+   * Each thread caches the IDs of the names it has used by their address, so
+   * this is fastest when the same name, such as a string literal, is passed
+   * each time.
+   *
+   * @param name The name.
+   * @return The ID of the name.
+   */
+  uint32_t internName(const char* name);
+
+  /**
+   * @brief Records an operation with a known start time and duration on the
+   * calling thread.
+   *
+   * @param nameID The ID of the name of the operation.
+   * @param startMicroseconds The start time, as returned by {@link now}.
+   * @param durationMicroseconds The duration of the operation.
+   */
+  void recordComplete(
+      uint32_t nameID,
+      int64_t startMicroseconds,
+      int64_t durationMicroseconds);
+
+  /**
+   * @brief Records the beginning of an operation.
+   *
+   * @param nameID The ID of the name of the operation.
+   * @param id The ID of the async track of the operation, or a negative value
+   * to record the operation on the calling thread.
+   */
+  void recordBegin(uint32_t nameID, int64_t id);
+
+  /**
+   * @brief Records the end of an operation started with {@link recordBegin}.
+   *
+   * @param nameID The ID of the name of the operation.
+   * @param id The ID of the async track of the operation, or a negative value
+   * to record the operation on the calling thread.
+   */
+  void recordEnd(uint32_t nameID, int64_t id);
+
+  /**
+   * @brief Records the current value of a counter.
+   *
+   * @param nameID The ID of the name of the counter.
+   * @param value The value of the counter.
+   */
+  void recordCounter(uint32_t nameID, int64_t value);
+
+  /**
+   * @brief Stops the background thread, writes all of the events that have
+   * been recorded, and completes the JSON.
+   *
+   * Events recorded after this are ignored.
+   */
+  void stop();
+
+  /**
+   * @brief Gets the number of events that were dropped because a thread's
+   * buffer was full.
+   *
+   * Events that are skipped because of sampling or the rate limit are not
+   * counted.
+   */
+  uint64_t getDroppedEventCount() const;
+
+  /**
+   * @brief Gets the current time of the clock used for the events, in
+   * microseconds.
+   */
+  static int64_t now() noexcept;
+
+private:
+  struct Event;
+  struct ThreadBuffer;
+
+  ThreadBuffer& getThreadBuffer();
+  bool isSampled(ThreadBuffer& buffer, int64_t time) const noexcept;
+  void record(ThreadBuffer& buffer, const Event& event);
+  void drainThread();
+  void drain();
+  void writeEvent(const Event& event, uint32_t threadIndex);
+
+  TraceRecorderOptions _options;
+  size_t _capacity;
+  uint64_t _id;
+  std::atomic<bool> _stopped;
+
+  std::mutex _namesMutex;
+  std::deque<std::string> _names;
+  std::unordered_map<std::string, uint32_t> _nameIDs;
+
+  mutable std::mutex _buffersMutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+
+  // Only used by the drain thread, or by stop after the drain thread has
+  // finished.
+  std::unique_ptr<std::ostream> _pOutput;
+  uint64_t _eventCount;
+
+  // A copy of _names, so that events can be written without holding
+  // _namesMutex. Names added since the last drain are copied before writing.
+  std::vector<std::string> _writtenNames;
+
+  std::mutex _drainMutex;
+  std::condition_variable _drainCondition;
+  bool _stopping;
+  std::thread _drainThread;
+};
+
+} // namespace CesiumUtility
@@ -17,6 +17,7 @@
 #define CESIUM_TRACE_END(name)
 #define CESIUM_TRACE_BEGIN_IN_TRACK(name)
 #define CESIUM_TRACE_END_IN_TRACK(name)
+#define CESIUM_TRACE_COUNTER(name, value)
 #define CESIUM_TRACE_DECLARE_TRACK_SET(id, name)
 #define CESIUM_TRACE_USE_TRACK_SET(id)
 #define CESIUM_TRACE_LAMBDA_CAPTURE_TRACK() tracingTrack = false
@@ -24,9 +25,11 @@
 
 #else
 
+#include <CesiumUtility/TraceRecorder.h>
+
 #include <atomic>
 #include <chrono>
-#include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -142,6 +145,21 @@
     CESIUM_TRACE_END(name);                                                    \
   }
 
+/**
+ * @brief Records the current value of a named counter.
+ *
+ * Counters are shown as a graph over time in the Chromium trace viewer, which
+ * makes them useful for tracking quantities such as queue lengths from frame
+ * to frame.
+ *
+ * @param name The name of the counter.
+ * @param value The current value of the counter.
+ */
+#define CESIUM_TRACE_COUNTER(name, value)                                      \
+  CesiumUtility::CesiumImpl::Tracer::instance().writeCounterEvent(             \
+      name,                                                                    \
+      static_cast<int64_t>(value))
+
 /**
  * @brief Declares a set of tracing tracks as a field inside a class.
  *
@@ -218,14 +236,19 @@ public:
 
   ~Tracer();
 
-  void startTracing(const std::string& filePath = "trace.json");
+  void startTracing(
+      const std::string& filePath = "trace.json",
+      const TraceRecorderOptions& options = TraceRecorderOptions());
   void endTracing();
 
+  TraceRecorder* getRecorder() const noexcept;
+
   void writeCompleteEvent(const Trace& trace);
   void writeAsyncEventBegin(const char* name, int64_t id);
   void writeAsyncEventBegin(const char* name);
   void writeAsyncEventEnd(const char* name, int64_t id);
   void writeAsyncEventEnd(const char* name);
+  void writeCounterEvent(const char* name, int64_t value);
 
   int64_t allocateTrackID();
 
@@ -233,20 +256,19 @@ private:
   Tracer();
 
   int64_t getCurrentThreadTrackID() const;
-  void writeAsyncEvent(
-      const char* category,
-      const char* name,
-      char type,
-      int64_t id);
-
-  std::ofstream _output;
-  uint32_t _numTraces;
+
   std::mutex _lock;
+  std::unique_ptr<TraceRecorder> _pRecorder;
+  // Recorders are kept until the tracer is destroyed, because a thread may
+  // still be using one after tracing ends.
+  std::vector<std::unique_ptr<TraceRecorder>> _stoppedRecorders;
+  std::atomic<TraceRecorder*> _pActiveRecorder;
   std::atomic<int64_t> _lastAllocatedID;
 };
 
 class ScopedTrace {
 public:
+  explicit ScopedTrace(const char* message);
   explicit ScopedTrace(const std::string& message);
   ~ScopedTrace();
 
@@ -258,9 +280,9 @@ public:
   ScopedTrace& operator=(ScopedTrace&& rhs) = delete;
 
 private:
-  std::string _name;
-  std::chrono::steady_clock::time_point _startTime;
-  std::thread::id _threadId;
+  TraceRecorder* _pRecorder;
+  uint32_t _nameID;
+  int64_t _startTime;
   bool _reset;
 };
 
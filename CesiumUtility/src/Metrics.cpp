@@ -0,0 +1,147 @@
+#include <CesiumUtility/Metrics.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace CesiumUtility {
+
+namespace {
+
+size_t getBucket(int64_t value) noexcept {
+  size_t bucket = 0;
+  for (uint64_t remaining = value > 0 ? uint64_t(value) : 0; remaining > 0;
+       remaining >>= 1) {
+    ++bucket;
+  }
+  return bucket < MetricHistogram::bucketCount
+             ? bucket
+             : MetricHistogram::bucketCount - 1;
+}
+
+template <typename TMetric>
+TMetric& getOrCreate(
+    std::mutex& mutex,
+    std::map<std::string, std::unique_ptr<TMetric>>& metrics,
+    const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex);
+  std::unique_ptr<TMetric>& pMetric = metrics[name];
+  if (!pMetric) {
+    pMetric = std::make_unique<TMetric>();
+  }
+  return *pMetric;
+}
+
+template <typename TMetric>
+const TMetric* find(
+    std::mutex& mutex,
+    const std::map<std::string, std::unique_ptr<TMetric>>& metrics,
+    const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = metrics.find(name);
+  return it == metrics.end() ? nullptr : it->second.get();
+}
+
+template <typename TMetric>
+void forEach(
+    std::mutex& mutex,
+    const std::map<std::string, std::unique_ptr<TMetric>>& metrics,
+    const std::function<void(const std::string&, const TMetric&)>& callback) {
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const auto& [name, pMetric] : metrics) {
+    callback(name, *pMetric);
+  }
+}
+
+} // namespace
+
+void MetricHistogram::record(int64_t value) noexcept {
+  this->_buckets[getBucket(value)].fetch_add(1, std::memory_order_relaxed);
+  this->_count.fetch_add(1, std::memory_order_relaxed);
+  this->_sum.fetch_add(value, std::memory_order_relaxed);
+
+  int64_t maximum = this->_maximum.load(std::memory_order_relaxed);
+  while (value > maximum && !this->_maximum.compare_exchange_weak(
+                                maximum,
+                                value,
+                                std::memory_order_relaxed)) {
+  }
+}
+
+/*static*/ int64_t
+MetricHistogram::getBucketUpperBound(size_t bucket) noexcept {
+  if (bucket >= bucketCount - 1) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  return int64_t(1) << bucket;
+}
+
+int64_t MetricHistogram::estimatePercentile(double percentile) const noexcept {
+  const int64_t count = this->getCount();
+  if (count == 0) {
+    return 0;
+  }
+
+  const double rank = percentile / 100.0 * double(count);
+  int64_t seen = 0;
+  for (size_t i = 0; i < bucketCount; ++i) {
+    seen += this->getBucketCount(i);
+    if (double(seen) >= rank && seen > 0) {
+      return getBucketUpperBound(i);
+    }
+  }
+
+  return getBucketUpperBound(bucketCount - 1);
+}
+
+MetricCounter& InMemoryMetricsSink::getCounter(const std::string& name) {
+  return getOrCreate(this->_mutex, this->_counters, name);
+}
+
+MetricGauge& InMemoryMetricsSink::getGauge(const std::string& name) {
+  return getOrCreate(this->_mutex, this->_gauges, name);
+}
+
+MetricHistogram& InMemoryMetricsSink::getHistogram(const std::string& name) {
+  return getOrCreate(this->_mutex, this->_histograms, name);
+}
+
+const MetricCounter*
+InMemoryMetricsSink::findCounter(const std::string& name) const {
+  return find(this->_mutex, this->_counters, name);
+}
+
+const MetricGauge*
+InMemoryMetricsSink::findGauge(const std::string& name) const {
+  return find(this->_mutex, this->_gauges, name);
+}
+
+const MetricHistogram*
+InMemoryMetricsSink::findHistogram(const std::string& name) const {
+  return find(this->_mutex, this->_histograms, name);
+}
+
+void InMemoryMetricsSink::forEachCounter(
+    const std::function<void(const std::string&, const MetricCounter&)>&
+        callback) const {
+  forEach(this->_mutex, this->_counters, callback);
+}
+
+void InMemoryMetricsSink::forEachGauge(
+    const std::function<void(const std::string&, const MetricGauge&)>&
+        callback) const {
+  forEach(this->_mutex, this->_gauges, callback);
+}
+
+void InMemoryMetricsSink::forEachHistogram(
+    const std::function<void(const std::string&, const MetricHistogram&)>&
+        callback) const {
+  forEach(this->_mutex, this->_histograms, callback);
+}
+
+} // namespace CesiumUtility
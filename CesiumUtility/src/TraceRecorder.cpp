@@ -0,0 +1,353 @@
+#include <CesiumUtility/TraceRecorder.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CesiumUtility {
+
+namespace {
+
+// The number of name addresses that each thread caches before starting over,
+// so that names built at runtime can't make the cache grow without bound.
+constexpr size_t maximumCachedNames = 1024;
+
+constexpr int64_t microsecondsPerSecond = 1000000;
+
+size_t roundUpToPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+std::atomic<uint64_t> lastRecorderID{0};
+
+} // namespace
+
+struct TraceRecorder::Event {
+  int64_t time;
+  // The duration of a complete event, the track of a begin or end event, or
+  // the value of a counter.
+  int64_t value;
+  uint32_t nameID;
+  char phase;
+};
+
+struct TraceRecorder::ThreadBuffer {
+  ThreadBuffer(size_t capacity, uint32_t threadIndex_)
+      : events(capacity), threadIndex(threadIndex_) {}
+
+  // A single-producer, single-consumer ring. Only the thread that owns the
+  // buffer advances `head`, and only the drain thread advances `tail`.
+  std::vector<Event> events;
+  std::atomic<size_t> head{0};
+  std::atomic<size_t> tail{0};
+  std::atomic<uint64_t> droppedEvents{0};
+  uint32_t threadIndex;
+
+  // Only used by the thread that owns the buffer.
+  uint32_t eventsUntilSample = 0;
+  int64_t rateWindowStart = 0;
+  uint32_t eventsInRateWindow = 0;
+  std::unordered_map<const char*, std::pair<uint32_t, const std::string*>>
+      nameCache;
+};
+
+TraceRecorder::TraceRecorder(
+    std::unique_ptr<std::ostream>&& pOutput,
+    const TraceRecorderOptions& options)
+    : _options(options),
+      _capacity(
+          roundUpToPowerOfTwo(std::max(options.eventsPerThread, size_t(1)))),
+      _id(++lastRecorderID),
+      _stopped(false),
+      _namesMutex(),
+      _names(),
+      _nameIDs(),
+      _buffersMutex(),
+      _buffers(),
+      _pOutput(std::move(pOutput)),
+      _eventCount(0),
+      _writtenNames(),
+      _drainMutex(),
+      _drainCondition(),
+      _stopping(false),
+      _drainThread() {
+  if (this->_options.sampleInterval == 0) {
+    this->_options.sampleInterval = 1;
+  }
+
+  *this->_pOutput << "{\"traceEvents\":[";
+  this->_drainThread = std::thread([this]() { this->drainThread(); });
+}
+
+TraceRecorder::~TraceRecorder() noexcept { this->stop(); }
+
+uint32_t TraceRecorder::internName(const char* name) {
+  ThreadBuffer& buffer = this->getThreadBuffer();
+
+  // The same address may hold a different name by now, so check the contents,
+  // too.
+  auto it = buffer.nameCache.find(name);
+  if (it != buffer.nameCache.end() && *it->second.second == name) {
+    return it->second.first;
+  }
+
+  uint32_t nameID;
+  const std::string* pName;
+  {
+    std::lock_guard<std::mutex> lock(this->_namesMutex);
+    auto [nameIt, inserted] = this->_nameIDs.emplace(
+        name,
+        static_cast<uint32_t>(this->_names.size()));
+    if (inserted) {
+      this->_names.emplace_back(name);
+    }
+    nameID = nameIt->second;
+    pName = &this->_names[nameID];
+  }
+
+  if (buffer.nameCache.size() >= maximumCachedNames) {
+    buffer.nameCache.clear();
+  }
+  buffer.nameCache[name] = std::make_pair(nameID, pName);
+
+  return nameID;
+}
+
+void TraceRecorder::recordComplete(
+    uint32_t nameID,
+    int64_t startMicroseconds,
+    int64_t durationMicroseconds) {
+  ThreadBuffer& buffer = this->getThreadBuffer();
+  if (this->isSampled(buffer, startMicroseconds + durationMicroseconds)) {
+    this->record(
+        buffer,
+        Event{startMicroseconds, durationMicroseconds, nameID, 'X'});
+  }
+}
+
+void TraceRecorder::recordBegin(uint32_t nameID, int64_t id) {
+  this->record(
+      this->getThreadBuffer(),
+      Event{TraceRecorder::now(), id, nameID, id < 0 ? 'B' : 'b'});
+}
+
+void TraceRecorder::recordEnd(uint32_t nameID, int64_t id) {
+  this->record(
+      this->getThreadBuffer(),
+      Event{TraceRecorder::now(), id, nameID, id < 0 ? 'E' : 'e'});
+}
+
+void TraceRecorder::recordCounter(uint32_t nameID, int64_t value) {
+  ThreadBuffer& buffer = this->getThreadBuffer();
+  const int64_t time = TraceRecorder::now();
+  if (this->isSampled(buffer, time)) {
+    this->record(buffer, Event{time, value, nameID, 'C'});
+  }
+}
+
+void TraceRecorder::stop() {
+  {
+    std::lock_guard<std::mutex> lock(this->_drainMutex);
+    if (this->_stopping) {
+      return;
+    }
+    this->_stopping = true;
+    this->_stopped.store(true, std::memory_order_relaxed);
+  }
+
+  this->_drainCondition.notify_all();
+  this->_drainThread.join();
+
+  this->drain();
+
+  *this->_pOutput << "],\"otherData\":{\"droppedEvents\":"
+                  << this->getDroppedEventCount() << "}}";
+  this->_pOutput->flush();
+}
+
+uint64_t TraceRecorder::getDroppedEventCount() const {
+  std::lock_guard<std::mutex> lock(this->_buffersMutex);
+  uint64_t count = 0;
+  for (const std::shared_ptr<ThreadBuffer>& pBuffer : this->_buffers) {
+    count += pBuffer->droppedEvents.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+/*static*/ int64_t TraceRecorder::now() noexcept {
+  return std::chrono::time_point_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now())
+      .time_since_epoch()
+      .count();
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::getThreadBuffer() {
+  // Each thread keeps its buffer for every recorder that it has used, which
+  // is usually just one. Recorders are identified by a unique ID rather than
+  // by address, because a new recorder may reuse the address of an old one.
+  static thread_local std::vector<
+      std::pair<uint64_t, std::shared_ptr<ThreadBuffer>>>
+      threadBuffers;
+
+  for (auto it = threadBuffers.rbegin(); it != threadBuffers.rend(); ++it) {
+    if (it->first == this->_id) {
+      return *it->second;
+    }
+  }
+
+  std::shared_ptr<ThreadBuffer> pBuffer;
+  {
+    std::lock_guard<std::mutex> lock(this->_buffersMutex);
+    pBuffer = std::make_shared<ThreadBuffer>(
+        this->_capacity,
+        static_cast<uint32_t>(this->_buffers.size()));
+    this->_buffers.emplace_back(pBuffer);
+  }
+
+  threadBuffers.emplace_back(this->_id, pBuffer);
+  return *pBuffer;
+}
+
+bool TraceRecorder::isSampled(
+    ThreadBuffer& buffer,
+    int64_t time) const noexcept {
+  if (buffer.eventsUntilSample > 0) {
+    --buffer.eventsUntilSample;
+    return false;
+  }
+
+  if (this->_options.maximumEventsPerSecondPerThread > 0) {
+    if (time - buffer.rateWindowStart >= microsecondsPerSecond) {
+      buffer.rateWindowStart = time;
+      buffer.eventsInRateWindow = 0;
+    }
+    if (buffer.eventsInRateWindow >=
+        this->_options.maximumEventsPerSecondPerThread) {
+      return false;
+    }
+    ++buffer.eventsInRateWindow;
+  }
+
+  buffer.eventsUntilSample = this->_options.sampleInterval - 1;
+  return true;
+}
+
+void TraceRecorder::record(ThreadBuffer& buffer, const Event& event) {
+  if (this->_stopped.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  const size_t head = buffer.head.load(std::memory_order_relaxed);
+  const size_t tail = buffer.tail.load(std::memory_order_acquire);
+  if (head - tail >= this->_capacity) {
+    // Only this thread writes the count, so it doesn't need to be incremented
+    // atomically.
+    buffer.droppedEvents.store(
+        buffer.droppedEvents.load(std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+    return;
+  }
+
+  buffer.events[head & (this->_capacity - 1)] = event;
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void TraceRecorder::drainThread() {
+  std::unique_lock<std::mutex> lock(this->_drainMutex);
+  while (!this->_stopping) {
+    this->_drainCondition.wait_for(
+        lock,
+        this->_options.drainInterval,
+        [this]() { return this->_stopping; });
+    lock.unlock();
+    this->drain();
+    lock.lock();
+  }
+}
+
+void TraceRecorder::drain() {
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  {
+    std::lock_guard<std::mutex> lock(this->_buffersMutex);
+    buffers = this->_buffers;
+  }
+
+  for (const std::shared_ptr<ThreadBuffer>& pBuffer : buffers) {
+    ThreadBuffer& buffer = *pBuffer;
+    size_t tail = buffer.tail.load(std::memory_order_relaxed);
+    const size_t head = buffer.head.load(std::memory_order_acquire);
+    if (tail == head) {
+      continue;
+    }
+
+    // Copy the names added since the last drain. Names are only ever added,
+    // and the name of each of these events was added before the event was
+    // recorded, so it is among them.
+    {
+      std::lock_guard<std::mutex> lock(this->_namesMutex);
+      this->_writtenNames.insert(
+          this->_writtenNames.end(),
+          this->_names.begin() +
+              static_cast<std::ptrdiff_t>(this->_writtenNames.size()),
+          this->_names.end());
+    }
+
+    for (; tail != head; ++tail) {
+      this->writeEvent(
+          buffer.events[tail & (this->_capacity - 1)],
+          buffer.threadIndex);
+    }
+
+    buffer.tail.store(head, std::memory_order_release);
+  }
+}
+
+void TraceRecorder::writeEvent(const Event& event, uint32_t threadIndex) {
+  std::ostream& output = *this->_pOutput;
+
+  // Chrome tracing wants the text like this
+  if (this->_eventCount++ > 0) {
+    output << ",";
+  }
+
+  output << "{\"cat\":\"cesium\",";
+  switch (event.phase) {
+  case 'X':
+    output << "\"dur\":" << event.value << ",";
+    output << "\"tid\":" << threadIndex << ",";
+    break;
+  case 'b':
+  case 'e':
+    output << "\"id\":" << event.value << ",";
+    break;
+  case 'B':
+  case 'E':
+    output << "\"tid\":" << threadIndex << ",";
+    break;
+  default:
+    break;
+  }
+  output << "\"name\":\"" << this->_writtenNames[event.nameID] << "\",";
+  output << "\"ph\":\"" << event.phase << "\",";
+  output << "\"pid\":0,";
+  output << "\"ts\":" << event.time;
+  if (event.phase == 'C') {
+    output << ",\"args\":{\"value\":" << event.value << "}";
+  }
+  output << "}";
+}
+
+} // namespace CesiumUtility
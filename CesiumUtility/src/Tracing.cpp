@@ -6,6 +6,8 @@
 #include <CesiumUtility/Assert.h>
 
 #include <algorithm>
+#include <fstream>
+#include <memory>
 
 #if CESIUM_TRACING_ENABLED
 
@@ -19,40 +21,52 @@ Tracer& Tracer::instance() {
 
 Tracer::~Tracer() { endTracing(); }
 
-void Tracer::startTracing(const std::string& filePath) {
-  this->_output.open(filePath);
-  this->_output << "{\"otherData\": {},\"traceEvents\":[";
+void Tracer::startTracing(
+    const std::string& filePath,
+    const TraceRecorderOptions& options) {
+  std::lock_guard<std::mutex> lock(this->_lock);
+  if (this->_pRecorder) {
+    this->_pActiveRecorder.store(nullptr, std::memory_order_release);
+    this->_pRecorder->stop();
+    this->_stoppedRecorders.emplace_back(std::move(this->_pRecorder));
+  }
+
+  this->_pRecorder = std::make_unique<TraceRecorder>(
+      std::make_unique<std::ofstream>(filePath),
+      options);
+  this->_pActiveRecorder.store(
+      this->_pRecorder.get(),
+      std::memory_order_release);
 }
 
 void Tracer::endTracing() {
-  this->_output << "]}";
-  this->_output.close();
+  std::lock_guard<std::mutex> lock(this->_lock);
+  if (this->_pRecorder) {
+    this->_pActiveRecorder.store(nullptr, std::memory_order_release);
+    this->_pRecorder->stop();
+    this->_stoppedRecorders.emplace_back(std::move(this->_pRecorder));
+  }
 }
 
-void Tracer::writeCompleteEvent(const Trace& trace) {
-  std::lock_guard<std::mutex> lock(_lock);
-  if (!this->_output) {
-    return;
-  }
+TraceRecorder* Tracer::getRecorder() const noexcept {
+  return this->_pActiveRecorder.load(std::memory_order_acquire);
+}
 
-  // Chrome tracing wants the text like this
-  if (this->_numTraces++ > 0) {
-    this->_output << ",";
+void Tracer::writeCompleteEvent(const Trace& trace) {
+  TraceRecorder* pRecorder = this->getRecorder();
+  if (pRecorder) {
+    pRecorder->recordComplete(
+        pRecorder->internName(trace.name.c_str()),
+        trace.start,
+        trace.duration);
   }
-
-  this->_output << "{";
-  this->_output << "\"cat\":\"cesium\",";
-  this->_output << "\"dur\":" << trace.duration << ',';
-  this->_output << "\"name\":\"" << trace.name << "\",";
-  this->_output << "\"ph\":\"X\",";
-  this->_output << "\"pid\":0,";
-  this->_output << "\"tid\":" << trace.threadID << ",";
-  this->_output << "\"ts\":" << trace.start;
-  this->_output << "}";
 }
 
 void Tracer::writeAsyncEventBegin(const char* name, int64_t id) {
-  this->writeAsyncEvent("cesium", name, 'b', id);
+  TraceRecorder* pRecorder = this->getRecorder();
+  if (pRecorder) {
+    pRecorder->recordBegin(pRecorder->internName(name), id);
+  }
 }
 
 void Tracer::writeAsyncEventBegin(const char* name) {
@@ -60,75 +74,58 @@ void Tracer::writeAsyncEventBegin(const char* name) {
 }
 
 void Tracer::writeAsyncEventEnd(const char* name, int64_t id) {
-  this->writeAsyncEvent("cesium", name, 'e', id);
+  TraceRecorder* pRecorder = this->getRecorder();
+  if (pRecorder) {
+    pRecorder->recordEnd(pRecorder->internName(name), id);
+  }
 }
 
 void Tracer::writeAsyncEventEnd(const char* name) {
   this->writeAsyncEventEnd(name, this->getCurrentThreadTrackID());
 }
 
+void Tracer::writeCounterEvent(const char* name, int64_t value) {
+  TraceRecorder* pRecorder = this->getRecorder();
+  if (pRecorder) {
+    pRecorder->recordCounter(pRecorder->internName(name), value);
+  }
+}
+
 int64_t Tracer::allocateTrackID() { return ++this->_lastAllocatedID; }
 
-Tracer::Tracer() : _output{}, _numTraces{0}, _lock{}, _lastAllocatedID(0) {}
+Tracer::Tracer()
+    : _lock{},
+      _pRecorder{},
+      _stoppedRecorders{},
+      _pActiveRecorder{nullptr},
+      _lastAllocatedID(0) {}
 
 int64_t Tracer::getCurrentThreadTrackID() const {
   const TrackReference* pTrack = TrackReference::current();
   return pTrack->getTracingID();
 }
 
-void Tracer::writeAsyncEvent(
-    const char* category,
-    const char* name,
-    char type,
-    int64_t id) {
-
-  bool isAsync = true;
-  if (id < 0) {
-    // Use a standard Duration event for slices without an async ID.
-    isAsync = false;
-    if (type == 'b') {
-      type = 'B';
-    } else if (type == 'e') {
-      type = 'E';
-    }
+ScopedTrace::ScopedTrace(const char* message)
+    : _pRecorder{Tracer::instance().getRecorder()},
+      _nameID{0},
+      _startTime{0},
+      _reset{_pRecorder == nullptr} {
+  if (!this->_pRecorder) {
+    return;
   }
 
-  std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
-  int64_t microseconds =
-      std::chrono::time_point_cast<std::chrono::microseconds>(time)
-          .time_since_epoch()
-          .count();
+  this->_nameID = this->_pRecorder->internName(message);
 
-  std::lock_guard<std::mutex> lock(_lock);
-  if (!this->_output) {
-    return;
+  const TrackReference* pTrack = TrackReference::current();
+  if (pTrack != nullptr) {
+    this->_pRecorder->recordBegin(this->_nameID, pTrack->getTracingID());
   }
 
-  // Chrome tracing wants the text like this
-  if (this->_numTraces++ > 0) {
-    this->_output << ",";
-  }
-  this->_output << "{";
-  this->_output << "\"cat\":\"" << category << "\",";
-  if (isAsync) {
-    this->_output << "\"id\":" << id << ",";
-  } else {
-    this->_output << "\"tid\":" << std::this_thread::get_id() << ",";
-  }
-  this->_output << "\"name\":\"" << name << "\",";
-  this->_output << "\"ph\":\"" << type << "\",";
-  this->_output << "\"pid\":0,";
-  this->_output << "\"ts\":" << microseconds;
-  this->_output << "}";
+  this->_startTime = TraceRecorder::now();
 }
 
 ScopedTrace::ScopedTrace(const std::string& message)
-    : _name{message},
-      _startTime{std::chrono::steady_clock::now()},
-      _threadId{std::this_thread::get_id()},
-      _reset{false} {
-  CESIUM_TRACE_BEGIN_IN_TRACK(_name.c_str());
-}
+    : ScopedTrace(message.c_str()) {}
 
 ScopedTrace::~ScopedTrace() {
   if (!this->_reset) {
@@ -139,20 +136,14 @@ ScopedTrace::~ScopedTrace() {
 void ScopedTrace::reset() {
   this->_reset = true;
 
-  if (TrackReference::current() != nullptr) {
-    CESIUM_TRACE_END(_name.c_str());
+  const TrackReference* pTrack = TrackReference::current();
+  if (pTrack != nullptr) {
+    this->_pRecorder->recordEnd(this->_nameID, pTrack->getTracingID());
   } else {
-    auto endTimePoint = std::chrono::steady_clock::now();
-    int64_t start = std::chrono::time_point_cast<std::chrono::microseconds>(
-                        this->_startTime)
-                        .time_since_epoch()
-                        .count();
-    int64_t end =
-        std::chrono::time_point_cast<std::chrono::microseconds>(endTimePoint)
-            .time_since_epoch()
-            .count();
-    Tracer::instance().writeCompleteEvent(
-        {this->_name, start, end - start, this->_threadId});
+    this->_pRecorder->recordComplete(
+        this->_nameID,
+        this->_startTime,
+        TraceRecorder::now() - this->_startTime);
   }
 }
 
@@ -0,0 +1,147 @@
+#include <CesiumUtility/Metrics.h>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CesiumUtility;
+
+TEST_CASE("MetricHistogram") {
+  MetricHistogram histogram;
+
+  SECTION("is empty before any values are recorded") {
+    CHECK(histogram.getCount() == 0);
+    CHECK(histogram.getSum() == 0);
+    CHECK(histogram.getMaximum() == 0);
+    CHECK(histogram.estimatePercentile(50.0) == 0);
+  }
+
+  SECTION("counts values in power-of-two buckets") {
+    histogram.record(-5);
+    histogram.record(0);
+    histogram.record(1);
+    histogram.record(2);
+    histogram.record(3);
+    histogram.record(4);
+    histogram.record(1000);
+
+    CHECK(histogram.getBucketCount(0) == 2);
+    CHECK(histogram.getBucketCount(1) == 1);
+    CHECK(histogram.getBucketCount(2) == 2);
+    CHECK(histogram.getBucketCount(3) == 1);
+    CHECK(histogram.getBucketCount(10) == 1);
+
+    CHECK(histogram.getCount() == 7);
+    CHECK(histogram.getSum() == 1005);
+    CHECK(histogram.getMaximum() == 1000);
+  }
+
+  SECTION("has bucket upper bounds that are powers of two") {
+    CHECK(MetricHistogram::getBucketUpperBound(0) == 1);
+    CHECK(MetricHistogram::getBucketUpperBound(1) == 2);
+    CHECK(MetricHistogram::getBucketUpperBound(10) == 1024);
+    CHECK(
+        MetricHistogram::getBucketUpperBound(
+            MetricHistogram::bucketCount - 1) ==
+        std::numeric_limits<int64_t>::max());
+
+    histogram.record(std::numeric_limits<int64_t>::max());
+    CHECK(histogram.getBucketCount(MetricHistogram::bucketCount - 1) == 1);
+  }
+
+  SECTION("estimates percentiles") {
+    for (int64_t i = 0; i < 90; ++i) {
+      histogram.record(10);
+    }
+    for (int64_t i = 0; i < 10; ++i) {
+      histogram.record(1000);
+    }
+
+    CHECK(histogram.estimatePercentile(50.0) == 16);
+    CHECK(histogram.estimatePercentile(90.0) == 16);
+    CHECK(histogram.estimatePercentile(99.0) == 1024);
+    CHECK(histogram.estimatePercentile(100.0) == 1024);
+  }
+}
+
+TEST_CASE("InMemoryMetricsSink") {
+  InMemoryMetricsSink sink;
+
+  SECTION("returns the same metric for the same name") {
+    MetricCounter& counter = sink.getCounter("counter");
+    CHECK(&sink.getCounter("counter") == &counter);
+    CHECK(&sink.getCounter("other") != &counter);
+
+    MetricGauge& gauge = sink.getGauge("gauge");
+    CHECK(&sink.getGauge("gauge") == &gauge);
+
+    MetricHistogram& histogram = sink.getHistogram("histogram");
+    CHECK(&sink.getHistogram("histogram") == &histogram);
+  }
+
+  SECTION("finds only metrics that have been created") {
+    CHECK(sink.findCounter("counter") == nullptr);
+    CHECK(sink.findGauge("gauge") == nullptr);
+    CHECK(sink.findHistogram("histogram") == nullptr);
+
+    sink.getCounter("counter").add(3);
+    sink.getGauge("gauge").set(-2);
+    sink.getHistogram("histogram").record(5);
+
+    REQUIRE(sink.findCounter("counter") != nullptr);
+    CHECK(sink.findCounter("counter")->get() == 3);
+    REQUIRE(sink.findGauge("gauge") != nullptr);
+    CHECK(sink.findGauge("gauge")->get() == -2);
+    REQUIRE(sink.findHistogram("histogram") != nullptr);
+    CHECK(sink.findHistogram("histogram")->getSum() == 5);
+  }
+
+  SECTION("visits metrics in order of name") {
+    sink.getCounter("b").add(2);
+    sink.getCounter("a").add(1);
+
+    std::vector<std::string> names;
+    sink.forEachCounter(
+        [&names](const std::string& name, const MetricCounter& counter) {
+          names.emplace_back(name + "=" + std::to_string(counter.get()));
+        });
+
+    REQUIRE(names.size() == 2);
+    CHECK(names[0] == "a=1");
+    CHECK(names[1] == "b=2");
+  }
+
+  SECTION("counts updates from many threads") {
+    MetricCounter& counter = sink.getCounter("counter");
+    MetricGauge& gauge = sink.getGauge("gauge");
+    MetricHistogram& histogram = sink.getHistogram("histogram");
+
+    size_t threadCount = 8;
+    int64_t updatesPerThread = 10000;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&, updatesPerThread]() {
+        for (int64_t j = 0; j < updatesPerThread; ++j) {
+          counter.add();
+          gauge.add(1);
+          gauge.add(-1);
+          histogram.record(j);
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    const int64_t total = int64_t(threadCount) * updatesPerThread;
+    CHECK(counter.get() == total);
+    CHECK(gauge.get() == 0);
+    CHECK(histogram.getCount() == total);
+    CHECK(histogram.getMaximum() == updatesPerThread - 1);
+  }
+}
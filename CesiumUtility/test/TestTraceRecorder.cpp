@@ -0,0 +1,232 @@
+#include <CesiumUtility/TraceRecorder.h>
+
+#include <catch2/catch.hpp>
+#include <rapidjson/document.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CesiumUtility;
+
+namespace {
+
+// A stream buffer that discards everything written to it.
+class NullBuffer : public std::streambuf {
+protected:
+  int overflow(int c) override { return c; }
+  std::streamsize xsputn(const char*, std::streamsize count) override {
+    return count;
+  }
+};
+
+class NullStream : public std::ostream {
+public:
+  NullStream() : std::ostream(&_buffer) {}
+
+private:
+  NullBuffer _buffer;
+};
+
+// Stops the recorder and parses what it wrote.
+rapidjson::Document
+stopAndParse(TraceRecorder& recorder, const std::ostringstream& output) {
+  recorder.stop();
+
+  rapidjson::Document document;
+  document.Parse(output.str().c_str());
+  REQUIRE(!document.HasParseError());
+  REQUIRE(document.IsObject());
+  REQUIRE(document["traceEvents"].IsArray());
+  return document;
+}
+
+} // namespace
+
+TEST_CASE("TraceRecorder") {
+  auto pOutput = std::make_unique<std::ostringstream>();
+  std::ostringstream& output = *pOutput;
+
+  SECTION("writes events from several threads") {
+    TraceRecorder recorder(std::move(pOutput));
+
+    size_t threadCount = 4;
+    size_t eventsPerThread = 1000;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&recorder, eventsPerThread]() {
+        const uint32_t nameID = recorder.internName("work");
+        for (size_t j = 0; j < eventsPerThread; ++j) {
+          recorder.recordComplete(nameID, TraceRecorder::now(), 1);
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    rapidjson::Document document = stopAndParse(recorder, output);
+    const rapidjson::Value& events = document["traceEvents"];
+    CHECK(events.Size() == threadCount * eventsPerThread);
+
+    std::map<int64_t, size_t> eventsByThread;
+    for (const rapidjson::Value& event : events.GetArray()) {
+      CHECK(std::string(event["name"].GetString()) == "work");
+      CHECK(std::string(event["ph"].GetString()) == "X");
+      CHECK(event["dur"].GetInt64() == 1);
+      ++eventsByThread[event["tid"].GetInt64()];
+    }
+
+    CHECK(eventsByThread.size() == threadCount);
+    for (const auto& [tid, count] : eventsByThread) {
+      CHECK(count == eventsPerThread);
+    }
+
+    CHECK(document["otherData"]["droppedEvents"].GetUint64() == 0);
+  }
+
+  SECTION("writes begin, end, and counter events") {
+    TraceRecorder recorder(std::move(pOutput));
+    const uint32_t asyncID = recorder.internName("async");
+    const uint32_t threadID = recorder.internName("thread");
+    const uint32_t counterID = recorder.internName("counter");
+    recorder.recordBegin(asyncID, 7);
+    recorder.recordBegin(threadID, -1);
+    recorder.recordEnd(threadID, -1);
+    recorder.recordEnd(asyncID, 7);
+    recorder.recordCounter(counterID, 42);
+
+    rapidjson::Document document = stopAndParse(recorder, output);
+    const rapidjson::Value& events = document["traceEvents"];
+    REQUIRE(events.Size() == 5);
+
+    CHECK(std::string(events[0]["ph"].GetString()) == "b");
+    CHECK(events[0]["id"].GetInt64() == 7);
+    CHECK(std::string(events[1]["ph"].GetString()) == "B");
+    CHECK(events[1].HasMember("tid"));
+    CHECK(std::string(events[2]["ph"].GetString()) == "E");
+    CHECK(std::string(events[3]["ph"].GetString()) == "e");
+    CHECK(std::string(events[3]["name"].GetString()) == "async");
+    CHECK(std::string(events[4]["ph"].GetString()) == "C");
+    CHECK(events[4]["args"]["value"].GetInt64() == 42);
+  }
+
+  SECTION("the same name always gets the same ID") {
+    TraceRecorder recorder(std::move(pOutput));
+    const std::string first = "name";
+    const std::string second = "name";
+    const uint32_t firstID = recorder.internName(first.c_str());
+    CHECK(recorder.internName(second.c_str()) == firstID);
+    CHECK(recorder.internName("other") != firstID);
+  }
+
+  SECTION("records one of every sampleInterval events") {
+    TraceRecorderOptions options;
+    options.sampleInterval = 10;
+    TraceRecorder recorder(std::move(pOutput), options);
+
+    const uint32_t nameID = recorder.internName("sampled");
+    for (int64_t i = 0; i < 1000; ++i) {
+      recorder.recordComplete(nameID, i, 1);
+    }
+
+    // Begin and end events are never sampled.
+    recorder.recordBegin(nameID, -1);
+    recorder.recordEnd(nameID, -1);
+
+    rapidjson::Document document = stopAndParse(recorder, output);
+    CHECK(document["traceEvents"].Size() == 102);
+  }
+
+  SECTION("limits the number of events per second") {
+    TraceRecorderOptions options;
+    options.maximumEventsPerSecondPerThread = 100;
+    TraceRecorder recorder(std::move(pOutput), options);
+
+    const uint32_t nameID = recorder.internName("limited");
+    const int64_t start = TraceRecorder::now();
+    for (int64_t i = 0; i < 1000; ++i) {
+      recorder.recordComplete(nameID, start + i, 1);
+    }
+    for (int64_t i = 0; i < 1000; ++i) {
+      recorder.recordComplete(nameID, start + 1000000 + i, 1);
+    }
+
+    rapidjson::Document document = stopAndParse(recorder, output);
+    CHECK(document["traceEvents"].Size() == 200);
+  }
+
+  SECTION("drops events when a thread's buffer is full") {
+    TraceRecorderOptions options;
+    options.eventsPerThread = 16;
+    options.drainInterval = std::chrono::hours(1);
+    TraceRecorder recorder(std::move(pOutput), options);
+
+    const uint32_t nameID = recorder.internName("dropped");
+    for (int64_t i = 0; i < 20; ++i) {
+      recorder.recordComplete(nameID, i, 1);
+    }
+    CHECK(recorder.getDroppedEventCount() == 4);
+
+    rapidjson::Document document = stopAndParse(recorder, output);
+    CHECK(document["traceEvents"].Size() == 16);
+    CHECK(document["otherData"]["droppedEvents"].GetUint64() == 4);
+  }
+
+  SECTION("ignores events after it is stopped") {
+    TraceRecorder recorder(std::move(pOutput));
+    const uint32_t nameID = recorder.internName("late");
+    recorder.stop();
+    recorder.recordComplete(nameID, 0, 1);
+    recorder.stop();
+
+    rapidjson::Document document;
+    document.Parse(output.str().c_str());
+    REQUIRE(!document.HasParseError());
+    CHECK(document["traceEvents"].Size() == 0);
+  }
+}
+
+TEST_CASE("Benchmark recording trace events", "[.][benchmark]") {
+  // Make the buffer large enough that events aren't dropped between drains.
+  TraceRecorderOptions options;
+  options.eventsPerThread = 1 << 20;
+  TraceRecorder recorder(std::make_unique<NullStream>(), options);
+
+  const uint32_t nameID = recorder.internName("benchmark");
+  BENCHMARK("Record a complete event") {
+    recorder.recordComplete(nameID, TraceRecorder::now(), 1);
+  };
+
+  BENCHMARK("Intern a name and record a complete event") {
+    recorder.recordComplete(
+        recorder.internName("benchmark"),
+        TraceRecorder::now(),
+        1);
+  };
+
+  // The previous tracer formatted each event into the file while holding a
+  // lock.
+  NullStream stream;
+  std::mutex mutex;
+  int64_t eventCount = 0;
+  BENCHMARK("Format a complete event while holding a lock") {
+    const int64_t start = TraceRecorder::now();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (eventCount++ > 0) {
+      stream << ",";
+    }
+    stream << "{\"cat\":\"cesium\",\"dur\":" << 1
+           << ",\"name\":\"benchmark\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+           << std::this_thread::get_id() << ",\"ts\":" << start << "}";
+  };
+
+  recorder.stop();
+}
@@ -0,0 +1,82 @@
+// Generates C++ code that finds the key in `keys` that is equal to the
+// `std::string_view` named `str`, and runs the code returned by
+// `formatMatch(key)` for it. Rather than comparing `str` with every key in
+// turn, the code switches on the length of `str`, and then on the character
+// that best distinguishes the keys of that length, so that usually only one
+// key is compared. The comparisons use `std::string_view` literals, so nothing
+// is allocated. The code expects `using namespace std::string_view_literals;`.
+function formatKeyDispatch(keys, formatMatch) {
+  const keysByLength = new Map();
+  for (const key of keys) {
+    const keysOfLength = keysByLength.get(key.length) || [];
+    keysOfLength.push(key);
+    keysByLength.set(key.length, keysOfLength);
+  }
+
+  const lengths = Array.from(keysByLength.keys()).sort((a, b) => a - b);
+  return formatSwitch(
+    "str.size()",
+    lengths.map((length) => [
+      `${length}`,
+      formatKeysOfLength(keysByLength.get(length), formatMatch),
+    ])
+  );
+}
+
+function formatKeysOfLength(keys, formatMatch) {
+  if (keys.length === 1) {
+    return formatMatches(keys, formatMatch);
+  }
+
+  // Find the position at which the keys have the most distinct characters.
+  // Often every key has a different character there, which makes the switch
+  // a perfect hash of the keys of this length.
+  let bestIndex = 0;
+  let bestCount = 0;
+  for (let i = 0; i < keys[0].length; ++i) {
+    const count = new Set(keys.map((key) => key[i])).size;
+    if (count > bestCount) {
+      bestIndex = i;
+      bestCount = count;
+    }
+  }
+
+  if (bestCount === 1) {
+    return formatMatches(keys, formatMatch);
+  }
+
+  const keysByCharacter = new Map();
+  for (const key of keys) {
+    const character = key[bestIndex];
+    const keysWithCharacter = keysByCharacter.get(character) || [];
+    keysWithCharacter.push(key);
+    keysByCharacter.set(character, keysWithCharacter);
+  }
+
+  return formatSwitch(
+    `str[${bestIndex}]`,
+    Array.from(keysByCharacter.entries()).map(
+      ([character, keysWithCharacter]) => [
+        `'${character}'`,
+        formatMatches(keysWithCharacter, formatMatch),
+      ]
+    )
+  );
+}
+
+function formatSwitch(condition, cases) {
+  const lines = [`switch (${condition}) {`];
+  for (const [label, body] of cases) {
+    lines.push(`case ${label}:`, body, "break;");
+  }
+  lines.push("default:", "break;", "}");
+  return lines.join("\n");
+}
+
+function formatMatches(keys, formatMatch) {
+  return keys
+    .map((key) => `if (str == "${key}"sv) ${formatMatch(key)}`)
+    .join("\n");
+}
+
+module.exports = formatKeyDispatch;
@@ -1,3 +1,4 @@
+const formatKeyDispatch = require("./formatKeyDispatch");
 const fs = require("fs");
 const getNameFromTitle = require("./getNameFromTitle");
 const indent = require("./indent");
@@ -352,15 +353,10 @@ function generate(options, schema, writers) {
         ` : ""}
 
         CesiumJsonReader::IJsonHandler* ${name}JsonHandler::readObjectKey${name}(const std::string& objectType, const std::string_view& str, ${namespace}::${name}& o) {
-          using namespace std::string_literals;
-
           ${properties.length > 0 ? `
-          ${indent(
-            properties
-              .map((property) => formatReaderPropertyImpl(property))
-              .join("\n"),
-            10
-          )}` : `(void)o;`}
+          using namespace std::string_view_literals;
+
+          ${indent(formatReaderPropertiesImpl(properties), 10)}` : `(void)o;`}
 
           return this->readObjectKey${NameFormatters.removeNamespace(base)}(objectType, str, *this->_pObject);
         }
@@ -573,8 +569,14 @@ function formatReaderProperty(property) {
   return `${property.readerType} _${property.cppSafeName};`;
 }
 
-function formatReaderPropertyImpl(property) {
-  return `if ("${property.name}"s == str) return property("${property.name}", this->_${property.cppSafeName}, o.${property.cppSafeName});`;
+function formatReaderPropertiesImpl(properties) {
+  const propertiesByName = new Map(
+    properties.map((property) => [property.name, property])
+  );
+  return formatKeyDispatch(Array.from(propertiesByName.keys()), (name) => {
+    const property = propertiesByName.get(name);
+    return `return property("${property.name}", this->_${property.cppSafeName}, o.${property.cppSafeName});`;
+  });
 }
 
 function formatWriterPropertyImpl(property) {